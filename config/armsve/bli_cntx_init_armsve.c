@@ -0,0 +1,178 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include <unistd.h>
+
+// Query the size (in bytes) of a level of the data cache, returning a
+// default value if the operating system does not report it.
+static dim_t bli_armsve_cache_size( int level, dim_t def_size )
+{
+	long size = 0;
+
+#if defined(_SC_LEVEL1_DCACHE_SIZE) && \
+    defined(_SC_LEVEL2_CACHE_SIZE)  && \
+    defined(_SC_LEVEL3_CACHE_SIZE)
+	if      ( level == 1 ) size = sysconf( _SC_LEVEL1_DCACHE_SIZE );
+	else if ( level == 2 ) size = sysconf( _SC_LEVEL2_CACHE_SIZE );
+	else if ( level == 3 ) size = sysconf( _SC_LEVEL3_CACHE_SIZE );
+#endif
+
+	return ( size > 0 ? ( dim_t )size : def_size );
+}
+
+// Derive the cache blocksizes for one datatype from its register blocksizes
+// and the sizes of the caches: a kc x nr micropanel of B should occupy half
+// of the L1 cache, an mc x kc block of A half of the L2 cache, and a kc x nc
+// block of B half of the L3 cache.
+static void bli_armsve_cache_blkszs
+     (
+       dim_t  mr,
+       dim_t  nr,
+       siz_t  elem_size,
+       dim_t  l1_size,
+       dim_t  l2_size,
+       dim_t  l3_size,
+       dim_t* mc,
+       dim_t* kc,
+       dim_t* nc
+     )
+{
+	*kc = ( l1_size / ( 2 * nr * elem_size ) ) / 8 * 8;
+	*kc = bli_max( *kc, 8 );
+
+	*mc = ( l2_size / ( 2 * *kc * elem_size ) ) / mr * mr;
+	*mc = bli_max( *mc, mr );
+
+	*nc = ( l3_size / ( 2 * *kc * elem_size ) ) / nr * nr;
+	*nc = bli_max( *nc, nr );
+}
+
+void bli_cntx_init_armsve( cntx_t* cntx )
+{
+	blksz_t blkszs[ BLIS_NUM_BLKSZS ];
+
+	// Set default kernel blocksizes and functions.
+	bli_cntx_init_armsve_ref( cntx );
+
+	// -------------------------------------------------------------------------
+
+	// The gemm micro-kernels are vector-length agnostic: each computes a
+	// microtile whose m dimension spans two SVE vectors. Thus, we query the
+	// vector length of the hardware and derive MR from it here rather than
+	// fixing it at compile time.
+	const dim_t vl_bytes = bli_armsve_vl_bytes();
+
+	const dim_t mr_s = 2 * vl_bytes / sizeof( float );
+	const dim_t mr_d = 2 * vl_bytes / sizeof( double );
+	const dim_t mr_c = 2 * vl_bytes / sizeof( scomplex );
+	const dim_t mr_z = 2 * vl_bytes / sizeof( dcomplex );
+
+	const dim_t nr_s = 12;
+	const dim_t nr_d = 10;
+	const dim_t nr_c = 10;
+	const dim_t nr_z = 10;
+
+	// Likewise, derive the cache blocksizes from the cache sizes that are
+	// reported by the operating system.
+	const dim_t l1_size  = bli_armsve_cache_size( 1,   64 * 1024 );
+	const dim_t l2_size  = bli_armsve_cache_size( 2, 1024 * 1024 );
+	const dim_t l3_size  = bli_armsve_cache_size( 3, 8192 * 1024 );
+
+	dim_t mc_s, kc_s, nc_s;
+	dim_t mc_d, kc_d, nc_d;
+	dim_t mc_c, kc_c, nc_c;
+	dim_t mc_z, kc_z, nc_z;
+
+	bli_armsve_cache_blkszs( mr_s, nr_s, sizeof( float ),
+	                         l1_size, l2_size, l3_size, &mc_s, &kc_s, &nc_s );
+	bli_armsve_cache_blkszs( mr_d, nr_d, sizeof( double ),
+	                         l1_size, l2_size, l3_size, &mc_d, &kc_d, &nc_d );
+	bli_armsve_cache_blkszs( mr_c, nr_c, sizeof( scomplex ),
+	                         l1_size, l2_size, l3_size, &mc_c, &kc_c, &nc_c );
+	bli_armsve_cache_blkszs( mr_z, nr_z, sizeof( dcomplex ),
+	                         l1_size, l2_size, l3_size, &mc_z, &kc_z, &nc_z );
+
+	// Update the context with optimized native gemm micro-kernels and
+	// their storage preferences.
+	bli_cntx_set_l3_nat_ukrs
+	(
+	  4,
+	  BLIS_GEMM_UKR, BLIS_FLOAT,    bli_sgemm_armsve_int_2vx12, FALSE,
+	  BLIS_GEMM_UKR, BLIS_DOUBLE,   bli_dgemm_armsve_int_2vx10, FALSE,
+	  BLIS_GEMM_UKR, BLIS_SCOMPLEX, bli_cgemm_armsve_int_2vx10, FALSE,
+	  BLIS_GEMM_UKR, BLIS_DCOMPLEX, bli_zgemm_armsve_int_2vx10, FALSE,
+	  cntx
+	);
+
+	// Update the context with optimized packm kernels. The packm kernel ids
+	// correspond to the panel dimension, so we register the VLA kernels at
+	// whichever id matches MR for the current vector length. (Vector lengths
+	// that yield an MR beyond the largest id fall back to the reference
+	// implementation.)
+	if ( mr_s < BLIS_NUM_PACKM_KERS )
+		bli_cntx_set_packm_kers( 1, ( l1mkr_t )mr_s, BLIS_FLOAT,
+		                         bli_spackm_armsve_int_2vxk, cntx );
+	if ( mr_d < BLIS_NUM_PACKM_KERS )
+		bli_cntx_set_packm_kers( 1, ( l1mkr_t )mr_d, BLIS_DOUBLE,
+		                         bli_dpackm_armsve_int_2vxk, cntx );
+	if ( mr_c < BLIS_NUM_PACKM_KERS )
+		bli_cntx_set_packm_kers( 1, ( l1mkr_t )mr_c, BLIS_SCOMPLEX,
+		                         bli_cpackm_armsve_int_2vxk, cntx );
+	if ( mr_z < BLIS_NUM_PACKM_KERS )
+		bli_cntx_set_packm_kers( 1, ( l1mkr_t )mr_z, BLIS_DCOMPLEX,
+		                         bli_zpackm_armsve_int_2vxk, cntx );
+
+	// Initialize level-3 blocksize objects with architecture-specific values.
+	//                                           s      d      c      z
+	bli_blksz_init_easy( &blkszs[ BLIS_MR ],  mr_s,  mr_d,  mr_c,  mr_z );
+	bli_blksz_init_easy( &blkszs[ BLIS_NR ],  nr_s,  nr_d,  nr_c,  nr_z );
+	bli_blksz_init_easy( &blkszs[ BLIS_MC ],  mc_s,  mc_d,  mc_c,  mc_z );
+	bli_blksz_init_easy( &blkszs[ BLIS_KC ],  kc_s,  kc_d,  kc_c,  kc_z );
+	bli_blksz_init_easy( &blkszs[ BLIS_NC ],  nc_s,  nc_d,  nc_c,  nc_z );
+
+	// Update the context with the current architecture's register and cache
+	// blocksizes (and multiples) for native execution.
+	bli_cntx_set_blkszs
+	(
+	  BLIS_NAT, 5,
+	  BLIS_NC, &blkszs[ BLIS_NC ], BLIS_NR,
+	  BLIS_KC, &blkszs[ BLIS_KC ], BLIS_KR,
+	  BLIS_MC, &blkszs[ BLIS_MC ], BLIS_MR,
+	  BLIS_NR, &blkszs[ BLIS_NR ], BLIS_NR,
+	  BLIS_MR, &blkszs[ BLIS_MR ], BLIS_MR,
+	  cntx
+	);
+}
+
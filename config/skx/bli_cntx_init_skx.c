@@ -37,6 +37,7 @@
 void bli_cntx_init_skx( cntx_t* cntx )
 {
 	blksz_t blkszs[ BLIS_NUM_BLKSZS ];
+	blksz_t thresh[ BLIS_NUM_THRESH ];
 
 	// Set default kernel blocksizes and functions.
 	bli_cntx_init_skx_ref( cntx );
@@ -47,10 +48,29 @@ void bli_cntx_init_skx( cntx_t* cntx )
 	// their storage preferences.
 	bli_cntx_set_l3_nat_ukrs
 	(
-	  2,
+	  8,
 	  // gemm
 	  BLIS_GEMM_UKR,       BLIS_FLOAT ,   bli_sgemm_skx_asm_32x12_l2,   FALSE,
 	  BLIS_GEMM_UKR,       BLIS_DOUBLE,   bli_dgemm_skx_asm_16x14,      FALSE,
+	  BLIS_GEMM_UKR,       BLIS_SCOMPLEX, bli_cgemm_skx_int_6x16,       TRUE,
+	  BLIS_GEMM_UKR,       BLIS_DCOMPLEX, bli_zgemm_skx_int_6x8,        TRUE,
+	  // gemmtrsm_l
+	  BLIS_GEMMTRSM_L_UKR, BLIS_SCOMPLEX, bli_cgemmtrsm_l_skx_int_6x16, TRUE,
+	  BLIS_GEMMTRSM_L_UKR, BLIS_DCOMPLEX, bli_zgemmtrsm_l_skx_int_6x8,  TRUE,
+	  // gemmtrsm_u
+	  BLIS_GEMMTRSM_U_UKR, BLIS_SCOMPLEX, bli_cgemmtrsm_u_skx_int_6x16, TRUE,
+	  BLIS_GEMMTRSM_U_UKR, BLIS_DCOMPLEX, bli_zgemmtrsm_u_skx_int_6x8,  TRUE,
+	  cntx
+	);
+
+	// Update the context with optimized packm kernels.
+	bli_cntx_set_packm_kers
+	(
+	  4,
+	  BLIS_PACKM_12XK_KER, BLIS_FLOAT,    bli_spackm_skx_int_12xk,
+	  BLIS_PACKM_32XK_KER, BLIS_FLOAT,    bli_spackm_skx_int_32xk,
+	  BLIS_PACKM_14XK_KER, BLIS_DOUBLE,   bli_dpackm_skx_int_14xk,
+	  BLIS_PACKM_16XK_KER, BLIS_DOUBLE,   bli_dpackm_skx_int_16xk,
 	  cntx
 	);
 
@@ -70,12 +90,20 @@ void bli_cntx_init_skx( cntx_t* cntx )
 	// Update the context with optimized level-1v kernels.
 	bli_cntx_set_l1v_kers
 	(
-	  10,
+	  50,
+	  // addv
+	  BLIS_ADDV_KER,   BLIS_FLOAT,    bli_saddv_zen_int,
+	  BLIS_ADDV_KER,   BLIS_DOUBLE,   bli_daddv_zen_int,
+	  BLIS_ADDV_KER,   BLIS_SCOMPLEX, bli_caddv_zen_int,
+	  BLIS_ADDV_KER,   BLIS_DCOMPLEX, bli_zaddv_zen_int,
 #if 1
 	  // amaxv
 	  BLIS_AMAXV_KER,  BLIS_FLOAT,  bli_samaxv_zen_int,
 	  BLIS_AMAXV_KER,  BLIS_DOUBLE, bli_damaxv_zen_int,
 #endif
+	  // axpbyv
+	  BLIS_AXPBYV_KER, BLIS_FLOAT,    bli_saxpbyv_zen_int,
+	  BLIS_AXPBYV_KER, BLIS_DOUBLE,   bli_daxpbyv_zen_int,
 	  // axpyv
 #if 0
 	  BLIS_AXPYV_KER,  BLIS_FLOAT,  bli_saxpyv_zen_int,
@@ -84,12 +112,34 @@ void bli_cntx_init_skx( cntx_t* cntx )
 	  BLIS_AXPYV_KER,  BLIS_FLOAT,  bli_saxpyv_zen_int10,
 	  BLIS_AXPYV_KER,  BLIS_DOUBLE, bli_daxpyv_zen_int10,
 #endif
+	  BLIS_AXPYV_KER,  BLIS_SCOMPLEX, bli_caxpyv_zen_int,
+	  BLIS_AXPYV_KER,  BLIS_DCOMPLEX, bli_zaxpyv_zen_int,
+	  // copyv
+	  BLIS_COPYV_KER,  BLIS_FLOAT,    bli_scopyv_zen_int,
+	  BLIS_COPYV_KER,  BLIS_DOUBLE,   bli_dcopyv_zen_int,
+	  BLIS_COPYV_KER,  BLIS_SCOMPLEX, bli_ccopyv_zen_int,
+	  BLIS_COPYV_KER,  BLIS_DCOMPLEX, bli_zcopyv_zen_int,
 	  // dotv
 	  BLIS_DOTV_KER,   BLIS_FLOAT,  bli_sdotv_zen_int,
 	  BLIS_DOTV_KER,   BLIS_DOUBLE, bli_ddotv_zen_int,
+	  BLIS_DOTV_KER,   BLIS_SCOMPLEX, bli_cdotv_zen_int,
+	  BLIS_DOTV_KER,   BLIS_DCOMPLEX, bli_zdotv_zen_int,
 	  // dotxv
 	  BLIS_DOTXV_KER,  BLIS_FLOAT,  bli_sdotxv_zen_int,
 	  BLIS_DOTXV_KER,  BLIS_DOUBLE, bli_ddotxv_zen_int,
+	  // normfv
+	  BLIS_NORMFV_KER, BLIS_FLOAT,    bli_snormfv_zen_int,
+	  BLIS_NORMFV_KER, BLIS_DOUBLE,   bli_dnormfv_zen_int,
+	  BLIS_NORMFV_KER, BLIS_SCOMPLEX, bli_cnormfv_zen_int,
+	  BLIS_NORMFV_KER, BLIS_DCOMPLEX, bli_znormfv_zen_int,
+	  // rotv
+	  BLIS_ROTV_KER,   BLIS_FLOAT,    bli_srotv_skx_int,
+	  BLIS_ROTV_KER,   BLIS_DOUBLE,   bli_drotv_skx_int,
+	  BLIS_ROTV_KER,   BLIS_SCOMPLEX, bli_crotv_zen_int,
+	  BLIS_ROTV_KER,   BLIS_DCOMPLEX, bli_zrotv_zen_int,
+	  // rotmv
+	  BLIS_ROTMV_KER,  BLIS_FLOAT,    bli_srotmv_skx_int,
+	  BLIS_ROTMV_KER,  BLIS_DOUBLE,   bli_drotmv_skx_int,
 	  // scalv
 #if 0
 	  BLIS_SCALV_KER,  BLIS_FLOAT,  bli_sscalv_zen_int,
@@ -98,17 +148,37 @@ void bli_cntx_init_skx( cntx_t* cntx )
 	  BLIS_SCALV_KER,  BLIS_FLOAT,  bli_sscalv_zen_int10,
 	  BLIS_SCALV_KER,  BLIS_DOUBLE, bli_dscalv_zen_int10,
 #endif
+	  BLIS_SCALV_KER,  BLIS_SCOMPLEX, bli_cscalv_zen_int,
+	  BLIS_SCALV_KER,  BLIS_DCOMPLEX, bli_zscalv_zen_int,
+	  // setv
+	  BLIS_SETV_KER,   BLIS_FLOAT,    bli_ssetv_zen_int,
+	  BLIS_SETV_KER,   BLIS_DOUBLE,   bli_dsetv_zen_int,
+	  BLIS_SETV_KER,   BLIS_SCOMPLEX, bli_csetv_zen_int,
+	  BLIS_SETV_KER,   BLIS_DCOMPLEX, bli_zsetv_zen_int,
+	  // subv
+	  BLIS_SUBV_KER,   BLIS_FLOAT,    bli_ssubv_zen_int,
+	  BLIS_SUBV_KER,   BLIS_DOUBLE,   bli_dsubv_zen_int,
+	  BLIS_SUBV_KER,   BLIS_SCOMPLEX, bli_csubv_zen_int,
+	  BLIS_SUBV_KER,   BLIS_DCOMPLEX, bli_zsubv_zen_int,
+	  // swapv
+	  BLIS_SWAPV_KER,  BLIS_FLOAT,    bli_sswapv_zen_int,
+	  BLIS_SWAPV_KER,  BLIS_DOUBLE,   bli_dswapv_zen_int,
+	  BLIS_SWAPV_KER,  BLIS_SCOMPLEX, bli_cswapv_zen_int,
+	  BLIS_SWAPV_KER,  BLIS_DCOMPLEX, bli_zswapv_zen_int,
+	  // xpbyv
+	  BLIS_XPBYV_KER,  BLIS_FLOAT,    bli_sxpbyv_zen_int,
+	  BLIS_XPBYV_KER,  BLIS_DOUBLE,   bli_dxpbyv_zen_int,
 	  cntx
 	);
 
 	// Initialize level-3 blocksize objects with architecture-specific values.
 	//                                           s      d      c      z
-	bli_blksz_init_easy( &blkszs[ BLIS_MR ],    32,    16,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_NR ],    12,    14,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_MC ],   480,   240,    -1,    -1 );
-	bli_blksz_init     ( &blkszs[ BLIS_KC ],   384,   384,    -1,    -1,
-	                                           480,   480,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_NC ],  3072,  3752,    -1,    -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_MR ],    32,    16,     6,     6 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NR ],    12,    14,    16,     8 );
+	bli_blksz_init_easy( &blkszs[ BLIS_MC ],   480,   240,   144,    72 );
+	bli_blksz_init     ( &blkszs[ BLIS_KC ],   384,   384,   384,   384,
+	                                           480,   480,   384,   384 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NC ],  3072,  3752,  3072,  3752 );
 	bli_blksz_init_easy( &blkszs[ BLIS_AF ],     8,     8,    -1,    -1 );
 	bli_blksz_init_easy( &blkszs[ BLIS_DF ],     8,     8,    -1,    -1 );
 
@@ -128,5 +198,107 @@ void bli_cntx_init_skx( cntx_t* cntx )
 	  BLIS_DF, &blkszs[ BLIS_DF ], BLIS_DF,
 	  cntx
 	);
+
+	// -------------------------------------------------------------------------
+
+	// Initialize sup thresholds with architecture-appropriate values. The
+	// complex domain is left at zero (ie: sup disabled) since we have no
+	// AVX-512 sup kernels for scomplex or dcomplex.
+	//                                          s     d     c     z
+	bli_blksz_init_easy( &thresh[ BLIS_MT ],  201,  161,    0,    0 );
+	bli_blksz_init_easy( &thresh[ BLIS_NT ],  201,  161,    0,    0 );
+	bli_blksz_init_easy( &thresh[ BLIS_KT ],  201,  201,    0,    0 );
+
+	// Initialize the context with the sup thresholds.
+	bli_cntx_set_l3_sup_thresh
+	(
+	  3,
+	  BLIS_MT, &thresh[ BLIS_MT ],
+	  BLIS_NT, &thresh[ BLIS_NT ],
+	  BLIS_KT, &thresh[ BLIS_KT ],
+	  cntx
+	);
+
+	// Update the context with optimized small/unpacked gemm kernels.
+	bli_cntx_set_l3_sup_kers
+	(
+	  16,
+	  BLIS_RRR, BLIS_DOUBLE,   bli_dgemmsup_rv_skx_int_6x16m,    TRUE,
+	  BLIS_RRC, BLIS_DOUBLE,   bli_dgemmsup_rd_skx_int_6x16m,    TRUE,
+	  BLIS_RCR, BLIS_DOUBLE,   bli_dgemmsup_rv_skx_int_6x16m,    TRUE,
+	  BLIS_RCC, BLIS_DOUBLE,   bli_dgemmsup_rv_skx_int_6x16n,    TRUE,
+	  BLIS_CRR, BLIS_DOUBLE,   bli_dgemmsup_rv_skx_int_6x16m,    TRUE,
+	  BLIS_CRC, BLIS_DOUBLE,   bli_dgemmsup_rd_skx_int_6x16n,    TRUE,
+	  BLIS_CCR, BLIS_DOUBLE,   bli_dgemmsup_rv_skx_int_6x16n,    TRUE,
+	  BLIS_CCC, BLIS_DOUBLE,   bli_dgemmsup_rv_skx_int_6x16n,    TRUE,
+
+	  BLIS_RRR, BLIS_FLOAT,    bli_sgemmsup_rv_skx_int_6x32m,    TRUE,
+	  BLIS_RRC, BLIS_FLOAT,    bli_sgemmsup_rd_skx_int_6x32m,    TRUE,
+	  BLIS_RCR, BLIS_FLOAT,    bli_sgemmsup_rv_skx_int_6x32m,    TRUE,
+	  BLIS_RCC, BLIS_FLOAT,    bli_sgemmsup_rv_skx_int_6x32n,    TRUE,
+	  BLIS_CRR, BLIS_FLOAT,    bli_sgemmsup_rv_skx_int_6x32m,    TRUE,
+	  BLIS_CRC, BLIS_FLOAT,    bli_sgemmsup_rd_skx_int_6x32n,    TRUE,
+	  BLIS_CCR, BLIS_FLOAT,    bli_sgemmsup_rv_skx_int_6x32n,    TRUE,
+	  BLIS_CCC, BLIS_FLOAT,    bli_sgemmsup_rv_skx_int_6x32n,    TRUE,
+	  cntx
+	);
+
+	// Update the context with optimized small/unpacked gemmtrsm kernels.
+	bli_cntx_set_l3_sup_trsm_kers
+	(
+	  4,
+	  BLIS_GEMMTRSM_L_UKR, BLIS_FLOAT,  bli_sgemmtrsmsup_l_haswell_int_6x16, TRUE,
+	  BLIS_GEMMTRSM_U_UKR, BLIS_FLOAT,  bli_sgemmtrsmsup_u_haswell_int_6x16, TRUE,
+	  BLIS_GEMMTRSM_L_UKR, BLIS_DOUBLE, bli_dgemmtrsmsup_l_haswell_int_6x8,  TRUE,
+	  BLIS_GEMMTRSM_U_UKR, BLIS_DOUBLE, bli_dgemmtrsmsup_u_haswell_int_6x8,  TRUE,
+	  cntx
+	);
+
+	// Initialize level-3 sup blocksize objects with architecture-specific
+	// values. The KC values are larger than those used by haswell to take
+	// advantage of the larger (1MB) L2 cache.
+	//                                           s      d      c      z
+	bli_blksz_init_easy( &blkszs[ BLIS_MR ],     6,     6,     3,     3 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NR ],    32,    16,     8,     4 );
+	bli_blksz_init_easy( &blkszs[ BLIS_MC ],   144,    72,    72,    36 );
+	bli_blksz_init_easy( &blkszs[ BLIS_KC ],   384,   384,   128,   128 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NC ],  4064,  4080,  4080,  4080 );
+
+	// Update the context with the current architecture's register and cache
+	// blocksizes for small/unpacked level-3 problems.
+	bli_cntx_set_l3_sup_blkszs
+	(
+	  5,
+	  BLIS_NC, &blkszs[ BLIS_NC ],
+	  BLIS_KC, &blkszs[ BLIS_KC ],
+	  BLIS_MC, &blkszs[ BLIS_MC ],
+	  BLIS_NR, &blkszs[ BLIS_NR ],
+	  BLIS_MR, &blkszs[ BLIS_MR ],
+	  cntx
+	);
+
+	// Update the context with optimized low-precision gemm micro-kernels
+	// and their register and cache blocksizes. The avx512_bf16 and
+	// avx512_vnni extensions are not part of skx proper, so the kernels that
+	// use them are registered only if the hardware supports them; otherwise,
+	// the avx2 kernels are used.
+	bli_cntx_set_lpgemm_ker( BLIS_GEMM_BF16BF16F32, bli_gemm_bf16bf16f32_haswell_int_4x16,  4, 16,  2, 144,  512, 4080, cntx );
+	bli_cntx_set_lpgemm_ker( BLIS_GEMM_U8S8S32,     bli_gemm_u8s8s32_haswell_int_6x16,      6, 16,  2, 144, 1024, 4080, cntx );
+
+#ifdef BLIS_ENABLE_SKX_LPGEMM_KERS
+	{
+		uint32_t family, model, features;
+
+		bli_cpuid_query( &family, &model, &features );
+
+		if ( bli_cpuid_has_features( features, FEATURE_AVX512BF16 ) )
+			bli_cntx_set_lpgemm_ker( BLIS_GEMM_BF16BF16F32, bli_gemm_bf16bf16f32_skx_int_12x32, 12, 32,  2, 240,  512, 4096, cntx );
+		if ( bli_cpuid_has_features( features, FEATURE_AVX512VNNI ) )
+			bli_cntx_set_lpgemm_ker( BLIS_GEMM_U8S8S32,     bli_gemm_u8s8s32_skx_int_12x32,     12, 32,  4, 240, 1024, 4096, cntx );
+	}
+#endif
+
+	// Update the context with the F16C-based half-precision packm kernel.
+	bli_cntx_set_packm_f16_ker( bli_packm_cxk_f16_haswell_int, cntx );
 }
 
@@ -66,6 +66,21 @@ void bli_cntx_init_zen( cntx_t* cntx )
 	  cntx
 	);
 
+	// Update the context with optimized packm kernels.
+	bli_cntx_set_packm_kers
+	(
+	  8,
+	  BLIS_PACKM_6XK_KER,  BLIS_FLOAT,    bli_spackm_haswell_int_6xk,
+	  BLIS_PACKM_16XK_KER, BLIS_FLOAT,    bli_spackm_haswell_int_16xk,
+	  BLIS_PACKM_6XK_KER,  BLIS_DOUBLE,   bli_dpackm_haswell_int_6xk,
+	  BLIS_PACKM_8XK_KER,  BLIS_DOUBLE,   bli_dpackm_haswell_int_8xk,
+	  BLIS_PACKM_3XK_KER,  BLIS_SCOMPLEX, bli_cpackm_haswell_int_3xk,
+	  BLIS_PACKM_8XK_KER,  BLIS_SCOMPLEX, bli_cpackm_haswell_int_8xk,
+	  BLIS_PACKM_3XK_KER,  BLIS_DCOMPLEX, bli_zpackm_haswell_int_3xk,
+	  BLIS_PACKM_4XK_KER,  BLIS_DCOMPLEX, bli_zpackm_haswell_int_4xk,
+	  cntx
+	);
+
 	// Update the context with optimized level-1f kernels.
 	bli_cntx_set_l1f_kers
 	(
@@ -82,12 +97,20 @@ void bli_cntx_init_zen( cntx_t* cntx )
 	// Update the context with optimized level-1v kernels.
 	bli_cntx_set_l1v_kers
 	(
-	  10,
+	  50,
+	  // addv
+	  BLIS_ADDV_KER,   BLIS_FLOAT,    bli_saddv_zen_int,
+	  BLIS_ADDV_KER,   BLIS_DOUBLE,   bli_daddv_zen_int,
+	  BLIS_ADDV_KER,   BLIS_SCOMPLEX, bli_caddv_zen_int,
+	  BLIS_ADDV_KER,   BLIS_DCOMPLEX, bli_zaddv_zen_int,
 #if 1
 	  // amaxv
 	  BLIS_AMAXV_KER,  BLIS_FLOAT,  bli_samaxv_zen_int,
 	  BLIS_AMAXV_KER,  BLIS_DOUBLE, bli_damaxv_zen_int,
 #endif
+	  // axpbyv
+	  BLIS_AXPBYV_KER, BLIS_FLOAT,    bli_saxpbyv_zen_int,
+	  BLIS_AXPBYV_KER, BLIS_DOUBLE,   bli_daxpbyv_zen_int,
 	  // axpyv
 #if 0
 	  BLIS_AXPYV_KER,  BLIS_FLOAT,  bli_saxpyv_zen_int,
@@ -96,12 +119,34 @@ void bli_cntx_init_zen( cntx_t* cntx )
 	  BLIS_AXPYV_KER,  BLIS_FLOAT,  bli_saxpyv_zen_int10,
 	  BLIS_AXPYV_KER,  BLIS_DOUBLE, bli_daxpyv_zen_int10,
 #endif
+	  BLIS_AXPYV_KER,  BLIS_SCOMPLEX, bli_caxpyv_zen_int,
+	  BLIS_AXPYV_KER,  BLIS_DCOMPLEX, bli_zaxpyv_zen_int,
+	  // copyv
+	  BLIS_COPYV_KER,  BLIS_FLOAT,    bli_scopyv_zen_int,
+	  BLIS_COPYV_KER,  BLIS_DOUBLE,   bli_dcopyv_zen_int,
+	  BLIS_COPYV_KER,  BLIS_SCOMPLEX, bli_ccopyv_zen_int,
+	  BLIS_COPYV_KER,  BLIS_DCOMPLEX, bli_zcopyv_zen_int,
 	  // dotv
 	  BLIS_DOTV_KER,   BLIS_FLOAT,  bli_sdotv_zen_int,
 	  BLIS_DOTV_KER,   BLIS_DOUBLE, bli_ddotv_zen_int,
+	  BLIS_DOTV_KER,   BLIS_SCOMPLEX, bli_cdotv_zen_int,
+	  BLIS_DOTV_KER,   BLIS_DCOMPLEX, bli_zdotv_zen_int,
 	  // dotxv
 	  BLIS_DOTXV_KER,  BLIS_FLOAT,  bli_sdotxv_zen_int,
 	  BLIS_DOTXV_KER,  BLIS_DOUBLE, bli_ddotxv_zen_int,
+	  // normfv
+	  BLIS_NORMFV_KER, BLIS_FLOAT,    bli_snormfv_zen_int,
+	  BLIS_NORMFV_KER, BLIS_DOUBLE,   bli_dnormfv_zen_int,
+	  BLIS_NORMFV_KER, BLIS_SCOMPLEX, bli_cnormfv_zen_int,
+	  BLIS_NORMFV_KER, BLIS_DCOMPLEX, bli_znormfv_zen_int,
+	  // rotv
+	  BLIS_ROTV_KER,   BLIS_FLOAT,    bli_srotv_zen_int,
+	  BLIS_ROTV_KER,   BLIS_DOUBLE,   bli_drotv_zen_int,
+	  BLIS_ROTV_KER,   BLIS_SCOMPLEX, bli_crotv_zen_int,
+	  BLIS_ROTV_KER,   BLIS_DCOMPLEX, bli_zrotv_zen_int,
+	  // rotmv
+	  BLIS_ROTMV_KER,  BLIS_FLOAT,    bli_srotmv_zen_int,
+	  BLIS_ROTMV_KER,  BLIS_DOUBLE,   bli_drotmv_zen_int,
 	  // scalv
 #if 0
 	  BLIS_SCALV_KER,  BLIS_FLOAT,  bli_sscalv_zen_int,
@@ -110,6 +155,26 @@ void bli_cntx_init_zen( cntx_t* cntx )
 	  BLIS_SCALV_KER,  BLIS_FLOAT,  bli_sscalv_zen_int10,
 	  BLIS_SCALV_KER,  BLIS_DOUBLE, bli_dscalv_zen_int10,
 #endif
+	  BLIS_SCALV_KER,  BLIS_SCOMPLEX, bli_cscalv_zen_int,
+	  BLIS_SCALV_KER,  BLIS_DCOMPLEX, bli_zscalv_zen_int,
+	  // setv
+	  BLIS_SETV_KER,   BLIS_FLOAT,    bli_ssetv_zen_int,
+	  BLIS_SETV_KER,   BLIS_DOUBLE,   bli_dsetv_zen_int,
+	  BLIS_SETV_KER,   BLIS_SCOMPLEX, bli_csetv_zen_int,
+	  BLIS_SETV_KER,   BLIS_DCOMPLEX, bli_zsetv_zen_int,
+	  // subv
+	  BLIS_SUBV_KER,   BLIS_FLOAT,    bli_ssubv_zen_int,
+	  BLIS_SUBV_KER,   BLIS_DOUBLE,   bli_dsubv_zen_int,
+	  BLIS_SUBV_KER,   BLIS_SCOMPLEX, bli_csubv_zen_int,
+	  BLIS_SUBV_KER,   BLIS_DCOMPLEX, bli_zsubv_zen_int,
+	  // swapv
+	  BLIS_SWAPV_KER,  BLIS_FLOAT,    bli_sswapv_zen_int,
+	  BLIS_SWAPV_KER,  BLIS_DOUBLE,   bli_dswapv_zen_int,
+	  BLIS_SWAPV_KER,  BLIS_SCOMPLEX, bli_cswapv_zen_int,
+	  BLIS_SWAPV_KER,  BLIS_DCOMPLEX, bli_zswapv_zen_int,
+	  // xpbyv
+	  BLIS_XPBYV_KER,  BLIS_FLOAT,    bli_sxpbyv_zen_int,
+	  BLIS_XPBYV_KER,  BLIS_DOUBLE,   bli_dxpbyv_zen_int,
 	  cntx
 	);
 
@@ -172,9 +237,9 @@ void bli_cntx_init_zen( cntx_t* cntx )
 
 	// Initialize sup thresholds with architecture-appropriate values.
 	//                                          s     d     c     z
-	bli_blksz_init_easy( &thresh[ BLIS_MT ],   -1,  256,   -1,   -1 );
-	bli_blksz_init_easy( &thresh[ BLIS_NT ],   -1,  256,   -1,   -1 );
-	bli_blksz_init_easy( &thresh[ BLIS_KT ],   -1,  220,   -1,   -1 );
+	bli_blksz_init_easy( &thresh[ BLIS_MT ],  256,  256,  256,  256 );
+	bli_blksz_init_easy( &thresh[ BLIS_NT ],  256,  256,  256,  256 );
+	bli_blksz_init_easy( &thresh[ BLIS_KT ],  220,  220,  220,  220 );
 
 	// Initialize the context with the sup thresholds.
 	bli_cntx_set_l3_sup_thresh
@@ -197,28 +262,66 @@ void bli_cntx_init_zen( cntx_t* cntx )
 	// Update the context with optimized small/unpacked gemm kernels.
 	bli_cntx_set_l3_sup_kers
 	(
-	  8,
+	  32,
 	  //BLIS_RCR, BLIS_DOUBLE, bli_dgemmsup_r_haswell_ref,
-	  BLIS_RRR, BLIS_DOUBLE, bli_dgemmsup_rv_haswell_asm_6x8m, TRUE,
-	  BLIS_RRC, BLIS_DOUBLE, bli_dgemmsup_rd_haswell_asm_6x8m, TRUE,
-	  BLIS_RCR, BLIS_DOUBLE, bli_dgemmsup_rv_haswell_asm_6x8m, TRUE,
-	  BLIS_RCC, BLIS_DOUBLE, bli_dgemmsup_rv_haswell_asm_6x8n, TRUE,
-	  BLIS_CRR, BLIS_DOUBLE, bli_dgemmsup_rv_haswell_asm_6x8m, TRUE,
-	  BLIS_CRC, BLIS_DOUBLE, bli_dgemmsup_rd_haswell_asm_6x8n, TRUE,
-	  BLIS_CCR, BLIS_DOUBLE, bli_dgemmsup_rv_haswell_asm_6x8n, TRUE,
-	  BLIS_CCC, BLIS_DOUBLE, bli_dgemmsup_rv_haswell_asm_6x8n, TRUE,
+	  BLIS_RRR, BLIS_DOUBLE,   bli_dgemmsup_rv_haswell_asm_6x8m, TRUE,
+	  BLIS_RRC, BLIS_DOUBLE,   bli_dgemmsup_rd_haswell_asm_6x8m, TRUE,
+	  BLIS_RCR, BLIS_DOUBLE,   bli_dgemmsup_rv_haswell_asm_6x8m, TRUE,
+	  BLIS_RCC, BLIS_DOUBLE,   bli_dgemmsup_rv_haswell_asm_6x8n, TRUE,
+	  BLIS_CRR, BLIS_DOUBLE,   bli_dgemmsup_rv_haswell_asm_6x8m, TRUE,
+	  BLIS_CRC, BLIS_DOUBLE,   bli_dgemmsup_rd_haswell_asm_6x8n, TRUE,
+	  BLIS_CCR, BLIS_DOUBLE,   bli_dgemmsup_rv_haswell_asm_6x8n, TRUE,
+	  BLIS_CCC, BLIS_DOUBLE,   bli_dgemmsup_rv_haswell_asm_6x8n, TRUE,
+
+	  BLIS_RRR, BLIS_FLOAT,    bli_sgemmsup_rv_zen_int_6x16m,    TRUE,
+	  BLIS_RRC, BLIS_FLOAT,    bli_sgemmsup_rd_zen_int_6x16m,    TRUE,
+	  BLIS_RCR, BLIS_FLOAT,    bli_sgemmsup_rv_zen_int_6x16m,    TRUE,
+	  BLIS_RCC, BLIS_FLOAT,    bli_sgemmsup_rv_zen_int_6x16n,    TRUE,
+	  BLIS_CRR, BLIS_FLOAT,    bli_sgemmsup_rv_zen_int_6x16m,    TRUE,
+	  BLIS_CRC, BLIS_FLOAT,    bli_sgemmsup_rd_zen_int_6x16n,    TRUE,
+	  BLIS_CCR, BLIS_FLOAT,    bli_sgemmsup_rv_zen_int_6x16n,    TRUE,
+	  BLIS_CCC, BLIS_FLOAT,    bli_sgemmsup_rv_zen_int_6x16n,    TRUE,
+
+	  BLIS_RRR, BLIS_SCOMPLEX, bli_cgemmsup_rv_zen_int_3x8m,     TRUE,
+	  BLIS_RRC, BLIS_SCOMPLEX, bli_cgemmsup_rd_zen_int_3x8m,     TRUE,
+	  BLIS_RCR, BLIS_SCOMPLEX, bli_cgemmsup_rv_zen_int_3x8m,     TRUE,
+	  BLIS_RCC, BLIS_SCOMPLEX, bli_cgemmsup_rv_zen_int_3x8n,     TRUE,
+	  BLIS_CRR, BLIS_SCOMPLEX, bli_cgemmsup_rv_zen_int_3x8m,     TRUE,
+	  BLIS_CRC, BLIS_SCOMPLEX, bli_cgemmsup_rd_zen_int_3x8n,     TRUE,
+	  BLIS_CCR, BLIS_SCOMPLEX, bli_cgemmsup_rv_zen_int_3x8n,     TRUE,
+	  BLIS_CCC, BLIS_SCOMPLEX, bli_cgemmsup_rv_zen_int_3x8n,     TRUE,
+
+	  BLIS_RRR, BLIS_DCOMPLEX, bli_zgemmsup_rv_zen_int_3x4m,     TRUE,
+	  BLIS_RRC, BLIS_DCOMPLEX, bli_zgemmsup_rd_zen_int_3x4m,     TRUE,
+	  BLIS_RCR, BLIS_DCOMPLEX, bli_zgemmsup_rv_zen_int_3x4m,     TRUE,
+	  BLIS_RCC, BLIS_DCOMPLEX, bli_zgemmsup_rv_zen_int_3x4n,     TRUE,
+	  BLIS_CRR, BLIS_DCOMPLEX, bli_zgemmsup_rv_zen_int_3x4m,     TRUE,
+	  BLIS_CRC, BLIS_DCOMPLEX, bli_zgemmsup_rd_zen_int_3x4n,     TRUE,
+	  BLIS_CCR, BLIS_DCOMPLEX, bli_zgemmsup_rv_zen_int_3x4n,     TRUE,
+	  BLIS_CCC, BLIS_DCOMPLEX, bli_zgemmsup_rv_zen_int_3x4n,     TRUE,
+	  cntx
+	);
+
+	// Update the context with optimized small/unpacked gemmtrsm kernels.
+	bli_cntx_set_l3_sup_trsm_kers
+	(
+	  4,
+	  BLIS_GEMMTRSM_L_UKR, BLIS_FLOAT,  bli_sgemmtrsmsup_l_haswell_int_6x16, TRUE,
+	  BLIS_GEMMTRSM_U_UKR, BLIS_FLOAT,  bli_sgemmtrsmsup_u_haswell_int_6x16, TRUE,
+	  BLIS_GEMMTRSM_L_UKR, BLIS_DOUBLE, bli_dgemmtrsmsup_l_haswell_int_6x8,  TRUE,
+	  BLIS_GEMMTRSM_U_UKR, BLIS_DOUBLE, bli_dgemmtrsmsup_u_haswell_int_6x8,  TRUE,
 	  cntx
 	);
 
 	// Initialize level-3 sup blocksize objects with architecture-specific
 	// values.
 	//                                           s      d      c      z
-	bli_blksz_init     ( &blkszs[ BLIS_MR ],    -1,     6,    -1,    -1,
-	                                            -1,     9,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_NR ],    -1,     8,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_MC ],    -1,    72,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_KC ],    -1,   256,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_NC ],    -1,  4080,    -1,    -1 );
+	bli_blksz_init     ( &blkszs[ BLIS_MR ],     6,     6,     3,     3,
+	                                             6,     9,     3,     3 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NR ],    16,     8,     8,     4 );
+	bli_blksz_init_easy( &blkszs[ BLIS_MC ],   144,    72,    72,    36 );
+	bli_blksz_init_easy( &blkszs[ BLIS_KC ],   256,   256,   128,   128 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NC ],  4080,  4080,  4080,  4080 );
 
 	// Update the context with the current architecture's register and cache
 	// blocksizes for small/unpacked level-3 problems.
@@ -232,5 +335,13 @@ void bli_cntx_init_zen( cntx_t* cntx )
 	  BLIS_MR, &blkszs[ BLIS_MR ],
 	  cntx
 	);
+
+	// Update the context with optimized low-precision gemm micro-kernels
+	// and their register and cache blocksizes.
+	bli_cntx_set_lpgemm_ker( BLIS_GEMM_BF16BF16F32, bli_gemm_bf16bf16f32_haswell_int_4x16,  4, 16,  2, 144,  512, 4080, cntx );
+	bli_cntx_set_lpgemm_ker( BLIS_GEMM_U8S8S32,     bli_gemm_u8s8s32_haswell_int_6x16,      6, 16,  2, 144, 1024, 4080, cntx );
+
+	// Update the context with the F16C-based half-precision packm kernel.
+	bli_cntx_set_packm_f16_ker( bli_packm_cxk_f16_haswell_int, cntx );
 }
 
@@ -57,6 +57,12 @@
 // Generate function pointer arrays for tapi functions (expert only).
 #include "bli_l1v_fpa.h"
 
+// Define the helpers used by the normfv kernels.
+#include "bli_l1v_nrm2.h"
+
+// Prototype multithreaded implementations.
+#include "bli_l1v_mt.h"
+
 // Pack-related
 // NOTE: packv and unpackv are temporarily disabled.
 //#include "bli_packv.h"
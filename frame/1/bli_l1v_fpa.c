@@ -60,6 +60,8 @@ GENFRONT( scal2v )
 GENFRONT( dotv )
 GENFRONT( dotxv )
 GENFRONT( invertv )
+GENFRONT( rotv )
+GENFRONT( rotmv )
 GENFRONT( scalv )
 GENFRONT( setv )
 GENFRONT( swapv )
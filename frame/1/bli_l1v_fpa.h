@@ -52,6 +52,8 @@ GENPROT( scal2v )
 GENPROT( dotv )
 GENPROT( dotxv )
 GENPROT( invertv )
+GENPROT( rotv )
+GENPROT( rotmv )
 GENPROT( scalv )
 GENPROT( setv )
 GENPROT( swapv )
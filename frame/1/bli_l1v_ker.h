@@ -90,6 +90,24 @@ INSERT_GENTPROT_BASIC0( dotxv_ker_name )
 INSERT_GENTPROT_BASIC0( invertv_ker_name )
 
 
+#undef  GENTPROTR
+#define GENTPROTR NORMFV_KER_PROT
+
+INSERT_GENTPROTR_BASIC0( normfv_ker_name )
+
+
+#undef  GENTPROTR
+#define GENTPROTR ROTV_KER_PROT
+
+INSERT_GENTPROTR_BASIC0( rotv_ker_name )
+
+
+#undef  GENTPROT
+#define GENTPROT ROTMV_KER_PROT
+
+INSERT_GENTPROT_BASIC0( rotmv_ker_name )
+
+
 #undef  GENTPROT
 #define GENTPROT SCALV_KER_PROT
 
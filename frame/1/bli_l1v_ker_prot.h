@@ -139,6 +139,42 @@ void PASTEMAC(ch,opname) \
      ); \
 
 
+#define NORMFV_KER_PROT( ctype, ctype_r, ch, chr, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t             n, \
+       ctype*   restrict x, inc_t incx, \
+       ctype_r* restrict norm, \
+       cntx_t*  restrict cntx  \
+     ); \
+
+
+#define ROTV_KER_PROT( ctype, ctype_r, ch, chr, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t             n, \
+       ctype_r* restrict c, \
+       ctype*   restrict s, \
+       ctype*   restrict x, inc_t incx, \
+       ctype*   restrict y, inc_t incy, \
+       cntx_t*  restrict cntx  \
+     ); \
+
+
+#define ROTMV_KER_PROT( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t            n, \
+       ctype*  restrict h, \
+       ctype*  restrict x, inc_t incx, \
+       ctype*  restrict y, inc_t incy, \
+       cntx_t* restrict cntx  \
+     ); \
+
+
 #define SCALV_KER_PROT( ctype, ch, opname ) \
 \
 void PASTEMAC(ch,opname) \
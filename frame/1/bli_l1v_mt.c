@@ -0,0 +1,515 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// A description of a level-1v problem, shared by all threads of the team.
+// Each operation uses only the fields that correspond to its parameters.
+typedef struct
+{
+	l1vkr_t ker_id;
+	conj_t  conjx;
+	conj_t  conjy;
+	dim_t   n;
+	void*   alpha;
+	void*   x;
+	inc_t   incx;
+	void*   y;
+	inc_t   incy;
+	void*   part;
+} l1vmtparams_t;
+
+// -----------------------------------------------------------------------------
+
+dim_t bli_l1v_mt_num_threads
+     (
+       num_t   dt,
+       dim_t   n,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       rntm_t* rntm_l
+     )
+{
+#ifdef BLIS_ENABLE_MULTITHREADING
+
+	const dim_t thresh = bli_cntx_get_l1v_thresh_dt( dt, cntx );
+
+	// Return early, without querying the runtime, if the multithreaded
+	// code path is disabled or if the vectors are too short.
+	if ( thresh == 0 || n < thresh ||
+	     n < 2 * BLIS_THREAD_L1V_MIN_ELEM ) return 1;
+
+	if ( rntm == NULL ) bli_rntm_init_from_global( rntm_l );
+	else                *rntm_l = *rntm;
+
+	// Interpret the number of threads or the ways of parallelism held by
+	// the rntm_t. Level-1v operations only partition one dimension, so all
+	// that matters is the total number of threads implied by the ways.
+	bli_rntm_set_ways_from_rntm( n, 1, 1, rntm_l );
+
+	dim_t n_threads = bli_rntm_num_threads( rntm_l );
+
+	// Limit the number of threads so that each thread receives enough
+	// work to amortize the cost of waking it up.
+	n_threads = bli_min( n_threads, n / BLIS_THREAD_L1V_MIN_ELEM );
+	n_threads = bli_max( n_threads, 1 );
+
+	bli_rntm_set_num_threads_only( n_threads, rntm_l );
+
+	return n_threads;
+
+#else
+
+	( void )dt;
+	( void )n;
+	( void )cntx;
+	( void )rntm;
+	( void )rntm_l;
+
+	return 1;
+
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+//
+// Define the functions executed by each thread of the team. Each thread
+// applies the kernel from the context to a contiguous subvector.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       void*      params, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t    dt    = PASTEMAC(ch,type); \
+\
+	l1vmtparams_t* p     = params; \
+\
+	conj_t         conjx = p->conjx; \
+	ctype*         x     = p->x; \
+	inc_t          incx  = p->incx; \
+	ctype*         y     = p->y; \
+	inc_t          incy  = p->incy; \
+\
+	dim_t          start, end; \
+\
+	bli_thread_range_sub( thread, p->n, BLIS_THREAD_L1V_BF, FALSE, &start, &end ); \
+\
+	if ( start == end ) return; \
+\
+	/* addv, copyv, and subv share the same kernel function type. */ \
+	PASTECH2(ch,addv,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, p->ker_id, cntx ); \
+\
+	f( conjx, end - start, x + start*incx, incx, y + start*incy, incy, cntx ); \
+}
+
+INSERT_GENTFUNC_BASIC0( addv_mt_thread )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       void*      params, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t    dt    = PASTEMAC(ch,type); \
+\
+	l1vmtparams_t* p     = params; \
+\
+	ctype*         x     = p->x; \
+	inc_t          incx  = p->incx; \
+	dim_t*         index = p->part; \
+\
+	dim_t          start, end; \
+	dim_t          i_l; \
+\
+	bli_thread_range_sub( thread, p->n, BLIS_THREAD_L1V_BF, FALSE, &start, &end ); \
+\
+	if ( start == end ) return; \
+\
+	PASTECH2(ch,amaxv,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, p->ker_id, cntx ); \
+\
+	f( end - start, x + start*incx, incx, &i_l, cntx ); \
+\
+	/* Store the index of the local maximum relative to the full vector. */ \
+	index[ bli_thread_work_id( thread ) ] = start + i_l; \
+}
+
+INSERT_GENTFUNC_BASIC0( amaxv_mt_thread )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       void*      params, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t    dt    = PASTEMAC(ch,type); \
+\
+	l1vmtparams_t* p     = params; \
+\
+	conj_t         conjx = p->conjx; \
+	ctype*         alpha = p->alpha; \
+	ctype*         x     = p->x; \
+	inc_t          incx  = p->incx; \
+	ctype*         y     = p->y; \
+	inc_t          incy  = p->incy; \
+\
+	dim_t          start, end; \
+\
+	bli_thread_range_sub( thread, p->n, BLIS_THREAD_L1V_BF, FALSE, &start, &end ); \
+\
+	if ( start == end ) return; \
+\
+	/* axpyv and scal2v share the same kernel function type. */ \
+	PASTECH2(ch,axpyv,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, p->ker_id, cntx ); \
+\
+	f( conjx, end - start, alpha, x + start*incx, incx, y + start*incy, incy, cntx ); \
+}
+
+INSERT_GENTFUNC_BASIC0( axpyv_mt_thread )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       void*      params, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t    dt    = PASTEMAC(ch,type); \
+\
+	l1vmtparams_t* p     = params; \
+\
+	conj_t         conjx = p->conjx; \
+	conj_t         conjy = p->conjy; \
+	ctype*         x     = p->x; \
+	inc_t          incx  = p->incx; \
+	ctype*         y     = p->y; \
+	inc_t          incy  = p->incy; \
+	ctype*         rho   = p->part; \
+\
+	dim_t          start, end; \
+\
+	bli_thread_range_sub( thread, p->n, BLIS_THREAD_L1V_BF, FALSE, &start, &end ); \
+\
+	if ( start == end ) return; \
+\
+	PASTECH2(ch,dotv,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, p->ker_id, cntx ); \
+\
+	/* Each thread stores its partial dot product in its own element of
+	   the rho array so that the partial results may be reduced in a
+	   fixed order once the team has finished. */ \
+	f( conjx, conjy, end - start, x + start*incx, incx, y + start*incy, incy, \
+	   &rho[ bli_thread_work_id( thread ) ], cntx ); \
+}
+
+INSERT_GENTFUNC_BASIC0( dotv_mt_thread )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       void*      params, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t    dt    = PASTEMAC(ch,type); \
+\
+	l1vmtparams_t* p     = params; \
+\
+	conj_t         conjx = p->conjx; \
+	ctype*         alpha = p->alpha; \
+	ctype*         x     = p->x; \
+	inc_t          incx  = p->incx; \
+\
+	dim_t          start, end; \
+\
+	bli_thread_range_sub( thread, p->n, BLIS_THREAD_L1V_BF, FALSE, &start, &end ); \
+\
+	if ( start == end ) return; \
+\
+	/* scalv and setv share the same kernel function type. */ \
+	PASTECH2(ch,scalv,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, p->ker_id, cntx ); \
+\
+	f( conjx, end - start, alpha, x + start*incx, incx, cntx ); \
+}
+
+INSERT_GENTFUNC_BASIC0( scalv_mt_thread )
+
+// -----------------------------------------------------------------------------
+
+//
+// Define multithreaded BLAS-like interfaces with typed operands.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, kerid ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       conj_t  conjx, \
+       dim_t   n, \
+       ctype*  x, inc_t incx, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	l1vmtparams_t params; \
+\
+	params.ker_id = kerid; \
+	params.conjx  = conjx; \
+	params.n      = n; \
+	params.x      = x; \
+	params.incx   = incx; \
+	params.y      = y; \
+	params.incy   = incy; \
+\
+	bli_l2_thread_decorator( PASTEMAC(ch,addv_mt_thread), &params, cntx, rntm ); \
+}
+
+INSERT_GENTFUNC_BASIC( addv_mt,  BLIS_ADDV_KER )
+INSERT_GENTFUNC_BASIC( copyv_mt, BLIS_COPYV_KER )
+INSERT_GENTFUNC_BASIC( subv_mt,  BLIS_SUBV_KER )
+
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, kerid ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t   n, \
+       ctype*  x, inc_t incx, \
+       dim_t*  index, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	l1vmtparams_t params; \
+\
+	const dim_t   n_threads = bli_rntm_num_threads( rntm ); \
+\
+	/* Initialize each thread's index to -1 so that the indices of threads
+	   that were assigned no elements can be recognized and skipped. */ \
+	dim_t*        index_t   = bli_malloc_intl( n_threads * sizeof( dim_t ) ); \
+\
+	for ( dim_t t = 0; t < n_threads; ++t ) index_t[ t ] = -1; \
+\
+	params.ker_id = kerid; \
+	params.n      = n; \
+	params.x      = x; \
+	params.incx   = incx; \
+	params.part   = index_t; \
+\
+	bli_l2_thread_decorator( PASTEMAC(ch,amaxv_mt_thread), &params, cntx, rntm ); \
+\
+	/* Reduce the local maxima in order of thread id. Since each thread owns
+	   a subvector that precedes that of the next thread, and since only a
+	   strictly larger value (or the first NaN) replaces the current
+	   candidate, the index found is the same as that of the reference
+	   kernel applied to the full vector. The absolute value is computed as
+	   in the reference kernel, i.e., as |real| + |imag|. */ \
+	ctype_r abs_chi1_max = *PASTEMAC(chr,m1); \
+	dim_t   i_max_l      = 0; \
+\
+	for ( dim_t t = 0; t < n_threads; ++t ) \
+	{ \
+		if ( index_t[ t ] < 0 ) continue; \
+\
+		ctype*  chi1 = x + index_t[ t ]*incx; \
+		ctype_r chi1_r; \
+		ctype_r chi1_i; \
+		ctype_r abs_chi1; \
+\
+		PASTEMAC2(ch,chr,gets)( *chi1, chi1_r, chi1_i ); \
+\
+		PASTEMAC(chr,abval2s)( chi1_r, chi1_r ); \
+		PASTEMAC(chr,abval2s)( chi1_i, chi1_i ); \
+\
+		PASTEMAC(chr,set0s)( abs_chi1 ); \
+		PASTEMAC(chr,adds)( chi1_r, abs_chi1 ); \
+		PASTEMAC(chr,adds)( chi1_i, abs_chi1 ); \
+\
+		if ( abs_chi1_max < abs_chi1 || ( bli_isnan( abs_chi1 ) && !bli_isnan( abs_chi1_max ) ) ) \
+		{ \
+			abs_chi1_max = abs_chi1; \
+			i_max_l      = index_t[ t ]; \
+		} \
+	} \
+\
+	*index = i_max_l; \
+\
+	bli_free_intl( index_t ); \
+}
+
+INSERT_GENTFUNCR_BASIC( amaxv_mt, BLIS_AMAXV_KER )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, kerid ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       conj_t  conjx, \
+       dim_t   n, \
+       ctype*  alpha, \
+       ctype*  x, inc_t incx, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	l1vmtparams_t params; \
+\
+	params.ker_id = kerid; \
+	params.conjx  = conjx; \
+	params.n      = n; \
+	params.alpha  = alpha; \
+	params.x      = x; \
+	params.incx   = incx; \
+	params.y      = y; \
+	params.incy   = incy; \
+\
+	bli_l2_thread_decorator( PASTEMAC(ch,axpyv_mt_thread), &params, cntx, rntm ); \
+}
+
+INSERT_GENTFUNC_BASIC( axpyv_mt,  BLIS_AXPYV_KER )
+INSERT_GENTFUNC_BASIC( scal2v_mt, BLIS_SCAL2V_KER )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, kerid ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       conj_t  conjx, \
+       conj_t  conjy, \
+       dim_t   n, \
+       ctype*  x, inc_t incx, \
+       ctype*  y, inc_t incy, \
+       ctype*  rho, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	l1vmtparams_t params; \
+\
+	const dim_t   n_threads = bli_rntm_num_threads( rntm ); \
+\
+	/* Initialize the partial dot products to zero so that threads that
+	   were assigned no elements do not contribute to the result. */ \
+	ctype*        rho_t     = bli_malloc_intl( n_threads * sizeof( ctype ) ); \
+\
+	for ( dim_t t = 0; t < n_threads; ++t ) PASTEMAC(ch,set0s)( rho_t[ t ] ); \
+\
+	params.ker_id = kerid; \
+	params.conjx  = conjx; \
+	params.conjy  = conjy; \
+	params.n      = n; \
+	params.x      = x; \
+	params.incx   = incx; \
+	params.y      = y; \
+	params.incy   = incy; \
+	params.part   = rho_t; \
+\
+	bli_l2_thread_decorator( PASTEMAC(ch,dotv_mt_thread), &params, cntx, rntm ); \
+\
+	/* Sum the partial dot products in order of thread id. Since the
+	   partitioning depends only on n and the number of threads, the
+	   result is reproducible from one invocation to the next. */ \
+	ctype rho_l; \
+\
+	PASTEMAC(ch,set0s)( rho_l ); \
+\
+	for ( dim_t t = 0; t < n_threads; ++t ) PASTEMAC(ch,adds)( rho_t[ t ], rho_l ); \
+\
+	PASTEMAC(ch,copys)( rho_l, *rho ); \
+\
+	bli_free_intl( rho_t ); \
+}
+
+INSERT_GENTFUNC_BASIC( dotv_mt, BLIS_DOTV_KER )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, kerid ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       conj_t  conjalpha, \
+       dim_t   n, \
+       ctype*  alpha, \
+       ctype*  x, inc_t incx, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	l1vmtparams_t params; \
+\
+	params.ker_id = kerid; \
+	params.conjx  = conjalpha; \
+	params.n      = n; \
+	params.alpha  = alpha; \
+	params.x      = x; \
+	params.incx   = incx; \
+\
+	bli_l2_thread_decorator( PASTEMAC(ch,scalv_mt_thread), &params, cntx, rntm ); \
+}
+
+INSERT_GENTFUNC_BASIC( scalv_mt, BLIS_SCALV_KER )
+INSERT_GENTFUNC_BASIC( setv_mt,  BLIS_SETV_KER )
+
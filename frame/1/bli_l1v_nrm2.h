@@ -0,0 +1,156 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_L1V_NRM2_H
+#define BLIS_L1V_NRM2_H
+
+//
+// Define the constants and scalar helpers of Blue's algorithm for computing
+// the Euclidean norm of a vector.
+//
+
+// Each element x is classified by its absolute value into one of three
+// accumulators: values above tbig are scaled down by sbig, values below tsml
+// are scaled up by ssml, and the remaining values are squared unscaled. The
+// thresholds are chosen so that none of the three sums of squares can
+// overflow or underflow unnecessarily, which means the norm can be computed
+// in a single pass without any divisions. The constants follow those used
+// by ?nrm2 in netlib LAPACK 3.10 (see also Anderson, "Algorithm 978: Safe
+// Scaling in the Level 1 BLAS").
+
+#define bli_snrm2_tsml  0x1p-63f
+#define bli_snrm2_tbig  0x1p52f
+#define bli_snrm2_ssml  0x1p75f
+#define bli_snrm2_sbig  0x1p-76f
+
+#define bli_dnrm2_tsml  0x1p-511
+#define bli_dnrm2_tbig  0x1p486
+#define bli_dnrm2_ssml  0x1p537
+#define bli_dnrm2_sbig  0x1p-538
+
+
+// Accumulate the square of x into the appropriate accumulator. NaN values
+// fail both comparisons and are therefore propagated through amed.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+BLIS_INLINE void PASTEMAC(ch,opname) \
+     ( \
+       ctype  x, \
+       ctype* asml, \
+       ctype* amed, \
+       ctype* abig  \
+     ) \
+{ \
+	const ctype ax = bli_fabs( x ); \
+\
+	if      ( ax > PASTEMAC(ch,nrm2_tbig) ) \
+	{ \
+		const ctype xs = ax * PASTEMAC(ch,nrm2_sbig); \
+		*abig += xs * xs; \
+	} \
+	else if ( ax < PASTEMAC(ch,nrm2_tsml) ) \
+	{ \
+		const ctype xs = ax * PASTEMAC(ch,nrm2_ssml); \
+		*asml += xs * xs; \
+	} \
+	else \
+	{ \
+		*amed += ax * ax; \
+	} \
+}
+
+GENTFUNC( float,  s, nrm2_blue_accum )
+GENTFUNC( double, d, nrm2_blue_accum )
+
+
+// Combine the three accumulators and return the norm. If any big value was
+// encountered, the small values cannot contribute to the result; likewise,
+// the medium values only matter relative to the small values if no big
+// value was encountered.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+BLIS_INLINE ctype PASTEMAC(ch,opname) \
+     ( \
+       ctype asml, \
+       ctype amed, \
+       ctype abig  \
+     ) \
+{ \
+	ctype scl; \
+	ctype sumsq; \
+\
+	if ( abig > 0 ) \
+	{ \
+		if ( amed > 0 || bli_isnan( amed ) ) \
+			abig += ( amed * PASTEMAC(ch,nrm2_sbig) ) * PASTEMAC(ch,nrm2_sbig); \
+\
+		scl   = 1 / PASTEMAC(ch,nrm2_sbig); \
+		sumsq = abig; \
+	} \
+	else if ( asml > 0 ) \
+	{ \
+		if ( amed > 0 || bli_isnan( amed ) ) \
+		{ \
+			const ctype ymed = sqrt( amed ); \
+			const ctype ysml = sqrt( asml ) / PASTEMAC(ch,nrm2_ssml); \
+			const ctype ymin = ( ysml > ymed ? ymed : ysml ); \
+			const ctype ymax = ( ysml > ymed ? ysml : ymed ); \
+\
+			scl   = 1; \
+			sumsq = ymax * ymax * ( 1 + ( ymin / ymax ) * ( ymin / ymax ) ); \
+		} \
+		else \
+		{ \
+			scl   = 1 / PASTEMAC(ch,nrm2_ssml); \
+			sumsq = asml; \
+		} \
+	} \
+	else \
+	{ \
+		scl   = 1; \
+		sumsq = amed; \
+	} \
+\
+	return scl * sqrt( sumsq ); \
+}
+
+GENTFUNC( float,  s, nrm2_blue_finalize )
+GENTFUNC( double, d, nrm2_blue_finalize )
+
+
+#endif
@@ -60,6 +60,15 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 \
 	/* Obtain a valid context from the gks if necessary. */ \
 	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* Execute the multithreaded implementation if the vectors are long
+	   enough (and more than one thread was requested). */ \
+	rntm_t rntm_l; \
+	if ( bli_l1v_mt_num_threads( dt, n, cntx, rntm, &rntm_l ) > 1 ) \
+	{ \
+		PASTEMAC2(ch,opname,_mt)( conjx, n, x, incx, y, incy, cntx, &rntm_l ); \
+		return; \
+	} \
 \
 	PASTECH2(ch,opname,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
 \
@@ -97,6 +106,15 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 \
 	/* Obtain a valid context from the gks if necessary. */ \
 	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* Execute the multithreaded implementation if the vectors are long
+	   enough (and more than one thread was requested). */ \
+	rntm_t rntm_l; \
+	if ( bli_l1v_mt_num_threads( dt, n, cntx, rntm, &rntm_l ) > 1 ) \
+	{ \
+		PASTEMAC2(ch,opname,_mt)( n, x, incx, index, cntx, &rntm_l ); \
+		return; \
+	} \
 \
 	PASTECH2(ch,opname,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
 \
@@ -174,6 +192,15 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 	/* Obtain a valid context from the gks if necessary. */ \
 	if ( cntx == NULL ) \
 		cntx = bli_gks_query_cntx(); \
+\
+	/* Execute the multithreaded implementation if the vectors are long
+	   enough (and more than one thread was requested). */ \
+	rntm_t rntm_l; \
+	if ( bli_l1v_mt_num_threads( dt, n, cntx, rntm, &rntm_l ) > 1 ) \
+	{ \
+		PASTEMAC2(ch,opname,_mt)( conjx, n, alpha, x, incx, y, incy, cntx, &rntm_l ); \
+		return; \
+	} \
 \
 	PASTECH2(ch,opname,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
 \
@@ -214,6 +241,15 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 \
 	/* Obtain a valid context from the gks if necessary. */ \
 	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* Execute the multithreaded implementation if the vectors are long
+	   enough (and more than one thread was requested). */ \
+	rntm_t rntm_l; \
+	if ( bli_l1v_mt_num_threads( dt, n, cntx, rntm, &rntm_l ) > 1 ) \
+	{ \
+		PASTEMAC2(ch,opname,_mt)( conjx, conjy, n, x, incx, y, incy, rho, cntx, &rntm_l ); \
+		return; \
+	} \
 \
 	PASTECH2(ch,opname,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
 \
@@ -308,6 +344,80 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 INSERT_GENTFUNC_BASIC( invertv, BLIS_INVERTV_KER )
 
 
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, kerid ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       dim_t    n, \
+       ctype_r* c, \
+       ctype*   s, \
+       ctype*   x, inc_t incx, \
+       ctype*   y, inc_t incy  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	PASTECH2(ch,opname,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
+\
+	f \
+	( \
+	   n, \
+	   c, \
+	   s, \
+	   x, incx, \
+	   y, incy, \
+	   cntx  \
+	); \
+}
+
+INSERT_GENTFUNCR_BASIC( rotv, BLIS_ROTV_KER )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, kerid ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       dim_t   n, \
+       ctype*  h, \
+       ctype*  x, inc_t incx, \
+       ctype*  y, inc_t incy  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	PASTECH2(ch,opname,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
+\
+	f \
+	( \
+	   n, \
+	   h, \
+	   x, incx, \
+	   y, incy, \
+	   cntx  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( rotmv, BLIS_ROTMV_KER )
+
+
 #undef  GENTFUNC
 #define GENTFUNC( ctype, ch, opname, kerid ) \
 \
@@ -328,6 +438,15 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 \
 	/* Obtain a valid context from the gks if necessary. */ \
 	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* Execute the multithreaded implementation if the vectors are long
+	   enough (and more than one thread was requested). */ \
+	rntm_t rntm_l; \
+	if ( bli_l1v_mt_num_threads( dt, n, cntx, rntm, &rntm_l ) > 1 ) \
+	{ \
+		PASTEMAC2(ch,opname,_mt)( conjalpha, n, alpha, x, incx, cntx, &rntm_l ); \
+		return; \
+	} \
 \
 	PASTECH2(ch,opname,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
 \
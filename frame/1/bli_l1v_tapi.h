@@ -151,6 +151,37 @@ BLIS_EXPORT_BLIS void PASTEMAC2(ch,opname,EX_SUF) \
 INSERT_GENTPROT_BASIC0( invertv )
 
 
+#undef  GENTPROTR
+#define GENTPROTR( ctype, ctype_r, ch, chr, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       dim_t    n, \
+       ctype_r* c, \
+       ctype*   s, \
+       ctype*   x, inc_t incx, \
+       ctype*   y, inc_t incy  \
+       BLIS_TAPI_EX_PARAMS  \
+     ); \
+
+INSERT_GENTPROTR_BASIC0( rotv )
+
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       dim_t   n, \
+       ctype*  h, \
+       ctype*  x, inc_t incx, \
+       ctype*  y, inc_t incy  \
+       BLIS_TAPI_EX_PARAMS  \
+     ); \
+
+INSERT_GENTPROT_BASIC0( rotmv )
+
+
 #undef  GENTPROT
 #define GENTPROT( ctype, ch, opname ) \
 \
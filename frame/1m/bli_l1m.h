@@ -66,3 +66,6 @@
 #include "bli_packm.h"
 #include "bli_unpackm.h"
 
+// Plane rotations
+#include "bli_rotsm.h"
+
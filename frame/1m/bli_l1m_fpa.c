@@ -58,6 +58,7 @@ GENFRONT( scal2m )
 GENFRONT( scalm )
 GENFRONT( setm )
 GENFRONT( xpbym )
+GENFRONT( rotsm )
 
 //
 // Define function pointer query interfaces for two-datatype operations.
@@ -50,6 +50,7 @@ GENPROT( scal2m )
 GENPROT( scalm )
 GENPROT( setm )
 GENPROT( xpbym )
+GENPROT( rotsm )
 
 #undef  GENPROT
 #define GENPROT( opname ) \
@@ -163,3 +163,22 @@ typedef void (*PASTECH3(ch,opname,EX_SUF,tsuf)) \
 INSERT_GENTDEF( xpbym )
 INSERT_GENTDEF( xpbym_md )
 
+// rotsm
+
+#undef  GENTDEFR
+#define GENTDEFR( ctype, ctype_r, ch, chr, opname, tsuf ) \
+\
+typedef void (*PASTECH3(ch,opname,EX_SUF,tsuf)) \
+     ( \
+       side_t   side, \
+       dim_t    m, \
+       dim_t    n, \
+       dim_t    k, \
+       ctype_r* c, inc_t rs_c, inc_t cs_c, \
+       ctype*   s, inc_t rs_s, inc_t cs_s, \
+       ctype*   a, inc_t rs_a, inc_t cs_a  \
+       BLIS_TAPI_EX_PARAMS  \
+     );
+
+INSERT_GENTDEFR( rotsm )
+
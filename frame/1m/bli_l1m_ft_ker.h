@@ -158,6 +158,19 @@ typedef void (*PASTECH3(ch,opname,_ker,tsuf)) \
 INSERT_GENTDEF( packm_cxk_rih )
 INSERT_GENTDEF( packm_cxk_1er )
 
+// packm_f16_ker
+
+typedef void (*packm_f16_ker_ft)
+     (
+       dim_t             cdim,
+       dim_t             n,
+       dim_t             n_max,
+       float*   restrict kappa,
+       float16* restrict a, inc_t inca, inc_t lda,
+       float*   restrict p,             inc_t ldp,
+       cntx_t*  restrict cntx
+     );
+
 
 
 
@@ -139,3 +139,22 @@ void PASTEMAC(ch,varname) \
        cntx_t* restrict cntx  \
      );
 
+
+
+// half-precision packm kernels
+// NOTE: These kernels up-convert an fp16 source micro-panel into a native
+// single-precision packed micro-panel of leading dimension ldp. Unlike the
+// kernels above, a single kernel handles every panel dimension cdim <= ldp.
+
+#define PACKM_F16_KER_PROT( opname ) \
+\
+void PASTEMAC0(opname) \
+     ( \
+       dim_t             cdim, \
+       dim_t             n, \
+       dim_t             n_max, \
+       float*   restrict kappa, \
+       float16* restrict a, inc_t inca, inc_t lda, \
+       float*   restrict p,             inc_t ldp, \
+       cntx_t*  restrict cntx  \
+     );
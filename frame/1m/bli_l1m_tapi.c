@@ -469,6 +469,49 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 INSERT_GENTFUNC_BASIC0( xpbym )
 
 
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       side_t   side, \
+       dim_t    m, \
+       dim_t    n, \
+       dim_t    k, \
+       ctype_r* c, inc_t rs_c, inc_t cs_c, \
+       ctype*   s, inc_t rs_s, inc_t cs_s, \
+       ctype*   a, inc_t rs_a, inc_t cs_a  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	if ( bli_zero_dim3( m, n, k ) ) return; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* Invoke the internal interface, which applies the rotations with a
+	   cache-blocked, wavefront-ordered algorithm. */ \
+	PASTEMAC(ch,rotsm_int) \
+	( \
+	  side, \
+	  m, \
+	  n, \
+	  k, \
+	  c, rs_c, cs_c, \
+	  s, rs_s, cs_s, \
+	  a, rs_a, cs_a, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNCR_BASIC0( rotsm )
+
+
 #undef  GENTFUNC2
 #define GENTFUNC2( ctype_x, ctype_y, chx, chy, opname ) \
 \
@@ -119,6 +119,24 @@ BLIS_EXPORT_BLIS void PASTEMAC2(ch,opname,EX_SUF) \
 INSERT_GENTPROT_BASIC0( xpbym )
 
 
+#undef  GENTPROTR
+#define GENTPROTR( ctype, ctype_r, ch, chr, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       side_t   side, \
+       dim_t    m, \
+       dim_t    n, \
+       dim_t    k, \
+       ctype_r* c, inc_t rs_c, inc_t cs_c, \
+       ctype*   s, inc_t rs_s, inc_t cs_s, \
+       ctype*   a, inc_t rs_a, inc_t cs_a  \
+       BLIS_TAPI_EX_PARAMS  \
+     );
+
+INSERT_GENTPROTR_BASIC0( rotsm )
+
+
 #undef  GENTPROT2
 #define GENTPROT2( ctype_x, ctype_y, chx, chy, opname ) \
 \
@@ -0,0 +1,144 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// This variant packs an operand that is stored in IEEE fp16 into the native
+// single-precision packed format, converting the elements as it goes. The
+// operand object is expected to be a single-precision view of the fp16
+// buffer (ie: an object of datatype BLIS_FLOAT whose strides and offsets are
+// in units of fp16 elements), which lets bli_packm_init() size and
+// configure the packed object exactly as it would for sgemm. Only the
+// address of the source micro-panels is computed here in units of fp16.
+//
+
+void bli_packm_blk_var1_f16
+     (
+       obj_t*   c,
+       obj_t*   p,
+       cntx_t*  cntx,
+       cntl_t*  cntl,
+       thrinfo_t* thread
+     )
+{
+	trans_t   transc     = bli_obj_onlytrans_status( c );
+	pack_t    schema     = bli_obj_pack_schema( p );
+
+	dim_t     m_p        = bli_obj_length( p );
+	dim_t     n_p        = bli_obj_width( p );
+	dim_t     m_max_p    = bli_obj_padded_length( p );
+	dim_t     n_max_p    = bli_obj_padded_width( p );
+
+	inc_t     rs_c       = bli_obj_row_stride( c );
+	inc_t     cs_c       = bli_obj_col_stride( c );
+	float16*  buf_c      = ( float16* )bli_obj_buffer( c ) +
+	                       bli_obj_row_off( c ) * rs_c +
+	                       bli_obj_col_off( c ) * cs_c;
+
+	float*    buf_p      = bli_obj_buffer_at_off( p );
+	inc_t     rs_p       = bli_obj_row_stride( p );
+	inc_t     cs_p       = bli_obj_col_stride( p );
+	dim_t     pd_p       = bli_obj_panel_dim( p );
+	inc_t     ps_p       = bli_obj_panel_stride( p );
+
+	packm_f16_ker_ft f   = bli_cntx_get_packm_f16_ker( cntx );
+
+	dim_t     iter_dim;
+	dim_t     panel_len;
+	dim_t     panel_len_max;
+	inc_t     incc, ldc;
+	inc_t     ldp;
+
+	// The micro-kernel applies alpha, so no scaling is performed during
+	// packing (see bli_packm_blk_var1()).
+	float*    kappa      = bli_obj_buffer_for_const( BLIS_FLOAT, &BLIS_ONE );
+
+	// If c needs a transposition, induce it so that we can more simply
+	// express the remaining parameters and code.
+	if ( bli_does_trans( transc ) )
+	{
+		bli_swap_incs( &rs_c, &cs_c );
+	}
+
+	// Row panels (of A) are packed along the rows of c, and column panels
+	// (of B) along its columns. In both cases, the panel length runs along
+	// the k dimension.
+	if ( bli_is_row_packed( schema ) )
+	{
+		iter_dim      = m_p;
+		panel_len     = n_p;
+		panel_len_max = n_max_p;
+		incc          = rs_c;
+		ldc           = cs_c;
+		ldp           = cs_p;
+	}
+	else // if ( bli_is_col_packed( schema ) )
+	{
+		iter_dim      = n_p;
+		panel_len     = m_p;
+		panel_len_max = m_max_p;
+		incc          = cs_c;
+		ldc           = rs_c;
+		ldp           = rs_p;
+	}
+
+	// Compute the total number of iterations we'll need.
+	dim_t n_iter = iter_dim / pd_p + ( iter_dim % pd_p ? 1 : 0 );
+
+	dim_t it_start, it_end, it_inc;
+
+	// Determine the thread range and increment using the current thread's
+	// packm thrinfo_t node. NOTE: The definition of bli_thread_range_jrir()
+	// will depend on whether slab or round-robin partitioning was requested
+	// at configure-time.
+	bli_thread_range_jrir( thread, n_iter, 1, FALSE, &it_start, &it_end, &it_inc );
+
+	// Iterate over the micropanels assigned to the current thread.
+	for ( dim_t it = it_start; it < it_end; it += it_inc )
+	{
+		dim_t panel_dim_i = bli_min( pd_p, iter_dim - it*pd_p );
+
+		f
+		(
+		  panel_dim_i,
+		  panel_len,
+		  panel_len_max,
+		  kappa,
+		  buf_c + it*pd_p*incc, incc, ldc,
+		  buf_p + it*ps_p,            ldp,
+		  cntx
+		);
+	}
+}
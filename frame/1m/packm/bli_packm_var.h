@@ -51,6 +51,7 @@ BLIS_EXPORT_BLIS void PASTEMAC0(opname) \
 
 GENPROT( packm_unb_var1 )
 GENPROT( packm_blk_var1 )
+GENPROT( packm_blk_var1_f16 )
 
 //
 // Prototype BLAS-like interfaces with void pointer operands.
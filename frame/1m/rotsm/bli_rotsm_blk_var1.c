@@ -0,0 +1,115 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       dim_t    m, \
+       dim_t    n, \
+       dim_t    k, \
+       ctype_r* c, inc_t rs_c, inc_t cs_c, \
+       ctype*   s, inc_t rs_s, inc_t cs_s, \
+       ctype*   a, inc_t rs_a, inc_t cs_a, \
+       cntx_t*  cntx  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	/* Query the context for the rotv kernel. */ \
+	PASTECH2(ch,rotv,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, BLIS_ROTV_KER, cntx ); \
+\
+	/* Each sequence consists of n - 1 rotations. */ \
+	const dim_t n_rot = n - 1; \
+\
+	if ( m == 0 || n_rot <= 0 || k == 0 ) return; \
+\
+	/* Partition A into blocks of rows. Since the rotations are applied
+	   from the right, each block of rows may be updated independently of
+	   the others. */ \
+	for ( dim_t ic = 0; ic < m; ic += BLIS_ROTSM_MB ) \
+	{ \
+		const dim_t mc   = bli_min( BLIS_ROTSM_MB, m - ic ); \
+		ctype*      a_ic = a + ic*rs_a; \
+\
+		/* Partition the sequences into blocks. */ \
+		for ( dim_t pc = 0; pc < k; pc += BLIS_ROTSM_KB ) \
+		{ \
+			const dim_t kc = bli_min( BLIS_ROTSM_KB, k - pc ); \
+\
+			/* Apply the rotations of the current block of sequences along
+			   wavefronts. Wavefront t consists of rotations j = t - p of
+			   sequences p = 0, 1, ..., kc - 1 (relative to pc). Rotation j of
+			   sequence p depends on rotation j - 1 of sequence p, which was
+			   applied during wavefront t - 1, and on rotation j + 1 of
+			   sequence p - 1, which was applied earlier during wavefront t,
+			   so the result is identical to that of applying the sequences
+			   one after another. However, each wavefront touches only
+			   kc + 1 adjacent columns, and consecutive wavefronts differ by
+			   a single column. */ \
+			for ( dim_t t = 0; t < n_rot + kc - 1; ++t ) \
+			{ \
+				const dim_t p_beg = bli_max( 0, t - n_rot + 1 ); \
+				const dim_t p_end = bli_min( kc, t + 1 ); \
+\
+				for ( dim_t p = p_beg; p < p_end; ++p ) \
+				{ \
+					const dim_t j    = t - p; \
+\
+					ctype_r*    c1   = c + (j  )*rs_c + (pc+p)*cs_c; \
+					ctype*      s1   = s + (j  )*rs_s + (pc+p)*cs_s; \
+					ctype*      a1   = a_ic + (j  )*cs_a; \
+					ctype*      a2   = a_ic + (j+1)*cs_a; \
+\
+					f \
+					( \
+					  mc, \
+					  c1, \
+					  s1, \
+					  a1, rs_a, \
+					  a2, rs_a, \
+					  cntx  \
+					); \
+				} \
+			} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNCR_BASIC0( rotsm_blk_var1 )
+
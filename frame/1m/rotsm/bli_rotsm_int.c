@@ -0,0 +1,159 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// A description of a rotsm problem, shared by all threads of the team.
+typedef struct
+{
+	dim_t m;
+	dim_t n;
+	dim_t k;
+	void* c;
+	inc_t rs_c;
+	inc_t cs_c;
+	void* s;
+	inc_t rs_s;
+	inc_t cs_s;
+	void* a;
+	inc_t rs_a;
+	inc_t cs_a;
+} rotsmparams_t;
+
+//
+// Define the function executed by each thread of the team. Each thread
+// applies all of the rotations to a contiguous range of rows of A.
+//
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, varname ) \
+\
+static void PASTEMAC(ch,varname) \
+     ( \
+       void*      params, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	rotsmparams_t* p = params; \
+\
+	ctype*         a = p->a; \
+\
+	dim_t          start, end; \
+\
+	bli_thread_range_sub( thread, p->m, BLIS_THREAD_L2_BF, FALSE, &start, &end ); \
+\
+	if ( start == end ) return; \
+\
+	PASTEMAC(ch,rotsm_blk_var1) \
+	( \
+	  end - start, \
+	  p->n, \
+	  p->k, \
+	  p->c, p->rs_c, p->cs_c, \
+	  p->s, p->rs_s, p->cs_s, \
+	  a + start*p->rs_a, p->rs_a, p->cs_a, \
+	  cntx  \
+	); \
+}
+
+INSERT_GENTFUNCR_BASIC0( rotsm_thread )
+
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       side_t   side, \
+       dim_t    m, \
+       dim_t    n, \
+       dim_t    k, \
+       ctype_r* c, inc_t rs_c, inc_t cs_c, \
+       ctype*   s, inc_t rs_s, inc_t cs_s, \
+       ctype*   a, inc_t rs_a, inc_t cs_a, \
+       cntx_t*  cntx, \
+       rntm_t*  rntm  \
+     ) \
+{ \
+	rntm_t rntm_l; \
+\
+	/* Rotations applied to the rows of A from the left are rotations
+	   applied to the columns of A^T from the right, so we only implement
+	   the right side explicitly. */ \
+	if ( bli_is_left( side ) ) \
+	{ \
+		bli_swap_dims( &m, &n ); \
+		bli_swap_incs( &rs_a, &cs_a ); \
+	} \
+\
+	/* Since the rows of A are independent, the rows are partitioned among
+	   the threads, each of which applies the cache-blocked algorithm to
+	   its own rows. */ \
+	if ( bli_l2_mt_num_threads( m * n * k, m, rntm, &rntm_l ) > 1 ) \
+	{ \
+		rotsmparams_t params; \
+\
+		params.m    = m; \
+		params.n    = n; \
+		params.k    = k; \
+		params.c    = c; \
+		params.rs_c = rs_c; \
+		params.cs_c = cs_c; \
+		params.s    = s; \
+		params.rs_s = rs_s; \
+		params.cs_s = cs_s; \
+		params.a    = a; \
+		params.rs_a = rs_a; \
+		params.cs_a = cs_a; \
+\
+		bli_l2_thread_decorator( PASTEMAC(ch,rotsm_thread), &params, cntx, &rntm_l ); \
+		return; \
+	} \
+\
+	PASTEMAC(ch,rotsm_blk_var1) \
+	( \
+	  m, \
+	  n, \
+	  k, \
+	  c, rs_c, cs_c, \
+	  s, rs_s, cs_s, \
+	  a, rs_a, cs_a, \
+	  cntx  \
+	); \
+}
+
+INSERT_GENTFUNCR_BASIC0( rotsm_int )
+
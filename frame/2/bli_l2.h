@@ -68,3 +68,15 @@
 #include "bli_trmv.h"
 #include "bli_trsv.h"
 
+// Band and packed operation headers
+#include "bli_gbmv.h"
+#include "bli_tbsv.h"
+#include "bli_hpmv.h"
+#include "bli_tpmv.h"
+#include "bli_tpsv.h"
+#include "bli_hpr.h"
+#include "bli_hpr2.h"
+
+
+// Prototype multithreaded implementations.
+#include "bli_l2_mt.h"
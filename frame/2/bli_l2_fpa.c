@@ -60,6 +60,19 @@ GENFRONT( her2 )
 GENFRONT( syr2 )
 GENFRONT( trmv )
 GENFRONT( trsv )
+GENFRONT( gbmv )
+GENFRONT( hbmv )
+GENFRONT( sbmv )
+GENFRONT( tbmv )
+GENFRONT( tbsv )
+GENFRONT( hpmv )
+GENFRONT( spmv )
+GENFRONT( tpmv )
+GENFRONT( tpsv )
+GENFRONT( hpr )
+GENFRONT( spr )
+GENFRONT( hpr2 )
+GENFRONT( spr2 )
 
 //
 // Define function pointer query interfaces for level-2 implementations.
@@ -114,3 +127,6 @@ GENFRONT( trsv, trsv_unb_var2 )
 GENFRONT( trsv, trsv_unf_var1 )
 GENFRONT( trsv, trsv_unf_var2 )
 
+GENFRONT( gbmv, gbmv_unf_var1 )
+GENFRONT( gbmv, gbmv_unf_var2 )
+
@@ -52,6 +52,19 @@ GENPROT( her2 )
 GENPROT( syr2 )
 GENPROT( trmv )
 GENPROT( trsv )
+GENPROT( gbmv )
+GENPROT( hbmv )
+GENPROT( sbmv )
+GENPROT( tbmv )
+GENPROT( tbsv )
+GENPROT( hpmv )
+GENPROT( spmv )
+GENPROT( tpmv )
+GENPROT( tpsv )
+GENPROT( hpr )
+GENPROT( spr )
+GENPROT( hpr2 )
+GENPROT( spr2 )
 
 //
 // Prototype function pointer query interfaces for level-2 implementations.
@@ -100,3 +113,6 @@ GENPROT( trsv, trsv_unb_var2 )
 GENPROT( trsv, trsv_unf_var1 )
 GENPROT( trsv, trsv_unf_var2 )
 
+GENPROT( gbmv, gbmv_unf_var1 )
+GENPROT( gbmv, gbmv_unf_var2 )
+
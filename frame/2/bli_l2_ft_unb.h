@@ -163,5 +163,28 @@ typedef void (*PASTECH3(ch,opname,_unb,tsuf)) \
 INSERT_GENTDEF( trmv )
 INSERT_GENTDEF( trsv )
 
+// gbmv
+
+#undef  GENTDEF
+#define GENTDEF( ctype, ch, opname, tsuf ) \
+\
+typedef void (*PASTECH3(ch,opname,_unb,tsuf)) \
+     ( \
+       trans_t transa, \
+       conj_t  conjx, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   kl, \
+       dim_t   ku, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx  \
+     );
+
+INSERT_GENTDEF( gbmv )
+
 
 #endif
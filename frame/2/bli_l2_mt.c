@@ -0,0 +1,1334 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// A description of a level-2 problem, shared by all threads of the team.
+// Each operation uses only the fields that correspond to its parameters.
+typedef struct
+{
+	uplo_t  uploa;
+	trans_t transa;
+	diag_t  diaga;
+	conj_t  conja;
+	conj_t  conjx;
+	conj_t  conjy;
+	conj_t  conjh;
+	dim_t   m;
+	dim_t   n;
+	dim_t   kl;
+	dim_t   ku;
+	void*   alpha;
+	void*   a;
+	inc_t   rs_a;
+	inc_t   cs_a;
+	void*   x;
+	inc_t   incx;
+	void*   beta;
+	void*   y;
+	inc_t   incy;
+	void*   w;
+} l2mtparams_t;
+
+// -----------------------------------------------------------------------------
+
+dim_t bli_l2_mt_num_threads
+     (
+       dim_t   n_elem,
+       dim_t   n_part,
+       rntm_t* rntm,
+       rntm_t* rntm_l
+     )
+{
+#ifdef BLIS_ENABLE_MULTITHREADING
+
+	// Return early, without querying the runtime, for problems that are
+	// too small to be split among at least two threads.
+	if ( n_elem < 2 * BLIS_THREAD_L2_MIN_ELEM ||
+	     n_part < 2 * BLIS_THREAD_L2_BF ) return 1;
+
+	if ( rntm == NULL ) bli_rntm_init_from_global( rntm_l );
+	else                *rntm_l = *rntm;
+
+	// Interpret the number of threads or the ways of parallelism held by
+	// the rntm_t. Level-2 operations only partition one dimension, so all
+	// that matters is the total number of threads implied by the ways.
+	bli_rntm_set_ways_from_rntm( n_part, 1, 1, rntm_l );
+
+	dim_t n_threads = bli_rntm_num_threads( rntm_l );
+
+	// Limit the number of threads so that each thread receives enough
+	// work to amortize the cost of waking it up.
+	n_threads = bli_min( n_threads, n_elem / BLIS_THREAD_L2_MIN_ELEM );
+	n_threads = bli_min( n_threads, n_part / BLIS_THREAD_L2_BF );
+	n_threads = bli_max( n_threads, 1 );
+
+	bli_rntm_set_num_threads_only( n_threads, rntm_l );
+
+	return n_threads;
+
+#else
+
+	( void )n_elem;
+	( void )n_part;
+	( void )rntm;
+	( void )rntm_l;
+
+	return 1;
+
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+//
+// Define helper functions that choose and invoke a single-threaded variant
+// in the same manner as the corresponding bli_?<opname>_ex() functions.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       conj_t  conjx, \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	PASTECH2(ch,gemv,_unb_ft) f; \
+\
+	if ( bli_does_notrans( transa ) ) \
+	{ \
+		if ( bli_is_row_stored( rs_a, cs_a ) ) f = PASTEMAC(ch,gemv_unf_var1); \
+		else /* column or general stored */    f = PASTEMAC(ch,gemv_unf_var2); \
+	} \
+	else /* if ( bli_does_trans( transa ) ) */ \
+	{ \
+		if ( bli_is_row_stored( rs_a, cs_a ) ) f = PASTEMAC(ch,gemv_unf_var2); \
+		else /* column or general stored */    f = PASTEMAC(ch,gemv_unf_var1); \
+	} \
+\
+	f( transa, conjx, m, n, alpha, a, rs_a, cs_a, x, incx, beta, y, incy, cntx ); \
+}
+
+INSERT_GENTFUNC_BASIC0( gemv_mt_seq )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       conj_t  conjx, \
+       conj_t  conjy, \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  alpha, \
+       ctype*  x, inc_t incx, \
+       ctype*  y, inc_t incy, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	PASTECH2(ch,ger,_unb_ft) f; \
+\
+	if ( bli_is_row_stored( rs_a, cs_a ) ) f = PASTEMAC(ch,ger_unb_var1); \
+	else /* column or general stored */    f = PASTEMAC(ch,ger_unb_var2); \
+\
+	f( conjx, conjy, m, n, alpha, x, incx, y, incy, a, rs_a, cs_a, cntx ); \
+}
+
+INSERT_GENTFUNC_BASIC0( ger_mt_seq )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conja, \
+       conj_t  conjx, \
+       conj_t  conjh, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	PASTECH2(ch,hemv,_unb_ft) f; \
+\
+	if ( bli_is_lower( uploa ) ) \
+	{ \
+		if ( bli_is_row_stored( rs_a, cs_a ) ) f = PASTEMAC(ch,hemv_unf_var1); \
+		else /* column or general stored */    f = PASTEMAC(ch,hemv_unf_var3); \
+	} \
+	else /* if ( bli_is_upper( uploa ) ) */ \
+	{ \
+		if ( bli_is_row_stored( rs_a, cs_a ) ) f = PASTEMAC(ch,hemv_unf_var3); \
+		else /* column or general stored */    f = PASTEMAC(ch,hemv_unf_var1); \
+	} \
+\
+	f( uploa, conja, conjx, conjh, m, alpha, a, rs_a, cs_a, \
+	   x, incx, beta, y, incy, cntx ); \
+}
+
+INSERT_GENTFUNC_BASIC0( hemv_mt_seq )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, rvarname, cvarname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       uplo_t  uploa, \
+       trans_t transa, \
+       diag_t  diaga, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	PASTECH2(ch,trmv,_unb_ft) f; \
+\
+	if ( bli_does_notrans( transa ) ) \
+	{ \
+		if ( bli_is_row_stored( rs_a, cs_a ) ) f = PASTEMAC(ch,rvarname); \
+		else /* column or general stored */    f = PASTEMAC(ch,cvarname); \
+	} \
+	else /* if ( bli_does_trans( transa ) ) */ \
+	{ \
+		if ( bli_is_row_stored( rs_a, cs_a ) ) f = PASTEMAC(ch,cvarname); \
+		else /* column or general stored */    f = PASTEMAC(ch,rvarname); \
+	} \
+\
+	f( uploa, transa, diaga, m, alpha, a, rs_a, cs_a, x, incx, cntx ); \
+}
+
+INSERT_GENTFUNC_BASIC2( trmv_mt_seq, trmv_unf_var1, trmv_unf_var2 )
+INSERT_GENTFUNC_BASIC2( trsv_mt_seq, trsv_unf_var1, trsv_unf_var2 )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       conj_t  conjx, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   kl, \
+       dim_t   ku, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	PASTECH2(ch,gbmv,_unb_ft) f; \
+\
+	if ( bli_does_notrans( transa ) ) \
+	{ \
+		if ( bli_is_row_stored( rs_a, cs_a ) ) f = PASTEMAC(ch,gbmv_unf_var1); \
+		else /* column or general stored */    f = PASTEMAC(ch,gbmv_unf_var2); \
+	} \
+	else /* if ( bli_does_trans( transa ) ) */ \
+	{ \
+		if ( bli_is_row_stored( rs_a, cs_a ) ) f = PASTEMAC(ch,gbmv_unf_var2); \
+		else /* column or general stored */    f = PASTEMAC(ch,gbmv_unf_var1); \
+	} \
+\
+	f( transa, conjx, m, n, kl, ku, alpha, a, rs_a, cs_a, \
+	   x, incx, beta, y, incy, cntx ); \
+}
+
+INSERT_GENTFUNC_BASIC0( gbmv_mt_seq )
+
+// -----------------------------------------------------------------------------
+
+//
+// Define the functions executed by each thread of the team.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       void*      params, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	l2mtparams_t* p      = params; \
+\
+	trans_t       transa = p->transa; \
+	conj_t        conjx  = p->conjx; \
+	dim_t         m      = p->m; \
+	dim_t         n      = p->n; \
+	ctype*        alpha  = p->alpha; \
+	ctype*        a      = p->a; \
+	inc_t         rs_a   = p->rs_a; \
+	inc_t         cs_a   = p->cs_a; \
+	ctype*        x      = p->x; \
+	inc_t         incx   = p->incx; \
+	ctype*        beta   = p->beta; \
+	ctype*        y      = p->y; \
+	inc_t         incy   = p->incy; \
+\
+	dim_t         m_y, n_x; \
+	inc_t         rs_at, cs_at; \
+	dim_t         start, end; \
+\
+	bli_set_dims_incs_with_trans( transa, \
+	                              m, n, rs_a, cs_a, \
+	                              &m_y, &n_x, &rs_at, &cs_at ); \
+\
+	/* Each thread computes a contiguous block of the elements of y, and
+	   thus reads the corresponding rows of transa( A ). This requires no
+	   synchronization and no reduction among the threads. */ \
+	bli_thread_range_sub( thread, m_y, BLIS_THREAD_L2_BF, FALSE, &start, &end ); \
+\
+	if ( start == end ) return; \
+\
+	ctype* a1 = a + start*rs_at; \
+	ctype* y1 = y + start*incy; \
+\
+	if ( bli_does_notrans( transa ) ) \
+		PASTEMAC(ch,gemv_mt_seq)( transa, conjx, end - start, n, \
+		                          alpha, a1, rs_a, cs_a, x, incx, \
+		                          beta, y1, incy, cntx ); \
+	else \
+		PASTEMAC(ch,gemv_mt_seq)( transa, conjx, m, end - start, \
+		                          alpha, a1, rs_a, cs_a, x, incx, \
+		                          beta, y1, incy, cntx ); \
+}
+
+INSERT_GENTFUNC_BASIC0( gemv_mt_thread )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       void*      params, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	l2mtparams_t* p      = params; \
+\
+	conj_t        conjx  = p->conjx; \
+	conj_t        conjy  = p->conjy; \
+	dim_t         m      = p->m; \
+	dim_t         n      = p->n; \
+	ctype*        alpha  = p->alpha; \
+	ctype*        x      = p->x; \
+	inc_t         incx   = p->incx; \
+	ctype*        y      = p->y; \
+	inc_t         incy   = p->incy; \
+	ctype*        a      = p->a; \
+	inc_t         rs_a   = p->rs_a; \
+	inc_t         cs_a   = p->cs_a; \
+\
+	const dim_t   n_min  = bli_thread_n_way( thread ) * BLIS_THREAD_L2_BF; \
+	dim_t         start, end; \
+\
+	/* Partition A into blocks of whole rows if A is row-stored and into
+	   blocks of whole columns otherwise, unless that dimension is too
+	   short to keep every thread busy and the other dimension is longer. */ \
+	bool part_m = bli_is_row_stored( rs_a, cs_a ); \
+\
+	if      (  part_m && m < n_min && m < n ) part_m = FALSE; \
+	else if ( !part_m && n < n_min && n < m ) part_m = TRUE; \
+\
+	if ( part_m ) \
+	{ \
+		bli_thread_range_sub( thread, m, BLIS_THREAD_L2_BF, FALSE, &start, &end ); \
+\
+		if ( start == end ) return; \
+\
+		PASTEMAC(ch,ger_mt_seq)( conjx, conjy, end - start, n, alpha, \
+		                         x + start*incx, incx, y, incy, \
+		                         a + start*rs_a, rs_a, cs_a, cntx ); \
+	} \
+	else \
+	{ \
+		bli_thread_range_sub( thread, n, BLIS_THREAD_L2_BF, FALSE, &start, &end ); \
+\
+		if ( start == end ) return; \
+\
+		PASTEMAC(ch,ger_mt_seq)( conjx, conjy, m, end - start, alpha, \
+		                         x, incx, y + start*incy, incy, \
+		                         a + start*cs_a, rs_a, cs_a, cntx ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( ger_mt_thread )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       void*      params, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	l2mtparams_t* p      = params; \
+\
+	uplo_t        uploa  = p->uploa; \
+	conj_t        conja  = p->conja; \
+	conj_t        conjx  = p->conjx; \
+	conj_t        conjh  = p->conjh; \
+	dim_t         m      = p->m; \
+	ctype*        alpha  = p->alpha; \
+	ctype*        a      = p->a; \
+	inc_t         rs_a   = p->rs_a; \
+	inc_t         cs_a   = p->cs_a; \
+	ctype*        x      = p->x; \
+	inc_t         incx   = p->incx; \
+	ctype*        beta   = p->beta; \
+	ctype*        y      = p->y; \
+	inc_t         incy   = p->incy; \
+\
+	ctype*        one    = PASTEMAC(ch,1); \
+	dim_t         start, end; \
+\
+	/* Each thread computes a contiguous block y1 of y, which requires the
+	   full rows of A that correspond to y1. Those rows are made up of the
+	   diagonal block A11 and of two off-diagonal blocks, one of which is
+	   stored as-is while the other must be read from the opposite side
+	   of the diagonal and (conjugate-)transposed. Since every row costs
+	   the same, the rows are partitioned evenly. */ \
+	bli_thread_range_sub( thread, m, BLIS_THREAD_L2_BF, FALSE, &start, &end ); \
+\
+	if ( start == end ) return; \
+\
+	const dim_t   m1       = end - start; \
+	const dim_t   m2       = m - end; \
+\
+	const conj_t  conja_r  = bli_apply_conj( conjh, conja ); \
+	const trans_t transa_s = ( trans_t )conja; \
+	const trans_t transa_r = bli_is_conj( conja_r ) ? BLIS_CONJ_TRANSPOSE \
+	                                                : BLIS_TRANSPOSE; \
+\
+	ctype*        a11      = a + start*rs_a + start*cs_a; \
+	ctype*        x0       = x; \
+	ctype*        x1       = x + start*incx; \
+	ctype*        x2       = x + end  *incx; \
+	ctype*        y1       = y + start*incy; \
+\
+	/* y1 = beta * y1 + alpha * A11 * x1; */ \
+	PASTEMAC(ch,hemv_mt_seq)( uploa, conja, conjx, conjh, m1, \
+	                          alpha, a11, rs_a, cs_a, x1, incx, \
+	                          beta, y1, incy, cntx ); \
+\
+	if ( bli_is_lower( uploa ) ) \
+	{ \
+		ctype* a10 = a + start*rs_a; \
+		ctype* a21 = a + end  *rs_a + start*cs_a; \
+\
+		/* y1 = y1 + alpha * A10 * x0; */ \
+		if ( 0 < start ) \
+		PASTEMAC(ch,gemv_mt_seq)( transa_s, conjx, m1, start, \
+		                          alpha, a10, rs_a, cs_a, x0, incx, \
+		                          one, y1, incy, cntx ); \
+\
+		/* y1 = y1 + alpha * A21' * x2; */ \
+		if ( 0 < m2 ) \
+		PASTEMAC(ch,gemv_mt_seq)( transa_r, conjx, m2, m1, \
+		                          alpha, a21, rs_a, cs_a, x2, incx, \
+		                          one, y1, incy, cntx ); \
+	} \
+	else /* if ( bli_is_upper( uploa ) ) */ \
+	{ \
+		ctype* a01 = a + start*cs_a; \
+		ctype* a12 = a + start*rs_a + end*cs_a; \
+\
+		/* y1 = y1 + alpha * A01' * x0; */ \
+		if ( 0 < start ) \
+		PASTEMAC(ch,gemv_mt_seq)( transa_r, conjx, start, m1, \
+		                          alpha, a01, rs_a, cs_a, x0, incx, \
+		                          one, y1, incy, cntx ); \
+\
+		/* y1 = y1 + alpha * A12 * x2; */ \
+		if ( 0 < m2 ) \
+		PASTEMAC(ch,gemv_mt_seq)( transa_s, conjx, m1, m2, \
+		                          alpha, a12, rs_a, cs_a, x2, incx, \
+		                          one, y1, incy, cntx ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( hemv_mt_thread )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       void*      params, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t   dt     = PASTEMAC(ch,type); \
+\
+	l2mtparams_t* p      = params; \
+\
+	uplo_t        uploa  = p->uploa; \
+	trans_t       transa = p->transa; \
+	diag_t        diaga  = p->diaga; \
+	dim_t         m      = p->m; \
+	ctype*        alpha  = p->alpha; \
+	ctype*        a      = p->a; \
+	inc_t         rs_a   = p->rs_a; \
+	inc_t         cs_a   = p->cs_a; \
+	ctype*        x      = p->x; \
+	inc_t         incx   = p->incx; \
+	ctype*        w      = p->w; \
+\
+	ctype*        one    = PASTEMAC(ch,1); \
+	dim_t         start, end; \
+	inc_t         rs_at, cs_at; \
+	uplo_t        uploa_trans; \
+\
+	PASTECH(ch,copyv_ker_ft) copyv_p = bli_cntx_get_l1v_ker_dt( dt, BLIS_COPYV_KER, cntx ); \
+\
+	/* Reduce all of the possible cases down to (possibly conjugated)
+	   lower/upper without transposition. */ \
+	if ( bli_does_notrans( transa ) ) \
+	{ \
+		rs_at = rs_a; \
+		cs_at = cs_a; \
+		uploa_trans = uploa; \
+	} \
+	else /* if ( bli_does_trans( transa ) ) */ \
+	{ \
+		rs_at = cs_a; \
+		cs_at = rs_a; \
+		uploa_trans = bli_uplo_toggled( uploa ); \
+	} \
+\
+	const trans_t transa_c = ( trans_t )bli_extract_conj( transa ); \
+\
+	/* Each thread computes a contiguous block x1 of the result into the
+	   corresponding block w1 of the workspace, reading from the original
+	   x. The cost of a row grows with its distance from the unstored
+	   triangle, so the rows are partitioned by area. (The partitioning
+	   function partitions columns, so we describe the transpose.) */ \
+	bli_thread_range_weighted_sub( thread, 0, bli_uplo_toggled( uploa_trans ), \
+	                               m, m, BLIS_THREAD_L2_BF, FALSE, &start, &end ); \
+\
+	const dim_t m1  = end - start; \
+	const dim_t m2  = m - end; \
+\
+	ctype*      a11 = a + start*rs_at + start*cs_at; \
+	ctype*      x1  = x + start*incx; \
+	ctype*      w1  = w + start; \
+\
+	if ( 0 < m1 ) \
+	{ \
+		/* w1 = x1; */ \
+		copyv_p( BLIS_NO_CONJUGATE, m1, x1, incx, w1, 1, cntx ); \
+\
+		/* w1 = alpha * A11 * w1; */ \
+		PASTEMAC(ch,trmv_mt_seq)( uploa_trans, transa_c, diaga, m1, \
+		                          alpha, a11, rs_at, cs_at, w1, 1, cntx ); \
+\
+		if ( bli_is_lower( uploa_trans ) ) \
+		{ \
+			/* w1 = w1 + alpha * A10 * x0; */ \
+			if ( 0 < start ) \
+			PASTEMAC(ch,gemv_mt_seq)( transa_c, BLIS_NO_CONJUGATE, m1, start, \
+			                          alpha, a + start*rs_at, rs_at, cs_at, \
+			                          x, incx, one, w1, 1, cntx ); \
+		} \
+		else /* if ( bli_is_upper( uploa_trans ) ) */ \
+		{ \
+			/* w1 = w1 + alpha * A12 * x2; */ \
+			if ( 0 < m2 ) \
+			PASTEMAC(ch,gemv_mt_seq)( transa_c, BLIS_NO_CONJUGATE, m1, m2, \
+			                          alpha, a + start*rs_at + end*cs_at, rs_at, cs_at, \
+			                          x + end*incx, incx, one, w1, 1, cntx ); \
+		} \
+	} \
+\
+	/* Wait until every thread is done reading x before overwriting it. */ \
+	bli_thread_barrier( thread ); \
+\
+	/* x1 = w1; */ \
+	if ( 0 < m1 ) \
+		copyv_p( BLIS_NO_CONJUGATE, m1, w1, 1, x1, incx, cntx ); \
+}
+
+INSERT_GENTFUNC_BASIC0( trmv_mt_thread )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       void*      params, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t   dt        = PASTEMAC(ch,type); \
+\
+	l2mtparams_t* p         = params; \
+\
+	uplo_t        uploa     = p->uploa; \
+	trans_t       transa    = p->transa; \
+	diag_t        diaga     = p->diaga; \
+	dim_t         m         = p->m; \
+	ctype*        alpha     = p->alpha; \
+	ctype*        a         = p->a; \
+	inc_t         rs_a      = p->rs_a; \
+	inc_t         cs_a      = p->cs_a; \
+	ctype*        x         = p->x; \
+	inc_t         incx      = p->incx; \
+\
+	ctype*        one       = PASTEMAC(ch,1); \
+	ctype*        minus_one = PASTEMAC(ch,m1); \
+	dim_t         start, end; \
+	dim_t         k0, kb; \
+	inc_t         rs_at, cs_at; \
+	uplo_t        uploa_trans; \
+\
+	PASTECH(ch,scalv_ker_ft) scalv_p = bli_cntx_get_l1v_ker_dt( dt, BLIS_SCALV_KER, cntx ); \
+\
+	/* Reduce all of the possible cases down to (possibly conjugated)
+	   lower/upper without transposition. */ \
+	if ( bli_does_notrans( transa ) ) \
+	{ \
+		rs_at = rs_a; \
+		cs_at = cs_a; \
+		uploa_trans = uploa; \
+	} \
+	else /* if ( bli_does_trans( transa ) ) */ \
+	{ \
+		rs_at = cs_a; \
+		cs_at = rs_a; \
+		uploa_trans = bli_uplo_toggled( uploa ); \
+	} \
+\
+	const trans_t transa_c = ( trans_t )bli_extract_conj( transa ); \
+	const dim_t   b_alg    = BLIS_THREAD_L2_TRSV_B; \
+\
+	/* x = alpha * x; */ \
+	if ( !PASTEMAC(ch,eq1)( *alpha ) ) \
+	{ \
+		bli_thread_range_sub( thread, m, BLIS_THREAD_L2_BF, FALSE, &start, &end ); \
+\
+		if ( start < end ) \
+			scalv_p( BLIS_NO_CONJUGATE, end - start, alpha, \
+			         x + start*incx, incx, cntx ); \
+\
+		bli_thread_barrier( thread ); \
+	} \
+\
+	/* The diagonal blocks are solved one after another by the chief
+	   thread, and after each solve, the rows of x that remain unsolved
+	   are updated by the whole team. Each block is solved in the direction
+	   implied by the triangle, so that the rows updated at each step are
+	   exactly those not yet solved. */ \
+	for ( dim_t iter = 0; iter < m; iter += kb ) \
+	{ \
+		kb = bli_min( b_alg, m - iter ); \
+\
+		/* Locate the current diagonal block and the unsolved rows. */ \
+		dim_t i_rest, m_rest; \
+\
+		if ( bli_is_lower( uploa_trans ) ) \
+		{ \
+			k0     = iter; \
+			i_rest = k0 + kb; \
+			m_rest = m - i_rest; \
+		} \
+		else /* if ( bli_is_upper( uploa_trans ) ) */ \
+		{ \
+			k0     = m - iter - kb; \
+			i_rest = 0; \
+			m_rest = k0; \
+		} \
+\
+		ctype* a11 = a + k0*rs_at + k0*cs_at; \
+		ctype* x1  = x + k0*incx; \
+\
+		/* x1 = inv( A11 ) * x1; */ \
+		if ( bli_thread_am_ochief( thread ) ) \
+			PASTEMAC(ch,trsv_mt_seq)( uploa_trans, transa_c, diaga, kb, \
+			                          one, a11, rs_at, cs_at, x1, incx, cntx ); \
+\
+		bli_thread_barrier( thread ); \
+\
+		if ( m_rest == 0 ) break; \
+\
+		/* x2 = x2 - A21 * x1; (or x0 = x0 - A01 * x1; if upper) */ \
+		bli_thread_range_sub( thread, m_rest, BLIS_THREAD_L2_BF, FALSE, &start, &end ); \
+\
+		if ( start < end ) \
+			PASTEMAC(ch,gemv_mt_seq)( transa_c, BLIS_NO_CONJUGATE, end - start, kb, \
+			                          minus_one, a + ( i_rest + start )*rs_at + k0*cs_at, \
+			                          rs_at, cs_at, x1, incx, \
+			                          one, x + ( i_rest + start )*incx, incx, cntx ); \
+\
+		bli_thread_barrier( thread ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( trsv_mt_thread )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       void*      params, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	l2mtparams_t* p      = params; \
+\
+	trans_t       transa = p->transa; \
+	conj_t        conjx  = p->conjx; \
+	dim_t         m      = p->m; \
+	dim_t         n      = p->n; \
+	dim_t         kl     = p->kl; \
+	dim_t         ku     = p->ku; \
+	ctype*        alpha  = p->alpha; \
+	ctype*        a      = p->a; \
+	inc_t         rs_a   = p->rs_a; \
+	inc_t         cs_a   = p->cs_a; \
+	ctype*        x      = p->x; \
+	inc_t         incx   = p->incx; \
+	ctype*        beta   = p->beta; \
+	ctype*        y      = p->y; \
+	inc_t         incy   = p->incy; \
+\
+	dim_t         m_y, n_x; \
+	dim_t         start, end; \
+\
+	bli_set_dims_with_trans( transa, m, n, &m_y, &n_x ); \
+\
+	/* Each thread computes a contiguous block of the elements of y, and
+	   thus reads the corresponding rows of transa( A ). Shifting the view
+	   of A to the first of those rows shifts the band relative to the
+	   diagonal of the view by the same amount. */ \
+	bli_thread_range_sub( thread, m_y, BLIS_THREAD_L2_BF, FALSE, &start, &end ); \
+\
+	if ( start == end ) return; \
+\
+	ctype* y1 = y + start*incy; \
+\
+	if ( bli_does_notrans( transa ) ) \
+		PASTEMAC(ch,gbmv_mt_seq)( transa, conjx, end - start, n, \
+		                          kl - start, ku + start, \
+		                          alpha, a + start*rs_a, rs_a, cs_a, x, incx, \
+		                          beta, y1, incy, cntx ); \
+	else \
+		PASTEMAC(ch,gbmv_mt_seq)( transa, conjx, m, end - start, \
+		                          kl + start, ku - start, \
+		                          alpha, a + start*cs_a, rs_a, cs_a, x, incx, \
+		                          beta, y1, incy, cntx ); \
+}
+
+INSERT_GENTFUNC_BASIC0( gbmv_mt_thread )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       void*      params, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	l2mtparams_t* p      = params; \
+\
+	dim_t         start, end; \
+\
+	/* Each thread computes a contiguous block of the elements of y. Since
+	   every row of a Hermitian/symmetric matrix has the same length, the
+	   rows are partitioned evenly. */ \
+	bli_thread_range_sub( thread, p->m, BLIS_THREAD_L2_BF, FALSE, &start, &end ); \
+\
+	if ( start == end ) return; \
+\
+	PASTEMAC(ch,hpmv_unf_var1)( p->uploa, p->conja, p->conjx, p->conjh, p->m, \
+	                            p->alpha, p->a, p->x, p->incx, \
+	                            p->beta, p->y, p->incy, start, end, cntx ); \
+}
+
+INSERT_GENTFUNC_BASIC0( hpmv_mt_thread )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       void*      params, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t   dt     = PASTEMAC(ch,type); \
+\
+	l2mtparams_t* p      = params; \
+\
+	uplo_t        uploa  = p->uploa; \
+	trans_t       transa = p->transa; \
+	dim_t         m      = p->m; \
+	ctype*        x      = p->x; \
+	inc_t         incx   = p->incx; \
+	ctype*        w      = p->w; \
+\
+	dim_t         start, end; \
+\
+	PASTECH(ch,copyv_ker_ft) copyv_p = bli_cntx_get_l1v_ker_dt( dt, BLIS_COPYV_KER, cntx ); \
+\
+	/* w = x; */ \
+	bli_thread_range_sub( thread, m, BLIS_THREAD_L2_BF, FALSE, &start, &end ); \
+\
+	if ( start < end ) \
+		copyv_p( BLIS_NO_CONJUGATE, end - start, x + start*incx, incx, \
+		         w + start, 1, cntx ); \
+\
+	/* Wait until all of x has been copied before overwriting it. */ \
+	bli_thread_barrier( thread ); \
+\
+	/* Each thread computes a contiguous block of x from w. The cost of a
+	   row grows with its distance from the unstored triangle, so the rows
+	   are partitioned by area. (The partitioning function partitions
+	   columns, so we describe the transpose.) */ \
+	const uplo_t uploa_trans = bli_does_notrans( transa ) \
+	                           ? uploa : bli_uplo_toggled( uploa ); \
+\
+	bli_thread_range_weighted_sub( thread, 0, bli_uplo_toggled( uploa_trans ), \
+	                               m, m, BLIS_THREAD_L2_BF, FALSE, &start, &end ); \
+\
+	if ( start == end ) return; \
+\
+	PASTEMAC(ch,tpmv_unf_var1)( uploa, transa, p->diaga, m, p->alpha, p->a, \
+	                            w, x, incx, start, end, cntx ); \
+}
+
+INSERT_GENTFUNC_BASIC0( tpmv_mt_thread )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       void*      params, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	l2mtparams_t* p      = params; \
+\
+	dim_t         start, end; \
+\
+	/* Each thread updates a contiguous block of columns of the stored
+	   triangle, which are partitioned by area. */ \
+	bli_thread_range_weighted_sub( thread, 0, p->uploa, p->m, p->m, \
+	                               BLIS_THREAD_L2_BF, FALSE, &start, &end ); \
+\
+	if ( start == end ) return; \
+\
+	PASTEMAC(ch,hpr_unf_var1)( p->uploa, p->conjx, p->conjh, p->m, \
+	                           p->alpha, p->x, p->incx, p->a, \
+	                           start, end, cntx ); \
+}
+
+INSERT_GENTFUNC_BASIC0( hpr_mt_thread )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       void*      params, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	l2mtparams_t* p      = params; \
+\
+	dim_t         start, end; \
+\
+	/* Each thread updates a contiguous block of columns of the stored
+	   triangle, which are partitioned by area. */ \
+	bli_thread_range_weighted_sub( thread, 0, p->uploa, p->m, p->m, \
+	                               BLIS_THREAD_L2_BF, FALSE, &start, &end ); \
+\
+	if ( start == end ) return; \
+\
+	PASTEMAC(ch,hpr2_unf_var1)( p->uploa, p->conjx, p->conjy, p->conjh, p->m, \
+	                            p->alpha, p->x, p->incx, p->y, p->incy, p->a, \
+	                            start, end, cntx ); \
+}
+
+INSERT_GENTFUNC_BASIC0( hpr2_mt_thread )
+
+// -----------------------------------------------------------------------------
+
+//
+// Define the multithreaded typed interfaces, which describe the problem and
+// hand it off to the level-2 thread decorator.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       conj_t  conjx, \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	l2mtparams_t params; \
+\
+	params.transa = transa; \
+	params.conjx  = conjx; \
+	params.m      = m; \
+	params.n      = n; \
+	params.alpha  = alpha; \
+	params.a      = a; \
+	params.rs_a   = rs_a; \
+	params.cs_a   = cs_a; \
+	params.x      = x; \
+	params.incx   = incx; \
+	params.beta   = beta; \
+	params.y      = y; \
+	params.incy   = incy; \
+\
+	bli_l2_thread_decorator( PASTEMAC(ch,gemv_mt_thread), &params, cntx, rntm ); \
+}
+
+INSERT_GENTFUNC_BASIC0( gemv_mt )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       conj_t  conjx, \
+       conj_t  conjy, \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  alpha, \
+       ctype*  x, inc_t incx, \
+       ctype*  y, inc_t incy, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	l2mtparams_t params; \
+\
+	params.conjx  = conjx; \
+	params.conjy  = conjy; \
+	params.m      = m; \
+	params.n      = n; \
+	params.alpha  = alpha; \
+	params.x      = x; \
+	params.incx   = incx; \
+	params.y      = y; \
+	params.incy   = incy; \
+	params.a      = a; \
+	params.rs_a   = rs_a; \
+	params.cs_a   = cs_a; \
+\
+	bli_l2_thread_decorator( PASTEMAC(ch,ger_mt_thread), &params, cntx, rntm ); \
+}
+
+INSERT_GENTFUNC_BASIC0( ger_mt )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conja, \
+       conj_t  conjx, \
+       conj_t  conjh, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	l2mtparams_t params; \
+\
+	params.uploa  = uploa; \
+	params.conja  = conja; \
+	params.conjx  = conjx; \
+	params.conjh  = conjh; \
+	params.m      = m; \
+	params.alpha  = alpha; \
+	params.a      = a; \
+	params.rs_a   = rs_a; \
+	params.cs_a   = cs_a; \
+	params.x      = x; \
+	params.incx   = incx; \
+	params.beta   = beta; \
+	params.y      = y; \
+	params.incy   = incy; \
+\
+	bli_l2_thread_decorator( PASTEMAC(ch,hemv_mt_thread), &params, cntx, rntm ); \
+}
+
+INSERT_GENTFUNC_BASIC0( hemv_mt )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       uplo_t  uploa, \
+       trans_t transa, \
+       diag_t  diaga, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	l2mtparams_t params; \
+\
+	/* Since every element of the result depends on elements of x owned
+	   by other threads, the result is first computed into a contiguous
+	   workspace vector. */ \
+	ctype* w = bli_malloc_intl( m * sizeof( ctype ) ); \
+\
+	params.uploa  = uploa; \
+	params.transa = transa; \
+	params.diaga  = diaga; \
+	params.m      = m; \
+	params.alpha  = alpha; \
+	params.a      = a; \
+	params.rs_a   = rs_a; \
+	params.cs_a   = cs_a; \
+	params.x      = x; \
+	params.incx   = incx; \
+	params.w      = w; \
+\
+	bli_l2_thread_decorator( PASTEMAC(ch,trmv_mt_thread), &params, cntx, rntm ); \
+\
+	bli_free_intl( w ); \
+}
+
+INSERT_GENTFUNC_BASIC0( trmv_mt )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       uplo_t  uploa, \
+       trans_t transa, \
+       diag_t  diaga, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	l2mtparams_t params; \
+\
+	params.uploa  = uploa; \
+	params.transa = transa; \
+	params.diaga  = diaga; \
+	params.m      = m; \
+	params.alpha  = alpha; \
+	params.a      = a; \
+	params.rs_a   = rs_a; \
+	params.cs_a   = cs_a; \
+	params.x      = x; \
+	params.incx   = incx; \
+\
+	bli_l2_thread_decorator( PASTEMAC(ch,trsv_mt_thread), &params, cntx, rntm ); \
+}
+
+INSERT_GENTFUNC_BASIC0( trsv_mt )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       conj_t  conjx, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   kl, \
+       dim_t   ku, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	l2mtparams_t params; \
+\
+	params.transa = transa; \
+	params.conjx  = conjx; \
+	params.m      = m; \
+	params.n      = n; \
+	params.kl     = kl; \
+	params.ku     = ku; \
+	params.alpha  = alpha; \
+	params.a      = a; \
+	params.rs_a   = rs_a; \
+	params.cs_a   = cs_a; \
+	params.x      = x; \
+	params.incx   = incx; \
+	params.beta   = beta; \
+	params.y      = y; \
+	params.incy   = incy; \
+\
+	bli_l2_thread_decorator( PASTEMAC(ch,gbmv_mt_thread), &params, cntx, rntm ); \
+}
+
+INSERT_GENTFUNC_BASIC0( gbmv_mt )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conja, \
+       conj_t  conjx, \
+       conj_t  conjh, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	l2mtparams_t params; \
+\
+	params.uploa  = uploa; \
+	params.conja  = conja; \
+	params.conjx  = conjx; \
+	params.conjh  = conjh; \
+	params.m      = m; \
+	params.alpha  = alpha; \
+	params.a      = a; \
+	params.x      = x; \
+	params.incx   = incx; \
+	params.beta   = beta; \
+	params.y      = y; \
+	params.incy   = incy; \
+\
+	bli_l2_thread_decorator( PASTEMAC(ch,hpmv_mt_thread), &params, cntx, rntm ); \
+}
+
+INSERT_GENTFUNC_BASIC0( hpmv_mt )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       uplo_t  uploa, \
+       trans_t transa, \
+       diag_t  diaga, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  a, \
+       ctype*  x, inc_t incx, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	l2mtparams_t params; \
+\
+	/* Since every element of the result depends on elements of x owned
+	   by other threads, the original contents of x are first copied to a
+	   contiguous workspace vector. */ \
+	ctype* w = bli_malloc_intl( m * sizeof( ctype ) ); \
+\
+	params.uploa  = uploa; \
+	params.transa = transa; \
+	params.diaga  = diaga; \
+	params.m      = m; \
+	params.alpha  = alpha; \
+	params.a      = a; \
+	params.x      = x; \
+	params.incx   = incx; \
+	params.w      = w; \
+\
+	bli_l2_thread_decorator( PASTEMAC(ch,tpmv_mt_thread), &params, cntx, rntm ); \
+\
+	bli_free_intl( w ); \
+}
+
+INSERT_GENTFUNC_BASIC0( tpmv_mt )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conjx, \
+       conj_t  conjh, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  x, inc_t incx, \
+       ctype*  a, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	l2mtparams_t params; \
+\
+	params.uploa  = uploa; \
+	params.conjx  = conjx; \
+	params.conjh  = conjh; \
+	params.m      = m; \
+	params.alpha  = alpha; \
+	params.x      = x; \
+	params.incx   = incx; \
+	params.a      = a; \
+\
+	bli_l2_thread_decorator( PASTEMAC(ch,hpr_mt_thread), &params, cntx, rntm ); \
+}
+
+INSERT_GENTFUNC_BASIC0( hpr_mt )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conjx, \
+       conj_t  conjy, \
+       conj_t  conjh, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  x, inc_t incx, \
+       ctype*  y, inc_t incy, \
+       ctype*  a, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	l2mtparams_t params; \
+\
+	params.uploa  = uploa; \
+	params.conjx  = conjx; \
+	params.conjy  = conjy; \
+	params.conjh  = conjh; \
+	params.m      = m; \
+	params.alpha  = alpha; \
+	params.x      = x; \
+	params.incx   = incx; \
+	params.y      = y; \
+	params.incy   = incy; \
+	params.a      = a; \
+\
+	bli_l2_thread_decorator( PASTEMAC(ch,hpr2_mt_thread), &params, cntx, rntm ); \
+}
+
+INSERT_GENTFUNC_BASIC0( hpr2_mt )
+
@@ -87,6 +87,29 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 		); \
 		return; \
 	} \
+\
+	/* If the problem is large enough and more than one thread was
+	   requested, partition the elements of y among a team of threads. */ \
+	rntm_t rntm_l; \
+\
+	if ( bli_l2_mt_num_threads( m_y * n_x, m_y, rntm, &rntm_l ) > 1 ) \
+	{ \
+		PASTEMAC2(ch,opname,_mt) \
+		( \
+		  transa, \
+		  conjx, \
+		  m, \
+		  n, \
+		  alpha, \
+		  a, rs_a, cs_a, \
+		  x, incx, \
+		  beta, \
+		  y, incy, \
+		  cntx, \
+		  &rntm_l  \
+		); \
+		return; \
+	} \
 \
 	/* Declare a void function pointer for the current operation. */ \
 	PASTECH2(ch,ftname,_unb_ft) f; \
@@ -148,6 +171,28 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 \
 	/* Obtain a valid context from the gks if necessary. */ \
 	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If the problem is large enough and more than one thread was
+	   requested, partition A among a team of threads. */ \
+	rntm_t rntm_l; \
+\
+	if ( bli_l2_mt_num_threads( m * n, bli_max( m, n ), rntm, &rntm_l ) > 1 ) \
+	{ \
+		PASTEMAC2(ch,opname,_mt) \
+		( \
+		  conjx, \
+		  conjy, \
+		  m, \
+		  n, \
+		  alpha, \
+		  x, incx, \
+		  y, incy, \
+		  a, rs_a, cs_a, \
+		  cntx, \
+		  &rntm_l  \
+		); \
+		return; \
+	} \
 \
 	/* Declare a void function pointer for the current operation. */ \
 	PASTECH2(ch,ftname,_unb_ft) f; \
@@ -214,6 +259,30 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 		); \
 		return; \
 	} \
+\
+	/* If the problem is large enough and more than one thread was
+	   requested, partition the elements of y among a team of threads. */ \
+	rntm_t rntm_l; \
+\
+	if ( bli_l2_mt_num_threads( m * m, m, rntm, &rntm_l ) > 1 ) \
+	{ \
+		PASTEMAC(ch,hemv_mt) \
+		( \
+		  uploa, \
+		  conja, \
+		  conjx, \
+		  conjh, \
+		  m, \
+		  alpha, \
+		  a, rs_a, cs_a, \
+		  x, incx, \
+		  beta, \
+		  y, incy, \
+		  cntx, \
+		  &rntm_l  \
+		); \
+		return; \
+	} \
 \
 	/* Declare a void function pointer for the current operation. */ \
 	PASTECH2(ch,ftname,_unb_ft) f; \
@@ -474,6 +543,27 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 		); \
 		return; \
 	} \
+\
+	/* If the problem is large enough and more than one thread was
+	   requested, partition the elements of x among a team of threads. */ \
+	rntm_t rntm_l; \
+\
+	if ( bli_l2_mt_num_threads( m * m / 2, m, rntm, &rntm_l ) > 1 ) \
+	{ \
+		PASTEMAC2(ch,opname,_mt) \
+		( \
+		  uploa, \
+		  transa, \
+		  diaga, \
+		  m, \
+		  alpha, \
+		  a, rs_a, cs_a, \
+		  x, incx, \
+		  cntx, \
+		  &rntm_l  \
+		); \
+		return; \
+	} \
 \
 	/* Declare a void function pointer for the current operation. */ \
 	PASTECH2(ch,ftname,_unb_ft) f; \
@@ -509,5 +599,784 @@ INSERT_GENTFUNC_BASIC3( trmv, trmv, trmv_unf_var1, trmv_unf_var2 )
 INSERT_GENTFUNC_BASIC3( trsv, trmv, trsv_unf_var1, trsv_unf_var2 )
 
 
+//
+// Define BLAS-like interfaces for band matrices. A band matrix is stored
+// in the format used by the BLAS: element (i,j) of A is located at
+// a[ (ku+i-j)*rs_a + j*cs_a ], where for the BLAS rs_a = 1 and cs_a = lda.
+// The stored triangle of a Hermitian/symmetric or triangular band matrix
+// with k sub- or superdiagonals is stored in the same format, with kl = k
+// and ku = 0 (lower) or kl = 0 and ku = k (upper). Internally, the operations
+// are expressed in terms of the general view of bli_gbmv_var.h.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       trans_t transa, \
+       conj_t  conjx, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   kl, \
+       dim_t   ku, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	dim_t m_y, n_x; \
+\
+	/* Determine the dimensions of y and x. */ \
+	bli_set_dims_with_trans( transa, m, n, &m_y, &n_x ); \
+\
+	/* If y has zero elements, return early. */ \
+	if ( bli_zero_dim1( m_y ) ) return; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If x has zero elements, or if alpha is zero, scale y by beta and
+	   return early. */ \
+	if ( bli_zero_dim1( n_x ) || PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		PASTEMAC2(ch,scalv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m_y, \
+		  beta, \
+		  y, incy, \
+		  cntx, \
+		  NULL  \
+		); \
+		return; \
+	} \
+\
+	/* Invoke the internal back-end on the general view of A. */ \
+	PASTEMAC(ch,gbmv_int) \
+	( \
+	  transa, \
+	  conjx, \
+	  m, \
+	  n, \
+	  kl, \
+	  ku, \
+	  alpha, \
+	  a + ku*rs_a, rs_a, cs_a - rs_a, \
+	  x, incx, \
+	  beta, \
+	  y, incy, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( gbmv )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, conjh ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conja, \
+       conj_t  conjx, \
+       dim_t   m, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	ctype*  one = PASTEMAC(ch,1); \
+	ctype*  a_g; \
+	ctype*  alpha11; \
+	ctype   alpha11_c; \
+	ctype   alpha_chi1; \
+	dim_t   kl, ku, i; \
+	inc_t   cs_g; \
+\
+	/* If y has zero elements, return early. */ \
+	if ( bli_zero_dim1( m ) ) return; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If alpha is zero, scale y by beta and return early. */ \
+	if ( PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		PASTEMAC2(ch,scalv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m, \
+		  beta, \
+		  y, incy, \
+		  cntx, \
+		  NULL  \
+		); \
+		return; \
+	} \
+\
+	/* Form the general view of A and the bandwidths of the strictly
+	   lower or upper part of the stored triangle. */ \
+	if ( bli_is_lower( uploa ) ) { a_g = a;          kl = k;  ku = -1; } \
+	else                         { a_g = a + k*rs_a; kl = -1; ku = k;  } \
+\
+	cs_g = cs_a - rs_a; \
+\
+	const conj_t  conja_r  = bli_apply_conj( conjh, conja ); \
+	const trans_t transa_s = ( trans_t )conja; \
+	const trans_t transa_r = bli_is_conj( conja_r ) ? BLIS_CONJ_TRANSPOSE \
+	                                                : BLIS_TRANSPOSE; \
+\
+	/* The strictly lower and upper parts of A are applied as two band
+	   matrix-vector products: one with the stored part as-is, and one
+	   with its (conjugate-)transpose, which is read from the same
+	   storage. */ \
+\
+	/* y = beta * y + alpha * conja( S ) * conjx( x ); */ \
+	PASTEMAC(ch,gbmv_int) \
+	( \
+	  transa_s, conjx, m, m, kl, ku, \
+	  alpha, a_g, rs_a, cs_g, x, incx, \
+	  beta, y, incy, cntx, rntm  \
+	); \
+\
+	/* y = y + alpha * conja_r( S )^T * conjx( x ); */ \
+	PASTEMAC(ch,gbmv_int) \
+	( \
+	  transa_r, conjx, m, m, kl, ku, \
+	  alpha, a_g, rs_a, cs_g, x, incx, \
+	  one, y, incy, cntx, rntm  \
+	); \
+\
+	/* y = y + alpha * conja( diag( A ) ) * conjx( x ); (For hbmv, the
+	   imaginary part of each diagonal element is assumed to be zero.) */ \
+	for ( i = 0; i < m; ++i ) \
+	{ \
+		alpha11 = a_g + i*rs_a + i*cs_g; \
+\
+		PASTEMAC(ch,copycjs)( conja, *alpha11, alpha11_c ); \
+		if ( bli_is_conj( conjh ) ) PASTEMAC(ch,seti0s)( alpha11_c ); \
+\
+		PASTEMAC(ch,copycjs)( conjx, *(x + i*incx), alpha_chi1 ); \
+		PASTEMAC(ch,scals)( *alpha, alpha_chi1 ); \
+		PASTEMAC(ch,axpys)( alpha_chi1, alpha11_c, *(y + i*incy) ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC( hbmv, BLIS_CONJUGATE )
+INSERT_GENTFUNC_BASIC( sbmv, BLIS_NO_CONJUGATE )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       uplo_t  uploa, \
+       trans_t transa, \
+       diag_t  diaga, \
+       dim_t   m, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	ctype*  a_g; \
+	ctype*  beta; \
+	ctype*  w; \
+	dim_t   kl, ku, off_d; \
+\
+	/* If x has zero elements, return early. */ \
+	if ( bli_zero_dim1( m ) ) return; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If alpha is zero, set x to zero and return early. */ \
+	if ( PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		PASTEMAC2(ch,setv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m, \
+		  alpha, \
+		  x, incx, \
+		  cntx, \
+		  NULL  \
+		); \
+		return; \
+	} \
+\
+	/* If the diagonal is implicitly unit, exclude it from the general view
+	   and instead apply it by scaling the original x by alpha (beta). */ \
+	off_d = ( bli_is_unit_diag( diaga ) ? 1 : 0 ); \
+	beta  = ( bli_is_unit_diag( diaga ) ? alpha : PASTEMAC(ch,0) ); \
+\
+	if ( bli_is_lower( uploa ) ) { a_g = a;          kl = k;      ku = -off_d; } \
+	else                         { a_g = a + k*rs_a; kl = -off_d; ku = k;      } \
+\
+	/* Since x is both an input and the output, copy it to a contiguous
+	   workspace vector w. */ \
+	w = bli_malloc_intl( m * sizeof( ctype ) ); \
+\
+	PASTEMAC2(ch,copyv,BLIS_TAPI_EX_SUF) \
+	( \
+	  BLIS_NO_CONJUGATE, \
+	  m, \
+	  x, incx, \
+	  w, 1, \
+	  cntx, \
+	  NULL  \
+	); \
+\
+	/* x = beta * x + alpha * transa( A ) * w; */ \
+	PASTEMAC(ch,gbmv_int) \
+	( \
+	  transa, \
+	  BLIS_NO_CONJUGATE, \
+	  m, \
+	  m, \
+	  kl, \
+	  ku, \
+	  alpha, \
+	  a_g, rs_a, cs_a - rs_a, \
+	  w, 1, \
+	  beta, \
+	  x, incx, \
+	  cntx, \
+	  rntm  \
+	); \
+\
+	bli_free_intl( w ); \
+}
+
+INSERT_GENTFUNC_BASIC0( tbmv )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       uplo_t  uploa, \
+       trans_t transa, \
+       diag_t  diaga, \
+       dim_t   m, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	/* If x has zero elements, return early. */ \
+	if ( bli_zero_dim1( m ) ) return; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If alpha is zero, set x to zero and return early. */ \
+	if ( PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		PASTEMAC2(ch,setv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m, \
+		  alpha, \
+		  x, incx, \
+		  cntx, \
+		  NULL  \
+		); \
+		return; \
+	} \
+\
+	/* Invoke the variant on the general view of A. */ \
+	PASTEMAC(ch,tbsv_unf_var1) \
+	( \
+	  uploa, \
+	  transa, \
+	  diaga, \
+	  m, \
+	  k, \
+	  alpha, \
+	  ( bli_is_lower( uploa ) ? a : a + k*rs_a ), rs_a, cs_a - rs_a, \
+	  x, incx, \
+	  cntx  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( tbsv )
+
+
+//
+// Define BLAS-like interfaces for packed matrices. The stored triangle of A
+// is packed by columns, as in the BLAS (see bli_packed_offset()).
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, conjh ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conja, \
+       conj_t  conjx, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If x has zero elements, or if alpha is zero, scale y by beta and
+	   return early. */ \
+	if ( bli_zero_dim1( m ) || PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		PASTEMAC2(ch,scalv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m, \
+		  beta, \
+		  y, incy, \
+		  cntx, \
+		  NULL  \
+		); \
+		return; \
+	} \
+\
+	/* If the problem is large enough and more than one thread was
+	   requested, partition the elements of y among a team of threads. */ \
+	rntm_t rntm_l; \
+\
+	if ( bli_l2_mt_num_threads( m * m / 2, m, rntm, &rntm_l ) > 1 ) \
+	{ \
+		PASTEMAC(ch,hpmv_mt) \
+		( \
+		  uploa, \
+		  conja, \
+		  conjx, \
+		  conjh, \
+		  m, \
+		  alpha, \
+		  a, \
+		  x, incx, \
+		  beta, \
+		  y, incy, \
+		  cntx, \
+		  &rntm_l  \
+		); \
+		return; \
+	} \
+\
+	PASTEMAC(ch,hpmv_unf_var1) \
+	( \
+	  uploa, \
+	  conja, \
+	  conjx, \
+	  conjh, /* used by the variant to distinguish hpmv from spmv */ \
+	  m, \
+	  alpha, \
+	  a, \
+	  x, incx, \
+	  beta, \
+	  y, incy, \
+	  0, m, \
+	  cntx  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( hpmv, BLIS_CONJUGATE )
+INSERT_GENTFUNC_BASIC( spmv, BLIS_NO_CONJUGATE )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       uplo_t  uploa, \
+       trans_t transa, \
+       diag_t  diaga, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  a, \
+       ctype*  x, inc_t incx  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	ctype* w; \
+\
+	/* If x has zero elements, return early. */ \
+	if ( bli_zero_dim1( m ) ) return; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If alpha is zero, set x to zero and return early. */ \
+	if ( PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		PASTEMAC2(ch,setv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m, \
+		  alpha, \
+		  x, incx, \
+		  cntx, \
+		  NULL  \
+		); \
+		return; \
+	} \
+\
+	/* If the problem is large enough and more than one thread was
+	   requested, partition the elements of x among a team of threads. */ \
+	rntm_t rntm_l; \
+\
+	if ( bli_l2_mt_num_threads( m * m / 2, m, rntm, &rntm_l ) > 1 ) \
+	{ \
+		PASTEMAC(ch,tpmv_mt) \
+		( \
+		  uploa, \
+		  transa, \
+		  diaga, \
+		  m, \
+		  alpha, \
+		  a, \
+		  x, incx, \
+		  cntx, \
+		  &rntm_l  \
+		); \
+		return; \
+	} \
+\
+	/* Since x is both an input and the output, copy it to a contiguous
+	   workspace vector w. */ \
+	w = bli_malloc_intl( m * sizeof( ctype ) ); \
+\
+	PASTEMAC2(ch,copyv,BLIS_TAPI_EX_SUF) \
+	( \
+	  BLIS_NO_CONJUGATE, \
+	  m, \
+	  x, incx, \
+	  w, 1, \
+	  cntx, \
+	  NULL  \
+	); \
+\
+	PASTEMAC(ch,tpmv_unf_var1) \
+	( \
+	  uploa, \
+	  transa, \
+	  diaga, \
+	  m, \
+	  alpha, \
+	  a, \
+	  w, \
+	  x, incx, \
+	  0, m, \
+	  cntx  \
+	); \
+\
+	bli_free_intl( w ); \
+}
+
+INSERT_GENTFUNC_BASIC0( tpmv )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       uplo_t  uploa, \
+       trans_t transa, \
+       diag_t  diaga, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  a, \
+       ctype*  x, inc_t incx  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	/* If x has zero elements, return early. */ \
+	if ( bli_zero_dim1( m ) ) return; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If alpha is zero, set x to zero and return early. */ \
+	if ( PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		PASTEMAC2(ch,setv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m, \
+		  alpha, \
+		  x, incx, \
+		  cntx, \
+		  NULL  \
+		); \
+		return; \
+	} \
+\
+	PASTEMAC(ch,tpsv_unf_var1) \
+	( \
+	  uploa, \
+	  transa, \
+	  diaga, \
+	  m, \
+	  alpha, \
+	  a, \
+	  x, incx, \
+	  cntx  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( tpsv )
+
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, conjh ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       uplo_t   uploa, \
+       conj_t   conjx, \
+       dim_t    m, \
+       ctype_r* alpha, \
+       ctype*   x, inc_t incx, \
+       ctype*   a  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	ctype alpha_local; \
+\
+	/* If x has zero elements, or if alpha is zero, return early. */ \
+	if ( bli_zero_dim1( m ) || PASTEMAC(chr,eq0)( *alpha ) ) return; \
+\
+	/* Make a local copy of alpha, cast into the complex domain. This
+	   allows us to use the same underlying hpr variant to implement
+	   both hpr and spr operations. */ \
+	PASTEMAC2(chr,ch,copys)( *alpha, alpha_local ); \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If the problem is large enough and more than one thread was
+	   requested, partition the columns of A among a team of threads. */ \
+	rntm_t rntm_l; \
+\
+	if ( bli_l2_mt_num_threads( m * m / 2, m, rntm, &rntm_l ) > 1 ) \
+	{ \
+		PASTEMAC(ch,hpr_mt) \
+		( \
+		  uploa, \
+		  conjx, \
+		  conjh, \
+		  m, \
+		  &alpha_local, \
+		  x, incx, \
+		  a, \
+		  cntx, \
+		  &rntm_l  \
+		); \
+		return; \
+	} \
+\
+	PASTEMAC(ch,hpr_unf_var1) \
+	( \
+	  uploa, \
+	  conjx, \
+	  conjh, /* used by the variant to distinguish hpr from spr */ \
+	  m, \
+	  &alpha_local, \
+	  x, incx, \
+	  a, \
+	  0, m, \
+	  cntx  \
+	); \
+}
+
+INSERT_GENTFUNCR_BASIC( hpr, BLIS_CONJUGATE )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, conjh ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       uplo_t   uploa, \
+       conj_t   conjx, \
+       dim_t    m, \
+       ctype*   alpha, \
+       ctype*   x, inc_t incx, \
+       ctype*   a  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	/* If x has zero elements, or if alpha is zero, return early. */ \
+	if ( bli_zero_dim1( m ) || PASTEMAC(ch,eq0)( *alpha ) ) return; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If the problem is large enough and more than one thread was
+	   requested, partition the columns of A among a team of threads. */ \
+	rntm_t rntm_l; \
+\
+	if ( bli_l2_mt_num_threads( m * m / 2, m, rntm, &rntm_l ) > 1 ) \
+	{ \
+		PASTEMAC(ch,hpr_mt) \
+		( \
+		  uploa, \
+		  conjx, \
+		  conjh, \
+		  m, \
+		  alpha, \
+		  x, incx, \
+		  a, \
+		  cntx, \
+		  &rntm_l  \
+		); \
+		return; \
+	} \
+\
+	PASTEMAC(ch,hpr_unf_var1) \
+	( \
+	  uploa, \
+	  conjx, \
+	  conjh, /* used by the variant to distinguish hpr from spr */ \
+	  m, \
+	  alpha, \
+	  x, incx, \
+	  a, \
+	  0, m, \
+	  cntx  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( spr, BLIS_NO_CONJUGATE )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, conjh ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conjx, \
+       conj_t  conjy, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  x, inc_t incx, \
+       ctype*  y, inc_t incy, \
+       ctype*  a  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	/* If x has zero elements, or if alpha is zero, return early. */ \
+	if ( bli_zero_dim1( m ) || PASTEMAC(ch,eq0)( *alpha ) ) return; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If the problem is large enough and more than one thread was
+	   requested, partition the columns of A among a team of threads. */ \
+	rntm_t rntm_l; \
+\
+	if ( bli_l2_mt_num_threads( m * m / 2, m, rntm, &rntm_l ) > 1 ) \
+	{ \
+		PASTEMAC(ch,hpr2_mt) \
+		( \
+		  uploa, \
+		  conjx, \
+		  conjy, \
+		  conjh, \
+		  m, \
+		  alpha, \
+		  x, incx, \
+		  y, incy, \
+		  a, \
+		  cntx, \
+		  &rntm_l  \
+		); \
+		return; \
+	} \
+\
+	PASTEMAC(ch,hpr2_unf_var1) \
+	( \
+	  uploa, \
+	  conjx, \
+	  conjy, \
+	  conjh, /* used by the variant to distinguish hpr2 from spr2 */ \
+	  m, \
+	  alpha, \
+	  x, incx, \
+	  y, incy, \
+	  a, \
+	  0, m, \
+	  cntx  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( hpr2, BLIS_CONJUGATE )
+INSERT_GENTFUNC_BASIC( spr2, BLIS_NO_CONJUGATE )
+
+
 #endif
 
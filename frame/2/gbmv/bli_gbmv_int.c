@@ -0,0 +1,127 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, rvarname, cvarname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       conj_t  conjx, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   kl, \
+       dim_t   ku, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	dim_t m_y, n_x; \
+\
+	/* Determine the dimensions of y and x. */ \
+	bli_set_dims_with_trans( transa, m, n, &m_y, &n_x ); \
+\
+	/* The number of elements within the band (up to the ragged corners)
+	   serves as the measure of the work. */ \
+	const dim_t n_band = bli_min( m, n ) * bli_max( 0, kl + ku + 1 ); \
+\
+	/* If the problem is large enough and more than one thread was
+	   requested, partition the elements of y among a team of threads. */ \
+	rntm_t rntm_l; \
+\
+	if ( bli_l2_mt_num_threads( n_band, m_y, rntm, &rntm_l ) > 1 ) \
+	{ \
+		PASTEMAC(ch,gbmv_mt) \
+		( \
+		  transa, \
+		  conjx, \
+		  m, \
+		  n, \
+		  kl, \
+		  ku, \
+		  alpha, \
+		  a, rs_a, cs_a, \
+		  x, incx, \
+		  beta, \
+		  y, incy, \
+		  cntx, \
+		  &rntm_l  \
+		); \
+		return; \
+	} \
+\
+	/* Declare a void function pointer for the current operation. */ \
+	PASTECH2(ch,gbmv,_unb_ft) f; \
+\
+	/* Choose the underlying implementation. */ \
+	if ( bli_does_notrans( transa ) ) \
+	{ \
+		if ( bli_is_row_stored( rs_a, cs_a ) ) f = PASTEMAC(ch,rvarname); \
+		else /* column or general stored */    f = PASTEMAC(ch,cvarname); \
+	} \
+	else /* if ( bli_does_trans( transa ) ) */ \
+	{ \
+		if ( bli_is_row_stored( rs_a, cs_a ) ) f = PASTEMAC(ch,cvarname); \
+		else /* column or general stored */    f = PASTEMAC(ch,rvarname); \
+	} \
+\
+	/* Invoke the variant chosen above, which loops over a level-1f kernel
+	   to implement the current operation. */ \
+	f \
+	( \
+	  transa, \
+	  conjx, \
+	  m, \
+	  n, \
+	  kl, \
+	  ku, \
+	  alpha, \
+	  a, rs_a, cs_a, \
+	  x, incx, \
+	  beta, \
+	  y, incy, \
+	  cntx  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC2( gbmv_int, gbmv_unf_var1, gbmv_unf_var2 )
+
@@ -0,0 +1,197 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       trans_t transa, \
+       conj_t  conjx, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   kl, \
+       dim_t   ku, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	ctype*  zero       = PASTEMAC(ch,0); \
+	ctype*  one        = PASTEMAC(ch,1); \
+	ctype*  A1; \
+	ctype*  x1; \
+	ctype*  y1; \
+	ctype   alpha_ij; \
+	ctype   chi; \
+	ctype   rho; \
+	dim_t   i, j, l, s; \
+	dim_t   b_fuse, f; \
+	dim_t   n_elem, n_iter; \
+	dim_t   kl_t, ku_t; \
+	dim_t   i_start, i_stop; \
+	dim_t   j_beg, j_end; \
+	inc_t   rs_at, cs_at; \
+	conj_t  conja; \
+\
+	bli_set_dims_incs_with_trans( transa, \
+	                              m, n, rs_a, cs_a, \
+	                              &n_elem, &n_iter, &rs_at, &cs_at ); \
+\
+	/* Transposing A also swaps the roles of the sub- and superdiagonals. */ \
+	if ( bli_does_notrans( transa ) ) { kl_t = kl; ku_t = ku; } \
+	else                              { kl_t = ku; ku_t = kl; } \
+\
+	conja = bli_extract_conj( transa ); \
+\
+	/* If beta is zero, use setv. Otherwise, scale by beta. */ \
+	if ( PASTEMAC(ch,eq0)( *beta ) ) \
+	{ \
+		/* y = 0; */ \
+		PASTEMAC2(ch,setv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  n_elem, \
+		  zero, \
+		  y, incy, \
+		  cntx, \
+		  NULL  \
+		); \
+	} \
+	else \
+	{ \
+		/* y = beta * y; */ \
+		PASTEMAC2(ch,scalv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  n_elem, \
+		  beta, \
+		  y, incy, \
+		  cntx, \
+		  NULL  \
+		); \
+	} \
+\
+	/* If the band is empty, we are done. */ \
+	if ( kl_t + ku_t < 0 ) return; \
+\
+	PASTECH(ch,dotxf_ker_ft) kfp_df; \
+\
+	/* Query the context for the kernel function pointer and fusing factor. */ \
+	kfp_df = bli_cntx_get_l1f_ker_dt( dt, BLIS_DOTXF_KER, cntx ); \
+	b_fuse = bli_cntx_get_blksz_def_dt( dt, BLIS_DF, cntx ); \
+\
+	/* Only the rows of transa( A ) in [i_start,i_stop) intersect the band;
+	   the remaining elements of y are only scaled by beta. */ \
+	i_start = bli_max( 0, -ku_t ); \
+	i_stop  = bli_min( n_elem, n_iter + kl_t ); \
+\
+	for ( i = i_start; i < i_stop; i += f ) \
+	{ \
+		f     = bli_determine_blocksize_dim_f( i, i_stop, b_fuse ); \
+\
+		/* Identify the columns in which all f rows of the current block
+		   lie within the band. */ \
+		j_beg = bli_max( 0, i + f - 1 - kl_t ); \
+		j_end = bli_min( n_iter, i + ku_t + 1 ); \
+\
+		if ( j_beg < j_end ) \
+		{ \
+			A1 = a + (i  )*rs_at + (j_beg)*cs_at; \
+			x1 = x + (j_beg)*incx; \
+			y1 = y + (i  )*incy; \
+\
+			/* y1 = y1 + alpha * A1 * x1; */ \
+			kfp_df \
+			( \
+			  conja, \
+			  conjx, \
+			  j_end - j_beg, \
+			  f, \
+			  alpha, \
+			  A1, cs_at, rs_at, \
+			  x1, incx, \
+			  one, \
+			  y1, incy, \
+			  cntx  \
+			); \
+		} \
+		else \
+		{ \
+			/* The rows have no columns in common, so each row is handled
+			   in its entirety below. */ \
+			j_beg = j_end = n_iter; \
+		} \
+\
+		/* Update y with the elements at the ragged left and right edges of
+		   the current block of rows, which were not included above. */ \
+		for ( l = 0; l < f; ++l ) \
+		{ \
+			const dim_t j_lo = bli_max( 0, i + l - kl_t ); \
+			const dim_t j_hi = bli_min( n_iter, i + l + ku_t + 1 ); \
+			const dim_t j_b  = bli_min( j_beg, j_hi ); \
+			const dim_t j_e  = bli_max( j_end, j_b ); \
+			const dim_t seg_beg[ 2 ] = { j_lo, j_e  }; \
+			const dim_t seg_end[ 2 ] = { j_b,  j_hi }; \
+\
+			ctype* restrict a1 = a + (i+l)*rs_at; \
+\
+			PASTEMAC(ch,set0s)( rho ); \
+\
+			for ( s = 0; s < 2; ++s ) \
+			{ \
+				for ( j = seg_beg[ s ]; j < seg_end[ s ]; ++j ) \
+				{ \
+					PASTEMAC(ch,copycjs)( conja, *(a1 + j*cs_at), alpha_ij ); \
+					PASTEMAC(ch,copycjs)( conjx, *(x  + j*incx ), chi ); \
+					PASTEMAC(ch,dots)( alpha_ij, chi, rho ); \
+				} \
+			} \
+\
+			/* psi1 = psi1 + alpha * rho; */ \
+			PASTEMAC(ch,axpys)( *alpha, rho, *(y + (i+l)*incy) ); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( gbmv_unf_var1 )
+
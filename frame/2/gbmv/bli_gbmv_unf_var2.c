@@ -0,0 +1,197 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       trans_t transa, \
+       conj_t  conjx, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   kl, \
+       dim_t   ku, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	ctype*  zero       = PASTEMAC(ch,0); \
+	ctype*  A1; \
+	ctype*  x1; \
+	ctype*  y1; \
+	ctype   chi; \
+	ctype   alpha_chi; \
+	dim_t   i, j, l, s; \
+	dim_t   b_fuse, f; \
+	dim_t   n_elem, n_iter; \
+	dim_t   kl_t, ku_t; \
+	dim_t   j_start, j_stop; \
+	dim_t   i_beg, i_end; \
+	inc_t   rs_at, cs_at; \
+	conj_t  conja; \
+\
+	bli_set_dims_incs_with_trans( transa, \
+	                              m, n, rs_a, cs_a, \
+	                              &n_elem, &n_iter, &rs_at, &cs_at ); \
+\
+	/* Transposing A also swaps the roles of the sub- and superdiagonals. */ \
+	if ( bli_does_notrans( transa ) ) { kl_t = kl; ku_t = ku; } \
+	else                              { kl_t = ku; ku_t = kl; } \
+\
+	conja = bli_extract_conj( transa ); \
+\
+	/* If beta is zero, use setv. Otherwise, scale by beta. */ \
+	if ( PASTEMAC(ch,eq0)( *beta ) ) \
+	{ \
+		/* y = 0; */ \
+		PASTEMAC2(ch,setv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  n_elem, \
+		  zero, \
+		  y, incy, \
+		  cntx, \
+		  NULL  \
+		); \
+	} \
+	else \
+	{ \
+		/* y = beta * y; */ \
+		PASTEMAC2(ch,scalv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  n_elem, \
+		  beta, \
+		  y, incy, \
+		  cntx, \
+		  NULL  \
+		); \
+	} \
+\
+	/* If the band is empty, we are done. */ \
+	if ( kl_t + ku_t < 0 ) return; \
+\
+	PASTECH(ch,axpyf_ker_ft) kfp_af; \
+\
+	/* Query the context for the kernel function pointer and fusing factor. */ \
+	kfp_af = bli_cntx_get_l1f_ker_dt( dt, BLIS_AXPYF_KER, cntx ); \
+	b_fuse = bli_cntx_get_blksz_def_dt( dt, BLIS_AF, cntx ); \
+\
+	/* Only the columns of transa( A ) in [j_start,j_stop) intersect the
+	   band. */ \
+	j_start = bli_max( 0, -kl_t ); \
+	j_stop  = bli_min( n_iter, n_elem + ku_t ); \
+\
+	for ( j = j_start; j < j_stop; j += f ) \
+	{ \
+		f     = bli_determine_blocksize_dim_f( j, j_stop, b_fuse ); \
+\
+		/* Identify the rows in which all f columns of the current block
+		   lie within the band. */ \
+		i_beg = bli_max( 0, j + f - 1 - ku_t ); \
+		i_end = bli_min( n_elem, j + kl_t + 1 ); \
+\
+		if ( i_beg < i_end ) \
+		{ \
+			A1 = a + (i_beg)*rs_at + (j  )*cs_at; \
+			x1 = x + (j  )*incx; \
+			y1 = y + (i_beg)*incy; \
+\
+			/* y1 = y1 + alpha * A1 * x1; */ \
+			kfp_af \
+			( \
+			  conja, \
+			  conjx, \
+			  i_end - i_beg, \
+			  f, \
+			  alpha, \
+			  A1, rs_at, cs_at, \
+			  x1, incx, \
+			  y1, incy, \
+			  cntx  \
+			); \
+		} \
+		else \
+		{ \
+			/* The columns have no rows in common, so each column is
+			   handled in its entirety below. */ \
+			i_beg = i_end = n_elem; \
+		} \
+\
+		/* Update y with the elements at the ragged top and bottom edges of
+		   the current block of columns, which were not included above. */ \
+		for ( l = 0; l < f; ++l ) \
+		{ \
+			const dim_t i_lo = bli_max( 0, j + l - ku_t ); \
+			const dim_t i_hi = bli_min( n_elem, j + l + kl_t + 1 ); \
+			const dim_t i_b  = bli_min( i_beg, i_hi ); \
+			const dim_t i_e  = bli_max( i_end, i_b ); \
+			const dim_t seg_beg[ 2 ] = { i_lo, i_e  }; \
+			const dim_t seg_end[ 2 ] = { i_b,  i_hi }; \
+\
+			ctype* restrict a1 = a + (j+l)*cs_at; \
+\
+			/* alpha_chi = alpha * conjx( chi1 ); */ \
+			PASTEMAC(ch,copycjs)( conjx, *(x + (j+l)*incx), chi ); \
+			PASTEMAC(ch,scal2s)( *alpha, chi, alpha_chi ); \
+\
+			for ( s = 0; s < 2; ++s ) \
+			{ \
+				if ( bli_is_conj( conja ) ) \
+				{ \
+					for ( i = seg_beg[ s ]; i < seg_end[ s ]; ++i ) \
+						PASTEMAC(ch,axpyjs)( alpha_chi, *(a1 + i*rs_at), *(y + i*incy) ); \
+				} \
+				else \
+				{ \
+					for ( i = seg_beg[ s ]; i < seg_end[ s ]; ++i ) \
+						PASTEMAC(ch,axpys)( alpha_chi, *(a1 + i*rs_at), *(y + i*incy) ); \
+				} \
+			} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( gbmv_unf_var2 )
+
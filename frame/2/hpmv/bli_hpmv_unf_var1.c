@@ -0,0 +1,263 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conja, \
+       conj_t  conjx, \
+       conj_t  conjh, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy, \
+       dim_t   i_start, \
+       dim_t   i_end, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	ctype*  zero       = PASTEMAC(ch,0); \
+	ctype*  one        = PASTEMAC(ch,1); \
+	ctype*  a1; \
+	ctype*  alpha11; \
+	ctype*  x1; \
+	ctype*  y1; \
+	ctype   alpha11_c; \
+	ctype   chi1; \
+	ctype   alpha_chi1; \
+	ctype   rho; \
+	dim_t   j; \
+	dim_t   m1, n_behind, n_ahead; \
+	conj_t  conjat; \
+\
+	/* The elements of the unstored triangle are read as the (conjugated,
+	   in the case of hpmv) transposes of the stored elements. */ \
+	conjat = bli_apply_conj( conjh, conja ); \
+\
+	m1 = i_end - i_start; \
+	y1 = y + i_start*incy; \
+\
+	/* If beta is zero, use setv. Otherwise, scale by beta. */ \
+	if ( PASTEMAC(ch,eq0)( *beta ) ) \
+	{ \
+		/* y1 = 0; */ \
+		PASTEMAC2(ch,setv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m1, \
+		  zero, \
+		  y1, incy, \
+		  cntx, \
+		  NULL  \
+		); \
+	} \
+	else \
+	{ \
+		/* y1 = beta * y1; */ \
+		PASTEMAC2(ch,scalv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m1, \
+		  beta, \
+		  y1, incy, \
+		  cntx, \
+		  NULL  \
+		); \
+	} \
+\
+	PASTECH(ch,axpyv_ker_ft)    kfp_av; \
+	PASTECH(ch,dotxv_ker_ft)    kfp_dv; \
+	PASTECH(ch,dotaxpyv_ker_ft) kfp_dav; \
+\
+	/* Query the context for the kernel function pointers. */ \
+	kfp_av  = bli_cntx_get_l1v_ker_dt( dt, BLIS_AXPYV_KER, cntx ); \
+	kfp_dv  = bli_cntx_get_l1v_ker_dt( dt, BLIS_DOTXV_KER, cntx ); \
+	kfp_dav = bli_cntx_get_l1f_ker_dt( dt, BLIS_DOTAXPYV_KER, cntx ); \
+\
+	/* Each column j of the stored triangle contributes to y in two ways:
+	   its elements within [i_start,i_end) are accumulated into the
+	   corresponding elements of y (axpyv), and, if j is itself within
+	   [i_start,i_end), its off-diagonal elements are reduced against x to
+	   form the contribution of the unstored triangle to psi_j (dotxv).
+	   Where the two overlap, both are computed in one pass (dotaxpyv). */ \
+	if ( bli_is_lower( uploa ) ) \
+	{ \
+		/* Columns to the left of the current rows only contribute via
+		   their stored elements. */ \
+		for ( j = 0; j < i_start; ++j ) \
+		{ \
+			a1 = a + bli_packed_offset( uploa, m, i_start, j ); \
+\
+			/* y1 = y1 + alpha * conjx( chi1 ) * conja( a1 ); */ \
+			PASTEMAC(ch,copycjs)( conjx, *(x + j*incx), chi1 ); \
+			PASTEMAC(ch,scal2s)( *alpha, chi1, alpha_chi1 ); \
+			kfp_av( conja, m1, &alpha_chi1, a1, 1, y1, incy, cntx ); \
+		} \
+\
+		for ( j = i_start; j < i_end; ++j ) \
+		{ \
+			alpha11  = a + bli_packed_offset( uploa, m, j, j ); \
+			n_ahead  = i_end - j - 1; \
+			n_behind = m - i_end; \
+\
+			PASTEMAC(ch,copycjs)( conjx, *(x + j*incx), chi1 ); \
+			PASTEMAC(ch,scal2s)( *alpha, chi1, alpha_chi1 ); \
+\
+			/* psi1 = psi1 + alpha * alpha11 * conjx( chi1 ); (For hpmv, the
+			   imaginary part of the diagonal element is assumed to be zero.) */ \
+			PASTEMAC(ch,copycjs)( conja, *alpha11, alpha11_c ); \
+			if ( bli_is_conj( conjh ) ) PASTEMAC(ch,seti0s)( alpha11_c ); \
+			PASTEMAC(ch,axpys)( alpha_chi1, alpha11_c, *(y + j*incy) ); \
+\
+			/* rho = conjat( a21 )^T * conjx( x2 );
+			   y2 = y2 + alpha * conjx( chi1 ) * conja( a21 ); */ \
+			if ( 0 < n_ahead ) \
+			kfp_dav \
+			( \
+			  conjat, \
+			  conja, \
+			  conjx, \
+			  n_ahead, \
+			  &alpha_chi1, \
+			  alpha11 + 1, 1, \
+			  x + (j+1)*incx, incx, \
+			  &rho, \
+			  y + (j+1)*incy, incy, \
+			  cntx  \
+			); \
+			else PASTEMAC(ch,set0s)( rho ); \
+\
+			/* psi1 = psi1 + alpha * rho; */ \
+			PASTEMAC(ch,axpys)( *alpha, rho, *(y + j*incy) ); \
+\
+			/* psi1 = psi1 + alpha * conjat( a31 )^T * conjx( x3 ); */ \
+			if ( 0 < n_behind ) \
+			kfp_dv \
+			( \
+			  conjat, \
+			  conjx, \
+			  n_behind, \
+			  alpha, \
+			  alpha11 + 1 + n_ahead, 1, \
+			  x + (i_end)*incx, incx, \
+			  one, \
+			  y + j*incy, \
+			  cntx  \
+			); \
+		} \
+	} \
+	else /* if ( bli_is_upper( uploa ) ) */ \
+	{ \
+		/* Columns to the right of the current rows only contribute via
+		   their stored elements. */ \
+		for ( j = i_end; j < m; ++j ) \
+		{ \
+			a1 = a + bli_packed_offset( uploa, m, i_start, j ); \
+\
+			/* y1 = y1 + alpha * conjx( chi1 ) * conja( a1 ); */ \
+			PASTEMAC(ch,copycjs)( conjx, *(x + j*incx), chi1 ); \
+			PASTEMAC(ch,scal2s)( *alpha, chi1, alpha_chi1 ); \
+			kfp_av( conja, m1, &alpha_chi1, a1, 1, y1, incy, cntx ); \
+		} \
+\
+		for ( j = i_start; j < i_end; ++j ) \
+		{ \
+			a1       = a + bli_packed_offset( uploa, m, 0, j ); \
+			alpha11  = a1 + j; \
+			n_ahead  = j - i_start; \
+			n_behind = i_start; \
+			x1       = x + (i_start)*incx; \
+\
+			PASTEMAC(ch,copycjs)( conjx, *(x + j*incx), chi1 ); \
+			PASTEMAC(ch,scal2s)( *alpha, chi1, alpha_chi1 ); \
+\
+			/* psi1 = psi1 + alpha * alpha11 * conjx( chi1 ); (For hpmv, the
+			   imaginary part of the diagonal element is assumed to be zero.) */ \
+			PASTEMAC(ch,copycjs)( conja, *alpha11, alpha11_c ); \
+			if ( bli_is_conj( conjh ) ) PASTEMAC(ch,seti0s)( alpha11_c ); \
+			PASTEMAC(ch,axpys)( alpha_chi1, alpha11_c, *(y + j*incy) ); \
+\
+			/* rho = conjat( a01 )^T * conjx( x0 );
+			   y0 = y0 + alpha * conjx( chi1 ) * conja( a01 ); (within the
+			   current rows) */ \
+			if ( 0 < n_ahead ) \
+			kfp_dav \
+			( \
+			  conjat, \
+			  conja, \
+			  conjx, \
+			  n_ahead, \
+			  &alpha_chi1, \
+			  a1 + i_start, 1, \
+			  x1, incx, \
+			  &rho, \
+			  y1, incy, \
+			  cntx  \
+			); \
+			else PASTEMAC(ch,set0s)( rho ); \
+\
+			/* psi1 = psi1 + alpha * rho; */ \
+			PASTEMAC(ch,axpys)( *alpha, rho, *(y + j*incy) ); \
+\
+			/* psi1 = psi1 + alpha * conjat( a01 )^T * conjx( x0 ); (above
+			   the current rows) */ \
+			if ( 0 < n_behind ) \
+			kfp_dv \
+			( \
+			  conjat, \
+			  conjx, \
+			  n_behind, \
+			  alpha, \
+			  a1, 1, \
+			  x, incx, \
+			  one, \
+			  y + j*incy, \
+			  cntx  \
+			); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( hpmv_unf_var1 )
+
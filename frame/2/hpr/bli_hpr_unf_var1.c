@@ -0,0 +1,99 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conjx, \
+       conj_t  conjh, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  x, inc_t incx, \
+       ctype*  a, \
+       dim_t   j_start, \
+       dim_t   j_end, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	ctype*  a1; \
+	ctype*  x1; \
+	ctype   chi1; \
+	ctype   alpha_chi1; \
+	dim_t   j; \
+	dim_t   i0, n_a; \
+	conj_t  conj0; \
+\
+	/* Eliminate unused variable warnings. */ \
+	( void )conj0; \
+\
+	/* The row vector x^T is conjugated for hpr (x^H), in addition to any
+	   conjugation requested via conjx. */ \
+	conj0 = bli_apply_conj( conjh, conjx ); \
+\
+	PASTECH(ch,axpyv_ker_ft) kfp_av; \
+\
+	/* Query the context for the kernel function pointer. */ \
+	kfp_av = bli_cntx_get_l1v_ker_dt( dt, BLIS_AXPYV_KER, cntx ); \
+\
+	for ( j = j_start; j < j_end; ++j ) \
+	{ \
+		/* Column j of the lower triangle spans rows [j,m); column j of the
+		   upper triangle spans rows [0,j]. */ \
+		i0  = ( bli_is_lower( uploa ) ? j     : 0     ); \
+		n_a = ( bli_is_lower( uploa ) ? m - j : j + 1 ); \
+		a1  = a + bli_packed_offset( uploa, m, i0, j ); \
+		x1  = x + i0*incx; \
+\
+		/* a1 = a1 + alpha * conj0( chi1 ) * conjx( x1 ); */ \
+		PASTEMAC(ch,copycjs)( conj0, *(x + j*incx), chi1 ); \
+		PASTEMAC(ch,scal2s)( *alpha, chi1, alpha_chi1 ); \
+		kfp_av( conjx, n_a, &alpha_chi1, x1, incx, a1, 1, cntx ); \
+\
+		/* For hpr, explicitly set the imaginary component of the diagonal
+		   element to zero. */ \
+		if ( bli_is_conj( conjh ) ) \
+			PASTEMAC(ch,seti0s)( *(a + bli_packed_offset( uploa, m, j, j )) ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( hpr_unf_var1 )
+
@@ -0,0 +1,127 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conjx, \
+       conj_t  conjy, \
+       conj_t  conjh, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  x, inc_t incx, \
+       ctype*  y, inc_t incy, \
+       ctype*  a, \
+       dim_t   j_start, \
+       dim_t   j_end, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	ctype*  a1; \
+	ctype*  x1; \
+	ctype*  y1; \
+	ctype   alpha0; \
+	ctype   alpha1; \
+	ctype   chi1; \
+	ctype   psi1; \
+	ctype   alpha0_psi1; \
+	ctype   alpha1_chi1; \
+	dim_t   j; \
+	dim_t   i0, n_a; \
+	conj_t  conj0, conj1; \
+\
+	/* Eliminate unused variable warnings. */ \
+	( void )conj0; \
+	( void )conj1; \
+\
+	/* The update is alpha * x * y^H + conj( alpha ) * y * x^H for hpr2 and
+	   alpha * x * y^T + alpha * y * x^T for spr2. */ \
+	conj0 = bli_apply_conj( conjh, conjy ); \
+	conj1 = bli_apply_conj( conjh, conjx ); \
+\
+	PASTEMAC(ch,copys)( *alpha, alpha0 ); \
+	PASTEMAC(ch,copycjs)( conjh, *alpha, alpha1 ); \
+\
+	PASTECH(ch,axpy2v_ker_ft) kfp_2v; \
+\
+	/* Query the context for the kernel function pointer. */ \
+	kfp_2v = bli_cntx_get_l1f_ker_dt( dt, BLIS_AXPY2V_KER, cntx ); \
+\
+	for ( j = j_start; j < j_end; ++j ) \
+	{ \
+		/* Column j of the lower triangle spans rows [j,m); column j of the
+		   upper triangle spans rows [0,j]. */ \
+		i0  = ( bli_is_lower( uploa ) ? j     : 0     ); \
+		n_a = ( bli_is_lower( uploa ) ? m - j : j + 1 ); \
+		a1  = a + bli_packed_offset( uploa, m, i0, j ); \
+		x1  = x + i0*incx; \
+		y1  = y + i0*incy; \
+\
+		PASTEMAC(ch,copycjs)( conj0, *(y + j*incy), psi1 ); \
+		PASTEMAC(ch,copycjs)( conj1, *(x + j*incx), chi1 ); \
+		PASTEMAC(ch,scal2s)( alpha0, psi1, alpha0_psi1 ); \
+		PASTEMAC(ch,scal2s)( alpha1, chi1, alpha1_chi1 ); \
+\
+		/* a1 = a1 + alpha0 * conj0( psi1 ) * conjx( x1 )
+		           + alpha1 * conj1( chi1 ) * conjy( y1 ); */ \
+		kfp_2v \
+		( \
+		  conjx, \
+		  conjy, \
+		  n_a, \
+		  &alpha0_psi1, \
+		  &alpha1_chi1, \
+		  x1, incx, \
+		  y1, incy, \
+		  a1, 1, \
+		  cntx  \
+		); \
+\
+		/* For hpr2, explicitly set the imaginary component of the diagonal
+		   element to zero. */ \
+		if ( bli_is_conj( conjh ) ) \
+			PASTEMAC(ch,seti0s)( *(a + bli_packed_offset( uploa, m, j, j )) ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( hpr2_unf_var1 )
+
@@ -0,0 +1,246 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       uplo_t  uploa, \
+       trans_t transa, \
+       diag_t  diaga, \
+       dim_t   m, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	ctype*  one        = PASTEMAC(ch,1); \
+	ctype*  minus_one  = PASTEMAC(ch,m1); \
+	ctype*  A01; \
+	ctype*  A11; \
+	ctype*  A21; \
+	ctype*  alpha11; \
+	ctype*  x0; \
+	ctype*  x1; \
+	ctype*  x2; \
+	ctype*  chi11; \
+	ctype   alpha11_conj; \
+	ctype   minus_chi11; \
+	dim_t   iter, i, l, r; \
+	dim_t   b_fuse, f; \
+	dim_t   m_ahead, f_ahead; \
+	inc_t   rs_at, cs_at; \
+	uplo_t  uploa_trans; \
+	conj_t  conja; \
+\
+	/* x = alpha * x; */ \
+	PASTEMAC2(ch,scalv,BLIS_TAPI_EX_SUF) \
+	( \
+	  BLIS_NO_CONJUGATE, \
+	  m, \
+	  alpha, \
+	  x, incx, \
+	  cntx, \
+	  NULL  \
+	); \
+\
+	if      ( bli_does_notrans( transa ) ) \
+	{ \
+		rs_at = rs_a; \
+		cs_at = cs_a; \
+		uploa_trans = uploa; \
+	} \
+	else /* if ( bli_does_trans( transa ) ) */ \
+	{ \
+		rs_at = cs_a; \
+		cs_at = rs_a; \
+		uploa_trans = bli_uplo_toggled( uploa ); \
+	} \
+\
+	conja = bli_extract_conj( transa ); \
+\
+	const trans_t transa_c = ( trans_t )conja; \
+\
+	/* The off-diagonal blocks are updated with the gbmv variant that suits
+	   the storage of transa( A ), and the fusing factor of its kernel sets
+	   the size of the diagonal blocks. */ \
+	PASTECH2(ch,gbmv,_unb_ft) f_gbmv; \
+\
+	if ( bli_is_row_stored( rs_at, cs_at ) ) \
+	{ \
+		f_gbmv = PASTEMAC(ch,gbmv_unf_var1); \
+		b_fuse = bli_cntx_get_blksz_def_dt( dt, BLIS_DF, cntx ); \
+	} \
+	else \
+	{ \
+		f_gbmv = PASTEMAC(ch,gbmv_unf_var2); \
+		b_fuse = bli_cntx_get_blksz_def_dt( dt, BLIS_AF, cntx ); \
+	} \
+\
+	/* We reduce all of the possible cases down to just lower/upper. */ \
+	if      ( bli_is_upper( uploa_trans ) ) \
+	{ \
+		for ( iter = 0; iter < m; iter += f ) \
+		{ \
+			f        = bli_determine_blocksize_dim_b( iter, m, b_fuse ); \
+			i        = m - iter - f; \
+			A11      = a + (i  )*rs_at + (i  )*cs_at; \
+			x1       = x + (i  )*incx; \
+\
+			/* x1 = x1 / triu( A11 ); */ \
+			for ( l = f - 1; l >= 0; --l ) \
+			{ \
+				alpha11  = A11 + (l  )*rs_at + (l  )*cs_at; \
+				chi11    = x1  + (l  )*incx; \
+				f_ahead  = bli_min( l, k ); \
+\
+				/* chi11 = chi11 / alpha11; */ \
+				if ( bli_is_nonunit_diag( diaga ) ) \
+				{ \
+					PASTEMAC(ch,copycjs)( conja, *alpha11, alpha11_conj ); \
+					PASTEMAC(ch,invscals)( alpha11_conj, *chi11 ); \
+				} \
+\
+				/* x01 = x01 - chi11 * a01; (within the band) */ \
+				PASTEMAC(ch,neg2s)( *chi11, minus_chi11 ); \
+				if ( bli_is_conj( conja ) ) \
+				{ \
+					for ( r = 1; r <= f_ahead; ++r ) \
+						PASTEMAC(ch,axpyjs)( minus_chi11, *(alpha11 - r*rs_at), *(chi11 - r*incx) ); \
+				} \
+				else \
+				{ \
+					for ( r = 1; r <= f_ahead; ++r ) \
+						PASTEMAC(ch,axpys)( minus_chi11, *(alpha11 - r*rs_at), *(chi11 - r*incx) ); \
+				} \
+			} \
+			/* Only the k rows above A11 intersect the band. */ \
+			const dim_t i0 = bli_max( 0, i - k ); \
+\
+			m_ahead  = i - i0; \
+			A01      = a + (i0 )*rs_at + (i  )*cs_at; \
+			x0       = x + (i0 )*incx; \
+\
+			/* x0 = x0 - A01 * x1; */ \
+			if ( 0 < m_ahead ) \
+			f_gbmv \
+			( \
+			  transa_c, \
+			  BLIS_NO_CONJUGATE, \
+			  m_ahead, \
+			  f, \
+			  i - i0, \
+			  k - ( i - i0 ), \
+			  minus_one, \
+			  A01, rs_at, cs_at, \
+			  x1,  incx, \
+			  one, \
+			  x0,  incx, \
+			  cntx  \
+			); \
+		} \
+	} \
+	else /* if ( bli_is_lower( uploa_trans ) ) */ \
+	{ \
+		for ( iter = 0; iter < m; iter += f ) \
+		{ \
+			f        = bli_determine_blocksize_dim_f( iter, m, b_fuse ); \
+			i        = iter; \
+			A11      = a + (i  )*rs_at + (i  )*cs_at; \
+			x1       = x + (i  )*incx; \
+\
+			/* x1 = x1 / tril( A11 ); */ \
+			for ( l = 0; l < f; ++l ) \
+			{ \
+				alpha11  = A11 + (l  )*rs_at + (l  )*cs_at; \
+				chi11    = x1  + (l  )*incx; \
+				f_ahead  = bli_min( f - l - 1, k ); \
+\
+				/* chi11 = chi11 / alpha11; */ \
+				if ( bli_is_nonunit_diag( diaga ) ) \
+				{ \
+					PASTEMAC(ch,copycjs)( conja, *alpha11, alpha11_conj ); \
+					PASTEMAC(ch,invscals)( alpha11_conj, *chi11 ); \
+				} \
+\
+				/* x21 = x21 - chi11 * a21; (within the band) */ \
+				PASTEMAC(ch,neg2s)( *chi11, minus_chi11 ); \
+				if ( bli_is_conj( conja ) ) \
+				{ \
+					for ( r = 1; r <= f_ahead; ++r ) \
+						PASTEMAC(ch,axpyjs)( minus_chi11, *(alpha11 + r*rs_at), *(chi11 + r*incx) ); \
+				} \
+				else \
+				{ \
+					for ( r = 1; r <= f_ahead; ++r ) \
+						PASTEMAC(ch,axpys)( minus_chi11, *(alpha11 + r*rs_at), *(chi11 + r*incx) ); \
+				} \
+			} \
+\
+			/* Only the k rows below the top of A11 intersect the band. */ \
+			m_ahead  = bli_min( m, i + f + k ) - ( i + f ); \
+			A21      = a + (i+f)*rs_at + (i  )*cs_at; \
+			x2       = x + (i+f)*incx; \
+\
+			/* x2 = x2 - A21 * x1; */ \
+			if ( 0 < m_ahead ) \
+			f_gbmv \
+			( \
+			  transa_c, \
+			  BLIS_NO_CONJUGATE, \
+			  m_ahead, \
+			  f, \
+			  k - f, \
+			  f, \
+			  minus_one, \
+			  A21, rs_at, cs_at, \
+			  x1,  incx, \
+			  one, \
+			  x2,  incx, \
+			  cntx  \
+			); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( tbsv_unf_var1 )
+
@@ -0,0 +1,178 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       uplo_t  uploa, \
+       trans_t transa, \
+       diag_t  diaga, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  a, \
+       ctype*  w, \
+       ctype*  x, inc_t incx, \
+       dim_t   i_start, \
+       dim_t   i_end, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	ctype*  zero       = PASTEMAC(ch,0); \
+	ctype*  one        = PASTEMAC(ch,1); \
+	ctype*  a1; \
+	ctype*  x1; \
+	ctype   alpha_chi1; \
+	dim_t   i, j; \
+	dim_t   m1, r0, r1, n_a; \
+	dim_t   off_d; \
+	conj_t  conja; \
+\
+	conja = bli_extract_conj( transa ); \
+\
+	/* If the diagonal is implicitly unit, skip it below and instead
+	   initialize the result with the corresponding elements of alpha * w. */ \
+	off_d = ( bli_is_unit_diag( diaga ) ? 1 : 0 ); \
+\
+	m1 = i_end - i_start; \
+	x1 = x + i_start*incx; \
+\
+	if ( bli_is_unit_diag( diaga ) ) \
+	{ \
+		/* x1 = alpha * w1; */ \
+		PASTEMAC2(ch,scal2v,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m1, \
+		  alpha, \
+		  w + i_start, 1, \
+		  x1, incx, \
+		  cntx, \
+		  NULL  \
+		); \
+	} \
+	else \
+	{ \
+		/* x1 = 0; */ \
+		PASTEMAC2(ch,setv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m1, \
+		  zero, \
+		  x1, incx, \
+		  cntx, \
+		  NULL  \
+		); \
+	} \
+\
+	if ( bli_does_notrans( transa ) ) \
+	{ \
+		PASTECH(ch,axpyv_ker_ft) kfp_av; \
+\
+		/* Query the context for the kernel function pointer. */ \
+		kfp_av = bli_cntx_get_l1v_ker_dt( dt, BLIS_AXPYV_KER, cntx ); \
+\
+		/* Accumulate the portion of each column of A that falls within the
+		   current rows. */ \
+		for ( j = 0; j < m; ++j ) \
+		{ \
+			if ( bli_is_lower( uploa ) ) \
+			{ \
+				r0 = bli_max( i_start, j + off_d ); \
+				r1 = i_end; \
+			} \
+			else \
+			{ \
+				r0 = i_start; \
+				r1 = bli_min( i_end, j + 1 - off_d ); \
+			} \
+			if ( r1 <= r0 ) continue; \
+\
+			a1 = a + bli_packed_offset( uploa, m, r0, j ); \
+\
+			/* x1 = x1 + alpha * w1 * conja( a1 ); */ \
+			PASTEMAC(ch,scal2s)( *alpha, *(w + j), alpha_chi1 ); \
+			kfp_av( conja, r1 - r0, &alpha_chi1, a1, 1, x + r0*incx, incx, cntx ); \
+		} \
+	} \
+	else /* if ( bli_does_trans( transa ) ) */ \
+	{ \
+		PASTECH(ch,dotxv_ker_ft) kfp_dv; \
+\
+		/* Query the context for the kernel function pointer. */ \
+		kfp_dv = bli_cntx_get_l1v_ker_dt( dt, BLIS_DOTXV_KER, cntx ); \
+\
+		/* Each element of the result is a reduction of the corresponding
+		   column of A against w. */ \
+		for ( i = i_start; i < i_end; ++i ) \
+		{ \
+			if ( bli_is_lower( uploa ) ) \
+			{ \
+				r0 = i + off_d; \
+				n_a = m - r0; \
+			} \
+			else \
+			{ \
+				r0 = 0; \
+				n_a = i + 1 - off_d; \
+			} \
+			if ( n_a == 0 ) continue; \
+\
+			a1 = a + bli_packed_offset( uploa, m, r0, i ); \
+\
+			/* chi1 = chi1 + alpha * conja( a1 )^T * w1; */ \
+			kfp_dv \
+			( \
+			  conja, \
+			  BLIS_NO_CONJUGATE, \
+			  n_a, \
+			  alpha, \
+			  a1, 1, \
+			  w + r0, 1, \
+			  one, \
+			  x + i*incx, \
+			  cntx  \
+			); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( tpmv_unf_var1 )
+
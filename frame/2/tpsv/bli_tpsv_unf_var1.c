@@ -0,0 +1,155 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       uplo_t  uploa, \
+       trans_t transa, \
+       diag_t  diaga, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  a, \
+       ctype*  x, inc_t incx, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	ctype*  one        = PASTEMAC(ch,1); \
+	ctype*  minus_one  = PASTEMAC(ch,m1); \
+	ctype*  a1; \
+	ctype*  alpha11; \
+	ctype*  chi1; \
+	ctype   alpha11_c; \
+	ctype   minus_chi1; \
+	dim_t   iter, i, j; \
+	conj_t  conja; \
+\
+	conja = bli_extract_conj( transa ); \
+\
+	/* x = alpha * x; */ \
+	PASTEMAC2(ch,scalv,BLIS_TAPI_EX_SUF) \
+	( \
+	  BLIS_NO_CONJUGATE, \
+	  m, \
+	  alpha, \
+	  x, incx, \
+	  cntx, \
+	  NULL  \
+	); \
+\
+	/* A lower triangular matrix is traversed forwards and an upper
+	   triangular matrix backwards when A is not transposed, and vice
+	   versa when it is. The columns of the packed storage are contiguous,
+	   so the updates are axpyv-based when A is not transposed and
+	   dotxv-based when it is. */ \
+	if ( bli_does_notrans( transa ) ) \
+	{ \
+		PASTECH(ch,axpyv_ker_ft) kfp_av; \
+\
+		/* Query the context for the kernel function pointer. */ \
+		kfp_av = bli_cntx_get_l1v_ker_dt( dt, BLIS_AXPYV_KER, cntx ); \
+\
+		for ( iter = 0; iter < m; ++iter ) \
+		{ \
+			j       = ( bli_is_lower( uploa ) ? iter : m - iter - 1 ); \
+			alpha11 = a + bli_packed_offset( uploa, m, j, j ); \
+			chi1    = x + j*incx; \
+\
+			/* chi1 = chi1 / conja( alpha11 ); */ \
+			if ( bli_is_nonunit_diag( diaga ) ) \
+			{ \
+				PASTEMAC(ch,copycjs)( conja, *alpha11, alpha11_c ); \
+				PASTEMAC(ch,invscals)( alpha11_c, *chi1 ); \
+			} \
+\
+			/* x2 = x2 - chi1 * conja( a21 ); (lower)
+			   x0 = x0 - chi1 * conja( a01 ); (upper) */ \
+			PASTEMAC(ch,neg2s)( *chi1, minus_chi1 ); \
+			if ( bli_is_lower( uploa ) ) \
+				kfp_av( conja, m - j - 1, &minus_chi1, alpha11 + 1, 1, \
+				        chi1 + incx, incx, cntx ); \
+			else \
+				kfp_av( conja, j, &minus_chi1, alpha11 - j, 1, \
+				        x, incx, cntx ); \
+		} \
+	} \
+	else /* if ( bli_does_trans( transa ) ) */ \
+	{ \
+		PASTECH(ch,dotxv_ker_ft) kfp_dv; \
+\
+		/* Query the context for the kernel function pointer. */ \
+		kfp_dv = bli_cntx_get_l1v_ker_dt( dt, BLIS_DOTXV_KER, cntx ); \
+\
+		for ( iter = 0; iter < m; ++iter ) \
+		{ \
+			i       = ( bli_is_lower( uploa ) ? m - iter - 1 : iter ); \
+			alpha11 = a + bli_packed_offset( uploa, m, i, i ); \
+			chi1    = x + i*incx; \
+\
+			/* chi1 = chi1 - conja( a21 )^T * x2; (lower)
+			   chi1 = chi1 - conja( a01 )^T * x0; (upper) */ \
+			if ( bli_is_lower( uploa ) ) \
+			{ \
+				a1 = alpha11 + 1; \
+				if ( 0 < m - i - 1 ) \
+				kfp_dv( conja, BLIS_NO_CONJUGATE, m - i - 1, minus_one, \
+				        a1, 1, chi1 + incx, incx, one, chi1, cntx ); \
+			} \
+			else \
+			{ \
+				a1 = alpha11 - i; \
+				if ( 0 < i ) \
+				kfp_dv( conja, BLIS_NO_CONJUGATE, i, minus_one, \
+				        a1, 1, x, incx, one, chi1, cntx ); \
+			} \
+\
+			/* chi1 = chi1 / conja( alpha11 ); */ \
+			if ( bli_is_nonunit_diag( diaga ) ) \
+			{ \
+				PASTEMAC(ch,copycjs)( conja, *alpha11, alpha11_c ); \
+				PASTEMAC(ch,invscals)( alpha11_c, *chi1 ); \
+			} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( tpsv_unf_var1 )
+
@@ -88,6 +88,8 @@
 
 // Operation-specific headers.
 #include "bli_gemm.h"
+#include "bli_gemmt.h"
+#include "bli_gemmlp.h"
 #include "bli_hemm.h"
 #include "bli_herk.h"
 #include "bli_her2k.h"
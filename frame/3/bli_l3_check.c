@@ -44,12 +44,36 @@ void bli_gemm_check
        cntx_t* cntx
      )
 {
-	//err_t e_val;
+	err_t e_val;
 
 	// Check basic properties of the operation.
 
 	bli_gemm_basic_check( alpha, a, b, beta, c, cntx );
 
+	// If B was pre-packed, make sure it is used in its entirety and that the
+	// operation does not mix datatypes (since pre-packed B is already stored
+	// in the computation datatype).
+
+	if ( bli_obj_root_is_packed( b ) )
+	{
+		e_val = bli_check_prepacked_object( b );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_consistent_object_datatypes( c, a );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_consistent_object_datatypes( c, b );
+		bli_check_error_code( e_val );
+
+		if ( bli_obj_comp_prec( c ) != bli_obj_prec( c ) )
+			bli_check_error_code( BLIS_INVALID_PREPACKED_OBJECT );
+	}
+
+	// Only B may be pre-packed.
+
+	if ( bli_obj_root_is_packed( a ) )
+		bli_check_error_code( BLIS_INVALID_PREPACKED_OBJECT );
+
 	// Check object structure.
 
 	// NOTE: Can't perform these checks as long as bli_gemm_check() is called
@@ -63,6 +87,30 @@ void bli_gemm_check
 	//bli_check_error_code( e_val );
 }
 
+void bli_gemmt_check
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx
+     )
+{
+	err_t e_val;
+
+	// Check basic properties of the operation. Since C must be square and
+	// only one triangle is updated, the checks are the same as for herk,
+	// except that B is an independent operand.
+
+	bli_herk_basic_check( alpha, a, b, beta, c, cntx );
+
+	// Check matrix structure.
+
+	e_val = bli_check_upper_or_lower_object( c );
+	bli_check_error_code( e_val );
+}
+
 void bli_hemm_check
      (
        side_t  side,
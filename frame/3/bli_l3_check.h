@@ -51,6 +51,7 @@ void PASTEMAC(opname,_check) \
     );
 
 GENPROT( gemm )
+GENPROT( gemmt )
 GENPROT( her2k )
 GENPROT( syr2k )
 
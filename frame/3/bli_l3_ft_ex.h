@@ -64,6 +64,30 @@ typedef void (*PASTECH3(ch,opname,BLIS_TAPI_EX_SUF,tsuf)) \
 INSERT_GENTDEF( gemm )
 
 
+// gemmt
+
+#undef  GENTDEF
+#define GENTDEF( ctype, ch, opname, tsuf ) \
+\
+typedef void (*PASTECH3(ch,opname,BLIS_TAPI_EX_SUF,tsuf)) \
+     ( \
+       uplo_t  uploc, \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     );
+
+INSERT_GENTDEF( gemmt )
+
+
 // hemm, symm
 
 #undef  GENTDEF
@@ -98,5 +98,32 @@ typedef void (*PASTECH3(ch,opname,_ukr,tsuf)) \
 INSERT_GENTDEF( trsm )
 
 
+// low-precision gemm
+
+typedef void (*gemm_bf16bf16f32_ukr_ft)
+     (
+       dim_t               k,
+       float*     restrict alpha,
+       bfloat16*  restrict a,
+       bfloat16*  restrict b,
+       float*     restrict beta,
+       float*     restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     );
+
+typedef void (*gemm_u8s8s32_ukr_ft)
+     (
+       dim_t               k,
+       float*     restrict alpha,
+       uint8_t*   restrict a,
+       int8_t*    restrict b,
+       float*     restrict beta,
+       int32_t*   restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     );
+
+
 #endif
 
@@ -62,6 +62,11 @@ void PASTEMAC(opname,EX_SUF) \
 	   handling altogether. */ \
 	bool enable_sup = TRUE; \
 	if ( rntm != NULL ) enable_sup = bli_rntm_l3_sup( rntm ); \
+\
+	/* A pre-packed B may only be consumed by the conventional (native)
+	   implementation. */ \
+	const bool b_is_prepacked = bli_obj_root_is_packed( b ); \
+	if ( b_is_prepacked ) enable_sup = FALSE; \
 \
 	if ( enable_sup ) \
 	{ \
@@ -83,7 +88,7 @@ void PASTEMAC(opname,EX_SUF) \
 	   execution. */ \
 	if ( bli_obj_is_complex( c ) && \
 	     bli_obj_is_complex( a ) && \
-	     bli_obj_is_complex( b ) ) \
+	     bli_obj_is_complex( b ) && !b_is_prepacked ) \
 	{ \
 		/* Invoke the operation's "ind" function--its induced method front-end.
 		   For complex problems, it calls the highest priority induced method
@@ -142,6 +147,7 @@ void PASTEMAC(opname,EX_SUF) \
 	} \
 }
 
+GENFRONT( gemmt )
 GENFRONT( her2k )
 GENFRONT( syr2k )
 
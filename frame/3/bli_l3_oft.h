@@ -57,6 +57,7 @@ typedef void (*PASTECH(opname,_oft)) \
 );
 
 GENTDEF( gemm )
+GENTDEF( gemmt )
 GENTDEF( her2k )
 GENTDEF( syr2k )
 
@@ -132,3 +132,68 @@ printf( "dims: %d %d %d (threshs: %d %d %d)\n",
 }
 
 
+// -----------------------------------------------------------------------------
+
+err_t bli_trsmsup
+     (
+       side_t  side,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	// Return early if small matrix handling is disabled at configure-time.
+	#ifdef BLIS_DISABLE_SUP_HANDLING
+	return BLIS_FAILURE;
+	#endif
+
+	// Return early if this is a mixed-datatype computation.
+	if ( bli_obj_dt( b ) != bli_obj_dt( a ) ) return BLIS_FAILURE;
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// The small/unpacked kernels are only registered in the native context,
+	// so return early if we were called on behalf of an induced method.
+	if ( bli_cntx_method( cntx ) != BLIS_NAT ) return BLIS_FAILURE;
+
+	// Return early if the thresholds are unsatisfied. The order of the
+	// triangular matrix A plays the role of the k dimension, since it is
+	// the inner dimension of the gemm updates that comprise the solve.
+	{
+		const num_t dt = bli_obj_dt( b );
+		const dim_t m  = bli_obj_length( b );
+		const dim_t n  = bli_obj_width( b );
+		const dim_t k  = bli_obj_length( a );
+
+		if ( !bli_cntx_l3_sup_thresh_is_met( dt, m, n, k, cntx ) )
+			return BLIS_FAILURE;
+	}
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+	else                { rntm_l = *rntm;                       rntm = &rntm_l; }
+
+	// Query the small/unpacked handler from the context and invoke it. As
+	// with gemm, the handler is free to enforce a stricter threshold regime,
+	// in which case it returns BLIS_FAILURE.
+	trsmsup_oft trsmsup_fp = bli_cntx_get_l3_sup_handler( BLIS_TRSM, cntx );
+
+	if ( trsmsup_fp == NULL ) return BLIS_FAILURE;
+
+	return
+	trsmsup_fp
+	(
+	  side,
+	  alpha,
+	  a,
+	  b,
+	  cntx,
+	  rntm
+	);
+}
+
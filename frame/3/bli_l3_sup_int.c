@@ -240,3 +240,28 @@ err_t bli_gemmsup_int
 	return BLIS_SUCCESS;
 }
 
+
+// -----------------------------------------------------------------------------
+
+err_t bli_trsmsup_int
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       thrinfo_t* thread
+     )
+{
+	// NOTE: The trsmsup handler passes B as both b and c, and passes zero
+	// as beta, since the thread decorator expects the gemm signature.
+	( void )beta;
+	( void )c;
+
+	bli_trsmsup_ref_var1( alpha, a, b, cntx, rntm, thread );
+
+	// Return success so that the caller knows that we computed the solution.
+	return BLIS_SUCCESS;
+}
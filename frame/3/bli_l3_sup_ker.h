@@ -54,3 +54,10 @@ INSERT_GENTPROT_BASIC0( gemmsup_cd_ukr_name )
 
 INSERT_GENTPROT_BASIC0( gemmsup_gx_ukr_name )
 
+
+#undef  GENTPROT
+#define GENTPROT GEMMTRSMSUP_KER_PROT
+
+INSERT_GENTPROT_BASIC0( gemmtrsmsup_l_ukr_name )
+INSERT_GENTPROT_BASIC0( gemmtrsmsup_u_ukr_name )
+
@@ -54,3 +54,21 @@ void PASTEMAC(ch,opname) \
        cntx_t*    restrict cntx  \
      );
 
+#define GEMMTRSMSUP_KER_PROT( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       conj_t              conja, \
+       dim_t               m, \
+       dim_t               n, \
+       dim_t               k, \
+       ctype*     restrict alpha, \
+       ctype*     restrict a1x, \
+       ctype*     restrict a11, inc_t rs_a, inc_t cs_a, \
+       ctype*     restrict d11, \
+       ctype*     restrict bx1, \
+       ctype*     restrict b11, inc_t rs_b, inc_t cs_b, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     );
+
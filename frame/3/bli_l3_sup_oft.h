@@ -58,5 +58,23 @@ typedef err_t (*PASTECH(opname,_oft)) \
 
 GENTDEF( gemmsup )
 
+
+// trsm
+
+#undef  GENTDEF
+#define GENTDEF( opname ) \
+\
+typedef err_t (*PASTECH(opname,_oft)) \
+( \
+  side_t  side, \
+  obj_t*  alpha, \
+  obj_t*  a, \
+  obj_t*  b, \
+  cntx_t* cntx, \
+  rntm_t* rntm  \
+);
+
+GENTDEF( trsmsup )
+
 #endif
 
@@ -106,3 +106,103 @@ err_t bli_gemmsup_ref
 	);
 }
 
+// -----------------------------------------------------------------------------
+
+err_t bli_trsmsup_ref
+     (
+       side_t  side,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	// This function implements the default trsmsup handler. If you are a
+	// BLIS developer and wish to use a different trsmsup handler, please
+	// register a different function pointer in the context in your
+	// sub-configuration's bli_cntx_init_*() function.
+
+	obj_t a_local;
+	obj_t b_local;
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bli_trsm_check( side, alpha, a, b, &BLIS_ZERO, b, cntx );
+
+	// Alias A and B so we can tweak the objects if necessary.
+	bli_obj_alias_to( a, &a_local );
+	bli_obj_alias_to( b, &b_local );
+
+	// As in bli_trsm_front(), we handle a transposed A by inducing the
+	// transposition, and we handle the right side by transposing all of
+	// the operands so that A is solved against from the left. Since none
+	// of the operands are packed, these transpositions only swap strides,
+	// which reduces the four side/uplo cases to two: a lower triangular
+	// A, which is solved forwards, and an upper triangular A, which is
+	// solved backwards.
+	if ( bli_obj_has_trans( &a_local ) )
+	{
+		bli_obj_induce_trans( &a_local );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &a_local );
+	}
+
+	if ( bli_is_right( side ) )
+	{
+		bli_obj_induce_trans( &a_local );
+		bli_obj_induce_trans( &b_local );
+	}
+
+	// The kernels assume that the diagonal of A is its main diagonal.
+	if ( bli_obj_diag_offset( &a_local ) != 0 ) return BLIS_FAILURE;
+
+	// Enforce a stricter threshold than bli_trsmsup(): since A is never
+	// packed, each NR-wide panel of B rereads all of A, and so we only
+	// proceed if the order of A is below the k threshold (that is, small
+	// enough to remain in cache).
+	{
+		const num_t dt = bli_obj_dt( &b_local );
+		const dim_t kt = bli_cntx_get_l3_sup_thresh_dt( dt, BLIS_KT, cntx );
+
+		if ( kt <= bli_obj_length( &a_local ) ) return BLIS_FAILURE;
+	}
+
+	// Return early if B is empty.
+	if ( bli_obj_has_zero_dim( &b_local ) ) return BLIS_SUCCESS;
+
+	// Each NR-wide panel of B is solved independently of the others, and so
+	// we only parallelize the jc loop. Form one team from all of the threads
+	// requested by the rntm_t, but no more threads than there are panels.
+#ifdef BLIS_ENABLE_MULTITHREADING
+	{
+		const num_t dt    = bli_obj_dt( &b_local );
+		const dim_t nr    = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_NR, cntx );
+		const dim_t n_pan = ( bli_obj_width( &b_local ) + nr - 1 ) / nr;
+
+		dim_t n_threads = bli_rntm_num_threads( rntm );
+		if ( n_threads < 1 ) n_threads = bli_rntm_calc_num_threads( rntm );
+		n_threads = bli_max( 1, bli_min( n_threads, n_pan ) );
+
+		bli_rntm_set_num_threads_only( n_threads, rntm );
+		bli_rntm_set_ways_only( n_threads, 1, 1, 1, 1, rntm );
+	}
+#else
+	bli_rntm_set_num_threads_only( 1, rntm );
+	bli_rntm_set_ways_only( 1, 1, 1, 1, 1, rntm );
+#endif
+
+	return
+	bli_l3_sup_thread_decorator
+	(
+	  bli_trsmsup_int,
+	  BLIS_TRSM, // operation family id
+	  alpha,
+	  &a_local,
+	  &b_local,
+	  &BLIS_ZERO,
+	  &b_local,
+	  cntx,
+	  rntm
+	);
+}
+
@@ -43,3 +43,13 @@ err_t bli_gemmsup_ref
        rntm_t* rntm
      );
 
+err_t bli_trsmsup_ref
+     (
+       side_t  side,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       cntx_t* cntx,
+       rntm_t* rntm
+     );
+
@@ -0,0 +1,289 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#define FUNCPTR_T trsmsup_fp
+
+typedef void (*FUNCPTR_T)
+     (
+       uplo_t           uploa,
+       conj_t           conja,
+       diag_t           diaga,
+       dim_t            m,
+       dim_t            n,
+       void*   restrict alpha,
+       void*   restrict a, inc_t rs_a, inc_t cs_a,
+       void*   restrict b, inc_t rs_b, inc_t cs_b,
+       cntx_t* restrict cntx,
+       rntm_t* restrict rntm,
+       thrinfo_t* restrict thread
+     );
+
+static FUNCPTR_T GENARRAY(ftypes,trsmsup_ref_var1);
+
+void bli_trsmsup_ref_var1
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       thrinfo_t* thread
+     )
+{
+	// NOTE: This variant expects that the operands were transformed by
+	// bli_trsmsup_ref(), such that A is solved against from the left and
+	// is not marked for transposition.
+
+	const num_t    dt        = bli_obj_dt( b );
+
+	const uplo_t   uploa     = bli_obj_uplo( a );
+	const conj_t   conja     = bli_obj_conj_status( a );
+	const diag_t   diaga     = bli_obj_diag( a );
+
+	const dim_t    m         = bli_obj_length( b );
+	const dim_t    n         = bli_obj_width( b );
+
+	void* restrict buf_a     = bli_obj_buffer_at_off( a );
+	const inc_t    rs_a      = bli_obj_row_stride( a );
+	const inc_t    cs_a      = bli_obj_col_stride( a );
+
+	void* restrict buf_b     = bli_obj_buffer_at_off( b );
+	const inc_t    rs_b      = bli_obj_row_stride( b );
+	const inc_t    cs_b      = bli_obj_col_stride( b );
+
+	void* restrict buf_alpha = bli_obj_buffer_for_1x1( dt, alpha );
+
+	// Index into the type combination array to extract the correct
+	// function pointer.
+	FUNCPTR_T f = ftypes[dt];
+
+	// Invoke the function.
+	f
+	(
+	  uploa,
+	  conja,
+	  diaga,
+	  m,
+	  n,
+	  buf_alpha,
+	  buf_a, rs_a, cs_a,
+	  buf_b, rs_b, cs_b,
+	  cntx,
+	  rntm,
+	  thread
+	);
+}
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       uplo_t           uploa, \
+       conj_t           conja, \
+       diag_t           diaga, \
+       dim_t            m, \
+       dim_t            n, \
+       void*   restrict alpha, \
+       void*   restrict a, inc_t rs_a, inc_t cs_a, \
+       void*   restrict b, inc_t rs_b, inc_t cs_b, \
+       cntx_t* restrict cntx, \
+       rntm_t* restrict rntm, \
+       thrinfo_t* restrict thread  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	/* Query the context for the register blocksizes of the sup kernels. */ \
+	const dim_t MR = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t NR = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_NR, cntx ); \
+\
+	/* Query the context for the sup gemmtrsm kernel for the current uplo
+	   case, along with its preference for the storage of B. */ \
+	const l3ukr_t ukr_id   = ( bli_is_lower( uploa ) ? BLIS_GEMMTRSM_L_UKR \
+	                                                 : BLIS_GEMMTRSM_U_UKR ); \
+	const bool    row_pref = bli_cntx_l3_sup_trsm_ker_prefers_rows_dt( dt, ukr_id, cntx ); \
+\
+	PASTECH2(ch,gemmtrsmsup,_ker_ft) \
+	              gemmtrsm_ukr = bli_cntx_get_l3_sup_trsm_ker_dt( dt, ukr_id, cntx ); \
+\
+	ctype* restrict a_cast     = a; \
+	ctype* restrict b_cast     = b; \
+	ctype* restrict alpha_cast = alpha; \
+\
+	auxinfo_t       aux; \
+\
+	/* If B is not stored the way the kernel prefers, each panel of B is
+	   copied to a temporary buffer with the preferred storage, solved in
+	   place, and then copied back. This costs O(m*NR) memory operations
+	   per panel versus O(m*m*NR) flops, which is worthwhile since it lets
+	   the kernel use its vectorized code path. */ \
+	const bool      copy_b = ( row_pref ? !bli_is_row_stored( rs_b, cs_b ) \
+	                                    : !bli_is_col_stored( rs_b, cs_b ) ); \
+	const inc_t     rs_bt  = ( row_pref ? NR : 1 ); \
+	const inc_t     cs_bt  = ( row_pref ? 1  : m ); \
+\
+	/* Compute the current thread's range of columns of B. */ \
+	dim_t jc_start, jc_end; \
+	bli_thread_range_sub( thread, n, NR, FALSE, &jc_start, &jc_end ); \
+\
+	if ( jc_end <= jc_start ) return; \
+\
+	/* Acquire a block from the pba for the inverted diagonal of A and, if
+	   needed, the copy of the current panel of B. */ \
+	mem_t mem = BLIS_MEM_INITIALIZER; \
+	const siz_t size_needed = ( m + ( copy_b ? m * NR : 0 ) ) * sizeof( ctype ); \
+\
+	bli_membrk_acquire_m \
+	( \
+	  rntm, \
+	  size_needed, \
+	  BLIS_BUFFER_FOR_B_PANEL, \
+	  &mem  \
+	); \
+\
+	ctype* restrict d11 = bli_mem_buffer( &mem ); \
+	ctype* restrict bt  = d11 + m; \
+\
+	/* Store the inverses of the diagonal elements of A (conjugated, if
+	   needed) so that the kernels may multiply rather than divide. */ \
+	for ( dim_t i = 0; i < m; ++i ) \
+	{ \
+		if ( bli_is_unit_diag( diaga ) ) \
+		{ \
+			PASTEMAC(ch,set1s)( d11[i] ); \
+		} \
+		else \
+		{ \
+			PASTEMAC(ch,copycjs)( conja, a_cast[ i*rs_a + i*cs_a ], d11[i] ); \
+			PASTEMAC(ch,inverts)( d11[i] ); \
+		} \
+	} \
+\
+	/* Loop over the NR-wide panels of B assigned to the current thread. */ \
+	for ( dim_t j = jc_start; j < jc_end; j += NR ) \
+	{ \
+		const dim_t nr_cur = bli_min( NR, jc_end - j ); \
+\
+		ctype* restrict b_j   = b_cast + j*cs_b; \
+		ctype* restrict bp    = b_j; \
+		inc_t           rs_bp = rs_b; \
+		inc_t           cs_bp = cs_b; \
+\
+		if ( copy_b ) \
+		{ \
+			for ( dim_t jj = 0; jj < nr_cur; ++jj ) \
+			for ( dim_t ii = 0; ii < m; ++ii ) \
+				PASTEMAC(ch,copys)( b_j[ ii*rs_b + jj*cs_b ], \
+				                    bt[ ii*rs_bt + jj*cs_bt ] ); \
+\
+			bp = bt; rs_bp = rs_bt; cs_bp = cs_bt; \
+		} \
+\
+		if ( bli_is_lower( uploa ) ) \
+		{ \
+			/* Solve forwards. Each block of B uses the rows of B above it,
+			   which have already been solved. */ \
+			for ( dim_t i = 0; i < m; i += MR ) \
+			{ \
+				const dim_t mr_cur = bli_min( MR, m - i ); \
+\
+				gemmtrsm_ukr \
+				( \
+				  conja, \
+				  mr_cur, \
+				  nr_cur, \
+				  i, \
+				  alpha_cast, \
+				  a_cast + i*rs_a, \
+				  a_cast + i*rs_a + i*cs_a, rs_a, cs_a, \
+				  d11 + i, \
+				  bp, \
+				  bp + i*rs_bp, rs_bp, cs_bp, \
+				  &aux, \
+				  cntx  \
+				); \
+			} \
+		} \
+		else \
+		{ \
+			/* Solve backwards. Each block of B uses the rows of B below it,
+			   which have already been solved. Any edge case is placed at
+			   the top of B. */ \
+			for ( dim_t i_end = m; 0 < i_end; ) \
+			{ \
+				const dim_t mr_cur = bli_min( MR, i_end ); \
+				const dim_t i      = i_end - mr_cur; \
+\
+				gemmtrsm_ukr \
+				( \
+				  conja, \
+				  mr_cur, \
+				  nr_cur, \
+				  m - i_end, \
+				  alpha_cast, \
+				  a_cast + i*rs_a + i_end*cs_a, \
+				  a_cast + i*rs_a + i*cs_a, rs_a, cs_a, \
+				  d11 + i, \
+				  bp + i_end*rs_bp, \
+				  bp + i*rs_bp, rs_bp, cs_bp, \
+				  &aux, \
+				  cntx  \
+				); \
+\
+				i_end = i; \
+			} \
+		} \
+\
+		if ( copy_b ) \
+		{ \
+			for ( dim_t jj = 0; jj < nr_cur; ++jj ) \
+			for ( dim_t ii = 0; ii < m; ++ii ) \
+				PASTEMAC(ch,copys)( bt[ ii*rs_bt + jj*cs_bt ], \
+				                    b_j[ ii*rs_b + jj*cs_b ] ); \
+		} \
+	} \
+\
+	bli_membrk_release \
+	( \
+	  rntm, \
+	  &mem  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( trsmsup_ref_var1 )
+
@@ -204,3 +204,40 @@ BLIS_INLINE void bli_gemmsup_ref_var1n2m_opt_cases
 	}
 }
 
+
+// -----------------------------------------------------------------------------
+
+//
+// Prototype the trsm small/unpacked variant.
+//
+
+void bli_trsmsup_ref_var1
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       thrinfo_t* thread
+     );
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       uplo_t           uploa, \
+       conj_t           conja, \
+       diag_t           diaga, \
+       dim_t            m, \
+       dim_t            n, \
+       void*   restrict alpha, \
+       void*   restrict a, inc_t rs_a, inc_t cs_a, \
+       void*   restrict b, inc_t rs_b, inc_t cs_b, \
+       cntx_t* restrict cntx, \
+       rntm_t* restrict rntm, \
+       thrinfo_t* restrict thread  \
+     );
+
+INSERT_GENTPROT_BASIC0( trsmsup_ref_var1 )
+
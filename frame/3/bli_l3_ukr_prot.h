@@ -78,3 +78,39 @@ void PASTEMAC(ch,opname) \
        cntx_t*    restrict cntx  \
      );
 
+
+//
+// Define prototypes for low-precision gemm micro-kernels. Unlike the
+// micro-kernels above, these are not type-generic: each one is specific to
+// a combination of storage types for A, B, and C.
+//
+
+#define GEMM_BF16BF16F32_UKR_PROT( opname ) \
+\
+void PASTEMAC0(opname) \
+     ( \
+       dim_t               k, \
+       float*     restrict alpha, \
+       bfloat16*  restrict a, \
+       bfloat16*  restrict b, \
+       float*     restrict beta, \
+       float*     restrict c, inc_t rs_c, inc_t cs_c, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     );
+
+
+#define GEMM_U8S8S32_UKR_PROT( opname ) \
+\
+void PASTEMAC0(opname) \
+     ( \
+       dim_t               k, \
+       float*     restrict alpha, \
+       uint8_t*   restrict a, \
+       int8_t*    restrict b, \
+       float*     restrict beta, \
+       int32_t*   restrict c, inc_t rs_c, inc_t cs_c, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     );
+
@@ -0,0 +1,494 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// The description of a batch that is shared by the threads of the team.
+// Items are claimed one at a time by incrementing next, which allows the
+// team to balance the load when the items differ in size.
+typedef struct gemm_batch_s
+{
+	dim_t   n_batch;
+	obj_t*  alpha;
+	obj_t*  a;
+	obj_t*  b;
+	obj_t*  beta;
+	obj_t*  c;
+	dim_t   next;
+} gemm_batch_t;
+
+static void bli_gemm_batch_thread
+     (
+       void*   params,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       dim_t   tid
+     );
+
+static bool bli_gemm_batch_is_small
+     (
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  c,
+       cntx_t* cntx
+     );
+
+// -----------------------------------------------------------------------------
+
+void bli_gemm_batch
+     (
+       dim_t   n_batch,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c
+     )
+{
+	bli_gemm_batch_ex( n_batch, alpha, a, b, beta, c, NULL, NULL );
+}
+
+void bli_gemm_batch_ex
+     (
+       dim_t   n_batch,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bli_gemm_batch_check( n_batch, alpha, a, b, beta, c, cntx );
+
+	// Return early if the batch is empty.
+	if ( n_batch == 0 ) return;
+
+	// If the rntm is non-NULL, it may indicate that we should forgo sup
+	// handling altogether.
+	bool enable_sup = TRUE;
+	if ( rntm != NULL ) enable_sup = bli_rntm_l3_sup( rntm );
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+	else                { rntm_l = *rntm;                       rntm = &rntm_l; }
+
+	bli_rntm_set_l3_sup( enable_sup, rntm );
+
+	// Rather than parallelizing within each item, we form one team from all
+	// of the threads requested by the rntm_t (but no more threads than there
+	// are items) and assign each item to exactly one thread of the team.
+#ifdef BLIS_ENABLE_MULTITHREADING
+	dim_t n_threads = bli_rntm_num_threads( rntm );
+	if ( n_threads < 1 ) n_threads = bli_rntm_calc_num_threads( rntm );
+	n_threads = bli_max( 1, bli_min( n_threads, n_batch ) );
+#else
+	const dim_t n_threads = 1;
+#endif
+
+	bli_rntm_set_num_threads_only( n_threads, rntm );
+	bli_rntm_set_ways_only( 1, 1, 1, 1, 1, rntm );
+
+	gemm_batch_t batch;
+
+	batch.n_batch = n_batch;
+	batch.alpha   = alpha;
+	batch.a       = a;
+	batch.b       = b;
+	batch.beta    = beta;
+	batch.c       = c;
+	batch.next    = 0;
+
+	bli_l3_batch_thread_decorator
+	(
+	  bli_gemm_batch_thread,
+	  &batch,
+	  cntx,
+	  rntm
+	);
+}
+
+void bli_gemm_batch_check
+     (
+       dim_t   n_batch,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx
+     )
+{
+	err_t e_val;
+
+	// Check the batch size.
+
+	e_val = bli_check_valid_batch_size( n_batch );
+	bli_check_error_code( e_val );
+
+	// Check each item of the batch as if it were an independent operation.
+
+	for ( dim_t i = 0; i < n_batch; ++i )
+	{
+		bli_gemm_check( &alpha[i], &a[i], &b[i], &beta[i], &c[i], cntx );
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+static void bli_gemm_batch_thread
+     (
+       void*   params,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       dim_t   tid
+     )
+{
+	gemm_batch_t* batch = params;
+
+	// Each item is computed sequentially by the current thread. Disabling
+	// the automatic factorization also keeps bli_gemmsup_int() from updating
+	// the global thrinfo_t node, which is shared by all threads of the team.
+	bli_rntm_set_num_threads_only( 1, rntm );
+	bli_rntm_set_auto_factor_only( FALSE, rntm );
+
+	// Items that are not handled by the sup code path are passed to the
+	// expert interface with sup handling disabled, since we have already
+	// determined that it does not apply.
+	rntm_t rntm_nosup = *rntm;
+	bli_rntm_disable_l3_sup( &rntm_nosup );
+
+	( void )tid;
+
+	while ( TRUE )
+	{
+		const dim_t i = __atomic_fetch_add( &batch->next, 1, __ATOMIC_RELAXED );
+
+		if ( batch->n_batch <= i ) break;
+
+		obj_t* alpha = &batch->alpha[i];
+		obj_t* a     = &batch->a[i];
+		obj_t* b     = &batch->b[i];
+		obj_t* beta  = &batch->beta[i];
+		obj_t* c     = &batch->c[i];
+
+		// Small items are computed via the sup code path. We call the sup
+		// implementation directly rather than via bli_gemm_ex() in order to
+		// skip the per-call overhead of the front-end and, more importantly,
+		// the sup thread decorator, since the current thread already has
+		// everything it needs in its rntm_t. If the item is not small, or
+		// if the sup implementation declines it, we fall back to the
+		// expert interface, which will use the conventional code path.
+		if ( bli_rntm_l3_sup( rntm ) &&
+		     bli_gemm_batch_is_small( a, b, c, cntx ) &&
+		     bli_gemmsup_int( alpha, a, b, beta, c, cntx, rntm,
+		                      &BLIS_GEMM_SINGLE_THREADED ) == BLIS_SUCCESS )
+			continue;
+
+		bli_gemm_ex( alpha, a, b, beta, c, cntx, &rntm_nosup );
+	}
+}
+
+static bool bli_gemm_batch_is_small
+     (
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  c,
+       cntx_t* cntx
+     )
+{
+	// This mirrors the tests performed by bli_gemmsup() before it invokes
+	// the gemmsup handler.
+	#ifdef BLIS_DISABLE_SUP_HANDLING
+	return FALSE;
+	#endif
+
+	// Mixed-datatype computations and pre-packed operands are not handled
+	// by the sup code path.
+	if ( bli_obj_dt( c ) != bli_obj_dt( a ) ||
+	     bli_obj_dt( c ) != bli_obj_dt( b ) ||
+	     bli_obj_comp_prec( c ) != bli_obj_prec( c ) ||
+	     bli_obj_root_is_packed( b ) ) return FALSE;
+
+	const num_t dt = bli_obj_dt( c );
+	const dim_t m  = bli_obj_length( c );
+	const dim_t n  = bli_obj_width( c );
+	const dim_t k  = bli_obj_width_after_trans( a );
+
+	// Take into account the transposition that would be induced by the
+	// microkernel's storage preference.
+	if ( bli_cntx_l3_vir_ukr_dislikes_storage_of( c, BLIS_GEMM_UKR, cntx ) )
+		return bli_cntx_l3_sup_thresh_is_met( dt, n, m, k, cntx );
+	else
+		return bli_cntx_l3_sup_thresh_is_met( dt, m, n, k, cntx );
+}
+
+// -----------------------------------------------------------------------------
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype** a, inc_t rs_a, inc_t cs_a, \
+       ctype** b, inc_t rs_b, inc_t cs_b, \
+       ctype*  beta, \
+       ctype** c, inc_t rs_c, inc_t cs_c, \
+       dim_t   n_batch  \
+     ) \
+{ \
+	PASTEMAC2(ch,opname,_ex) \
+	( \
+	  transa, transb, m, n, k, \
+	  alpha, a, rs_a, cs_a, b, rs_b, cs_b, \
+	  beta,  c, rs_c, cs_c, \
+	  n_batch, NULL, NULL \
+	); \
+} \
+\
+void PASTEMAC2(ch,opname,_ex) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype** a, inc_t rs_a, inc_t cs_a, \
+       ctype** b, inc_t rs_b, inc_t cs_b, \
+       ctype*  beta, \
+       ctype** c, inc_t rs_c, inc_t cs_c, \
+       dim_t   n_batch, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	const num_t dt           = PASTEMAC(ch,type); \
+\
+	const obj_t obj_init     = BLIS_OBJECT_INITIALIZER; \
+	const obj_t obj_init_1x1 = BLIS_OBJECT_INITIALIZER_1X1; \
+\
+	obj_t* objs; \
+	dim_t  m_a, n_a; \
+	dim_t  m_b, n_b; \
+\
+	if ( bli_error_checking_is_enabled() ) \
+		bli_check_error_code( bli_check_valid_batch_size( n_batch ) ); \
+\
+	if ( n_batch == 0 ) return; \
+\
+	bli_set_dims_with_trans( transa, m, k, &m_a, &n_a ); \
+	bli_set_dims_with_trans( transb, k, n, &m_b, &n_b ); \
+\
+	/* Allocate one array for all five operand arrays. */ \
+	objs = bli_gemm_batch_alloc_objs( n_batch ); \
+\
+	obj_t* alphao = objs; \
+	obj_t* ao     = alphao + n_batch; \
+	obj_t* bo     = ao     + n_batch; \
+	obj_t* betao  = bo     + n_batch; \
+	obj_t* co     = betao  + n_batch; \
+\
+	for ( dim_t i = 0; i < n_batch; ++i ) \
+	{ \
+		alphao[i] = obj_init_1x1; \
+		betao[i]  = obj_init_1x1; \
+		ao[i]     = obj_init; \
+		bo[i]     = obj_init; \
+		co[i]     = obj_init; \
+\
+		bli_obj_init_finish_1x1( dt, alpha, &alphao[i] ); \
+		bli_obj_init_finish_1x1( dt, beta,  &betao[i]  ); \
+\
+		bli_obj_init_finish( dt, m_a, n_a, a[i], rs_a, cs_a, &ao[i] ); \
+		bli_obj_init_finish( dt, m_b, n_b, b[i], rs_b, cs_b, &bo[i] ); \
+		bli_obj_init_finish( dt, m,   n,   c[i], rs_c, cs_c, &co[i] ); \
+\
+		bli_obj_set_conjtrans( transa, &ao[i] ); \
+		bli_obj_set_conjtrans( transb, &bo[i] ); \
+	} \
+\
+	bli_gemm_batch_ex( n_batch, alphao, ao, bo, betao, co, cntx, rntm ); \
+\
+	bli_gemm_batch_free_objs( objs ); \
+}
+
+INSERT_GENTFUNC_BASIC0( gemm_batch )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, inc_t ss_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, inc_t ss_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c, inc_t ss_c, \
+       dim_t   n_batch  \
+     ) \
+{ \
+	PASTEMAC2(ch,opname,_ex) \
+	( \
+	  transa, transb, m, n, k, \
+	  alpha, a, rs_a, cs_a, ss_a, b, rs_b, cs_b, ss_b, \
+	  beta,  c, rs_c, cs_c, ss_c, \
+	  n_batch, NULL, NULL \
+	); \
+} \
+\
+void PASTEMAC2(ch,opname,_ex) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, inc_t ss_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, inc_t ss_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c, inc_t ss_c, \
+       dim_t   n_batch, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	const num_t dt           = PASTEMAC(ch,type); \
+\
+	const obj_t obj_init     = BLIS_OBJECT_INITIALIZER; \
+	const obj_t obj_init_1x1 = BLIS_OBJECT_INITIALIZER_1X1; \
+\
+	obj_t* objs; \
+	dim_t  m_a, n_a; \
+	dim_t  m_b, n_b; \
+\
+	if ( bli_error_checking_is_enabled() ) \
+		bli_check_error_code( bli_check_valid_batch_size( n_batch ) ); \
+\
+	if ( n_batch == 0 ) return; \
+\
+	bli_set_dims_with_trans( transa, m, k, &m_a, &n_a ); \
+	bli_set_dims_with_trans( transb, k, n, &m_b, &n_b ); \
+\
+	/* Allocate one array for all five operand arrays. */ \
+	objs = bli_gemm_batch_alloc_objs( n_batch ); \
+\
+	obj_t* alphao = objs; \
+	obj_t* ao     = alphao + n_batch; \
+	obj_t* bo     = ao     + n_batch; \
+	obj_t* betao  = bo     + n_batch; \
+	obj_t* co     = betao  + n_batch; \
+\
+	for ( dim_t i = 0; i < n_batch; ++i ) \
+	{ \
+		alphao[i] = obj_init_1x1; \
+		betao[i]  = obj_init_1x1; \
+		ao[i]     = obj_init; \
+		bo[i]     = obj_init; \
+		co[i]     = obj_init; \
+\
+		bli_obj_init_finish_1x1( dt, alpha, &alphao[i] ); \
+		bli_obj_init_finish_1x1( dt, beta,  &betao[i]  ); \
+\
+		bli_obj_init_finish( dt, m_a, n_a, a + i * ss_a, rs_a, cs_a, &ao[i] ); \
+		bli_obj_init_finish( dt, m_b, n_b, b + i * ss_b, rs_b, cs_b, &bo[i] ); \
+		bli_obj_init_finish( dt, m,   n,   c + i * ss_c, rs_c, cs_c, &co[i] ); \
+\
+		bli_obj_set_conjtrans( transa, &ao[i] ); \
+		bli_obj_set_conjtrans( transb, &bo[i] ); \
+	} \
+\
+	bli_gemm_batch_ex( n_batch, alphao, ao, bo, betao, co, cntx, rntm ); \
+\
+	bli_gemm_batch_free_objs( objs ); \
+}
+
+INSERT_GENTFUNC_BASIC0( gemm_batch_strided )
+
+// -----------------------------------------------------------------------------
+
+obj_t* bli_gemm_batch_alloc_objs
+     (
+       dim_t n_batch
+     )
+{
+	// Allocate 5 * n_batch objects: one array for each of the operands of
+	// the batched gemm.
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_gemm_batch_alloc_objs(): " );
+	#endif
+
+	return bli_malloc_intl( 5 * n_batch * sizeof( obj_t ) );
+}
+
+void bli_gemm_batch_free_objs
+     (
+       obj_t* objs
+     )
+{
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_gemm_batch_free_objs(): " );
+	#endif
+
+	bli_free_intl( objs );
+}
+
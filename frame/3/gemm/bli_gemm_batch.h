@@ -0,0 +1,169 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// Prototypes for batched gemm.
+//
+
+// Object API. Each of alpha, a, b, beta, and c refers to an array of
+// n_batch objects, where item i computes
+//
+//   c[i] := beta[i] * c[i] + alpha[i] * a[i] * b[i].
+//
+
+BLIS_EXPORT_BLIS void bli_gemm_batch
+     (
+       dim_t   n_batch,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c
+     );
+
+BLIS_EXPORT_BLIS void bli_gemm_batch_ex
+     (
+       dim_t   n_batch,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     );
+
+void bli_gemm_batch_check
+     (
+       dim_t   n_batch,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx
+     );
+
+// Typed API. All items share the same parameters, dimensions, and strides.
+// The array-of-pointers variant takes an array of n_batch addresses for
+// each matrix operand, while the strided variant locates the matrices of
+// item i at a + i * ss_a, b + i * ss_b, and c + i * ss_c.
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype** a, inc_t rs_a, inc_t cs_a, \
+       ctype** b, inc_t rs_b, inc_t cs_b, \
+       ctype*  beta, \
+       ctype** c, inc_t rs_c, inc_t cs_c, \
+       dim_t   n_batch  \
+     ); \
+\
+BLIS_EXPORT_BLIS void PASTEMAC2(ch,opname,_ex) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype** a, inc_t rs_a, inc_t cs_a, \
+       ctype** b, inc_t rs_b, inc_t cs_b, \
+       ctype*  beta, \
+       ctype** c, inc_t rs_c, inc_t cs_c, \
+       dim_t   n_batch, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     );
+
+INSERT_GENTPROT_BASIC0( gemm_batch )
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, inc_t ss_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, inc_t ss_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c, inc_t ss_c, \
+       dim_t   n_batch  \
+     ); \
+\
+BLIS_EXPORT_BLIS void PASTEMAC2(ch,opname,_ex) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, inc_t ss_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, inc_t ss_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c, inc_t ss_c, \
+       dim_t   n_batch, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     );
+
+INSERT_GENTPROT_BASIC0( gemm_batch_strided )
+
+// Allocation of the temporary object arrays used by the typed API.
+
+obj_t* bli_gemm_batch_alloc_objs
+     (
+       dim_t n_batch
+     );
+
+void bli_gemm_batch_free_objs
+     (
+       obj_t* objs
+     );
+
@@ -148,7 +148,13 @@ void bli_gemm_front
 	// contiguous columns, or if C is stored by columns and the micro-kernel
 	// prefers contiguous rows, transpose the entire operation to allow the
 	// micro-kernel to access elements of C in its preferred manner.
-	if ( bli_cntx_l3_vir_ukr_dislikes_storage_of( &c_local, BLIS_GEMM_UKR, cntx ) )
+	// (If B was pre-packed, its micropanels are only suitable for one of
+	// the two orientations, which bli_gemm_prepack_b() chose based on the
+	// micro-kernel's preference for a column-stored C, and so we transpose
+	// the operation if and only if B was packed as the left-hand operand.)
+	if ( bli_obj_root_is_packed( &b_local )
+	     ? bli_obj_is_row_packed( bli_obj_root( &b_local ) )
+	     : bli_cntx_l3_vir_ukr_dislikes_storage_of( &c_local, BLIS_GEMM_UKR, cntx ) )
 	{
 		bli_obj_swap( &a_local, &b_local );
 
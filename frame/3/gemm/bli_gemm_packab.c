@@ -47,16 +47,31 @@ void bli_gemm_packa
 {
 	obj_t a_pack;
 
-	// Pack matrix A according to the control tree node.
-	bli_l3_packm
-	(
-	  a,
-	  &a_pack,
-	  cntx,
-	  rntm,
-	  cntl,
-	  thread
-	);
+	// If A is the transpose of a B that was pre-packed via
+	// bli_gemm_prepack_b(), we simply alias the appropriate micropanels.
+	// Otherwise, pack matrix A according to the control tree node.
+	if ( bli_obj_root_is_packed( a ) )
+	{
+		bli_gemm_prepacked_alias
+		(
+		  a,
+		  &a_pack,
+		  cntx,
+		  cntl
+		);
+	}
+	else
+	{
+		bli_l3_packm
+		(
+		  a,
+		  &a_pack,
+		  cntx,
+		  rntm,
+		  cntl,
+		  thread
+		);
+	}
 
 	// Proceed with execution using packed matrix A.
 	bli_gemm_int
@@ -88,16 +103,31 @@ void bli_gemm_packb
 {
 	obj_t b_pack;
 
-	// Pack matrix B according to the control tree node.
-	bli_l3_packm
-	(
-	  b,
-	  &b_pack,
-	  cntx,
-	  rntm,
-	  cntl,
-	  thread
-	);
+	// If B was pre-packed via bli_gemm_prepack_b(), we simply alias the
+	// appropriate micropanels. Otherwise, pack matrix B according to the
+	// control tree node.
+	if ( bli_obj_root_is_packed( b ) )
+	{
+		bli_gemm_prepacked_alias
+		(
+		  b,
+		  &b_pack,
+		  cntx,
+		  cntl
+		);
+	}
+	else
+	{
+		bli_l3_packm
+		(
+		  b,
+		  &b_pack,
+		  cntx,
+		  rntm,
+		  cntl,
+		  thread
+		);
+	}
 
 	// Proceed with execution using packed matrix B.
 	bli_gemm_int
@@ -0,0 +1,290 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// A pre-packed B is stored as a sequence of k-blocks, one for each
+// iteration of the kc loop in bli_gemm_blk_var3(). Each k-block contains
+// all of the micropanels of the corresponding rows of B, exactly as
+// bli_l3_packm() would have packed them, and begins a fixed distance
+// (in elements) after the previous one. The object's buffer refers to the
+// first k-block, and the following fields record the layout:
+//
+// - pack schema:  the schema of the micropanels (see below),
+// - panel dim:    the micropanel width used when packing,
+// - panel stride: the distance between consecutive k-blocks,
+// - panel length: the default kc blocksize used when packing,
+// - panel width:  the maximum kc blocksize used when packing.
+//
+// If the gemm microkernel prefers to access C by columns, B is packed into
+// NR-wide column panels for use as the right-hand operand. Otherwise, a
+// column-stored C (the common case) will cause bli_gemm_front() to transpose
+// the operation, and so B is packed into MR-wide row panels of B^T for use
+// as the left-hand operand. In either case, the loops that partition the
+// dimension of B that is not k (bli_gemm_blk_var2() and bli_gemm_blk_var1(),
+// respectively) do so along multiples of the micropanel width, and since
+// bli_gemm_blk_var3() partitions k with the same blocksizes used here, each
+// panel that would otherwise be packed is a contiguous range of micropanels
+// within one k-block.
+//
+
+void bli_gemm_prepack_b
+     (
+       obj_t*  b,
+       obj_t*  bp
+     )
+{
+	bli_gemm_prepack_b_ex( b, bp, NULL );
+}
+
+void bli_gemm_prepack_b_ex
+     (
+       obj_t*  b,
+       obj_t*  bp,
+       cntx_t* cntx
+     )
+{
+	bli_init_once();
+
+	obj_t  bt, b1, p1;
+	dim_t  b_alg;
+	pack_t schema;
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bli_gemm_prepack_b_check( b, bp, cntx );
+
+	const num_t    dt        = bli_obj_dt( b );
+	const dim_t    k         = bli_obj_length_after_trans( b );
+	const dim_t    n         = bli_obj_width_after_trans( b );
+	const siz_t    elem_size = bli_obj_elem_size( b );
+	blksz_t*       kc        = bli_cntx_get_blksz( BLIS_KC, cntx );
+	const dim_t    kc_def    = bli_blksz_get_def( dt, kc );
+	const dim_t    kc_max    = bli_blksz_get_max( dt, kc );
+
+	// Pack B as the left-hand operand of the transposed operation if that
+	// is how bli_gemm_front() will use it when C is stored by columns.
+	const bool     pack_bt   = bli_cntx_l3_vir_ukr_prefers_rows_dt
+	                           ( dt, BLIS_GEMM_UKR, cntx );
+
+	if ( pack_bt ) schema = bli_cntx_schema_a_block( cntx );
+	else           schema = bli_cntx_schema_b_panel( cntx );
+
+	bli_obj_alias_with_trans( BLIS_TRANSPOSE, b, &bt );
+
+	// Initialize a packed object for the largest k-block that could arise
+	// in order to determine the distance between k-blocks, which we align
+	// so that each k-block begins at an aligned address.
+	b_alg = bli_min( k, kc_max );
+
+	const siz_t size_max
+	=
+	bli_gemm_prepack_init_kblock( pack_bt, schema, 0, b_alg,
+	                              b, &bt, &b1, &p1, cntx );
+
+	const inc_t bs_p = bli_align_dim_to_size( size_max / elem_size, elem_size,
+	                                          BLIS_HEAP_ADDR_ALIGN_SIZE );
+
+	// Count the number of k-blocks.
+	dim_t n_blocks = 0;
+	for ( dim_t i = 0; i < k; i += b_alg, ++n_blocks )
+		b_alg = bli_determine_blocksize_f_sub( i, k, kc_def, kc_max );
+
+	// Initialize bp as a k x n matrix whose root is marked as packed, and
+	// record the layout of the k-blocks. Note that if B^T was packed, the
+	// strides of the packed k-blocks are transposed so that they match bp.
+	bli_obj_create_without_buffer( dt, k, n, bp );
+	bli_obj_set_pack_schema( schema, bp );
+	if ( pack_bt )
+		bli_obj_set_strides( bli_obj_col_stride( &p1 ),
+		                     bli_obj_row_stride( &p1 ), bp );
+	else
+		bli_obj_set_strides( bli_obj_row_stride( &p1 ),
+		                     bli_obj_col_stride( &p1 ), bp );
+	bli_obj_set_imag_stride( bli_obj_imag_stride( &p1 ), bp );
+	bli_obj_set_panel_dim( bli_obj_panel_dim( &p1 ), bp );
+	bli_obj_set_panel_stride( bs_p, bp );
+	bli_obj_set_panel_length( kc_def, bp );
+	bli_obj_set_panel_width( kc_max, bp );
+
+	bli_obj_set_buffer( bli_malloc_user( n_blocks * bs_p * elem_size ), bp );
+
+	// Pack each k-block of B (or B^T).
+	for ( dim_t i = 0, p = 0; i < k; i += b_alg, ++p )
+	{
+		b_alg = bli_determine_blocksize_f_sub( i, k, kc_def, kc_max );
+
+		bli_gemm_prepack_init_kblock( pack_bt, schema, i, b_alg,
+		                              b, &bt, &b1, &p1, cntx );
+
+		bli_obj_set_buffer( ( char* )bli_obj_buffer( bp ) +
+		                    p * bs_p * elem_size, &p1 );
+
+		bli_packm_blk_var1( &b1, &p1, cntx, NULL,
+		                    &BLIS_PACKM_SINGLE_THREADED );
+	}
+}
+
+siz_t bli_gemm_prepack_init_kblock
+     (
+       bool    pack_bt,
+       pack_t  schema,
+       dim_t   i,
+       dim_t   b_alg,
+       obj_t*  b,
+       obj_t*  bt,
+       obj_t*  b1,
+       obj_t*  p1,
+       cntx_t* cntx
+     )
+{
+	// Acquire the k-block of B (or B^T) that begins at row (or column) i,
+	// and initialize p1 as bli_l3_packm() would when packing it as the
+	// right-hand (or left-hand) operand of gemm.
+	if ( pack_bt )
+	{
+		bli_acquire_mpart_ndim( BLIS_FWD, BLIS_SUBPART1,
+		                        i, b_alg, bt, b1 );
+
+		return bli_packm_init_pack( BLIS_NO_INVERT_DIAG, schema,
+		                            BLIS_PACK_FWD_IF_UPPER, BLIS_PACK_FWD_IF_LOWER,
+		                            BLIS_MR, BLIS_KR, b1, p1, cntx );
+	}
+	else
+	{
+		bli_acquire_mpart_mdim( BLIS_FWD, BLIS_SUBPART1,
+		                        i, b_alg, b, b1 );
+
+		return bli_packm_init_pack( BLIS_NO_INVERT_DIAG, schema,
+		                            BLIS_PACK_FWD_IF_UPPER, BLIS_PACK_FWD_IF_LOWER,
+		                            BLIS_KR, BLIS_NR, b1, p1, cntx );
+	}
+}
+
+void bli_gemm_prepack_b_check
+     (
+       obj_t*  b,
+       obj_t*  bp,
+       cntx_t* cntx
+     )
+{
+	err_t e_val;
+
+	// Check object datatypes.
+
+	e_val = bli_check_floating_object( b );
+	bli_check_error_code( e_val );
+
+	// Check object dimensions.
+
+	e_val = bli_check_matrix_object( b );
+	bli_check_error_code( e_val );
+
+	// Check object buffers (for non-NULLness).
+
+	e_val = bli_check_object_buffer( b );
+	bli_check_error_code( e_val );
+
+	// Check object structure.
+
+	e_val = bli_check_general_object( b );
+	bli_check_error_code( e_val );
+
+	// Pre-packed objects may not be packed again.
+
+	if ( bli_obj_root_is_packed( b ) )
+		bli_check_error_code( BLIS_INVALID_PREPACKED_OBJECT );
+}
+
+void bli_gemm_prepacked_alias
+     (
+       obj_t*  x,
+       obj_t*  x_pack,
+       cntx_t* cntx,
+       cntl_t* cntl
+     )
+{
+	obj_t* bp = bli_obj_root( x );
+	dim_t  off_k, off_r, kc;
+
+	// x is either a panel of the pre-packed B or, if B^T was packed, a
+	// block of the transposed B that bli_gemm_front() passed as A.
+	if ( bli_obj_is_row_packed( bp ) )
+	{
+		off_k = bli_obj_col_off( x );
+		off_r = bli_obj_row_off( x );
+		kc    = bli_obj_width( x );
+	}
+	else
+	{
+		off_k = bli_obj_row_off( x );
+		off_r = bli_obj_col_off( x );
+		kc    = bli_obj_length( x );
+	}
+
+	const dim_t k      = bli_obj_length( bp );
+	const dim_t kc_def = bli_obj_panel_length( bp );
+	const dim_t kc_max = bli_obj_panel_width( bp );
+	const inc_t bs_p   = bli_obj_panel_stride( bp );
+
+	// Initialize x_pack exactly as bli_l3_packm() would have, but without
+	// acquiring a packing block.
+	bli_packm_init( x, x_pack, cntx, cntl );
+
+	const dim_t pd_p   = bli_obj_panel_dim( x_pack );
+	const inc_t ps_p   = bli_obj_panel_stride( x_pack );
+
+	// Make sure that x coincides with a range of micropanels of the k-block
+	// packed by bli_gemm_prepack_b(). This will only fail if the context
+	// (and thus the blocksizes) or the schema differ from those used when B
+	// was packed, which can happen if the operation was not transposed as
+	// expected.
+	if ( bli_obj_pack_schema( x_pack ) != bli_obj_pack_schema( bp ) ||
+	     pd_p != bli_obj_panel_dim( bp ) ||
+	     off_k % kc_def != 0 || off_r % pd_p != 0 ||
+	     kc != bli_determine_blocksize_f_sub( off_k, k, kc_def, kc_max ) )
+		bli_check_error_code( BLIS_INVALID_PREPACKED_OBJECT );
+
+	// Point x_pack to the first micropanel of the current panel.
+	char* buf_p = bli_obj_buffer( bp );
+
+	buf_p += ( ( off_k / kc_def ) * bs_p +
+	           ( off_r / pd_p   ) * ps_p ) * bli_obj_elem_size( x_pack );
+
+	bli_obj_set_buffer( buf_p, x_pack );
+}
@@ -0,0 +1,79 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// Prototypes for pre-packing the right-hand operand of gemm.
+//
+
+BLIS_EXPORT_BLIS void bli_gemm_prepack_b
+     (
+       obj_t*  b,
+       obj_t*  bp
+     );
+
+BLIS_EXPORT_BLIS void bli_gemm_prepack_b_ex
+     (
+       obj_t*  b,
+       obj_t*  bp,
+       cntx_t* cntx
+     );
+
+void bli_gemm_prepack_b_check
+     (
+       obj_t*  b,
+       obj_t*  bp,
+       cntx_t* cntx
+     );
+
+siz_t bli_gemm_prepack_init_kblock
+     (
+       bool    pack_bt,
+       pack_t  schema,
+       dim_t   i,
+       dim_t   b_alg,
+       obj_t*  b,
+       obj_t*  bt,
+       obj_t*  b1,
+       obj_t*  p1,
+       cntx_t* cntx
+     );
+
+void bli_gemm_prepacked_alias
+     (
+       obj_t*  x,
+       obj_t*  x_pack,
+       cntx_t* cntx,
+       cntl_t* cntl
+     );
+
@@ -0,0 +1,279 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "bli_gemmlp_front.h"
+#include "bli_gemmlp_var.h"
+
+
+//
+// Conversions between float and bfloat16.
+//
+
+BLIS_INLINE float bli_bf16_to_float( bfloat16 x )
+{
+	union { uint32_t i; float f; } u;
+
+	u.i = ( uint32_t )x << 16;
+
+	return u.f;
+}
+
+BLIS_INLINE bfloat16 bli_float_to_bf16( float x )
+{
+	union { uint32_t i; float f; } u;
+
+	u.f = x;
+
+	// Keep NaNs quiet NaNs instead of letting the rounding below carry
+	// their payload into the exponent.
+	if ( ( u.i & 0x7fffffff ) > 0x7f800000 )
+		return ( bfloat16 )( ( u.i >> 16 ) | 0x0040 );
+
+	// Round to nearest, ties to even.
+	u.i += 0x7fff + ( ( u.i >> 16 ) & 1 );
+
+	return ( bfloat16 )( u.i >> 16 );
+}
+
+
+//
+// Conversions between float and float16.
+//
+
+BLIS_INLINE float bli_f16_to_float( float16 x )
+{
+	union { uint32_t i; float f; } u;
+
+	const uint32_t s = ( ( uint32_t )x & 0x8000 ) << 16;
+	const uint32_t e = ( ( uint32_t )x >> 10 ) & 0x1f;
+	const uint32_t m = ( uint32_t )x & 0x03ff;
+
+	if ( e == 0 )
+	{
+		// Zeros and subnormals, the latter being m * 2^-24.
+		u.f = ( float )m * 5.9604644775390625e-8F;
+		u.i |= s;
+	}
+	else if ( e == 0x1f )
+	{
+		// Infinities and NaNs.
+		u.i = s | 0x7f800000 | ( m << 13 );
+	}
+	else
+	{
+		// Normal numbers: rebias the exponent from 15 to 127.
+		u.i = s | ( ( e + 112 ) << 23 ) | ( m << 13 );
+	}
+
+	return u.f;
+}
+
+BLIS_INLINE float16 bli_float_to_f16( float x )
+{
+	union { uint32_t i; float f; } u;
+
+	u.f = x;
+
+	const uint32_t s = ( u.i >> 16 ) & 0x8000;
+	const uint32_t a = u.i & 0x7fffffff;
+
+	// Infinities and NaNs (the latter kept quiet).
+	if ( a >= 0x7f800000 )
+		return ( float16 )( s | 0x7c00 | ( a > 0x7f800000 ? 0x0200 : 0 ) );
+
+	// Values that round to a magnitude of at least 65520 overflow.
+	if ( a >= 0x477ff000 )
+		return ( float16 )( s | 0x7c00 );
+
+	uint32_t h, rem, half;
+
+	if ( a >= 0x38800000 )
+	{
+		// Normal results: rebias the exponent from 127 to 15 and drop the
+		// 13 low-order bits of the mantissa.
+		h    = ( a >> 13 ) - ( 112 << 10 );
+		rem  = a & 0x1fff;
+		half = 0x1000;
+	}
+	else
+	{
+		// Subnormal (or zero) results, in units of 2^-24.
+		const uint32_t e     = a >> 23;
+		const uint32_t shift = 126 - e;
+
+		if ( shift > 24 ) return ( float16 )s;
+
+		const uint32_t m = ( a & 0x007fffff ) | 0x00800000;
+
+		h    = m >> shift;
+		rem  = m & ( ( 1u << shift ) - 1 );
+		half = 1u << ( shift - 1 );
+	}
+
+	// Round to nearest, ties to even. A carry out of the mantissa correctly
+	// increments the exponent.
+	if ( rem > half || ( rem == half && ( h & 1 ) ) ) ++h;
+
+	return ( float16 )( s | h );
+}
+
+
+//
+// Prototype the low-precision gemm typed APIs.
+//
+// Both operations compute
+//
+//   C := beta * C + alpha * transa(A) * transb(B)
+//
+// where A is m x k and B is k x n after transposition. The products are
+// accumulated exactly in the storage type of C (float or int32), and alpha
+// and beta are single-precision for both operations. When C is int32,
+// alpha == 1 and beta is 0 or 1 leave the update exact; any other alpha
+// or beta is applied in single precision and the result is rounded to the
+// nearest integer (results that do not fit in an int32 are undefined).
+// Conjugation is ignored since all operands are real.
+//
+
+BLIS_EXPORT_BLIS void bli_gemm_bf16bf16f32
+     (
+       trans_t   transa,
+       trans_t   transb,
+       dim_t     m,
+       dim_t     n,
+       dim_t     k,
+       float*    alpha,
+       bfloat16* a, inc_t rs_a, inc_t cs_a,
+       bfloat16* b, inc_t rs_b, inc_t cs_b,
+       float*    beta,
+       float*    c, inc_t rs_c, inc_t cs_c
+     );
+
+BLIS_EXPORT_BLIS void bli_gemm_bf16bf16f32_ex
+     (
+       trans_t   transa,
+       trans_t   transb,
+       dim_t     m,
+       dim_t     n,
+       dim_t     k,
+       float*    alpha,
+       bfloat16* a, inc_t rs_a, inc_t cs_a,
+       bfloat16* b, inc_t rs_b, inc_t cs_b,
+       float*    beta,
+       float*    c, inc_t rs_c, inc_t cs_c,
+       cntx_t*   cntx,
+       rntm_t*   rntm
+     );
+
+BLIS_EXPORT_BLIS void bli_gemm_u8s8s32
+     (
+       trans_t   transa,
+       trans_t   transb,
+       dim_t     m,
+       dim_t     n,
+       dim_t     k,
+       float*    alpha,
+       uint8_t*  a, inc_t rs_a, inc_t cs_a,
+       int8_t*   b, inc_t rs_b, inc_t cs_b,
+       float*    beta,
+       int32_t*  c, inc_t rs_c, inc_t cs_c
+     );
+
+BLIS_EXPORT_BLIS void bli_gemm_u8s8s32_ex
+     (
+       trans_t   transa,
+       trans_t   transb,
+       dim_t     m,
+       dim_t     n,
+       dim_t     k,
+       float*    alpha,
+       uint8_t*  a, inc_t rs_a, inc_t cs_a,
+       int8_t*   b, inc_t rs_b, inc_t cs_b,
+       float*    beta,
+       int32_t*  c, inc_t rs_c, inc_t cs_c,
+       cntx_t*   cntx,
+       rntm_t*   rntm
+     );
+
+
+//
+// Prototype the half-precision storage gemm typed APIs.
+//
+// These operations compute
+//
+//   C := beta * C + alpha * transa(A) * transb(B)
+//
+// with A and/or B stored in IEEE fp16 and C stored in single precision.
+// The fp16 operands are converted to single precision as they are packed,
+// and the computation then proceeds exactly as it would for bli_sgemm(),
+// so no single-precision copy of an fp16 operand is ever formed. Conjugation
+// is ignored since all operands are real.
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype_a, ctype_b, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC0(opname) \
+     ( \
+       trans_t   transa, \
+       trans_t   transb, \
+       dim_t     m, \
+       dim_t     n, \
+       dim_t     k, \
+       float*    alpha, \
+       ctype_a*  a, inc_t rs_a, inc_t cs_a, \
+       ctype_b*  b, inc_t rs_b, inc_t cs_b, \
+       float*    beta, \
+       float*    c, inc_t rs_c, inc_t cs_c  \
+     ); \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(opname,_ex) \
+     ( \
+       trans_t   transa, \
+       trans_t   transb, \
+       dim_t     m, \
+       dim_t     n, \
+       dim_t     k, \
+       float*    alpha, \
+       ctype_a*  a, inc_t rs_a, inc_t cs_a, \
+       ctype_b*  b, inc_t rs_b, inc_t cs_b, \
+       float*    beta, \
+       float*    c, inc_t rs_c, inc_t cs_c, \
+       cntx_t*   cntx, \
+       rntm_t*   rntm  \
+     );
+
+GENTPROT( float16, float16, gemm_f16f16f32 )
+GENTPROT( float16, float,   gemm_f16f32f32 )
+GENTPROT( float,   float16, gemm_f32f16f32 )
+
@@ -0,0 +1,184 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+static cntl_t* bli_gemmlp_cntl_create_tree
+     (
+       void_fp macro_kernel_fp,
+       void_fp packa_fp,
+       void_fp packb_fp
+     )
+{
+	// NOTE: The tree is created with a NULL rntm_t (and thus allocated from
+	// the heap) since it is only used as a template: the thread decorator
+	// gives each thread its own copy of the tree.
+
+	// Create two nodes for the macro-kernel.
+	cntl_t* gemm_cntl_bu_ke = bli_gemm_cntl_create_node
+	(
+	  NULL,
+	  BLIS_GEMM,
+	  BLIS_MR, // needed for bli_thrinfo_rgrow()
+	  NULL,    // variant function pointer not used
+	  NULL     // no sub-node; this is the leaf of the tree.
+	);
+
+	cntl_t* gemm_cntl_bp_bu = bli_gemm_cntl_create_node
+	(
+	  NULL,
+	  BLIS_GEMM,
+	  BLIS_NR, // not used by macro-kernel, but needed for bli_thrinfo_rgrow()
+	  macro_kernel_fp,
+	  gemm_cntl_bu_ke
+	);
+
+	// Create a node for packing matrix A.
+	cntl_t* gemm_cntl_packa = bli_packm_cntl_create_node
+	(
+	  NULL,
+	  bli_gemm_packa,
+	  packa_fp,
+	  BLIS_MR,
+	  BLIS_KR,
+	  FALSE,   // do NOT invert diagonal
+	  FALSE,   // reverse iteration if upper?
+	  FALSE,   // reverse iteration if lower?
+	  BLIS_PACKED_ROW_PANELS,
+	  BLIS_BUFFER_FOR_A_BLOCK,
+	  gemm_cntl_bp_bu
+	);
+
+	// Create a node for partitioning the m dimension by MC.
+	cntl_t* gemm_cntl_op_bp = bli_gemm_cntl_create_node
+	(
+	  NULL,
+	  BLIS_GEMM,
+	  BLIS_MC,
+	  bli_gemm_blk_var1,
+	  gemm_cntl_packa
+	);
+
+	// Create a node for packing matrix B.
+	cntl_t* gemm_cntl_packb = bli_packm_cntl_create_node
+	(
+	  NULL,
+	  bli_gemm_packb,
+	  packb_fp,
+	  BLIS_KR,
+	  BLIS_NR,
+	  FALSE,   // do NOT invert diagonal
+	  FALSE,   // reverse iteration if upper?
+	  FALSE,   // reverse iteration if lower?
+	  BLIS_PACKED_COL_PANELS,
+	  BLIS_BUFFER_FOR_B_PANEL,
+	  gemm_cntl_op_bp
+	);
+
+	// Create a node for partitioning the k dimension by KC.
+	cntl_t* gemm_cntl_mm_op = bli_gemm_cntl_create_node
+	(
+	  NULL,
+	  BLIS_GEMM,
+	  BLIS_KC,
+	  bli_gemm_blk_var3,
+	  gemm_cntl_packb
+	);
+
+	// Create a node for partitioning the n dimension by NC.
+	cntl_t* gemm_cntl_vl_mm = bli_gemm_cntl_create_node
+	(
+	  NULL,
+	  BLIS_GEMM,
+	  BLIS_NC,
+	  bli_gemm_blk_var2,
+	  gemm_cntl_mm_op
+	);
+
+	return gemm_cntl_vl_mm;
+}
+
+// -----------------------------------------------------------------------------
+
+cntl_t* bli_gemmlp_cntl_create
+     (
+       lpgemm_t ker_id
+     )
+{
+	void_fp macro_kernel_fp;
+
+	// The low-precision operations reuse the blocked variants and packing
+	// nodes of the gemm control tree; only the packm variant and the
+	// macro-kernel, which know about the grouped packing format and the
+	// storage types of the operands, differ from those of gemm.
+	if ( ker_id == BLIS_GEMM_BF16BF16F32 )
+		macro_kernel_fp = bli_gemm_bf16bf16f32_ker_var2;
+	else // if ( ker_id == BLIS_GEMM_U8S8S32 )
+		macro_kernel_fp = bli_gemm_u8s8s32_ker_var2;
+
+	return bli_gemmlp_cntl_create_tree
+	(
+	  macro_kernel_fp,
+	  bli_gemmlp_packm_var1,
+	  bli_gemmlp_packm_var1
+	);
+}
+
+cntl_t* bli_gemmf16_cntl_create
+     (
+       bool packa_f16,
+       bool packb_f16
+     )
+{
+	// The half-precision storage operations produce the native packed
+	// format, so they use the gemm macro-kernel and need only replace the
+	// packm variant of each fp16 operand with one that converts as it packs.
+	return bli_gemmlp_cntl_create_tree
+	(
+	  bli_gemm_ker_var2,
+	  packa_f16 ? bli_packm_blk_var1_f16 : bli_packm_blk_var1,
+	  packb_f16 ? bli_packm_blk_var1_f16 : bli_packm_blk_var1
+	);
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_gemmlp_cntl_free
+     (
+       cntl_t* cntl
+     )
+{
+	bli_cntl_free_wo_thrinfo( NULL, cntl );
+}
+
@@ -0,0 +1,517 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// Scale an int32 matrix by a single-precision beta, rounding the result
+// to the nearest integer.
+static void bli_gemmlp_scalm_s32
+     (
+       float*   beta,
+       dim_t    m,
+       dim_t    n,
+       int32_t* c, inc_t rs_c, inc_t cs_c
+     )
+{
+	if ( *beta == 1.0F ) return;
+
+	if ( bli_is_row_stored( rs_c, cs_c ) )
+	{
+		bli_swap_dims( &m, &n );
+		bli_swap_incs( &rs_c, &cs_c );
+	}
+
+	for ( dim_t j = 0; j < n; ++j )
+	for ( dim_t i = 0; i < m; ++i )
+	{
+		int32_t* restrict cij = c + i*rs_c + j*cs_c;
+
+		if ( *beta == 0.0F ) *cij = 0;
+		else                 *cij = ( int32_t )lrintf( *beta * ( float )*cij );
+	}
+}
+
+// Set the single-precision register and cache blocksizes of a context to
+// those of a low-precision gemm kernel.
+static void bli_gemmlp_cntx_set_blkszs
+     (
+       lpgemm_ker_t* ker,
+       cntx_t*       cntx
+     )
+{
+	// Make sure that the cache blocksizes are multiples of the register
+	// blocksizes that they are partitioned into.
+	const dim_t mc = bli_align_dim_to_mult( ker->mc, ker->mr );
+	const dim_t kc = bli_align_dim_to_mult( ker->kc, ker->kr );
+	const dim_t nc = bli_align_dim_to_mult( ker->nc, ker->nr );
+
+	const bszid_t bs_ids[ 6 ] = { BLIS_MR,  BLIS_NR,  BLIS_KR,
+	                              BLIS_MC,  BLIS_KC,  BLIS_NC };
+	const dim_t   bs_vals[ 6 ] = { ker->mr, ker->nr, ker->kr,
+	                               mc,      kc,      nc      };
+
+	for ( dim_t i = 0; i < 6; ++i )
+	{
+		blksz_t* bs = bli_cntx_get_blksz( bs_ids[ i ], cntx );
+
+		bli_blksz_set_def( bs_vals[ i ], BLIS_FLOAT, bs );
+		bli_blksz_set_max( bs_vals[ i ], BLIS_FLOAT, bs );
+	}
+}
+
+void bli_gemmlp_front
+     (
+       lpgemm_t ker_id,
+       obj_t*   alpha,
+       obj_t*   a,
+       obj_t*   b,
+       obj_t*   beta,
+       obj_t*   c,
+       cntx_t*  cntx,
+       rntm_t*  rntm
+     )
+{
+	bli_init_once();
+
+	// NOTE: The operands arrive as single-precision objects whose element
+	// sizes were overridden to match their actual storage types. Since
+	// the framework computes all addresses via the element size, this lets
+	// the gemm blocked variants, thread decorator, and packing buffer
+	// management operate on them unmodified. Only the packm variant and the
+	// macro-kernel, installed via the control tree, interpret the contents
+	// of the buffers.
+
+	obj_t   a_local;
+	obj_t   b_local;
+	obj_t   c_local;
+	cntx_t  cntx_l;
+	rntm_t  rntm_l;
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+	else                { rntm_l = *rntm;                       rntm = &rntm_l; }
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bli_gemm_basic_check( alpha, a, b, beta, c, cntx );
+
+	// If C has a zero dimension, return early.
+	if ( bli_obj_has_zero_dim( c ) ) return;
+
+	// If alpha is zero, or if A and B have a zero dimension (k == 0), scale
+	// by beta and return. This must be done here since bli_gemm_int() would
+	// otherwise interpret an int32 C as single-precision.
+	if ( bli_obj_equals( alpha, &BLIS_ZERO ) ||
+	     bli_obj_has_zero_dim( a ) )
+	{
+		if ( ker_id == BLIS_GEMM_U8S8S32 )
+			bli_gemmlp_scalm_s32
+			(
+			  bli_obj_buffer_for_1x1( BLIS_FLOAT, beta ),
+			  bli_obj_length( c ),
+			  bli_obj_width( c ),
+			  bli_obj_buffer_at_off( c ),
+			  bli_obj_row_stride( c ),
+			  bli_obj_col_stride( c )
+			);
+		else
+			bli_scalm( beta, c );
+
+		return;
+	}
+
+	// Create a local copy of the context in which the single-precision
+	// blocksizes are those of the low-precision kernel. The blocked
+	// variants, packm_init(), and the packm variant all query blocksizes
+	// according to the (single-precision) execution datatype.
+	cntx_l = *cntx;
+	bli_gemmlp_cntx_set_blkszs( bli_cntx_get_lpgemm_ker( ker_id, cntx ), &cntx_l );
+
+	// Alias A, B, and C in case we need to apply transformations.
+	bli_obj_alias_to( a, &a_local );
+	bli_obj_alias_to( b, &b_local );
+	bli_obj_alias_to( c, &c_local );
+
+	// Attach alpha to B and beta to C. Both remain single-precision.
+	bli_obj_scalar_attach( BLIS_NO_CONJUGATE, alpha, &b_local );
+	bli_obj_scalar_attach( BLIS_NO_CONJUGATE, beta,  &c_local );
+
+	// The low-precision micro-kernels prefer row-stored C. If C is
+	// column-stored and A and B share a storage type (so that they may trade
+	// places), transpose the entire operation.
+	if ( ker_id == BLIS_GEMM_BF16BF16F32 &&
+	     bli_obj_is_col_stored( &c_local ) )
+	{
+		bli_obj_swap( &a_local, &b_local );
+
+		bli_obj_induce_trans( &a_local );
+		bli_obj_induce_trans( &b_local );
+		bli_obj_induce_trans( &c_local );
+	}
+
+	// Parse and interpret the contents of the rntm_t object to properly
+	// set the ways of parallelism for each loop.
+	bli_rntm_set_ways_for_op
+	(
+	  BLIS_GEMM,
+	  BLIS_LEFT, // ignored for gemm/hemm/symm
+	  bli_obj_length( &c_local ),
+	  bli_obj_width( &c_local ),
+	  bli_obj_width( &a_local ),
+	  rntm
+	);
+
+	// Create the control tree for the operation. The thread decorator gives
+	// each thread its own copy.
+	cntl_t* cntl = bli_gemmlp_cntl_create( ker_id );
+
+	// Invoke the internal back-end via the thread handler.
+	bli_l3_thread_decorator
+	(
+	  bli_gemm_int,
+	  BLIS_GEMM, // operation family id
+	  &BLIS_ONE,
+	  &a_local,
+	  &b_local,
+	  &BLIS_ONE,
+	  &c_local,
+	  &cntx_l,
+	  rntm,
+	  cntl
+	);
+
+	bli_gemmlp_cntl_free( cntl );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_gemmf16_front
+     (
+       obj_t*   alpha,
+       obj_t*   a,
+       obj_t*   b,
+       obj_t*   beta,
+       obj_t*   c,
+       cntx_t*  cntx,
+       rntm_t*  rntm
+     )
+{
+	bli_init_once();
+
+	// NOTE: As with the low-precision operations, an fp16 operand arrives
+	// as a single-precision object whose element size was overridden to
+	// that of its storage type. Here, we note which operands are fp16 and
+	// then restore their element sizes so that bli_packm_init() sizes and
+	// formats the packed blocks exactly as it would for sgemm. From then on,
+	// only the packm variant installed for an fp16 operand interprets its
+	// buffer, and everything downstream of packing is plain sgemm.
+
+	obj_t   a_local;
+	obj_t   b_local;
+	obj_t   c_local;
+	rntm_t  rntm_l;
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+	else                { rntm_l = *rntm;                       rntm = &rntm_l; }
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bli_gemm_basic_check( alpha, a, b, beta, c, cntx );
+
+	// If C has a zero dimension, return early.
+	if ( bli_obj_has_zero_dim( c ) ) return;
+
+	// If alpha is zero, or if A and B have a zero dimension (k == 0), scale
+	// by beta and return.
+	if ( bli_obj_equals( alpha, &BLIS_ZERO ) ||
+	     bli_obj_has_zero_dim( a ) )
+	{
+		bli_scalm( beta, c );
+		return;
+	}
+
+	// Alias A, B, and C in case we need to apply transformations.
+	bli_obj_alias_to( a, &a_local );
+	bli_obj_alias_to( b, &b_local );
+	bli_obj_alias_to( c, &c_local );
+
+	bool packa_f16 = ( bli_obj_elem_size( &a_local ) == sizeof( float16 ) );
+	bool packb_f16 = ( bli_obj_elem_size( &b_local ) == sizeof( float16 ) );
+
+	bli_obj_set_elem_size( sizeof( float ), &a_local );
+	bli_obj_set_elem_size( sizeof( float ), &b_local );
+
+	// Attach alpha to B and beta to C.
+	bli_obj_scalar_attach( BLIS_NO_CONJUGATE, alpha, &b_local );
+	bli_obj_scalar_attach( BLIS_NO_CONJUGATE, beta,  &c_local );
+
+	// If C is stored by rows and the micro-kernel prefers contiguous
+	// columns, or vice versa, transpose the entire operation (see
+	// bli_gemm_front()).
+	if ( bli_cntx_l3_vir_ukr_dislikes_storage_of( &c_local, BLIS_GEMM_UKR, cntx ) )
+	{
+		bool t = packa_f16; packa_f16 = packb_f16; packb_f16 = t;
+
+		bli_obj_swap( &a_local, &b_local );
+
+		bli_obj_induce_trans( &a_local );
+		bli_obj_induce_trans( &b_local );
+		bli_obj_induce_trans( &c_local );
+	}
+
+	// Parse and interpret the contents of the rntm_t object to properly
+	// set the ways of parallelism for each loop.
+	bli_rntm_set_ways_for_op
+	(
+	  BLIS_GEMM,
+	  BLIS_LEFT, // ignored for gemm/hemm/symm
+	  bli_obj_length( &c_local ),
+	  bli_obj_width( &c_local ),
+	  bli_obj_width( &a_local ),
+	  rntm
+	);
+
+	// Create the control tree for the operation. The thread decorator gives
+	// each thread its own copy.
+	cntl_t* cntl = bli_gemmf16_cntl_create( packa_f16, packb_f16 );
+
+	// Invoke the internal back-end via the thread handler.
+	bli_l3_thread_decorator
+	(
+	  bli_gemm_int,
+	  BLIS_GEMM, // operation family id
+	  &BLIS_ONE,
+	  &a_local,
+	  &b_local,
+	  &BLIS_ONE,
+	  &c_local,
+	  cntx,
+	  rntm,
+	  cntl
+	);
+
+	bli_gemmlp_cntl_free( cntl );
+}
+
+// -----------------------------------------------------------------------------
+
+//
+// Define the typed APIs.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype_a, ctype_b, ctype_c, ker_id, opname ) \
+\
+void PASTEMAC(opname,_ex) \
+     ( \
+       trans_t  transa, \
+       trans_t  transb, \
+       dim_t    m, \
+       dim_t    n, \
+       dim_t    k, \
+       float*   alpha, \
+       ctype_a* a, inc_t rs_a, inc_t cs_a, \
+       ctype_b* b, inc_t rs_b, inc_t cs_b, \
+       float*   beta, \
+       ctype_c* c, inc_t rs_c, inc_t cs_c, \
+       cntx_t*  cntx, \
+       rntm_t*  rntm  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	obj_t       alphao, ao, bo, betao, co; \
+\
+	dim_t       m_a, n_a; \
+	dim_t       m_b, n_b; \
+\
+	bli_set_dims_with_trans( transa, m, k, &m_a, &n_a ); \
+	bli_set_dims_with_trans( transb, k, n, &m_b, &n_b ); \
+\
+	bli_obj_create_1x1_with_attached_buffer( BLIS_FLOAT, alpha, &alphao ); \
+	bli_obj_create_1x1_with_attached_buffer( BLIS_FLOAT, beta,  &betao  ); \
+\
+	bli_obj_create_with_attached_buffer( BLIS_FLOAT, m_a, n_a, a, rs_a, cs_a, &ao ); \
+	bli_obj_create_with_attached_buffer( BLIS_FLOAT, m_b, n_b, b, rs_b, cs_b, &bo ); \
+	bli_obj_create_with_attached_buffer( BLIS_FLOAT, m,   n,   c, rs_c, cs_c, &co ); \
+\
+	/* Override the element sizes to match the storage types. */ \
+	bli_obj_set_elem_size( sizeof( ctype_a ), &ao ); \
+	bli_obj_set_elem_size( sizeof( ctype_b ), &bo ); \
+	bli_obj_set_elem_size( sizeof( ctype_c ), &co ); \
+\
+	bli_obj_set_conjtrans( transa, &ao ); \
+	bli_obj_set_conjtrans( transb, &bo ); \
+\
+	bli_gemmlp_front \
+	( \
+	  ker_id, \
+	  &alphao, \
+	  &ao, \
+	  &bo, \
+	  &betao, \
+	  &co, \
+	  cntx, \
+	  rntm  \
+	); \
+} \
+\
+void PASTEMAC0(opname) \
+     ( \
+       trans_t  transa, \
+       trans_t  transb, \
+       dim_t    m, \
+       dim_t    n, \
+       dim_t    k, \
+       float*   alpha, \
+       ctype_a* a, inc_t rs_a, inc_t cs_a, \
+       ctype_b* b, inc_t rs_b, inc_t cs_b, \
+       float*   beta, \
+       ctype_c* c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	PASTEMAC(opname,_ex) \
+	( \
+	  transa, transb, \
+	  m, n, k, \
+	  alpha, \
+	  a, rs_a, cs_a, \
+	  b, rs_b, cs_b, \
+	  beta, \
+	  c, rs_c, cs_c, \
+	  NULL, \
+	  NULL  \
+	); \
+}
+
+GENTFUNC( bfloat16, bfloat16, float,   BLIS_GEMM_BF16BF16F32, gemm_bf16bf16f32 )
+GENTFUNC( uint8_t,  int8_t,   int32_t, BLIS_GEMM_U8S8S32,     gemm_u8s8s32 )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype_a, ctype_b, opname ) \
+\
+void PASTEMAC(opname,_ex) \
+     ( \
+       trans_t  transa, \
+       trans_t  transb, \
+       dim_t    m, \
+       dim_t    n, \
+       dim_t    k, \
+       float*   alpha, \
+       ctype_a* a, inc_t rs_a, inc_t cs_a, \
+       ctype_b* b, inc_t rs_b, inc_t cs_b, \
+       float*   beta, \
+       float*   c, inc_t rs_c, inc_t cs_c, \
+       cntx_t*  cntx, \
+       rntm_t*  rntm  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	obj_t       alphao, ao, bo, betao, co; \
+\
+	dim_t       m_a, n_a; \
+	dim_t       m_b, n_b; \
+\
+	bli_set_dims_with_trans( transa, m, k, &m_a, &n_a ); \
+	bli_set_dims_with_trans( transb, k, n, &m_b, &n_b ); \
+\
+	bli_obj_create_1x1_with_attached_buffer( BLIS_FLOAT, alpha, &alphao ); \
+	bli_obj_create_1x1_with_attached_buffer( BLIS_FLOAT, beta,  &betao  ); \
+\
+	bli_obj_create_with_attached_buffer( BLIS_FLOAT, m_a, n_a, a, rs_a, cs_a, &ao ); \
+	bli_obj_create_with_attached_buffer( BLIS_FLOAT, m_b, n_b, b, rs_b, cs_b, &bo ); \
+	bli_obj_create_with_attached_buffer( BLIS_FLOAT, m,   n,   c, rs_c, cs_c, &co ); \
+\
+	/* Override the element sizes to match the storage types. */ \
+	bli_obj_set_elem_size( sizeof( ctype_a ), &ao ); \
+	bli_obj_set_elem_size( sizeof( ctype_b ), &bo ); \
+\
+	bli_obj_set_conjtrans( transa, &ao ); \
+	bli_obj_set_conjtrans( transb, &bo ); \
+\
+	bli_gemmf16_front \
+	( \
+	  &alphao, \
+	  &ao, \
+	  &bo, \
+	  &betao, \
+	  &co, \
+	  cntx, \
+	  rntm  \
+	); \
+} \
+\
+void PASTEMAC0(opname) \
+     ( \
+       trans_t  transa, \
+       trans_t  transb, \
+       dim_t    m, \
+       dim_t    n, \
+       dim_t    k, \
+       float*   alpha, \
+       ctype_a* a, inc_t rs_a, inc_t cs_a, \
+       ctype_b* b, inc_t rs_b, inc_t cs_b, \
+       float*   beta, \
+       float*   c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	PASTEMAC(opname,_ex) \
+	( \
+	  transa, transb, \
+	  m, n, k, \
+	  alpha, \
+	  a, rs_a, cs_a, \
+	  b, rs_b, cs_b, \
+	  beta, \
+	  c, rs_c, cs_c, \
+	  NULL, \
+	  NULL  \
+	); \
+}
+
+GENTFUNC( float16, float16, gemm_f16f16f32 )
+GENTFUNC( float16, float,   gemm_f16f32f32 )
+GENTFUNC( float,   float16, gemm_f32f16f32 )
+
@@ -0,0 +1,262 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// Define the low-precision gemm macro-kernels. These mirror
+// bli_gemm_ker_var2(), except that the micro-kernel (and its storage
+// types) is taken from the context's low-precision gemm kernel slot, and
+// edge cases are handled by copying the edge of C into (and back out of)
+// a temporary buffer. The latter avoids applying beta and the rounding of
+// an int32 C in two separate steps.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype_a, ctype_b, ctype_c, ukr_ft, ker_id, opname ) \
+\
+void PASTEMAC0(opname) \
+     ( \
+       obj_t*  a, \
+       obj_t*  b, \
+       obj_t*  c, \
+       cntx_t* cntx, \
+       rntm_t* rntm, \
+       cntl_t* cntl, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	pack_t          schema_a   = bli_obj_pack_schema( a ); \
+	pack_t          schema_b   = bli_obj_pack_schema( b ); \
+\
+	dim_t           m          = bli_obj_length( c ); \
+	dim_t           n          = bli_obj_width( c ); \
+	dim_t           k          = bli_obj_width( a ); \
+\
+	ctype_a* restrict a_cast   = bli_obj_buffer_at_off( a ); \
+	dim_t           pd_a       = bli_obj_panel_dim( a ); \
+	inc_t           ps_a       = bli_obj_panel_stride( a ); \
+\
+	ctype_b* restrict b_cast   = bli_obj_buffer_at_off( b ); \
+	dim_t           pd_b       = bli_obj_panel_dim( b ); \
+	inc_t           ps_b       = bli_obj_panel_stride( b ); \
+\
+	ctype_c* restrict c_cast   = bli_obj_buffer_at_off( c ); \
+	inc_t           rs_c       = bli_obj_row_stride( c ); \
+	inc_t           cs_c       = bli_obj_col_stride( c ); \
+\
+	obj_t           scalar_a; \
+	obj_t           scalar_b; \
+\
+	/* Detach and multiply the scalars attached to A and B. */ \
+	bli_obj_scalar_detach( a, &scalar_a ); \
+	bli_obj_scalar_detach( b, &scalar_b ); \
+	bli_mulsc( &scalar_a, &scalar_b ); \
+\
+	/* Grab the addresses of the internal scalar buffers for the scalar
+	   merged above and the scalar attached to C. Both are single-
+	   precision. */ \
+	float* restrict alpha_cast = bli_obj_internal_scalar_buffer( &scalar_b ); \
+	float* restrict beta_cast  = bli_obj_internal_scalar_buffer( c ); \
+\
+	/* Alias some constants to simpler names. */ \
+	const dim_t     MR         = pd_a; \
+	const dim_t     NR         = pd_b; \
+\
+	/* Query the context for the micro-kernel address and cast it to its
+	   function pointer type. */ \
+	ukr_ft          gemm_ukr   = bli_cntx_get_lpgemm_ker( ker_id, cntx )->ukr; \
+\
+	/* Temporary C buffer for edge cases. The micro-kernels prefer
+	   row-stored C, and so the buffer is row-stored. */ \
+	ctype_c         ct[ BLIS_STACK_BUF_MAX_SIZE \
+	                    / sizeof( ctype_c ) ] \
+	                    __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	const inc_t     rs_ct      = NR; \
+	const inc_t     cs_ct      = 1; \
+\
+	ctype_b* restrict b1; \
+	ctype_c* restrict c1; \
+\
+	dim_t           m_iter, m_left; \
+	dim_t           n_iter, n_left; \
+	dim_t           i, j; \
+	dim_t           m_cur; \
+	dim_t           n_cur; \
+	inc_t           rstep_a; \
+	inc_t           cstep_b; \
+	inc_t           rstep_c, cstep_c; \
+	auxinfo_t       aux; \
+\
+	/* If any dimension is zero, return immediately. */ \
+	if ( bli_zero_dim3( m, n, k ) ) return; \
+\
+	/* Compute number of primary and leftover components of the m and n
+	   dimensions. */ \
+	n_iter = n / NR; \
+	n_left = n % NR; \
+\
+	m_iter = m / MR; \
+	m_left = m % MR; \
+\
+	if ( n_left ) ++n_iter; \
+	if ( m_left ) ++m_iter; \
+\
+	/* Determine some increments used to step through A, B, and C. */ \
+	rstep_a = ps_a; \
+\
+	cstep_b = ps_b; \
+\
+	rstep_c = rs_c * MR; \
+	cstep_c = cs_c * NR; \
+\
+	/* Save the pack schemas of A and B to the auxinfo_t object. */ \
+	bli_auxinfo_set_schema_a( schema_a, &aux ); \
+	bli_auxinfo_set_schema_b( schema_b, &aux ); \
+\
+	/* The 'thread' argument points to the thrinfo_t node for the 2nd (jr)
+	   loop around the microkernel. Here we query the thrinfo_t node for the
+	   1st (ir) loop around the microkernel. */ \
+	thrinfo_t* caucus = bli_thrinfo_sub_node( thread ); \
+\
+	/* Query the number of threads and thread ids for each loop. */ \
+	dim_t jr_nt  = bli_thread_n_way( thread ); \
+	dim_t jr_tid = bli_thread_work_id( thread ); \
+	dim_t ir_nt  = bli_thread_n_way( caucus ); \
+	dim_t ir_tid = bli_thread_work_id( caucus ); \
+\
+	dim_t jr_start, jr_end; \
+	dim_t ir_start, ir_end; \
+	dim_t jr_inc,   ir_inc; \
+\
+	/* Determine the thread range and increment for the 2nd and 1st loops. */ \
+	bli_thread_range_jrir( thread, n_iter, 1, FALSE, &jr_start, &jr_end, &jr_inc ); \
+	bli_thread_range_jrir( caucus, m_iter, 1, FALSE, &ir_start, &ir_end, &ir_inc ); \
+\
+	/* Loop over the n dimension (NR columns at a time). */ \
+	for ( j = jr_start; j < jr_end; j += jr_inc ) \
+	{ \
+		ctype_a* restrict a1; \
+		ctype_c* restrict c11; \
+		ctype_b* restrict b2; \
+\
+		b1 = b_cast + j * cstep_b; \
+		c1 = c_cast + j * cstep_c; \
+\
+		n_cur = ( bli_is_not_edge_f( j, n_iter, n_left ) ? NR : n_left ); \
+\
+		/* Initialize our next panel of B to be the current panel of B. */ \
+		b2 = b1; \
+\
+		/* Loop over the m dimension (MR rows at a time). */ \
+		for ( i = ir_start; i < ir_end; i += ir_inc ) \
+		{ \
+			ctype_a* restrict a2; \
+\
+			a1  = a_cast + i * rstep_a; \
+			c11 = c1     + i * rstep_c; \
+\
+			m_cur = ( bli_is_not_edge_f( i, m_iter, m_left ) ? MR : m_left ); \
+\
+			/* Compute the addresses of the next panels of A and B. */ \
+			a2 = bli_gemm_get_next_a_upanel( a1, rstep_a, ir_inc ); \
+			if ( bli_is_last_iter( i, ir_end, ir_tid, ir_nt ) ) \
+			{ \
+				a2 = a_cast; \
+				b2 = bli_gemm_get_next_b_upanel( b1, cstep_b, jr_inc ); \
+				if ( bli_is_last_iter( j, jr_end, jr_tid, jr_nt ) ) \
+					b2 = b_cast; \
+			} \
+\
+			/* Save addresses of next panels of A and B to the auxinfo_t
+			   object. */ \
+			bli_auxinfo_set_next_a( a2, &aux ); \
+			bli_auxinfo_set_next_b( b2, &aux ); \
+\
+			/* Handle interior and edge cases separately. */ \
+			if ( m_cur == MR && n_cur == NR ) \
+			{ \
+				/* Invoke the gemm micro-kernel. */ \
+				gemm_ukr \
+				( \
+				  k, \
+				  alpha_cast, \
+				  a1, \
+				  b1, \
+				  beta_cast, \
+				  c11, rs_c, cs_c, \
+				  &aux, \
+				  cntx  \
+				); \
+			} \
+			else \
+			{ \
+				/* Copy the edge of C into the temporary buffer (unless
+				   beta is zero, in which case C must not be read), and
+				   clear the rest of the buffer in case it holds any infs
+				   or NaNs. */ \
+				for ( dim_t ii = 0; ii < MR; ++ii ) \
+				for ( dim_t jj = 0; jj < NR; ++jj ) \
+				{ \
+					if ( ii < m_cur && jj < n_cur && *beta_cast != 0.0F ) \
+						ct[ ii*rs_ct + jj*cs_ct ] = c11[ ii*rs_c + jj*cs_c ]; \
+					else \
+						ct[ ii*rs_ct + jj*cs_ct ] = 0; \
+				} \
+\
+				/* Invoke the gemm micro-kernel. */ \
+				gemm_ukr \
+				( \
+				  k, \
+				  alpha_cast, \
+				  a1, \
+				  b1, \
+				  beta_cast, \
+				  ct, rs_ct, cs_ct, \
+				  &aux, \
+				  cntx  \
+				); \
+\
+				/* Copy the result back to the edge of C. */ \
+				for ( dim_t ii = 0; ii < m_cur; ++ii ) \
+				for ( dim_t jj = 0; jj < n_cur; ++jj ) \
+					c11[ ii*rs_c + jj*cs_c ] = ct[ ii*rs_ct + jj*cs_ct ]; \
+			} \
+		} \
+	} \
+}
+
+GENTFUNC( bfloat16, bfloat16, float,   gemm_bf16bf16f32_ukr_ft, BLIS_GEMM_BF16BF16F32, gemm_bf16bf16f32_ker_var2 )
+GENTFUNC( uint8_t,  int8_t,   int32_t, gemm_u8s8s32_ukr_ft,     BLIS_GEMM_U8S8S32,     gemm_u8s8s32_ker_var2 )
+
@@ -0,0 +1,225 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+typedef void (*gemmlp_packm_cxk_ft)
+     (
+       dim_t  panel_dim,
+       dim_t  panel_dim_max,
+       dim_t  panel_len,
+       dim_t  panel_len_max,
+       void*  c, inc_t incc, inc_t ldc,
+       void*  p
+     );
+
+//
+// Define the panel packing functions. Each one packs a panel_dim x panel_len
+// source micro-panel (with a stride of incc along panel_dim and ldc along
+// panel_len) into groups of kr elements along panel_len, zero-padding up to
+// panel_dim_max x panel_len_max. The functions operate on raw bits and are
+// therefore selected by element size and kr only.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, opname, kr ) \
+\
+static void PASTEMAC0(opname) \
+     ( \
+       dim_t  panel_dim, \
+       dim_t  panel_dim_max, \
+       dim_t  panel_len, \
+       dim_t  panel_len_max, \
+       void*  c, inc_t incc, inc_t ldc, \
+       void*  p  \
+     ) \
+{ \
+	ctype* restrict c_cast   = c; \
+	ctype* restrict p_cast   = p; \
+	const dim_t     len_full = ( panel_len / kr ) * kr; \
+\
+	/* Pack the groups that lie entirely within the source panel. */ \
+	for ( dim_t l = 0; l < len_full; l += kr ) \
+	{ \
+		ctype* restrict c_l = c_cast + l*ldc; \
+\
+		if ( ldc == 1 ) \
+		{ \
+			for ( dim_t i = 0; i < panel_dim; ++i ) \
+			for ( dim_t q = 0; q < kr; ++q ) \
+				p_cast[ i*kr + q ] = c_l[ i*incc + q ]; \
+		} \
+		else \
+		{ \
+			for ( dim_t i = 0; i < panel_dim; ++i ) \
+			for ( dim_t q = 0; q < kr; ++q ) \
+				p_cast[ i*kr + q ] = c_l[ i*incc + q*ldc ]; \
+		} \
+\
+		for ( dim_t i = panel_dim*kr; i < panel_dim_max*kr; ++i ) \
+			p_cast[ i ] = 0; \
+\
+		p_cast += panel_dim_max * kr; \
+	} \
+\
+	/* Pack the partial group at the end of the panel, if it exists, along
+	   with any groups that lie entirely within the zero padding. */ \
+	for ( dim_t l = len_full; l < panel_len_max; l += kr ) \
+	{ \
+		for ( dim_t i = 0; i < panel_dim_max; ++i ) \
+		for ( dim_t q = 0; q < kr; ++q ) \
+		{ \
+			if ( i < panel_dim && l + q < panel_len ) \
+				p_cast[ i*kr + q ] = c_cast[ i*incc + ( l + q )*ldc ]; \
+			else \
+				p_cast[ i*kr + q ] = 0; \
+		} \
+\
+		p_cast += panel_dim_max * kr; \
+	} \
+}
+
+GENTFUNC( uint8_t,  gemmlp_packm_b8_k1_cxk,  1 )
+GENTFUNC( uint8_t,  gemmlp_packm_b8_k2_cxk,  2 )
+GENTFUNC( uint8_t,  gemmlp_packm_b8_k4_cxk,  4 )
+GENTFUNC( uint16_t, gemmlp_packm_b16_k1_cxk, 1 )
+GENTFUNC( uint16_t, gemmlp_packm_b16_k2_cxk, 2 )
+GENTFUNC( uint16_t, gemmlp_packm_b16_k4_cxk, 4 )
+
+
+void bli_gemmlp_packm_var1
+     (
+       obj_t*  c,
+       obj_t*  p,
+       cntx_t* cntx,
+       cntl_t* cntl,
+       thrinfo_t* thread
+     )
+{
+	trans_t   transc     = bli_obj_onlytrans_status( c );
+	pack_t    schema     = bli_obj_pack_schema( p );
+	siz_t     elem_size  = bli_obj_elem_size( p );
+
+	dim_t     m_p        = bli_obj_length( p );
+	dim_t     n_p        = bli_obj_width( p );
+	dim_t     m_max_p    = bli_obj_padded_length( p );
+	dim_t     n_max_p    = bli_obj_padded_width( p );
+
+	char*     buf_c      = bli_obj_buffer_at_off( c );
+	inc_t     rs_c       = bli_obj_row_stride( c );
+	inc_t     cs_c       = bli_obj_col_stride( c );
+
+	char*     buf_p      = bli_obj_buffer_at_off( p );
+	dim_t     pd_p       = bli_obj_panel_dim( p );
+	inc_t     ps_p       = bli_obj_panel_stride( p );
+
+	// The k-group size is the KR blocksize, which the front-end set in the
+	// single-precision slot of its local copy of the context.
+	dim_t     kr         = bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_KR, cntx );
+
+	gemmlp_packm_cxk_ft f;
+
+	dim_t     iter_dim;
+	dim_t     panel_len;
+	dim_t     panel_len_max;
+	inc_t     incc, ldc;
+
+	// Select the panel packing function.
+	if      ( elem_size == 1 && kr == 1 ) f = bli_gemmlp_packm_b8_k1_cxk;
+	else if ( elem_size == 1 && kr == 2 ) f = bli_gemmlp_packm_b8_k2_cxk;
+	else if ( elem_size == 1 && kr == 4 ) f = bli_gemmlp_packm_b8_k4_cxk;
+	else if ( elem_size == 2 && kr == 1 ) f = bli_gemmlp_packm_b16_k1_cxk;
+	else if ( elem_size == 2 && kr == 2 ) f = bli_gemmlp_packm_b16_k2_cxk;
+	else if ( elem_size == 2 && kr == 4 ) f = bli_gemmlp_packm_b16_k4_cxk;
+	else
+	{
+		bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED );
+		return;
+	}
+
+	// If c needs a transposition, induce it so that we can more simply
+	// express the remaining parameters and code.
+	if ( bli_does_trans( transc ) )
+	{
+		bli_swap_incs( &rs_c, &cs_c );
+	}
+
+	// Row panels (of A) are packed along the rows of c, and column panels
+	// (of B) along its columns. In both cases, the panel length runs along
+	// the k dimension.
+	if ( bli_is_row_packed( schema ) )
+	{
+		iter_dim      = m_p;
+		panel_len     = n_p;
+		panel_len_max = n_max_p;
+		incc          = rs_c;
+		ldc           = cs_c;
+	}
+	else // if ( bli_is_col_packed( schema ) )
+	{
+		iter_dim      = n_p;
+		panel_len     = m_p;
+		panel_len_max = m_max_p;
+		incc          = cs_c;
+		ldc           = rs_c;
+	}
+
+	// Compute the total number of iterations we'll need.
+	dim_t n_iter = iter_dim / pd_p + ( iter_dim % pd_p ? 1 : 0 );
+
+	dim_t it_start, it_end, it_inc;
+
+	// Determine the thread range and increment using the current thread's
+	// packm thrinfo_t node. NOTE: The definition of bli_thread_range_jrir()
+	// will depend on whether slab or round-robin partitioning was requested
+	// at configure-time.
+	bli_thread_range_jrir( thread, n_iter, 1, FALSE, &it_start, &it_end, &it_inc );
+
+	// Iterate over the micropanels assigned to the current thread.
+	for ( dim_t it = it_start; it < it_end; it += it_inc )
+	{
+		dim_t panel_dim_i = bli_min( pd_p, iter_dim - it*pd_p );
+
+		f
+		(
+		  panel_dim_i,
+		  pd_p,
+		  panel_len,
+		  panel_len_max,
+		  buf_c + ( it*pd_p*incc )*elem_size, incc, ldc,
+		  buf_p + ( it*ps_p      )*elem_size
+		);
+	}
+}
+
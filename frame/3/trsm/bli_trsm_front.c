@@ -57,6 +57,16 @@ void bli_trsm_front
 	if ( status == BLIS_SUCCESS ) return;
 #endif
 
+	// If the rntm does not prohibit it, execute the small/unpacked handler
+	// registered in the context. If it finds that the problem does not fall
+	// within the thresholds that define "small", it returns BLIS_FAILURE and
+	// we proceed with the conventional implementation.
+	if ( bli_rntm_l3_sup( rntm ) )
+	{
+		if ( bli_trsmsup( side, alpha, a, b, cntx, rntm ) == BLIS_SUCCESS )
+			return;
+	}
+
 	// Check parameters.
 	if ( bli_error_checking_is_enabled() )
 		bli_trsm_check( side, alpha, a, b, &BLIS_ZERO, b, cntx );
@@ -127,6 +137,13 @@ void bli_trsm_front
 	bli_obj_set_as_root( &b_local );
 	bli_obj_set_as_root( &c_local );
 
+	// If B has too few columns to keep all of the threads busy during the
+	// diagonal solves of the conventional algorithm, use the lookahead
+	// algorithm instead. If the problem is not suitable, it returns with
+	// BLIS_FAILURE and we proceed with the conventional algorithm.
+	if ( bli_trsm_la( alpha, &a_local, &b_local, cntx, rntm ) == BLIS_SUCCESS )
+		return;
+
 	// Parse and interpret the contents of the rntm_t object to properly
 	// set the ways of parallelism for each loop, and then make any
 	// additional modifications necessary for the current operation.
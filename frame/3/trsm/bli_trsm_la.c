@@ -0,0 +1,428 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// The lookahead trsm algorithm.
+//
+// The conventional left-side trsm (bli_trsm_blk_var1()) solves each KC x KC
+// diagonal block of A with all threads partitioning only the n dimension of
+// the packed block of B, and it then waits at a barrier before any thread
+// may begin the rank-kc update of the rows below. When B has few columns,
+// most threads sit idle during the solve, and the solve is never overlapped
+// with the (far larger) trailing updates.
+//
+// Here, B is instead viewed as a grid of tiles: row tiles the size of the
+// diagonal blocks of A and column slabs that are a multiple of NR wide.
+// Since every dependency in trsm is confined to a single column slab, the
+// operations on tile (i,j) form a chain: the i updates
+//
+//   B(i,j) := B(i,j) - A(i,k) * B(k,j),   k = 0, ..., i-1
+//
+// followed by the solve B(i,j) := inv(A(i,i)) * B(i,j). The update by row
+// tile k may proceed once B(k,j) has been solved. Each tile records how
+// many of its operations have been completed, and the threads of the team
+// repeatedly claim the first tile (in order of increasing i) whose next
+// operation is ready, and perform that operation with a single-threaded
+// gemm or trsm. Favoring the tiles nearest the diagonal means that solves,
+// and the updates that feed them, take priority over the rest of the
+// trailing update, which gives lookahead of arbitrary depth; meanwhile,
+// the updates of different row tiles proceed in parallel (ic-parallelism)
+// while the solves are still in progress.
+//
+// NOTE: This algorithm expects the operands to have been transformed as in
+// bli_trsm_front(), such that A is solved against from the left and none
+// of the operands are marked for transposition.
+//
+
+// Use a spin-wait hint, where available, while a thread waits for another
+// operation to become ready. (See bli_thrpool.c.)
+#if defined(__x86_64__) || defined(__i386__)
+  #define bli_trsm_la_pause() __asm__ __volatile__ ( "pause" )
+#elif defined(__aarch64__)
+  #define bli_trsm_la_pause() __asm__ __volatile__ ( "yield" )
+#else
+  #define bli_trsm_la_pause()
+#endif
+
+// The description of the problem and the schedule shared by the threads of
+// the team.
+typedef struct trsm_la_s
+{
+	obj_t*  alpha;
+	obj_t*  a;
+	obj_t*  b;
+	dir_t   direct;
+
+	// The row tile size (the size of the diagonal blocks of A) and the number
+	// of row tiles.
+	dim_t   mb;
+	dim_t   m_iter;
+
+	// The column slab width and the number of column slabs.
+	dim_t   nb;
+	dim_t   n_iter;
+
+	// For each tile, the number of its operations that have been completed
+	// and whether a thread is currently performing one of them. Both arrays
+	// are stored by rows, one element per tile.
+	dim_t*  n_done;
+	dim_t*  busy;
+
+	// The total number of operations, and the number completed so far.
+	dim_t   n_ops;
+	dim_t   n_ops_done;
+
+} trsm_la_t;
+
+static void bli_trsm_la_thread
+     (
+       void*   params,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       dim_t   tid
+     );
+
+// -----------------------------------------------------------------------------
+
+err_t bli_trsm_la
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	const num_t dt = bli_obj_dt( b );
+	const dim_t m  = bli_obj_length( b );
+	const dim_t n  = bli_obj_width( b );
+
+	dim_t n_threads = bli_rntm_num_threads( rntm );
+	if ( n_threads < 1 ) n_threads = bli_rntm_calc_num_threads( rntm );
+
+	// Decline the problem if the algorithm was disabled, if there is only
+	// one thread, if an induced method is in use, or if A is stored with an
+	// offset diagonal.
+	if ( !bli_rntm_trsm_la( rntm ) ||
+	     n_threads < 2 ||
+	     bli_cntx_method( cntx ) != BLIS_NAT ||
+	     bli_obj_diag_offset( a ) != 0 ) return BLIS_FAILURE;
+
+	const dim_t mr = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+	const dim_t nr = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+	const dim_t kc = bli_cntx_get_blksz_def_dt( dt, BLIS_KC, cntx );
+
+	// The conventional algorithm already keeps every thread busy during the
+	// diagonal solves if there are at least as many NR-wide column panels
+	// of B as there are threads, so we only step in when there are not.
+	const dim_t n_panels = ( n + nr - 1 ) / nr;
+
+	if ( n_threads <= n_panels ) return BLIS_FAILURE;
+
+	// Use row tiles the size of the diagonal blocks that the conventional
+	// algorithm would solve (KC, rounded down to a multiple of MR), and
+	// decline the problem if it consists of only one of them.
+	const dim_t mb     = bli_max( mr, ( kc / mr ) * mr );
+	const dim_t m_iter = ( m + mb - 1 ) / mb;
+
+	if ( m_iter < 2 ) return BLIS_FAILURE;
+
+	// The operations on each column slab form a chain (the critical path)
+	// of about 2 * m_iter tile operations, out of a total of about
+	// m_iter^2 / 2 per slab, so the average parallelism available with
+	// n_iter slabs is about n_iter * m_iter / 4. Choose n_iter so that this
+	// exceeds the number of threads by the desired factor, but never split
+	// B into slabs narrower than NR.
+	dim_t n_iter = ( 4 * BLIS_TRSM_LA_PAR_PER_THREAD * n_threads + m_iter - 1 )
+	               / m_iter;
+	n_iter = bli_min( bli_max( n_iter, 1 ), n_panels );
+
+	const dim_t nb = ( ( n + n_iter - 1 ) / n_iter + nr - 1 ) / nr * nr;
+	n_iter = ( n + nb - 1 ) / nb;
+
+	// Each tile (i,j) requires i updates and one solve.
+	const dim_t n_tiles = m_iter * n_iter;
+	const dim_t n_ops   = n_iter * m_iter * ( m_iter + 1 ) / 2;
+
+	// There is no use for more threads than tiles.
+	n_threads = bli_min( n_threads, n_tiles );
+
+	trsm_la_t la;
+
+	la.alpha      = alpha;
+	la.a          = a;
+	la.b          = b;
+	la.direct     = bli_obj_is_upper( a ) ? BLIS_BWD : BLIS_FWD;
+	la.mb         = mb;
+	la.m_iter     = m_iter;
+	la.nb         = nb;
+	la.n_iter     = n_iter;
+	la.n_ops      = n_ops;
+	la.n_ops_done = 0;
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_trsm_la(): " );
+	#endif
+
+	la.n_done = bli_malloc_intl( 2 * n_tiles * sizeof( dim_t ) );
+	la.busy   = la.n_done + n_tiles;
+
+	for ( dim_t t = 0; t < 2 * n_tiles; ++t ) la.n_done[ t ] = 0;
+
+	// Form one team from the threads, each of which performs the operations
+	// it claims sequentially.
+	rntm_t rntm_l = *rntm;
+
+	bli_rntm_set_num_threads_only( n_threads, &rntm_l );
+	bli_rntm_set_ways_only( 1, 1, 1, 1, 1, &rntm_l );
+
+	bli_l3_batch_thread_decorator
+	(
+	  bli_trsm_la_thread,
+	  &la,
+	  cntx,
+	  &rntm_l
+	);
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_trsm_la(): " );
+	#endif
+
+	bli_free_intl( la.n_done );
+
+	return BLIS_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+
+// Query the offset and length of row tile i. Row tiles are counted in the
+// direction of the solve, so when moving backwards, tile 0 is at the bottom
+// of the matrix and the partial tile, if any, is at the top.
+static void bli_trsm_la_tile_range
+     (
+       trsm_la_t* la,
+       dim_t      i,
+       dim_t*     off,
+       dim_t*     len
+     )
+{
+	const dim_t m = bli_obj_length( la->b );
+
+	if ( la->direct == BLIS_FWD )
+	{
+		*off = i * la->mb;
+		*len = bli_min( la->mb, m - *off );
+	}
+	else
+	{
+		const dim_t end = m - i * la->mb;
+
+		*off = bli_max( 0, end - la->mb );
+		*len = end - *off;
+	}
+}
+
+// Acquire tile (i,j) of B, where j indexes the column slabs.
+static void bli_trsm_la_acquire_b
+     (
+       trsm_la_t* la,
+       dim_t      i,
+       dim_t      j,
+       obj_t*     b_ij
+     )
+{
+	dim_t off_i, len_i;
+
+	bli_trsm_la_tile_range( la, i, &off_i, &len_i );
+
+	const dim_t off_j = j * la->nb;
+	const dim_t len_j = bli_min( la->nb, bli_obj_width( la->b ) - off_j );
+
+	bli_acquire_mpart( off_i, off_j, len_i, len_j, la->b, b_ij );
+}
+
+// Acquire block (i,k) of A, where both i and k index row tiles.
+static void bli_trsm_la_acquire_a
+     (
+       trsm_la_t* la,
+       dim_t      i,
+       dim_t      k,
+       obj_t*     a_ik
+     )
+{
+	dim_t off_i, len_i;
+	dim_t off_k, len_k;
+
+	bli_trsm_la_tile_range( la, i, &off_i, &len_i );
+	bli_trsm_la_tile_range( la, k, &off_k, &len_k );
+
+	// NOTE: bli_acquire_mpart() does not update the diagonal offset, which
+	// is correct for the diagonal blocks (since off_i == off_k) and
+	// irrelevant for the others, which the caller marks as general.
+	bli_acquire_mpart( off_i, off_k, len_i, len_k, la->a, a_ik );
+}
+
+static void bli_trsm_la_update
+     (
+       trsm_la_t* la,
+       dim_t      i,
+       dim_t      k,
+       dim_t      j,
+       cntx_t*    cntx,
+       rntm_t*    rntm
+     )
+{
+	obj_t a_ik, b_kj, b_ij;
+
+	bli_trsm_la_acquire_a( la, i, k, &a_ik );
+	bli_trsm_la_acquire_b( la, k, j, &b_kj );
+	bli_trsm_la_acquire_b( la, i, j, &b_ij );
+
+	// A(i,k) lies entirely within the stored region of A.
+	bli_obj_set_struc( BLIS_GENERAL, &a_ik );
+	bli_obj_set_uplo( BLIS_DENSE, &a_ik );
+
+	// The first operation on each tile applies alpha.
+	obj_t* beta = ( k == 0 ? la->alpha : &BLIS_ONE );
+
+	bli_gemm_ex( &BLIS_MINUS_ONE, &a_ik, &b_kj, beta, &b_ij, cntx, rntm );
+}
+
+static void bli_trsm_la_solve
+     (
+       trsm_la_t* la,
+       dim_t      i,
+       dim_t      j,
+       cntx_t*    cntx,
+       rntm_t*    rntm
+     )
+{
+	obj_t a_ii, b_ij;
+
+	bli_trsm_la_acquire_a( la, i, i, &a_ii );
+	bli_trsm_la_acquire_b( la, i, j, &b_ij );
+
+	// The first operation on each tile applies alpha.
+	obj_t* alpha = ( i == 0 ? la->alpha : &BLIS_ONE );
+
+	bli_trsm_ex( BLIS_LEFT, alpha, &a_ii, &b_ij, cntx, rntm );
+}
+
+static void bli_trsm_la_thread
+     (
+       void*   params,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       dim_t   tid
+     )
+{
+	trsm_la_t* la = params;
+
+	const dim_t m_iter = la->m_iter;
+	const dim_t n_iter = la->n_iter;
+
+	// Each operation is computed sequentially by the current thread. (See
+	// bli_gemm_batch_thread().)
+	bli_rntm_set_num_threads_only( 1, rntm );
+	bli_rntm_set_auto_factor_only( FALSE, rntm );
+
+	( void )tid;
+
+	while ( TRUE )
+	{
+		// Note how many operations had been completed before looking for
+		// one that is ready.
+		const dim_t n_ops_done = __atomic_load_n( &la->n_ops_done, __ATOMIC_ACQUIRE );
+
+		if ( n_ops_done == la->n_ops ) break;
+
+		bool found = FALSE;
+
+		for ( dim_t i = 0; i < m_iter && !found; ++i )
+		for ( dim_t j = 0; j < n_iter && !found; ++j )
+		{
+			dim_t* n_done = &la->n_done[ i * n_iter + j ];
+			dim_t* busy   = &la->busy[ i * n_iter + j ];
+
+			// The next operation on tile (i,j) is the update by row tile k,
+			// if k < i, which is ready once tile (k,j) has been solved, or
+			// the solve, if k == i, which is ready immediately. If k > i,
+			// the tile is finished.
+			dim_t k = __atomic_load_n( n_done, __ATOMIC_ACQUIRE );
+
+			if ( i < k ) continue;
+			if ( k < i && __atomic_load_n( &la->n_done[ k * n_iter + j ],
+			                               __ATOMIC_ACQUIRE ) <= k ) continue;
+
+			// Try to claim the tile.
+			dim_t idle = 0;
+			if ( !__atomic_compare_exchange_n( busy, &idle, 1, FALSE,
+			                                   __ATOMIC_ACQUIRE,
+			                                   __ATOMIC_RELAXED ) ) continue;
+
+			// Another thread may have performed an operation on the tile
+			// after we checked it, so check it again now that it is ours.
+			k = __atomic_load_n( n_done, __ATOMIC_ACQUIRE );
+
+			if ( i < k ||
+			     ( k < i && __atomic_load_n( &la->n_done[ k * n_iter + j ],
+			                                 __ATOMIC_ACQUIRE ) <= k ) )
+			{
+				__atomic_store_n( busy, 0, __ATOMIC_RELEASE );
+				continue;
+			}
+
+			if ( k < i ) bli_trsm_la_update( la, i, k, j, cntx, rntm );
+			else         bli_trsm_la_solve( la, i, j, cntx, rntm );
+
+			// Publish the result before releasing the tile.
+			__atomic_store_n( n_done, k + 1, __ATOMIC_RELEASE );
+			__atomic_store_n( busy, 0, __ATOMIC_RELEASE );
+			__atomic_fetch_add( &la->n_ops_done, 1, __ATOMIC_ACQ_REL );
+
+			found = TRUE;
+		}
+
+		// If no operation was ready, wait until another thread completes an
+		// operation, since that may make another one ready.
+		if ( !found )
+		{
+			while ( __atomic_load_n( &la->n_ops_done, __ATOMIC_ACQUIRE ) == n_ops_done )
+				bli_trsm_la_pause();
+		}
+	}
+}
+
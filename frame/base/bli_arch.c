@@ -131,6 +131,9 @@ void bli_arch_set_id( void )
 #endif
 
 	// ARM microarchitectures.
+#ifdef BLIS_FAMILY_ARMSVE
+	id = BLIS_ARCH_ARMSVE;
+#endif
 #ifdef BLIS_FAMILY_THUNDERX2
 	id = BLIS_ARCH_THUNDERX2;
 #endif
@@ -163,6 +166,48 @@ void bli_arch_set_id( void )
 	id = BLIS_ARCH_GENERIC;
 #endif
 
+#ifndef BLIS_CONFIGURETIME_CPUID
+	// Check the environment variable BLIS_ARCH_TYPE to see if the user
+	// requested that we use a specific sub-configuration instead of the one
+	// chosen above. The sub-configuration may be given either by name (e.g.
+	// "zen2") or by its arch_t value. Note that we can only check that the
+	// value refers to a valid arch_t here; whether the sub-configuration was
+	// actually registered is checked by the gks when its context is looked
+	// up during initialization.
+	char* req_str = getenv( "BLIS_ARCH_TYPE" );
+
+	if ( req_str != NULL && req_str[0] != '\0' )
+	{
+		arch_t req_id = bli_arch_query_id_for_string( req_str );
+
+		// If the string is not the name of a sub-configuration, interpret
+		// it as an arch_t value.
+		if ( req_id == -1 )
+		{
+			char* end;
+			long  val = strtol( req_str, &end, 10 );
+
+			if ( *end == '\0' ) req_id = ( arch_t )val;
+		}
+
+		if ( bli_error_checking_is_enabled() )
+		{
+			err_t e_val = bli_check_valid_arch_id( req_id );
+			bli_check_error_code( e_val );
+		}
+
+		// If error checking is disabled, ignore invalid requests.
+		if ( bli_check_valid_arch_id( req_id ) == BLIS_SUCCESS )
+		{
+			if ( bli_arch_get_logging() )
+				fprintf( stderr, "libblis: BLIS_ARCH_TYPE overrides sub-configuration '%s'.\n",
+						 bli_arch_string( id ) );
+
+			id = req_id;
+		}
+	}
+#endif
+
 	if ( bli_arch_get_logging() )
 		fprintf( stderr, "libblis: selecting sub-configuration '%s'.\n",
 				 bli_arch_string( id ) );
@@ -193,6 +238,7 @@ static char* config_name[ BLIS_NUM_ARCHS ] =
     "piledriver",
     "bulldozer",
 
+    "armsve",
     "thunderx2",
     "cortexa57",
     "cortexa53",
@@ -211,6 +257,20 @@ char* bli_arch_string( arch_t id )
 	return config_name[ id ];
 }
 
+arch_t bli_arch_query_id_for_string( const char* str )
+{
+	arch_t id;
+
+	// Return the arch_t value whose sub-configuration name matches str, or
+	// -1 if there is no such sub-configuration.
+	for ( id = 0; id < BLIS_NUM_ARCHS; ++id )
+	{
+		if ( strcmp( str, config_name[ id ] ) == 0 ) return id;
+	}
+
+	return -1;
+}
+
 // -----------------------------------------------------------------------------
 
 static bool arch_dolog = 0;
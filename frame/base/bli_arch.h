@@ -41,6 +41,7 @@ void bli_arch_set_id_once( void );
 void bli_arch_set_id( void );
 
 BLIS_EXPORT_BLIS char*  bli_arch_string( arch_t id );
+BLIS_EXPORT_BLIS arch_t bli_arch_query_id_for_string( const char* str );
 
 void bli_arch_set_logging( bool dolog );
 bool bli_arch_get_logging( void );
@@ -525,6 +525,16 @@ err_t bli_check_object_diag_offset_equals( obj_t* a, doff_t offset )
 	return e_val;
 }
 
+err_t bli_check_valid_batch_size( dim_t n_batch )
+{
+	err_t e_val = BLIS_SUCCESS;
+
+	if ( n_batch < 0 )
+		e_val = BLIS_NEGATIVE_DIMENSION;
+
+	return e_val;
+}
+
 // -- Stride-related checks ----------------------------------------------------
 
 err_t bli_check_matrix_strides( dim_t m, dim_t n, inc_t rs, inc_t cs, inc_t is )
@@ -766,6 +776,24 @@ err_t bli_check_packv_schema_on_unpack( obj_t* a )
 	return e_val;
 }
 
+err_t bli_check_prepacked_object( obj_t* a )
+{
+	err_t e_val = BLIS_SUCCESS;
+
+	// A pre-packed object may only be used in its entirety, without any
+	// transposition or conjugation.
+	obj_t* root = bli_obj_root( a );
+
+	if ( bli_obj_row_off( a ) != 0 ||
+	     bli_obj_col_off( a ) != 0 ||
+	     bli_obj_length( a ) != bli_obj_length( root ) ||
+	     bli_obj_width( a )  != bli_obj_width( root ) ||
+	     bli_obj_conjtrans_status( a ) != BLIS_NO_TRANSPOSE )
+		e_val = BLIS_INVALID_PREPACKED_OBJECT;
+
+	return e_val;
+}
+
 // -- Buffer-related checks ----------------------------------------------------
 
 err_t bli_check_object_buffer( obj_t* a )
@@ -891,6 +919,16 @@ err_t bli_check_valid_arch_id( arch_t id )
 	return e_val;
 }
 
+err_t bli_check_initialized_gks_cntx( cntx_t** cntx )
+{
+	err_t e_val = BLIS_SUCCESS;
+
+	if ( cntx == NULL )
+		e_val = BLIS_UNINITIALIZED_GKS_CNTX;
+
+	return e_val;
+}
+
 // -- Architecture-related errors ----------------------------------------------
 
 err_t bli_check_valid_mc_mod_mult( blksz_t* mc, blksz_t* mr )
@@ -77,6 +77,7 @@ err_t bli_check_object_length_equals( obj_t* a, dim_t m );
 err_t bli_check_object_width_equals( obj_t* a, dim_t n );
 err_t bli_check_vector_dim_equals( obj_t* a, dim_t n );
 err_t bli_check_object_diag_offset_equals( obj_t* a, doff_t offset );
+err_t bli_check_valid_batch_size( dim_t n_batch );
 
 err_t bli_check_matrix_strides( dim_t m, dim_t n, inc_t rs, inc_t cs, inc_t is );
 
@@ -96,6 +97,7 @@ err_t bli_check_valid_cntl( void* cntl );
 
 err_t bli_check_packm_schema_on_unpack( obj_t* a );
 err_t bli_check_packv_schema_on_unpack( obj_t* a );
+err_t bli_check_prepacked_object( obj_t* a );
 
 err_t bli_check_object_buffer( obj_t* a );
 
@@ -110,6 +112,7 @@ err_t bli_check_alignment_is_mult_of_ptr_size( size_t align_size );
 err_t bli_check_object_alias_of( obj_t* a, obj_t* b );
 
 err_t bli_check_valid_arch_id( arch_t id );
+err_t bli_check_initialized_gks_cntx( cntx_t** cntx );
 
 err_t bli_check_valid_mc_mod_mult( blksz_t* mc, blksz_t* mr );
 err_t bli_check_valid_nc_mod_mult( blksz_t* nc, blksz_t* nr );
@@ -1264,6 +1264,140 @@ void bli_cntx_set_l3_sup_kers( dim_t n_ukrs, ... )
 
 // -----------------------------------------------------------------------------
 
+void bli_cntx_set_l3_sup_trsm_kers( dim_t n_ukrs, ... )
+{
+	// This function can be called from the bli_cntx_init_*() function for
+	// a particular architecture if the kernel developer wishes to use
+	// non-default gemmtrsm kernels for small/unpacked matrices. It should
+	// be called after bli_cntx_init_defaults() so that the context begins
+	// with default sup gemmtrsm kernels across all datatypes.
+
+	/* Example prototypes:
+
+	   void bli_cntx_set_l3_sup_trsm_kers
+	   (
+	     dim_t   n_ukrs,
+	     l3ukr_t ukr0_id, num_t dt0, void_fp ukr0_fp, bool pref0,
+	     l3ukr_t ukr1_id, num_t dt1, void_fp ukr1_fp, bool pref1,
+	     l3ukr_t ukr2_id, num_t dt2, void_fp ukr2_fp, bool pref2,
+	     ...
+	     cntx_t* cntx
+	   );
+
+	   where each ukr_id is either BLIS_GEMMTRSM_L_UKR or
+	   BLIS_GEMMTRSM_U_UKR.
+	*/
+
+	va_list   args;
+	dim_t     i;
+
+	// Allocate some temporary local arrays.
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_cntx_set_l3_sup_trsm_kers(): " );
+	#endif
+	l3ukr_t* ukr_ids   = bli_malloc_intl( n_ukrs * sizeof( l3ukr_t ) );
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_cntx_set_l3_sup_trsm_kers(): " );
+	#endif
+	num_t*   ukr_dts   = bli_malloc_intl( n_ukrs * sizeof( num_t   ) );
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_cntx_set_l3_sup_trsm_kers(): " );
+	#endif
+	void_fp* ukr_fps   = bli_malloc_intl( n_ukrs * sizeof( void_fp ) );
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_cntx_set_l3_sup_trsm_kers(): " );
+	#endif
+	bool*    ukr_prefs = bli_malloc_intl( n_ukrs * sizeof( bool    ) );
+
+	// -- Begin variable argument section --
+
+	// Initialize variable argument environment.
+	va_start( args, n_ukrs );
+
+	// Process n_ukrs tuples.
+	for ( i = 0; i < n_ukrs; ++i )
+	{
+		// Here, we query the variable argument list for:
+		// - the l3ukr_t of the kernel we're about to process,
+		// - the datatype of the kernel,
+		// - the kernel function pointer, and
+		// - the kernel function storage preference
+		// that we need to store to the context.
+		const l3ukr_t  ukr_id   = ( l3ukr_t )va_arg( args, l3ukr_t );
+		const num_t    ukr_dt   = ( num_t   )va_arg( args, num_t   );
+		      void_fp  ukr_fp   = ( void_fp )va_arg( args, void_fp );
+		const bool     ukr_pref = ( bool    )va_arg( args, int     );
+
+		// Store the values in our temporary arrays.
+		ukr_ids[ i ]   = ukr_id;
+		ukr_dts[ i ]   = ukr_dt;
+		ukr_fps[ i ]   = ukr_fp;
+		ukr_prefs[ i ] = ukr_pref;
+	}
+
+	// The last argument should be the context pointer.
+	cntx_t* cntx = ( cntx_t* )va_arg( args, cntx_t* );
+
+	// Shutdown variable argument environment and clean up stack.
+	va_end( args );
+
+	// -- End variable argument section --
+
+	// Query the context for the addresses of:
+	// - the l3 small/unpacked gemmtrsm kernel func_t array
+	// - the l3 small/unpacked gemmtrsm kernel preferences array
+	func_t*  cntx_l3_sup_trsm_kers       = bli_cntx_l3_sup_trsm_kers_buf( cntx );
+	mbool_t* cntx_l3_sup_trsm_kers_prefs = bli_cntx_l3_sup_trsm_kers_prefs_buf( cntx );
+
+	// Process each kernel tuple provided.
+	for ( i = 0; i < n_ukrs; ++i )
+	{
+		// Read the current ukernel id, ukernel datatype, ukernel function
+		// pointer, and ukernel preference.
+		const l3ukr_t ukr_id   = ukr_ids[ i ];
+		const num_t   ukr_dt   = ukr_dts[ i ];
+		      void_fp ukr_fp   = ukr_fps[ i ];
+		const bool    ukr_pref = ukr_prefs[ i ];
+
+		// Index into the func_t and mbool_t for the current kernel id
+		// being processed.
+		func_t*  ukrs   = &cntx_l3_sup_trsm_kers[ ukr_id ];
+		mbool_t* prefs  = &cntx_l3_sup_trsm_kers_prefs[ ukr_id ];
+
+		// Store the ukernel function pointer and preference values into
+		// the context.
+		bli_func_set_dt( ukr_fp, ukr_dt, ukrs );
+		bli_mbool_set_dt( ukr_pref, ukr_dt, prefs );
+	}
+
+	// Free the temporary local arrays.
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_cntx_set_l3_sup_trsm_kers(): " );
+	#endif
+	bli_free_intl( ukr_ids );
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_cntx_set_l3_sup_trsm_kers(): " );
+	#endif
+	bli_free_intl( ukr_dts );
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_cntx_set_l3_sup_trsm_kers(): " );
+	#endif
+	bli_free_intl( ukr_fps );
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_cntx_set_l3_sup_trsm_kers(): " );
+	#endif
+	bli_free_intl( ukr_prefs );
+}
+
+// -----------------------------------------------------------------------------
+
 void bli_cntx_set_l1f_kers( dim_t n_kers, ... )
 {
 	// This function can be called from the bli_cntx_init_*() function for
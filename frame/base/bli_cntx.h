@@ -55,13 +55,19 @@ typedef struct cntx_s
 	blksz_t*  l3_sup_blkszs;
 	func_t*   l3_sup_kers;
 	mbool_t*  l3_sup_kers_prefs;
+	func_t*   l3_sup_trsm_kers;
+	mbool_t*  l3_sup_trsm_kers_prefs;
 
 	func_t*   l1f_kers;
 	func_t*   l1v_kers;
+	blksz_t   l1v_thresh;
 
 	func_t*   packm_kers;
 	func_t*   unpackm_kers;
 
+	lpgemm_ker_t* lpgemm_kers;
+	void_fp   packm_f16_ker;
+
 	ind_t     method;
 	pack_t    schema_a;
 	pack_t    schema_b;
@@ -116,6 +122,14 @@ BLIS_INLINE mbool_t* bli_cntx_l3_sup_kers_prefs_buf( cntx_t* cntx )
 {
 	return cntx->l3_sup_kers_prefs;
 }
+BLIS_INLINE func_t* bli_cntx_l3_sup_trsm_kers_buf( cntx_t* cntx )
+{
+	return cntx->l3_sup_trsm_kers;
+}
+BLIS_INLINE mbool_t* bli_cntx_l3_sup_trsm_kers_prefs_buf( cntx_t* cntx )
+{
+	return cntx->l3_sup_trsm_kers_prefs;
+}
 BLIS_INLINE func_t* bli_cntx_l1f_kers_buf( cntx_t* cntx )
 {
 	return cntx->l1f_kers;
@@ -124,6 +138,10 @@ BLIS_INLINE func_t* bli_cntx_l1v_kers_buf( cntx_t* cntx )
 {
 	return cntx->l1v_kers;
 }
+BLIS_INLINE blksz_t* bli_cntx_l1v_thresh_buf( cntx_t* cntx )
+{
+	return &(cntx->l1v_thresh);
+}
 BLIS_INLINE func_t* bli_cntx_packm_kers_buf( cntx_t* cntx )
 {
 	return cntx->packm_kers;
@@ -132,6 +150,10 @@ BLIS_INLINE func_t* bli_cntx_unpackm_kers_buf( cntx_t* cntx )
 {
 	return cntx->unpackm_kers;
 }
+BLIS_INLINE lpgemm_ker_t* bli_cntx_lpgemm_kers_buf( cntx_t* cntx )
+{
+	return cntx->lpgemm_kers;
+}
 BLIS_INLINE ind_t bli_cntx_method( cntx_t* cntx )
 {
 	return cntx->method;
@@ -387,6 +409,40 @@ BLIS_INLINE bool bli_cntx_get_l3_sup_ker_prefs_dt( num_t dt, stor3_t stor_id, cn
 
 // -----------------------------------------------------------------------------
 
+BLIS_INLINE func_t* bli_cntx_get_l3_sup_trsm_kers( l3ukr_t ukr_id, cntx_t* cntx )
+{
+	func_t* funcs = bli_cntx_l3_sup_trsm_kers_buf( cntx );
+	func_t* func  = &funcs[ ukr_id ];
+
+	return func;
+}
+
+BLIS_INLINE void_fp bli_cntx_get_l3_sup_trsm_ker_dt( num_t dt, l3ukr_t ukr_id, cntx_t* cntx )
+{
+	func_t* func = bli_cntx_get_l3_sup_trsm_kers( ukr_id, cntx );
+
+	return bli_func_get_dt( dt, func );
+}
+
+// -----------------------------------------------------------------------------
+
+BLIS_INLINE mbool_t* bli_cntx_get_l3_sup_trsm_ker_prefs( l3ukr_t ukr_id, cntx_t* cntx )
+{
+	mbool_t* mbools = bli_cntx_l3_sup_trsm_kers_prefs_buf( cntx );
+	mbool_t* mbool  = &mbools[ ukr_id ];
+
+	return mbool;
+}
+
+BLIS_INLINE bool bli_cntx_get_l3_sup_trsm_ker_prefs_dt( num_t dt, l3ukr_t ukr_id, cntx_t* cntx )
+{
+	mbool_t* mbool = bli_cntx_get_l3_sup_trsm_ker_prefs( ukr_id, cntx );
+
+	return ( bool )bli_mbool_get_dt( dt, mbool );
+}
+
+// -----------------------------------------------------------------------------
+
 BLIS_INLINE func_t* bli_cntx_get_l1f_kers( l1fkr_t ker_id, cntx_t* cntx )
 {
 	func_t* funcs = bli_cntx_l1f_kers_buf( cntx );
@@ -419,6 +475,27 @@ BLIS_INLINE void_fp bli_cntx_get_l1v_ker_dt( num_t dt, l1vkr_t ker_id, cntx_t* c
 	return bli_func_get_dt( dt, func );
 }
 
+BLIS_INLINE dim_t bli_cntx_get_l1v_thresh_dt( num_t dt, cntx_t* cntx )
+{
+	blksz_t* thresh = bli_cntx_l1v_thresh_buf( cntx );
+
+	return bli_blksz_get_def( dt, thresh );
+}
+
+// -----------------------------------------------------------------------------
+
+BLIS_INLINE lpgemm_ker_t* bli_cntx_get_lpgemm_ker( lpgemm_t ker_id, cntx_t* cntx )
+{
+	lpgemm_ker_t* kers = bli_cntx_lpgemm_kers_buf( cntx );
+
+	return &kers[ ker_id ];
+}
+
+BLIS_INLINE void_fp bli_cntx_get_packm_f16_ker( cntx_t* cntx )
+{
+	return cntx->packm_f16_ker;
+}
+
 // -----------------------------------------------------------------------------
 
 BLIS_INLINE func_t* bli_cntx_get_packm_kers( l1mkr_t ker_id, cntx_t* cntx )
@@ -605,6 +682,26 @@ BLIS_INLINE bool bli_cntx_l3_sup_ker_prefers_cols_dt( num_t dt, stor3_t stor_id,
 	       ( prefs == FALSE );
 }
 
+BLIS_INLINE bool bli_cntx_l3_sup_trsm_ker_prefers_rows_dt( num_t dt, l3ukr_t ukr_id, cntx_t* cntx )
+{
+	const bool prefs = bli_cntx_get_l3_sup_trsm_ker_prefs_dt( dt, ukr_id, cntx );
+
+	// A ukernel preference of TRUE means the ukernel prefers that B be
+	// stored by rows.
+	return ( bool )
+	       ( prefs == TRUE );
+}
+
+BLIS_INLINE bool bli_cntx_l3_sup_trsm_ker_prefers_cols_dt( num_t dt, l3ukr_t ukr_id, cntx_t* cntx )
+{
+	const bool prefs = bli_cntx_get_l3_sup_trsm_ker_prefs_dt( dt, ukr_id, cntx );
+
+	// A ukernel preference of FALSE means the ukernel prefers that B be
+	// stored by columns.
+	return ( bool )
+	       ( prefs == FALSE );
+}
+
 #if 0
 // NOTE: These static functions aren't needed yet.
 
@@ -699,6 +796,11 @@ BLIS_INLINE void bli_cntx_set_l1v_ker( l1vkr_t ker_id, func_t* func, cntx_t* cnt
 	funcs[ ker_id ] = *func;
 }
 
+BLIS_INLINE void bli_cntx_set_l1v_thresh( blksz_t* thresh, cntx_t* cntx )
+{
+	*bli_cntx_l1v_thresh_buf( cntx ) = *thresh;
+}
+
 BLIS_INLINE void bli_cntx_set_packm_ker( l1mkr_t ker_id, func_t* func, cntx_t* cntx )
 {
 	func_t* funcs = bli_cntx_get_packm_kers( ker_id, cntx );
@@ -727,6 +829,35 @@ BLIS_INLINE void bli_cntx_set_unpackm_ker_dt( void_fp fp, num_t dt, l1mkr_t ker_
 	bli_func_set_dt( fp, dt, func );
 }
 
+BLIS_INLINE void bli_cntx_set_lpgemm_ker
+     (
+       lpgemm_t ker_id,
+       void_fp  ukr,
+       dim_t    mr,
+       dim_t    nr,
+       dim_t    kr,
+       dim_t    mc,
+       dim_t    kc,
+       dim_t    nc,
+       cntx_t*  cntx
+     )
+{
+	lpgemm_ker_t* ker = bli_cntx_get_lpgemm_ker( ker_id, cntx );
+
+	ker->ukr = ukr;
+	ker->mr  = mr;
+	ker->nr  = nr;
+	ker->kr  = kr;
+	ker->mc  = mc;
+	ker->kc  = kc;
+	ker->nc  = nc;
+}
+
+BLIS_INLINE void bli_cntx_set_packm_f16_ker( void_fp fp, cntx_t* cntx )
+{
+	cntx->packm_f16_ker = fp;
+}
+
 // -----------------------------------------------------------------------------
 
 // Function prototypes
@@ -744,6 +875,7 @@ BLIS_EXPORT_BLIS void bli_cntx_set_l3_sup_thresh( dim_t n_thresh, ... );
 BLIS_EXPORT_BLIS void bli_cntx_set_l3_sup_handlers( dim_t n_ops, ... );
 BLIS_EXPORT_BLIS void bli_cntx_set_l3_sup_blkszs( dim_t n_bs, ... );
 BLIS_EXPORT_BLIS void bli_cntx_set_l3_sup_kers( dim_t n_ukrs, ... );
+BLIS_EXPORT_BLIS void bli_cntx_set_l3_sup_trsm_kers( dim_t n_ukrs, ... );
 
 BLIS_EXPORT_BLIS void bli_cntx_set_l1f_kers( dim_t n_kers, ... );
 BLIS_EXPORT_BLIS void bli_cntx_set_l1v_kers( dim_t n_kers, ... );
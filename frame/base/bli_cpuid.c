@@ -451,6 +451,14 @@ arch_t bli_cpuid_query_id( void )
 
 	if ( vendor == VENDOR_ARM )
 	{
+		// SVE is detected independently of the model, since the kernels
+		// that use it are vector-length agnostic and thus do not depend
+		// on any particular microarchitecture.
+#ifdef BLIS_CONFIG_ARMSVE
+		if ( bli_cpuid_is_armsve( model, part, features ) )
+			return BLIS_ARCH_ARMSVE;
+#endif
+
 		if ( model == MODEL_ARMV8 )
 		{
 			// Check for each ARMv8 configuration that is enabled, check for that
@@ -492,6 +500,21 @@ arch_t bli_cpuid_query_id( void )
 	return BLIS_ARCH_GENERIC;
 }
 
+bool bli_cpuid_is_armsve
+     (
+       uint32_t family,
+       uint32_t model,
+       uint32_t features
+     )
+{
+	// Check for expected CPU features.
+	const uint32_t expected = FEATURE_SVE;
+
+	if ( !bli_cpuid_has_features( features, expected ) ) return FALSE;
+
+	return TRUE;
+}
+
 bool bli_cpuid_is_thunderx2
      (
        uint32_t family,
@@ -629,6 +652,8 @@ enum
 	FEATURE_MASK_AVX512CD = (1u<<28), // cpuid[eax=7,ecx=0]   :ebx[28]
 	FEATURE_MASK_AVX512BW = (1u<<30), // cpuid[eax=7,ecx=0]   :ebx[30]
 	FEATURE_MASK_AVX512VL = (1u<<31), // cpuid[eax=7,ecx=0]   :ebx[31]
+	FEATURE_MASK_AVX512VNNI = (1u<<11), // cpuid[eax=7,ecx=0]   :ecx[11]
+	FEATURE_MASK_AVX512BF16 = (1u<< 5), // cpuid[eax=7,ecx=1]   :eax[5]
 	FEATURE_MASK_XGETBV   = (1u<<26)|
                             (1u<<27), // cpuid[eax=1]         :ecx[27:26]
 	XGETBV_MASK_XMM       = 0x02u,    // xcr0[1]
@@ -695,6 +720,16 @@ uint32_t bli_cpuid_query
 		if ( bli_cpuid_has_features( ebx, FEATURE_MASK_AVX512CD ) ) *features |= FEATURE_AVX512CD;
 		if ( bli_cpuid_has_features( ebx, FEATURE_MASK_AVX512BW ) ) *features |= FEATURE_AVX512BW;
 		if ( bli_cpuid_has_features( ebx, FEATURE_MASK_AVX512VL ) ) *features |= FEATURE_AVX512VL;
+
+		if ( bli_cpuid_has_features( ecx, FEATURE_MASK_AVX512VNNI ) ) *features |= FEATURE_AVX512VNNI;
+
+		// Sub-leaf 1 exists only if sub-leaf 0 reports it in eax.
+		if ( eax >= 1 )
+		{
+			__cpuid_count( 7, 1, eax, ebx, ecx, edx );
+
+			if ( bli_cpuid_has_features( eax, FEATURE_MASK_AVX512BF16 ) ) *features |= FEATURE_AVX512BF16;
+		}
 	}
 
 	// Check extended processor info / features bits for AMD-specific features.
@@ -822,7 +857,9 @@ uint32_t bli_cpuid_query
 				                FEATURE_AVX512ER |
 				                FEATURE_AVX512CD |
 				                FEATURE_AVX512BW |
-				                FEATURE_AVX512VL );
+				                FEATURE_AVX512VL |
+				                FEATURE_AVX512VNNI |
+				                FEATURE_AVX512BF16 );
 			}
 
 			// The OS can manage the state of 256-bit ymm (AVX) registers
@@ -987,6 +1024,13 @@ int vpu_count( void )
 
 #elif defined(__aarch64__) || defined(__arm__) || defined(_M_ARM)
 
+#if defined(__aarch64__) && defined(__linux__)
+#include <sys/auxv.h>
+#ifndef HWCAP_SVE
+#define HWCAP_SVE ( 1 << 22 )
+#endif
+#endif
+
 #define TEMP_BUFFER_SIZE 200
 
 uint32_t bli_cpuid_query
@@ -1007,6 +1051,15 @@ uint32_t bli_cpuid_query
 	char  feat_str[ TEMP_BUFFER_SIZE ];
 	char* r_val;
 
+#if defined(__aarch64__) && defined(__linux__)
+	// Query the kernel's hardware capability bits for SVE. We do this before
+	// searching /proc/cpuinfo since the 'Features' entry may be truncated by
+	// our buffer, and since newer kernels omit the 'Processor' entry, which
+	// would otherwise cause us to return early below.
+	if ( getauxval( AT_HWCAP ) & HWCAP_SVE )
+		*features |= FEATURE_SVE;
+#endif
+
 	//printf( "bli_cpuid_query(): beginning search\n" );
 
 	// Search /proc/cpuinfo for the 'Processor' entry.
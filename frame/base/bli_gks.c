@@ -129,6 +129,11 @@ void bli_gks_init( void )
 #endif
 
 		// ARM architectures
+#ifdef BLIS_CONFIG_ARMSVE
+		bli_gks_register_cntx( BLIS_ARCH_ARMSVE,      bli_cntx_init_armsve,
+		                                              bli_cntx_init_armsve_ref,
+		                                              bli_cntx_init_armsve_ind );
+#endif
 #ifdef BLIS_CONFIG_THUNDERX2
 		bli_gks_register_cntx( BLIS_ARCH_THUNDERX2,   bli_cntx_init_thunderx2,
 		                                              bli_cntx_init_thunderx2_ref,
@@ -287,6 +292,15 @@ cntx_t* bli_gks_lookup_ind_cntx
 	// Index into the array of context pointers for the given architecture id,
 	// and then index into the subarray for the given induced method.
 	cntx_t** restrict gks_id     = gks[ id ];
+
+	// Sanity check: verify that the architecture was registered. (This may
+	// not be the case if the id was requested via BLIS_ARCH_TYPE.)
+	if ( bli_error_checking_is_enabled() )
+	{
+		err_t e_val = bli_check_initialized_gks_cntx( gks_id );
+		bli_check_error_code( e_val );
+	}
+
 	cntx_t*  restrict gks_id_ind = gks_id[ ind ];
 
 	// Return the context pointer at gks_id_ind.
@@ -431,6 +445,43 @@ cntx_t* bli_gks_query_nat_cntx( void )
 
 // -----------------------------------------------------------------------------
 
+cntx_t* bli_gks_query_cntx_for_arch
+     (
+       arch_t id
+     )
+{
+	bli_init_once();
+
+	// Return the address of the native context for the given architecture
+	// id, which need not be the id returned by bli_arch_query_id(). This
+	// allows the caller to pass the context of any registered sub-
+	// configuration into the expert APIs, e.g. to compare the kernels and
+	// blocksizes of two sub-configurations on the same hardware. (Note that
+	// this is only safe if the hardware supports the instructions used by
+	// that sub-configuration's kernels.) bli_gks_lookup_nat_cntx() verifies
+	// that the architecture was registered.
+
+	return bli_gks_lookup_nat_cntx( id );
+}
+
+bool bli_gks_arch_is_registered
+     (
+       arch_t id
+     )
+{
+	bli_init_once();
+
+	// Return whether a context was registered for the given architecture
+	// id. Unlike most gks functions, this one accepts any arch_t value so
+	// that the caller may use it to iterate over all architectures.
+
+	if ( bli_check_valid_arch_id( id ) != BLIS_SUCCESS ) return FALSE;
+
+	return gks[ id ] != NULL;
+}
+
+// -----------------------------------------------------------------------------
+
 cntx_t* bli_gks_query_cntx_noinit( void )
 {
 	// This function is identical to bli_gks_query_cntx(), except that it
@@ -491,6 +542,14 @@ cntx_t* bli_gks_query_ind_cntx
 	// Query the gks for the array of context pointers corresponding to the
 	// given architecture id.
 	cntx_t** restrict gks_id     = gks[ id ];
+
+	// Sanity check: verify that the architecture was registered.
+	if ( bli_error_checking_is_enabled() )
+	{
+		err_t e_val = bli_check_initialized_gks_cntx( gks_id );
+		bli_check_error_code( e_val );
+	}
+
 	cntx_t*  restrict gks_id_nat = gks_id[ BLIS_NAT ];
 
 	// If for some reason the native context was requested, we can return
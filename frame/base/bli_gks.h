@@ -47,6 +47,9 @@ void    bli_gks_register_cntx( arch_t id, void_fp nat_fp, void_fp ref_fp, void_f
 BLIS_EXPORT_BLIS cntx_t* bli_gks_query_cntx( void );
 BLIS_EXPORT_BLIS cntx_t* bli_gks_query_nat_cntx( void );
 
+BLIS_EXPORT_BLIS cntx_t* bli_gks_query_cntx_for_arch( arch_t id );
+BLIS_EXPORT_BLIS bool    bli_gks_arch_is_registered( arch_t id );
+
 cntx_t* bli_gks_query_cntx_noinit( void );
 
 BLIS_EXPORT_BLIS cntx_t* bli_gks_query_ind_cntx( ind_t ind, num_t dt );
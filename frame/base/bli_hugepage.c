@@ -0,0 +1,206 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#if defined(__linux__)
+  // Needed for MAP_ANONYMOUS, MAP_HUGETLB, and MADV_HUGEPAGE.
+  #ifndef _GNU_SOURCE
+  #define _GNU_SOURCE
+  #endif
+  #include <sys/mman.h>
+#endif
+
+#include "blis.h"
+
+// Each allocation begins with a small header that records how the memory
+// was obtained so that bli_free_hugepage() knows how to release it. The
+// header is padded so that the address returned to the caller remains
+// suitably aligned for bli_fmalloc_align().
+typedef enum
+{
+	BLIS_HUGEPAGE_ALLOC_MALLOC = 0,
+	BLIS_HUGEPAGE_ALLOC_HUGETLB,
+	BLIS_HUGEPAGE_ALLOC_THP
+
+} hugepage_alloc_t;
+
+typedef union
+{
+	struct
+	{
+		hugepage_alloc_t kind;
+		void*            base;
+		size_t           len;
+	} s;
+
+	char pad[ 64 ];
+
+} hugepage_hdr_t;
+
+static bool               hugepage_enabled = FALSE;
+static bli_pthread_once_t hugepage_once    = BLIS_PTHREAD_ONCE_INIT;
+
+static void bli_hugepage_init_enabled( void )
+{
+#ifdef BLIS_ENABLE_HUGEPAGES
+	const gint_t def = 1;
+#else
+	const gint_t def = 0;
+#endif
+
+	// The environment variable, if set, overrides the configure-time
+	// default.
+	hugepage_enabled = ( bli_env_get_var( "BLIS_HUGEPAGES", def ) != 0 );
+}
+
+bool bli_hugepage_is_enabled( void )
+{
+	// Query the environment only once so that all blocks allocated by
+	// bli_malloc_hugepage() are freed consistently, even if the
+	// environment changes between calls to bli_init() and bli_finalize().
+	bli_pthread_once( &hugepage_once, bli_hugepage_init_enabled );
+
+	return hugepage_enabled;
+}
+
+void* bli_malloc_hugepage( size_t size )
+{
+	const size_t    hdr_size = sizeof( hugepage_hdr_t );
+	hugepage_hdr_t* hdr      = NULL;
+
+#if defined(__linux__)
+	const size_t hp_size = BLIS_HUGEPAGE_SIZE;
+
+	// Small requests would waste most of a huge page, and they span few
+	// enough base pages that TLB reach is not a concern, so we serve them
+	// with malloc() (below).
+	if ( size + hdr_size >= hp_size / 2 )
+	{
+		// Round the length of the mapping up to a whole number of huge
+		// pages.
+		const size_t len = ( ( size + hdr_size + hp_size - 1 ) / hp_size )
+		                   * hp_size;
+
+		#ifdef MAP_HUGETLB
+		// First, try to map pages from the hugetlbfs pool. This only
+		// succeeds if the administrator has reserved huge pages (e.g. via
+		// /proc/sys/vm/nr_hugepages).
+		void* base = mmap( NULL, len, PROT_READ | PROT_WRITE,
+		                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 );
+
+		if ( base != MAP_FAILED )
+		{
+			hdr = base;
+			hdr->s.kind = BLIS_HUGEPAGE_ALLOC_HUGETLB;
+			hdr->s.base = base;
+			hdr->s.len  = len;
+		}
+		else
+		#endif
+		{
+			// Otherwise, map ordinary anonymous memory that is large enough
+			// to contain a huge page-aligned region of length len, trim the
+			// excess on either side, and ask the kernel to back the region
+			// with transparent huge pages.
+			char* raw = mmap( NULL, len + hp_size, PROT_READ | PROT_WRITE,
+			                  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+
+			if ( raw != MAP_FAILED )
+			{
+				const size_t head    = ( hp_size - ( uintptr_t )raw % hp_size )
+				                       % hp_size;
+				const size_t tail    = hp_size - head;
+				char*        aligned = raw + head;
+
+				if ( head != 0 ) munmap( raw, head );
+				if ( tail != 0 ) munmap( aligned + len, tail );
+
+				#ifdef MADV_HUGEPAGE
+				madvise( aligned, len, MADV_HUGEPAGE );
+				#endif
+
+				hdr = ( hugepage_hdr_t* )aligned;
+				hdr->s.kind = BLIS_HUGEPAGE_ALLOC_THP;
+				hdr->s.base = aligned;
+				hdr->s.len  = len;
+			}
+		}
+	}
+#endif
+
+	// If huge pages are not supported, or if the mappings above failed, we
+	// fall back to malloc().
+	if ( hdr == NULL )
+	{
+		hdr = malloc( size + hdr_size );
+
+		if ( hdr == NULL ) return NULL;
+
+		hdr->s.kind = BLIS_HUGEPAGE_ALLOC_MALLOC;
+		hdr->s.base = hdr;
+		hdr->s.len  = size + hdr_size;
+	}
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_malloc_hugepage(): size %ld, kind %d\n",
+	        ( long )size, ( int )hdr->s.kind );
+	fflush( stdout );
+	#endif
+
+	return ( char* )hdr + hdr_size;
+}
+
+void bli_free_hugepage( void* p )
+{
+	if ( p == NULL ) return;
+
+	hugepage_hdr_t* hdr = ( hugepage_hdr_t* )( ( char* )p - sizeof( hugepage_hdr_t ) );
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_free_hugepage(): freeing block of kind %d\n",
+	        ( int )hdr->s.kind );
+	fflush( stdout );
+	#endif
+
+#if defined(__linux__)
+	if ( hdr->s.kind != BLIS_HUGEPAGE_ALLOC_MALLOC )
+	{
+		munmap( hdr->s.base, hdr->s.len );
+		return;
+	}
+#endif
+
+	free( hdr->s.base );
+}
+
@@ -36,13 +36,121 @@
 
 #include "blis.h"
 
-static membrk_t global_membrk;
+// One packing block allocator per NUMA node. When the system has only one
+// node (or the number of nodes could not be determined), only the first
+// element is used.
+static membrk_t global_membrk[ BLIS_NUMA_NODES_MAX ];
+static dim_t    global_membrk_n_nodes = 1;
+
+#if defined( BLIS_ENABLE_PBA_POOLS ) && defined( BLIS_ENABLE_PBA_TCACHE )
+
+// Each thread may hold on to at most one released block for each of the
+// three pool types (A, B, and C) in a thread-specific cache. Cached blocks
+// are "detached" from the pool that allocated them: the pool no longer
+// tracks them, and so a thread that repeatedly acquires and releases
+// blocks of the same type (e.g. an application thread calling single-
+// threaded BLIS in a loop) can do so without acquiring a membrk_t mutex.
+typedef struct membrk_tcache_s
+{
+	pblk_t blocks[ 3 ];
+
+} membrk_tcache_t;
+
+// The key is created only once and never deleted so that the destructor
+// frees the cached blocks of any thread that exits, even after the membrk_t
+// objects have been finalized.
+static bli_pthread_key_t  membrk_tcache_key;
+static bli_pthread_once_t membrk_tcache_once = BLIS_PTHREAD_ONCE_INIT;
+
+// Free a detached block of pool type pi. The offset sizes and free()
+// function must match those used by bli_membrk_init_pools().
+static void bli_membrk_tcache_free_block( dim_t pi, pblk_t* blk )
+{
+	const siz_t offset_size[ 3 ] = { BLIS_POOL_ADDR_OFFSET_SIZE_A,
+	                                 BLIS_POOL_ADDR_OFFSET_SIZE_B,
+	                                 BLIS_POOL_ADDR_OFFSET_SIZE_C };
+
+	free_ft free_fp = BLIS_FREE_POOL;
+
+	if ( bli_hugepage_is_enabled() ) free_fp = bli_free_hugepage;
+
+	bli_pool_free_block( offset_size[ pi ], free_fp, blk );
+	bli_pblk_clear( blk );
+}
+
+static void bli_membrk_tcache_free( void* tc_p )
+{
+	membrk_tcache_t* tc = tc_p;
+
+	if ( tc == NULL ) return;
+
+	for ( dim_t pi = 0; pi < 3; ++pi )
+	{
+		pblk_t* tblk = &(tc->blocks[ pi ]);
+
+		if ( bli_pblk_buf( tblk ) != NULL )
+			bli_membrk_tcache_free_block( pi, tblk );
+	}
+}
+
+static void bli_membrk_tcache_destroy( void* tc_p )
+{
+	bli_membrk_tcache_free( tc_p );
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_membrk_tcache_destroy(): " );
+	#endif
+	bli_free_intl( tc_p );
+}
+
+static void bli_membrk_tcache_init_key( void )
+{
+	bli_pthread_key_create( &membrk_tcache_key, bli_membrk_tcache_destroy );
+}
+
+static membrk_tcache_t* bli_membrk_tcache( void )
+{
+	membrk_tcache_t* tc = bli_pthread_getspecific( membrk_tcache_key );
+
+	// Lazily allocate the calling thread's cache the first time it is
+	// needed.
+	if ( tc == NULL )
+	{
+		#ifdef BLIS_ENABLE_MEM_TRACING
+		printf( "bli_membrk_tcache(): " );
+		#endif
+		tc = bli_malloc_intl( sizeof( membrk_tcache_t ) );
+
+		for ( dim_t pi = 0; pi < 3; ++pi )
+			bli_pblk_clear( &(tc->blocks[ pi ]) );
+
+		bli_pthread_setspecific( membrk_tcache_key, tc );
+	}
+
+	return tc;
+}
+
+#endif
 
 // -----------------------------------------------------------------------------
 
 membrk_t* bli_membrk_query( void )
 {
-    return &global_membrk;
+    return &global_membrk[0];
+}
+
+membrk_t* bli_membrk_query_node( dim_t node )
+{
+	// Threads on nodes beyond those for which we keep pools share the
+	// pools of node 0.
+	if ( node < 0 || global_membrk_n_nodes <= node ) node = 0;
+
+	return &global_membrk[ node ];
+}
+
+dim_t bli_membrk_num_nodes( void )
+{
+	return global_membrk_n_nodes;
 }
 
 void bli_membrk_init
@@ -50,22 +158,35 @@ void bli_membrk_init
        cntx_t* restrict cntx
      )
 {
-	membrk_t* restrict membrk = bli_membrk_query();
+	global_membrk_n_nodes = bli_numa_num_nodes();
 
-	const siz_t align_size = BLIS_POOL_ADDR_ALIGN_SIZE_GEN;
-	malloc_ft   malloc_fp  = BLIS_MALLOC_POOL;
-	free_ft     free_fp    = BLIS_FREE_POOL;
+#if defined( BLIS_ENABLE_PBA_POOLS ) && defined( BLIS_ENABLE_PBA_TCACHE )
+	bli_pthread_once( &membrk_tcache_once, bli_membrk_tcache_init_key );
+#endif
+
+	for ( dim_t node = 0; node < global_membrk_n_nodes; ++node )
+	{
+		membrk_t* restrict membrk = &global_membrk[ node ];
 
-	// These fields are used for general-purpose allocation (ie: buf_type
-	// equal to BLIS_BUFFER_FOR_GEN_USE) within bli_membrk_acquire_m().
-	bli_membrk_set_align_size( align_size, membrk );
-	bli_membrk_set_malloc_fp( malloc_fp, membrk );
-	bli_membrk_set_free_fp( free_fp, membrk );
+		const siz_t align_size = BLIS_POOL_ADDR_ALIGN_SIZE_GEN;
+		malloc_ft   malloc_fp  = BLIS_MALLOC_POOL;
+		free_ft     free_fp    = BLIS_FREE_POOL;
 
-	bli_membrk_init_mutex( membrk );
+		// These fields are used for general-purpose allocation (ie: buf_type
+		// equal to BLIS_BUFFER_FOR_GEN_USE) within bli_membrk_acquire_m().
+		bli_membrk_set_align_size( align_size, membrk );
+		bli_membrk_set_malloc_fp( malloc_fp, membrk );
+		bli_membrk_set_free_fp( free_fp, membrk );
+
+		membrk->node     = node;
+		membrk->n_local  = 0;
+		membrk->n_remote = 0;
+
+		bli_membrk_init_mutex( membrk );
 #ifdef BLIS_ENABLE_PBA_POOLS
-	bli_membrk_init_pools( cntx, membrk );
+		bli_membrk_init_pools( cntx, membrk );
 #endif
+	}
 }
 
 void bli_membrk_finalize
@@ -73,15 +194,53 @@ void bli_membrk_finalize
        void
      )
 {
-	membrk_t* restrict membrk = bli_membrk_query();
+	for ( dim_t node = 0; node < global_membrk_n_nodes; ++node )
+	{
+		membrk_t* restrict membrk = &global_membrk[ node ];
 
-	bli_membrk_set_malloc_fp( NULL, membrk );
-	bli_membrk_set_free_fp( NULL, membrk );
+		bli_membrk_set_malloc_fp( NULL, membrk );
+		bli_membrk_set_free_fp( NULL, membrk );
 
 #ifdef BLIS_ENABLE_PBA_POOLS
-	bli_membrk_finalize_pools( membrk );
+		bli_membrk_finalize_pools( membrk );
+#endif
+		bli_membrk_finalize_mutex( membrk );
+	}
+
+	global_membrk_n_nodes = 1;
+
+#if defined( BLIS_ENABLE_PBA_POOLS ) && defined( BLIS_ENABLE_PBA_TCACHE )
+	// Free any blocks held by the calling thread's cache. (The caches of
+	// other threads are freed when those threads exit.)
+	bli_membrk_tcache_free( bli_pthread_getspecific( membrk_tcache_key ) );
 #endif
-	bli_membrk_finalize_mutex( membrk );
+}
+
+void bli_membrk_checkout_counts
+     (
+       dim_t  node,
+       siz_t* n_local,
+       siz_t* n_remote
+     )
+{
+	membrk_t* membrk = bli_membrk_query_node( node );
+
+	*n_local  = __atomic_load_n( &(membrk->n_local),  __ATOMIC_RELAXED );
+	*n_remote = __atomic_load_n( &(membrk->n_remote), __ATOMIC_RELAXED );
+}
+
+// Find the membrk_t that owns a given pool_t.
+static membrk_t* bli_membrk_of_pool( pool_t* pool )
+{
+	for ( dim_t node = 1; node < global_membrk_n_nodes; ++node )
+	{
+		membrk_t* membrk = &global_membrk[ node ];
+
+		if ( bli_membrk_pool( 0, membrk ) <= pool &&
+		     pool <= bli_membrk_pool( 2, membrk ) ) return membrk;
+	}
+
+	return &global_membrk[0];
 }
 
 void bli_membrk_acquire_m
@@ -147,12 +306,50 @@ void bli_membrk_acquire_m
 		// Extract the address of the pblk_t struct within the mem_t.
 		pblk = bli_mem_pblk( mem );
 
+		// Determine whether the calling thread is running on the node
+		// associated with the membrk object (which is normally the case
+		// unless the thread has migrated since the membrk was chosen).
+		const bool is_local =
+		( global_membrk_n_nodes == 1 ||
+		  bli_numa_curr_node() == membrk->node );
+
+		if ( is_local ) __atomic_fetch_add( &(membrk->n_local),  1, __ATOMIC_RELAXED );
+		else            __atomic_fetch_add( &(membrk->n_remote), 1, __ATOMIC_RELAXED );
+
+#if defined( BLIS_ENABLE_PBA_POOLS ) && defined( BLIS_ENABLE_PBA_TCACHE )
+		membrk_tcache_t* tc   = bli_membrk_tcache();
+		pblk_t*          tblk = &(tc->blocks[ pi ]);
+
+		if ( bli_pblk_buf( tblk ) != NULL )
+		{
+			if ( req_size <= bli_pblk_block_size( tblk ) )
+			{
+				// The calling thread's cache holds a block that is large
+				// enough, so we take it without touching the pool (or its
+				// mutex). Since the block is detached from any pool, we set
+				// the mem_t's pool field to NULL.
+				*pblk = *tblk;
+				bli_pblk_clear( tblk );
+
+				bli_mem_set_buf_type( buf_type, mem );
+				bli_mem_set_pool( NULL, mem );
+				bli_mem_set_size( bli_pblk_block_size( pblk ), mem );
+				return;
+			}
+
+			// Otherwise, the cached block is too small (e.g. because the
+			// cache blocksizes have since grown), so we free it and fall
+			// back to the pool, which will reinitialize itself with larger
+			// blocks as usual.
+			bli_membrk_tcache_free_block( pi, tblk );
+		}
+#endif
+
 		// Acquire the mutex associated with the membrk object.
 		bli_membrk_lock( membrk );
 
 		// BEGIN CRITICAL SECTION
 		{
-
 			// Checkout a block from the pool. If the pool's blocks are too
 			// small, it will be reinitialized with blocks large enough to
 			// accommodate the requested block size. If the pool is exhausted,
@@ -229,12 +426,46 @@ void bli_membrk_release
 		// Extract the address of the pblk_t struct within the mem_t struct.
 		pblk = bli_mem_pblk( mem );
 
+#if defined( BLIS_ENABLE_PBA_POOLS ) && defined( BLIS_ENABLE_PBA_TCACHE )
+		const dim_t      pi   = bli_packbuf_index( buf_type );
+		membrk_tcache_t* tc   = bli_membrk_tcache();
+		pblk_t*          tblk = &(tc->blocks[ pi ]);
+
+		if ( pool == NULL )
+		{
+			// The block was detached from its pool when it was cached by
+			// some thread (not necessarily the calling thread). We either
+			// cache it again or, if the cache slot is taken, free it.
+			if ( bli_pblk_buf( tblk ) == NULL ) *tblk = *pblk;
+			else bli_membrk_tcache_free_block( pi, pblk );
+
+			bli_mem_clear( mem );
+			return;
+		}
+#endif
+
+		// Use the membrk object that owns the pool, which may differ from
+		// that of the rntm_t if the block was acquired via another rntm_t.
+		membrk = bli_membrk_of_pool( pool );
+
 		// Acquire the mutex associated with the membrk object.
 		bli_membrk_lock( membrk );
 
 		// BEGIN CRITICAL SECTION
 		{
-
+#if defined( BLIS_ENABLE_PBA_POOLS ) && defined( BLIS_ENABLE_PBA_TCACHE )
+			// If the calling thread's cache slot is empty, we detach the
+			// block from its pool and cache it so that the next checkout of
+			// this type from the calling thread may bypass the mutex.
+			// Orphaned blocks cannot be detached, and so they are checked
+			// in (and thus freed) as usual.
+			if ( bli_pblk_buf( tblk ) == NULL &&
+			     bli_pool_detach_block( pblk, pool ) )
+			{
+				*tblk = *pblk;
+			}
+			else
+#endif
 			// Check the block back into the pool.
 			bli_pool_checkin_block( pblk, pool );
 
@@ -277,8 +508,14 @@ void bli_membrk_rntm_set_membrk
        rntm_t* rntm
      )
 {
+	// Use the membrk_t associated with the NUMA node on which the calling
+	// thread is currently running so that the packing blocks it acquires
+	// were (most likely) first touched by threads on the same node.
 	membrk_t* membrk = bli_membrk_query();
 
+	if ( 1 < global_membrk_n_nodes )
+		membrk = bli_membrk_query_node( bli_numa_curr_node() );
+
 	bli_rntm_set_membrk( membrk, rntm );
 }
 
@@ -363,6 +600,17 @@ void bli_membrk_init_pools
 	malloc_ft malloc_fp  = BLIS_MALLOC_POOL;
 	free_ft   free_fp    = BLIS_FREE_POOL;
 
+	// If huge pages were requested (at configure-time or via the
+	// environment), allocate pool blocks with the huge page allocator
+	// instead. Packed B panels in particular often span hundreds of base
+	// pages, which otherwise leads to frequent TLB misses in the
+	// microkernel.
+	if ( bli_hugepage_is_enabled() )
+	{
+		malloc_fp = bli_malloc_hugepage;
+		free_fp   = bli_free_hugepage;
+	}
+
 	// Determine the block size for each memory pool.
 	bli_membrk_compute_pool_block_sizes( &block_size_a,
 	                                     &block_size_b,
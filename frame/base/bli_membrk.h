@@ -103,6 +103,15 @@ BLIS_INLINE void bli_membrk_unlock( membrk_t* membrk )
 // -----------------------------------------------------------------------------
 
 membrk_t* bli_membrk_query( void );
+membrk_t* bli_membrk_query_node( dim_t node );
+
+BLIS_EXPORT_BLIS dim_t bli_membrk_num_nodes( void );
+BLIS_EXPORT_BLIS void  bli_membrk_checkout_counts
+     (
+       dim_t  node,
+       siz_t* n_local,
+       siz_t* n_remote
+     );
 
 void bli_membrk_init
      (
@@ -4,7 +4,7 @@
    An object-based framework for developing high-performance BLAS-like
    libraries.
 
-   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2020, The University of Texas at Austin
 
    Redistribution and use in source and binary forms, with or without
    modification, are permitted provided that the following conditions are
@@ -32,11 +32,71 @@
 
 */
 
-#ifdef BLIS_ENABLE_BLAS
+#if defined(__linux__)
+  // Needed for syscall().
+  #ifndef _GNU_SOURCE
+  #define _GNU_SOURCE
+  #endif
+  #include <unistd.h>
+  #include <sys/syscall.h>
+#endif
+
+#include "blis.h"
+
+// Return the number of NUMA nodes in the system, as reported by sysfs, or
+// 1 if the number of nodes could not be determined (or is not applicable
+// to the operating system). The value is capped at BLIS_NUMA_NODES_MAX.
+dim_t bli_numa_num_nodes( void )
+{
+	dim_t n_nodes = 1;
+
+#if defined(__linux__)
+	FILE* fp = fopen( "/sys/devices/system/node/possible", "r" );
+
+	if ( fp != NULL )
+	{
+		char buf[ 256 ];
+
+		// The file contains a list of node id ranges, such as "0" or "0-3"
+		// or "0,2-3". We simply find the largest node id in the list.
+		if ( fgets( buf, sizeof( buf ), fp ) != NULL )
+		{
+			char* p      = buf;
+			long  id_max = 0;
+
+			while ( *p != '\0' )
+			{
+				if ( isdigit( ( unsigned char )*p ) )
+				{
+					long id = strtol( p, &p, 10 );
+					if ( id_max < id ) id_max = id;
+				}
+				else ++p;
+			}
 
-BLIS_EXPORT_BLAS int PASTEF77(c,gbmv)(const bla_character *trans, const bla_integer *m, const bla_integer *n, const bla_integer *kl, const bla_integer *ku, const bla_scomplex *alpha, const bla_scomplex *a, const bla_integer *lda, const bla_scomplex *x, const bla_integer *incx, const bla_scomplex *beta, bla_scomplex *y, const bla_integer *incy);
-BLIS_EXPORT_BLAS int PASTEF77(d,gbmv)(const bla_character *trans, const bla_integer *m, const bla_integer *n, const bla_integer *kl, const bla_integer *ku, const bla_double *alpha, const bla_double *a, const bla_integer *lda, const bla_double *x, const bla_integer *incx, const bla_double *beta, bla_double *y, const bla_integer *incy);
-BLIS_EXPORT_BLAS int PASTEF77(s,gbmv)(const bla_character *trans, const bla_integer *m, const bla_integer *n, const bla_integer *kl, const bla_integer *ku, const bla_real *alpha, const bla_real *a, const bla_integer *lda, const bla_real *x, const bla_integer * incx, const bla_real *beta, bla_real *y, const bla_integer *incy);
-BLIS_EXPORT_BLAS int PASTEF77(z,gbmv)(const bla_character *trans, const bla_integer *m, const bla_integer *n, const bla_integer *kl, const bla_integer *ku, const bla_dcomplex *alpha, const bla_dcomplex *a, const bla_integer *lda, const bla_dcomplex *x, const bla_integer *incx, const bla_dcomplex *beta, bla_dcomplex * y, const bla_integer *incy);
+			n_nodes = ( dim_t )id_max + 1;
+		}
 
+		fclose( fp );
+	}
 #endif
+
+	return bli_min( n_nodes, BLIS_NUMA_NODES_MAX );
+}
+
+// Return the NUMA node on which the calling thread is currently running,
+// or 0 if it could not be determined.
+dim_t bli_numa_curr_node( void )
+{
+#if defined(__linux__) && defined(SYS_getcpu)
+	unsigned cpu  = 0;
+	unsigned node = 0;
+
+	if ( syscall( SYS_getcpu, &cpu, &node, NULL ) != 0 ) return 0;
+
+	return ( dim_t )node;
+#else
+	return 0;
+#endif
+}
+
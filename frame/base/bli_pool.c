@@ -337,6 +337,50 @@ void bli_pool_checkin_block
 	bli_pool_set_top_index( top_index - 1, pool );
 }
 
+bool bli_pool_detach_block
+     (
+       pblk_t* restrict block,
+       pool_t* restrict pool
+     )
+{
+	// Orphaned blocks (those allocated with a block size other than the one
+	// currently in use by the pool) are not tracked by the pool and thus
+	// cannot be detached. The caller should check them in instead, which
+	// will free them.
+	if ( bli_pblk_block_size( block ) != bli_pool_block_size( pool ) )
+		return FALSE;
+
+	// Query the block_ptrs array.
+	pblk_t* restrict block_ptrs = bli_pool_block_ptrs( pool );
+
+	// Query the top_index of the pool and the total number of blocks.
+	const siz_t top_index  = bli_pool_top_index( pool );
+	const siz_t num_blocks = bli_pool_num_blocks( pool );
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_pool_detach_block(): detaching block %d of size %d "
+	        "(align %d, offset %d).\n",
+	        ( int )top_index - 1, ( int )bli_pool_block_size( pool ),
+	                              ( int )bli_pool_align_size( pool ),
+	                              ( int )bli_pool_offset_size( pool ) );
+	fflush( stdout );
+	#endif
+
+	// Rather than checking the block back in, we permanently give up the
+	// pool's ownership of it. Since the block is currently checked out, one
+	// of the entries below top_index is free to be overwritten. We move the
+	// last available block (if any) into that entry and then shrink the
+	// range of checked-out blocks and the range of allocated blocks by one.
+	// The caller is now responsible for eventually freeing the block with
+	// the pool's free() function and offset size.
+	block_ptrs[ top_index - 1 ] = block_ptrs[ num_blocks - 1 ];
+
+	bli_pool_set_top_index( top_index - 1, pool );
+	bli_pool_set_num_blocks( num_blocks - 1, pool );
+
+	return TRUE;
+}
+
 void bli_pool_grow
      (
        siz_t            num_blocks_add,
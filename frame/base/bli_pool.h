@@ -251,6 +251,11 @@ void bli_pool_checkin_block
        pblk_t* restrict block,
        pool_t* restrict pool
      );
+bool bli_pool_detach_block
+     (
+       pblk_t* restrict block,
+       pool_t* restrict pool
+     );
 
 void bli_pool_grow
      (
@@ -50,6 +50,7 @@ typedef struct rntm_s
 	bool      pack_a;
 	bool      pack_b;
 	bool      l3_sup;
+	bool      trsm_la;
 
 	pool_t*   sba_pool;
 	membrk_t* membrk;
@@ -115,6 +116,11 @@ BLIS_INLINE bool bli_rntm_l3_sup( rntm_t* rntm )
 	return rntm->l3_sup;
 }
 
+BLIS_INLINE bool bli_rntm_trsm_la( rntm_t* rntm )
+{
+	return rntm->trsm_la;
+}
+
 //
 // -- rntm_t query (internal use only) -----------------------------------------
 //
@@ -279,6 +285,21 @@ BLIS_INLINE void bli_rntm_disable_l3_sup( rntm_t* rntm )
 	bli_rntm_set_l3_sup( FALSE, rntm );
 }
 
+BLIS_INLINE void bli_rntm_set_trsm_la( bool trsm_la, rntm_t* rntm )
+{
+	// Set the bool indicating whether the lookahead trsm algorithm may be
+	// used.
+	rntm->trsm_la = trsm_la;
+}
+BLIS_INLINE void bli_rntm_enable_trsm_la( rntm_t* rntm )
+{
+	bli_rntm_set_trsm_la( TRUE, rntm );
+}
+BLIS_INLINE void bli_rntm_disable_trsm_la( rntm_t* rntm )
+{
+	bli_rntm_set_trsm_la( FALSE, rntm );
+}
+
 //
 // -- rntm_t modification (internal use only) ----------------------------------
 //
@@ -295,6 +316,10 @@ BLIS_INLINE void bli_rntm_clear_l3_sup( rntm_t* rntm )
 {
 	bli_rntm_set_l3_sup( TRUE, rntm );
 }
+BLIS_INLINE void bli_rntm_clear_trsm_la( rntm_t* rntm )
+{
+	bli_rntm_set_trsm_la( TRUE, rntm );
+}
 
 //
 // -- rntm_t initialization ----------------------------------------------------
@@ -312,6 +337,7 @@ BLIS_INLINE void bli_rntm_clear_l3_sup( rntm_t* rntm )
           .pack_a      = FALSE, \
           .pack_b      = FALSE, \
           .l3_sup      = TRUE, \
+          .trsm_la     = TRUE, \
           .sba_pool    = NULL, \
           .membrk      = NULL, \
         }  \
@@ -325,6 +351,7 @@ BLIS_INLINE void bli_rntm_init( rntm_t* rntm )
 	bli_rntm_clear_pack_a( rntm );
 	bli_rntm_clear_pack_b( rntm );
 	bli_rntm_clear_l3_sup( rntm );
+	bli_rntm_clear_trsm_la( rntm );
 
 	bli_rntm_clear_sba_pool( rntm );
 	bli_rntm_clear_membrk( rntm );
@@ -0,0 +1,241 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+
+//
+// Define BLAS-to-BLIS interfaces.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ftype, ch, blasname, blisname ) \
+\
+void PASTEF77(ch,blasname) \
+     ( \
+       const f77_char* transa_array, \
+       const f77_char* transb_array, \
+       const f77_int*  m_array, \
+       const f77_int*  n_array, \
+       const f77_int*  k_array, \
+       const ftype*    alpha_array, \
+       const ftype**   a_array, const f77_int* lda_array, \
+       const ftype**   b_array, const f77_int* ldb_array, \
+       const ftype*    beta_array, \
+             ftype**   c_array, const f77_int* ldc_array, \
+       const f77_int*  group_count, \
+       const f77_int*  group_size  \
+     ) \
+{ \
+	dim_t n_batch = 0; \
+\
+	/* Initialize BLIS. */ \
+	bli_init_auto(); \
+\
+	/* Perform BLAS parameter checking. */ \
+	if ( *group_count < 0 ) \
+		bla_gemm_batch_xerbla( MKSTR(ch), MKSTR(blasname), 14 ); \
+\
+	for ( f77_int g = 0; g < *group_count; ++g ) \
+	{ \
+		bla_gemm_batch_check \
+		( \
+		  MKSTR(ch), \
+		  MKSTR(blasname), \
+		  &transa_array[g], \
+		  &transb_array[g], \
+		  &m_array[g], \
+		  &n_array[g], \
+		  &k_array[g], \
+		  &lda_array[g], \
+		  &ldb_array[g], \
+		  &ldc_array[g], \
+		  &group_size[g], \
+		  10, 13, 15 \
+		); \
+\
+		n_batch += group_size[g]; \
+	} \
+\
+	if ( 0 < n_batch ) \
+	{ \
+		const num_t dt           = PASTEMAC(ch,type); \
+\
+		const obj_t obj_init     = BLIS_OBJECT_INITIALIZER; \
+		const obj_t obj_init_1x1 = BLIS_OBJECT_INITIALIZER_1X1; \
+\
+		obj_t*      objs   = bli_gemm_batch_alloc_objs( n_batch ); \
+\
+		obj_t*      alphao = objs; \
+		obj_t*      ao     = alphao + n_batch; \
+		obj_t*      bo     = ao     + n_batch; \
+		obj_t*      betao  = bo     + n_batch; \
+		obj_t*      co     = betao  + n_batch; \
+\
+		dim_t       i      = 0; \
+\
+		for ( f77_int g = 0; g < *group_count; ++g ) \
+		{ \
+			trans_t blis_transa; \
+			trans_t blis_transb; \
+			dim_t   m0, n0, k0; \
+			dim_t   m0_a, n0_a; \
+			dim_t   m0_b, n0_b; \
+\
+			/* Map BLAS chars to their corresponding BLIS enumerated type value. */ \
+			bli_param_map_netlib_to_blis_trans( transa_array[g], &blis_transa ); \
+			bli_param_map_netlib_to_blis_trans( transb_array[g], &blis_transb ); \
+\
+			/* Typecast BLAS integers to BLIS integers. */ \
+			bli_convert_blas_dim1( m_array[g], m0 ); \
+			bli_convert_blas_dim1( n_array[g], n0 ); \
+			bli_convert_blas_dim1( k_array[g], k0 ); \
+\
+			bli_set_dims_with_trans( blis_transa, m0, k0, &m0_a, &n0_a ); \
+			bli_set_dims_with_trans( blis_transb, k0, n0, &m0_b, &n0_b ); \
+\
+			for ( f77_int j = 0; j < group_size[g]; ++j, ++i ) \
+			{ \
+				alphao[i] = obj_init_1x1; \
+				betao[i]  = obj_init_1x1; \
+				ao[i]     = obj_init; \
+				bo[i]     = obj_init; \
+				co[i]     = obj_init; \
+\
+				bli_obj_init_finish_1x1( dt, (ftype*)&alpha_array[g], &alphao[i] ); \
+				bli_obj_init_finish_1x1( dt, (ftype*)&beta_array[g],  &betao[i]  ); \
+\
+				bli_obj_init_finish( dt, m0_a, n0_a, (ftype*)a_array[i], 1, lda_array[g], &ao[i] ); \
+				bli_obj_init_finish( dt, m0_b, n0_b, (ftype*)b_array[i], 1, ldb_array[g], &bo[i] ); \
+				bli_obj_init_finish( dt, m0,   n0,   (ftype*)c_array[i], 1, ldc_array[g], &co[i] ); \
+\
+				bli_obj_set_conjtrans( blis_transa, &ao[i] ); \
+				bli_obj_set_conjtrans( blis_transb, &bo[i] ); \
+			} \
+		} \
+\
+		bli_gemm_batch_ex( n_batch, alphao, ao, bo, betao, co, NULL, NULL ); \
+\
+		bli_gemm_batch_free_objs( objs ); \
+	} \
+\
+	/* Finalize BLIS. */ \
+	bli_finalize_auto(); \
+}
+
+#ifdef BLIS_ENABLE_BLAS
+INSERT_GENTFUNC_BLAS( gemm_batch, gemm_batch )
+#endif
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ftype, ch, blasname, blisname ) \
+\
+void PASTEF77(ch,blasname) \
+     ( \
+       const f77_char* transa, \
+       const f77_char* transb, \
+       const f77_int*  m, \
+       const f77_int*  n, \
+       const f77_int*  k, \
+       const ftype*    alpha, \
+       const ftype*    a, const f77_int* lda, const f77_int* stridea, \
+       const ftype*    b, const f77_int* ldb, const f77_int* strideb, \
+       const ftype*    beta, \
+             ftype*    c, const f77_int* ldc, const f77_int* stridec, \
+       const f77_int*  batch_size  \
+     ) \
+{ \
+	trans_t blis_transa; \
+	trans_t blis_transb; \
+	dim_t   m0, n0, k0; \
+	dim_t   n_batch; \
+\
+	/* Initialize BLIS. */ \
+	bli_init_auto(); \
+\
+	/* Perform BLAS parameter checking. */ \
+	bla_gemm_batch_check \
+	( \
+	  MKSTR(ch), \
+	  MKSTR(blasname), \
+	  transa, \
+	  transb, \
+	  m, \
+	  n, \
+	  k, \
+	  lda, \
+	  ldb, \
+	  ldc, \
+	  batch_size, \
+	  11, 15, 17 \
+	); \
+\
+	/* Map BLAS chars to their corresponding BLIS enumerated type value. */ \
+	bli_param_map_netlib_to_blis_trans( *transa, &blis_transa ); \
+	bli_param_map_netlib_to_blis_trans( *transb, &blis_transb ); \
+\
+	/* Typecast BLAS integers to BLIS integers. */ \
+	bli_convert_blas_dim1( *m, m0 ); \
+	bli_convert_blas_dim1( *n, n0 ); \
+	bli_convert_blas_dim1( *k, k0 ); \
+	bli_convert_blas_dim1( *batch_size, n_batch ); \
+\
+	/* Call BLIS interface. */ \
+	PASTEMAC2(ch,blisname,_ex) \
+	( \
+	  blis_transa, \
+	  blis_transb, \
+	  m0, \
+	  n0, \
+	  k0, \
+	  (ftype*)alpha, \
+	  (ftype*)a, 1, *lda, *stridea, \
+	  (ftype*)b, 1, *ldb, *strideb, \
+	  (ftype*)beta, \
+	  (ftype*)c, 1, *ldc, *stridec, \
+	  n_batch, \
+	  NULL, \
+	  NULL  \
+	); \
+\
+	/* Finalize BLIS. */ \
+	bli_finalize_auto(); \
+}
+
+#ifdef BLIS_ENABLE_BLAS
+INSERT_GENTFUNC_BLAS( gemm_batch_strided, gemm_batch_strided )
+#endif
+
@@ -0,0 +1,111 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+
+//
+// Define BLAS-to-BLIS interfaces.
+//
+#undef  GENTFUNCROT
+#define GENTFUNCROT( ftype_xy, ftype_r, chxy, chr, blasname, blisname ) \
+\
+void PASTEF772(chxy,chr,blasname) \
+     ( \
+       const f77_int* n, \
+       ftype_xy* x, const f77_int* incx, \
+       ftype_xy* y, const f77_int* incy, \
+       const ftype_r*  c, \
+       const ftype_r*  s  \
+     ) \
+{ \
+	dim_t     n0; \
+	ftype_xy* x0; \
+	ftype_xy* y0; \
+	inc_t     incx0; \
+	inc_t     incy0; \
+	ftype_r   c_cast; \
+	ftype_xy  s_cast; \
+\
+	/* Initialize BLIS. */ \
+	bli_init_auto(); \
+\
+	/* Convert/typecast negative values of n to zero. */ \
+	bli_convert_blas_dim1( *n, n0 ); \
+\
+	/* The rotation is applied to each pair of elements independently, so
+	   if both increments are negative, traversing both vectors forward
+	   pairs the same elements. This lets the kernel use contiguous vector
+	   loads and stores when both increments are -1. Otherwise, adjust the
+	   pointers so we can use the BLIS semantics for negative increments. */ \
+	if ( *incx < 0 && *incy < 0 ) \
+	{ \
+		x0 = x; incx0 = -( inc_t )(*incx); \
+		y0 = y; incy0 = -( inc_t )(*incy); \
+	} \
+	else \
+	{ \
+		bli_convert_blas_incv( n0, (ftype_xy*)x, *incx, x0, incx0 ); \
+		bli_convert_blas_incv( n0, (ftype_xy*)y, *incy, y0, incy0 ); \
+	} \
+\
+	/* The BLAS ?rot and csrot/zdrot take a real s, which we cast to the
+	   datatype of x and y. */ \
+	c_cast = *c; \
+	PASTEMAC2(chr,chxy,copys)( *s, s_cast ); \
+\
+	/* Call BLIS interface. */ \
+	PASTEMAC2(chxy,blisname,BLIS_TAPI_EX_SUF) \
+	( \
+	  n0, \
+	  &c_cast, \
+	  &s_cast, \
+	  x0, incx0, \
+	  y0, incy0, \
+	  NULL, \
+	  NULL  \
+	); \
+\
+	/* Finalize BLIS. */ \
+	bli_finalize_auto(); \
+}
+
+#ifdef BLIS_ENABLE_BLAS
+GENTFUNCROT( float,    float,  s,  , rot, rotv )
+GENTFUNCROT( double,   double, d,  , rot, rotv )
+GENTFUNCROT( scomplex, float,  c, s, rot, rotv )
+GENTFUNCROT( dcomplex, double, z, d, rot, rotv )
+#endif
+
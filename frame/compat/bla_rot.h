@@ -4,7 +4,7 @@
    An object-based framework for developing high-performance BLAS-like
    libraries.
 
-   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2020, The University of Texas at Austin
 
    Redistribution and use in source and binary forms, with or without
    modification, are permitted provided that the following conditions are
@@ -32,11 +32,27 @@
 
 */
 
-#ifdef BLIS_ENABLE_BLAS
 
-BLIS_EXPORT_BLAS int PASTEF77(s,rot)(const bla_integer *n, bla_real *sx, const bla_integer *incx, bla_real *sy, const bla_integer *incy, const bla_real *c__, const bla_real *s);
-BLIS_EXPORT_BLAS int PASTEF77(d,rot)(const bla_integer *n, bla_double *dx, const bla_integer *incx, bla_double *dy, const bla_integer *incy, const bla_double *c__, const bla_double *s);
-BLIS_EXPORT_BLAS int PASTEF77(cs,rot)(const bla_integer *n, bla_scomplex *cx, const bla_integer *incx, bla_scomplex *cy, const bla_integer *incy, const bla_real *c__, const bla_real *s);
-BLIS_EXPORT_BLAS int PASTEF77(zd,rot)(const bla_integer *n, bla_dcomplex *zx, const bla_integer *incx, bla_dcomplex *zy, const bla_integer *incy, const bla_double *c__, const bla_double *s);
 
+//
+// Prototype BLAS-to-BLIS interfaces.
+//
+#undef  GENTPROTROT
+#define GENTPROTROT( ftype_xy, ftype_r, chxy, chr, blasname ) \
+\
+BLIS_EXPORT_BLAS void PASTEF772(chxy,chr,blasname) \
+     ( \
+       const f77_int* n, \
+       ftype_xy* x, const f77_int* incx, \
+       ftype_xy* y, const f77_int* incy, \
+       const ftype_r*  c, \
+       const ftype_r*  s  \
+     );
+
+#ifdef BLIS_ENABLE_BLAS
+GENTPROTROT( float,    float,  s,  , rot )
+GENTPROTROT( double,   double, d,  , rot )
+GENTPROTROT( scomplex, float,  c, s, rot )
+GENTPROTROT( dcomplex, double, z, d, rot )
 #endif
+
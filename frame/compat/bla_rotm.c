@@ -0,0 +1,127 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+
+//
+// Define BLAS-to-BLIS interfaces.
+//
+#undef  GENTFUNCRO
+#define GENTFUNCRO( ftype, ch, blasname, blisname ) \
+\
+void PASTEF77(ch,blasname) \
+     ( \
+       const f77_int* n, \
+       ftype*   x, const f77_int* incx, \
+       ftype*   y, const f77_int* incy, \
+       const ftype*   param  \
+     ) \
+{ \
+	dim_t  n0; \
+	ftype* x0; \
+	ftype* y0; \
+	inc_t  incx0; \
+	inc_t  incy0; \
+	ftype  h[ 4 ]; \
+\
+	/* Initialize BLIS. */ \
+	bli_init_auto(); \
+\
+	/* Convert/typecast negative values of n to zero. */ \
+	bli_convert_blas_dim1( *n, n0 ); \
+\
+	/* The first element of param is a flag that indicates which elements
+	   of the 2x2 matrix H are stored in the remaining four elements of
+	   param (h11, h21, h12, h22, in that order). The elements that are not
+	   stored are implicitly -1, 0, or 1. A flag of -2 indicates that H is
+	   the identity, in which case there is nothing to do. */ \
+	const ftype flag = param[0]; \
+\
+	if ( flag == -2.0 ) \
+	{ \
+		bli_finalize_auto(); \
+		return; \
+	} \
+	else if ( flag < 0.0 ) \
+	{ \
+		h[0] = param[1]; h[2] = param[3]; \
+		h[1] = param[2]; h[3] = param[4]; \
+	} \
+	else if ( flag == 0.0 ) \
+	{ \
+		h[0] = 1.0;      h[2] = param[3]; \
+		h[1] = param[2]; h[3] = 1.0; \
+	} \
+	else \
+	{ \
+		h[0] = param[1]; h[2] = 1.0; \
+		h[1] = -1.0;     h[3] = param[4]; \
+	} \
+\
+	/* H is applied to each pair of elements independently, so if both
+	   increments are negative, traversing both vectors forward pairs the
+	   same elements. Otherwise, adjust the pointers so we can use the BLIS
+	   semantics for negative increments. */ \
+	if ( *incx < 0 && *incy < 0 ) \
+	{ \
+		x0 = x; incx0 = -( inc_t )(*incx); \
+		y0 = y; incy0 = -( inc_t )(*incy); \
+	} \
+	else \
+	{ \
+		bli_convert_blas_incv( n0, (ftype*)x, *incx, x0, incx0 ); \
+		bli_convert_blas_incv( n0, (ftype*)y, *incy, y0, incy0 ); \
+	} \
+\
+	/* Call BLIS interface. */ \
+	PASTEMAC2(ch,blisname,BLIS_TAPI_EX_SUF) \
+	( \
+	  n0, \
+	  h, \
+	  x0, incx0, \
+	  y0, incy0, \
+	  NULL, \
+	  NULL  \
+	); \
+\
+	/* Finalize BLIS. */ \
+	bli_finalize_auto(); \
+}
+
+#ifdef BLIS_ENABLE_BLAS
+INSERT_GENTFUNCRO_BLAS( rotm, rotmv )
+#endif
+
@@ -165,6 +165,15 @@
 #include "bla_tpmv.h"
 #include "bla_tpsv.h"
 
+#include "bla_hpmv_check.h"
+#include "bla_hpr_check.h"
+#include "bla_hpr2_check.h"
+#include "bla_spmv_check.h"
+#include "bla_spr_check.h"
+#include "bla_spr2_check.h"
+#include "bla_tpmv_check.h"
+#include "bla_tpsv_check.h"
+
 // banded
 
 #include "bla_gbmv.h"
@@ -173,10 +182,18 @@
 #include "bla_tbmv.h"
 #include "bla_tbsv.h"
 
+#include "bla_gbmv_check.h"
+#include "bla_hbmv_check.h"
+#include "bla_sbmv_check.h"
+#include "bla_tbmv_check.h"
+#include "bla_tbsv_check.h"
+
 
 // -- Level-3 BLAS prototypes --
 
 #include "bla_gemm.h"
+#include "bla_gemm_batch.h"
+#include "bla_gemmt.h"
 #include "bla_hemm.h"
 #include "bla_herk.h"
 #include "bla_her2k.h"
@@ -187,6 +204,8 @@
 #include "bla_trsm.h"
 
 #include "bla_gemm_check.h"
+#include "bla_gemm_batch_check.h"
+#include "bla_gemmt_check.h"
 #include "bla_hemm_check.h"
 #include "bla_herk_check.h"
 #include "bla_her2k_check.h"
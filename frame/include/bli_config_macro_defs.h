@@ -139,6 +139,17 @@
   #define BLIS_ENABLE_STAY_AUTO_INITIALIZED
 #endif
 
+// Allow each thread to cache one released block per packing block allocator
+// pool so that subsequent checkouts can bypass the allocator's mutex. This
+// option only has an effect when the pba pools are enabled.
+#ifdef BLIS_DISABLE_PBA_TCACHE
+  #undef BLIS_ENABLE_PBA_TCACHE
+#else
+  // Default behavior is enabled.
+  #undef  BLIS_ENABLE_PBA_TCACHE // In case user explicitly enabled.
+  #define BLIS_ENABLE_PBA_TCACHE
+#endif
+
 
 // -- BLAS COMPATIBILITY LAYER -------------------------------------------------
 
@@ -56,6 +56,45 @@
 #define BLIS_THREAD_MAX_JR      4
 #endif
 
+// -- Level-1v values --
+
+// The minimum number of vector elements that must be assigned to each
+// thread of a multithreaded level-1v operation. (Whether a level-1v
+// operation is parallelized at all is governed by the threshold stored
+// in the context; see bli_cntx_get_l1v_thresh_dt().)
+#ifndef BLIS_THREAD_L1V_MIN_ELEM
+#define BLIS_THREAD_L1V_MIN_ELEM  65536
+#endif
+
+// The granularity with which vectors are partitioned among the threads of
+// a level-1v operation. This is chosen so that each thread's subvector
+// begins on a cache line (and a SIMD vector) boundary whenever the full
+// vector does.
+#ifndef BLIS_THREAD_L1V_BF
+#define BLIS_THREAD_L1V_BF        64
+#endif
+
+// -- Level-2 values --
+
+// The minimum number of matrix elements that must be assigned to each
+// thread before a level-2 operation is parallelized.
+#ifndef BLIS_THREAD_L2_MIN_ELEM
+#define BLIS_THREAD_L2_MIN_ELEM   32768
+#endif
+
+// The granularity with which vectors are partitioned among the threads of
+// a level-2 operation. This should be a multiple of the number of elements
+// in a cache line to avoid false sharing between neighboring threads.
+#ifndef BLIS_THREAD_L2_BF
+#define BLIS_THREAD_L2_BF         16
+#endif
+
+// The size of the diagonal blocks solved by a single thread in
+// multithreaded trsv. Each block costs the team two barriers.
+#ifndef BLIS_THREAD_L2_TRSV_B
+#define BLIS_THREAD_L2_TRSV_B     256
+#endif
+
 #if 0
 // -- Skinny/small possibly-unpacked (sup code path) values --
 
@@ -635,6 +635,12 @@ BLIS_INLINE bool bli_obj_root_is_herm_or_symm( obj_t* obj )
 	         bli_obj_is_symmetric( bli_obj_root( obj ) ) );
 }
 
+BLIS_INLINE bool bli_obj_root_is_packed( obj_t* obj )
+{
+	return ( bool )
+	       ( bli_obj_is_packed( bli_obj_root( obj ) ) );
+}
+
 BLIS_INLINE bool bli_obj_root_is_upper( obj_t* obj )
 {
 	return ( bool )
@@ -582,6 +582,16 @@ BLIS_INLINE bool bli_has_nonunit_inc3( inc_t s1, inc_t s2, inc_t s3 )
 	       ( s1 != 1 || s2 != 1 || s3 != 1 );
 }
 
+// Return the offset of element (i,j) of an m x m matrix whose uplo triangle
+// is stored in the packed, column-major format used by the BLAS. Element
+// (i,j) must lie within the stored triangle.
+BLIS_INLINE dim_t bli_packed_offset( uplo_t uplo, dim_t m, dim_t i, dim_t j )
+{
+	return ( dim_t )
+	       ( bli_is_upper( uplo ) ? i + ( j * ( j + 1 ) ) / 2
+	                              : i + ( j * ( 2 * m - j - 1 ) ) / 2 );
+}
+
 
 // diag offset-related
 
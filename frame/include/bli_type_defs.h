@@ -170,6 +170,15 @@ typedef uint32_t objbits_t;  // object information bit field
 
 #endif // BLIS_ENABLE_C99_COMPLEX
 
+// -- Low-precision types --
+
+// A bfloat16 value is stored as the upper 16 bits of the corresponding IEEE
+// single-precision value. A float16 value is an IEEE 754 binary16 (half-
+// precision) value. These types are only used by the low-precision gemm
+// operations and are not covered by num_t.
+typedef uint16_t bfloat16;
+typedef uint16_t float16;
+
 // -- Atom type --
 
 // Note: atom types are used to hold "bufferless" scalar object values. Note
@@ -692,6 +701,9 @@ typedef enum
 	BLIS_DOTV_KER,
 	BLIS_DOTXV_KER,
 	BLIS_INVERTV_KER,
+	BLIS_NORMFV_KER,
+	BLIS_ROTV_KER,
+	BLIS_ROTMV_KER,
 	BLIS_SCALV_KER,
 	BLIS_SCAL2V_KER,
 	BLIS_SETV_KER,
@@ -700,7 +712,7 @@ typedef enum
 	BLIS_XPBYV_KER
 } l1vkr_t;
 
-#define BLIS_NUM_LEVEL1V_KERS 14
+#define BLIS_NUM_LEVEL1V_KERS 17
 
 
 typedef enum
@@ -749,6 +761,7 @@ typedef enum
 	BLIS_PACKM_29XK_KER = 29,
 	BLIS_PACKM_30XK_KER = 30,
 	BLIS_PACKM_31XK_KER = 31,
+	BLIS_PACKM_32XK_KER = 32,
 
 	BLIS_UNPACKM_0XK_KER  = 0,
 	BLIS_UNPACKM_1XK_KER  = 1,
@@ -785,7 +798,7 @@ typedef enum
 
 } l1mkr_t;
 
-#define BLIS_NUM_PACKM_KERS   32
+#define BLIS_NUM_PACKM_KERS   33
 #define BLIS_NUM_UNPACKM_KERS 32
 
 
@@ -801,6 +814,15 @@ typedef enum
 #define BLIS_NUM_LEVEL3_UKRS 5
 
 
+typedef enum
+{
+	BLIS_GEMM_BF16BF16F32 = 0,
+	BLIS_GEMM_U8S8S32
+} lpgemm_t;
+
+#define BLIS_NUM_LPGEMM_TYPES 2
+
+
 typedef enum
 {
 	BLIS_REFERENCE_UKERNEL = 0,
@@ -918,6 +940,7 @@ typedef enum
 // bli_l3_ind.c to index into arrays.
 //
 	BLIS_GEMM = 0,
+	BLIS_GEMMT,
 	BLIS_HEMM,
 	BLIS_HERK,
 	BLIS_HER2K,
@@ -931,7 +954,7 @@ typedef enum
 	BLIS_NOID
 } opid_t;
 
-#define BLIS_NUM_LEVEL3_OPS 10
+#define BLIS_NUM_LEVEL3_OPS 11
 
 
 // -- Blocksize ID type --
@@ -1001,6 +1024,7 @@ typedef enum
 	BLIS_ARCH_BULLDOZER,
 
 	// ARM
+	BLIS_ARCH_ARMSVE,
 	BLIS_ARCH_THUNDERX2,
 	BLIS_ARCH_CORTEXA57,
 	BLIS_ARCH_CORTEXA53,
@@ -1019,7 +1043,7 @@ typedef enum
 
 // NOTE: This value must be updated to reflect the number of enum values
 // listed above for arch_t!
-#define BLIS_NUM_ARCHS 21
+#define BLIS_NUM_ARCHS 22
 
 
 //
@@ -1097,6 +1121,13 @@ typedef struct membrk_s
 	malloc_ft           malloc_fp;
 	free_ft             free_fp;
 
+	// The NUMA node whose threads acquire blocks from the pools above, and
+	// the number of blocks checked out by threads that were running on that
+	// node (local) or on another node (remote) at the time of checkout.
+	dim_t               node;
+	siz_t               n_local;
+	siz_t               n_remote;
+
 } membrk_t;
 
 
@@ -1146,6 +1177,28 @@ typedef struct blksz_s
 } blksz_t;
 
 
+// -- Low-precision gemm kernel object type --
+
+typedef struct lpgemm_ker_s
+{
+	// Micro-kernel address.
+	void_fp ukr;
+
+	// Register blocksizes. kr is the number of consecutive elements along
+	// the k dimension that the micro-kernel consumes from each row of A and
+	// each column of B (ie: the k-group size of the packed micro-panels).
+	dim_t   mr;
+	dim_t   nr;
+	dim_t   kr;
+
+	// Cache blocksizes.
+	dim_t   mc;
+	dim_t   kc;
+	dim_t   nc;
+
+} lpgemm_ker_t;
+
+
 // -- Function pointer object type --
 
 typedef struct func_s
@@ -1430,13 +1483,19 @@ typedef struct cntx_s
 	blksz_t   l3_sup_blkszs[ BLIS_NUM_BLKSZS ];
 	func_t    l3_sup_kers[ BLIS_NUM_3OP_RC_COMBOS ];
 	mbool_t   l3_sup_kers_prefs[ BLIS_NUM_3OP_RC_COMBOS ];
+	func_t    l3_sup_trsm_kers[ BLIS_NUM_LEVEL3_UKRS ];
+	mbool_t   l3_sup_trsm_kers_prefs[ BLIS_NUM_LEVEL3_UKRS ];
 
 	func_t    l1f_kers[ BLIS_NUM_LEVEL1F_KERS ];
 	func_t    l1v_kers[ BLIS_NUM_LEVEL1V_KERS ];
+	blksz_t   l1v_thresh;
 
 	func_t    packm_kers[ BLIS_NUM_PACKM_KERS ];
 	func_t    unpackm_kers[ BLIS_NUM_UNPACKM_KERS ];
 
+	lpgemm_ker_t lpgemm_kers[ BLIS_NUM_LPGEMM_TYPES ];
+	void_fp   packm_f16_ker;
+
 	ind_t     method;
 	pack_t    schema_a_block;
 	pack_t    schema_b_panel;
@@ -1460,6 +1519,7 @@ typedef struct rntm_s
 	bool      pack_a; // enable/disable packing of left-hand matrix A.
 	bool      pack_b; // enable/disable packing of right-hand matrix B.
 	bool      l3_sup; // enable/disable small matrix handling in level-3 ops.
+	bool      trsm_la; // enable/disable the lookahead trsm algorithm.
 
 	// "Internal" fields: these should not be exposed to the end-user.
 
@@ -1551,6 +1611,7 @@ typedef enum
 
 	// Packing-specific errors
 	BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_UNPACK  = (-100),
+	BLIS_INVALID_PREPACKED_OBJECT              = (-101),
 
 	// Buffer-specific errors 
 	BLIS_EXPECTED_NONNULL_OBJECT_BUFFER        = (-110),
@@ -1570,6 +1631,7 @@ typedef enum
 
 	// Architecture-related errors
 	BLIS_INVALID_ARCH_ID                       = (-150),
+	BLIS_UNINITIALIZED_GKS_CNTX                = (-151),
 
 	// Blocksize-related errors
 	BLIS_MC_DEF_NONMULTIPLE_OF_MR              = (-160),
@@ -75,6 +75,7 @@ extern "C" {
 
 #include "bli_thread.h"
 #include "bli_pthread.h"
+#include "bli_thrpool.h"
 
 
 // -- Constant definitions --
@@ -109,6 +110,8 @@ extern "C" {
 #include "bli_rntm.h"
 #include "bli_gks.h"
 #include "bli_ind.h"
+#include "bli_numa.h"
+#include "bli_hugepage.h"
 #include "bli_membrk.h"
 #include "bli_pool.h"
 #include "bli_array.h"
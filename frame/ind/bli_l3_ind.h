@@ -44,6 +44,7 @@ void_fp PASTEMAC(opname,ind_get_avail)( num_t dt );
 /*bool PASTEMAC(opname,ind_has_avail)( num_t dt ); */
 
 GENPROT( gemm )
+GENPROT( gemmt )
 GENPROT( hemm )
 GENPROT( herk )
 GENPROT( her2k )
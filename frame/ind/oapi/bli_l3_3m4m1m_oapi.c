@@ -35,7 +35,7 @@
 
 #include "blis.h"
 
-// -- gemm/her2k/syr2k ---------------------------------------------------------
+// -- gemm/gemmt/her2k/syr2k ---------------------------------------------------
 
 #undef  GENFRONT
 #define GENFRONT( opname, cname, imeth, nstage ) \
@@ -125,6 +125,14 @@ GENFRONT( gemm, gemm, 4mb, 1 )
 GENFRONT( gemm, gemm, 4m1, 1 )
 GENFRONT( gemm, gemm, 1m,  1 )
 
+// gemmt
+GENFRONT( gemmt, gemm, 3mh, 3 )
+GENFRONT( gemmt, gemm, 3m1, 1 )
+GENFRONT( gemmt, gemm, 4mh, 4 )
+//GENFRONT( gemmt, gemm, 4mb, 1 ) // Not implemented.
+GENFRONT( gemmt, gemm, 4m1, 1 )
+GENFRONT( gemmt, gemm, 1m,  1 )
+
 // her2k
 GENFRONT( her2k, gemm, 3mh, 3 )
 GENFRONT( her2k, gemm, 3m1, 1 )
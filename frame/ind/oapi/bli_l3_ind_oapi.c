@@ -36,7 +36,7 @@
 #include "blis.h"
 
 
-// -- gemm/her2k/syr2k ---------------------------------------------------------
+// -- gemm/gemmt/her2k/syr2k ---------------------------------------------------
 
 #undef  GENFRONT
 #define GENFRONT( opname, imeth ) \
@@ -67,6 +67,7 @@ void PASTEMAC(opname,imeth) \
 }
 
 GENFRONT( gemm, ind )
+GENFRONT( gemmt, ind )
 GENFRONT( her2k, ind )
 GENFRONT( syr2k, ind )
 
@@ -41,7 +41,7 @@
 // of executing one iteration of a for loop, plus the overhead of calling a
 // function that does nothing (ie: the _cntx_init_stage() function).
 
-// -- gemm/her2k/syr2k ---------------------------------------------------------
+// -- gemm/gemmt/her2k/syr2k ---------------------------------------------------
 
 #undef  GENFRONT
 #define GENFRONT( opname, cname, imeth ) \
@@ -80,6 +80,7 @@ void PASTEMAC(opname,imeth) \
 #ifndef BLIS_ENABLE_SANDBOX
 GENFRONT( gemm, gemm, nat )
 #endif
+GENFRONT( gemmt, gemm, nat )
 GENFRONT( her2k, gemm, nat )
 GENFRONT( syr2k, gemm, nat )
 
@@ -0,0 +1,65 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef BLIS_L2_DECOR_H
+#define BLIS_L2_DECOR_H
+
+// -- level-2 definitions ------------------------------------------------------
+
+// Level-2 internal function type. The params argument refers to an
+// operation-specific description of the problem, which each thread of the
+// team partitions according to its thrinfo_t.
+typedef void (*l2int_t)
+     (
+       void*      params,
+       cntx_t*    cntx,
+       thrinfo_t* thread
+     );
+
+// Level-2 thread decorator prototype. (The multithreaded level-1v
+// operations are executed via this decorator as well.) The team shares a single (flat)
+// communicator, which the internal function may use to synchronize via
+// bli_thread_barrier(). Level-2 operations do not pack, so unlike the
+// level-3 decorators, no sba or pba state is set up for the threads.
+void bli_l2_thread_decorator
+     (
+       l2int_t func,
+       void*   params,
+       cntx_t* cntx,
+       rntm_t* rntm
+     );
+
+#endif
+
@@ -0,0 +1,91 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#ifdef BLIS_ENABLE_OPENMP
+
+void bli_l2_thread_decorator
+     (
+       l2int_t func,
+       void*   params,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	// Query the total number of threads from the rntm_t object.
+	const dim_t n_threads = bli_rntm_num_threads( rntm );
+
+	// Initialize a communicator shared by all threads of the team.
+	thrcomm_t gl_comm;
+
+	bli_thrcomm_init( n_threads, &gl_comm );
+
+	_Pragma( "omp parallel num_threads(n_threads)" )
+	{
+		// Create a thread-local copy of the master thread's rntm_t, which
+		// is only modified if the thread check below fails.
+		rntm_t rntm_l = *rntm;
+
+		// Query the thread's id from OpenMP.
+		const dim_t tid = omp_get_thread_num();
+
+		// Check for a somewhat obscure OpenMP thread-mistmatch issue.
+		// NOTE: This calls the same function used for the conventional/large
+		// level-3 code path.
+		bli_l3_thread_decorator_thread_check( n_threads, tid, &gl_comm, &rntm_l );
+
+		// Each thread gets a single-level thrinfo_t that partitions the
+		// work n_way ways, where n_way may have been reduced to one by the
+		// thread check above.
+		thrinfo_t thread;
+
+		bli_thrinfo_set_ocomm( &gl_comm, &thread );
+		bli_thrinfo_set_ocomm_id( tid, &thread );
+		bli_thrinfo_set_n_way( bli_thread_num_threads( &thread ), &thread );
+		bli_thrinfo_set_work_id( tid, &thread );
+		bli_thrinfo_set_free_comm( FALSE, &thread );
+		bli_thrinfo_set_bszid( BLIS_NO_PART, &thread );
+		bli_thrinfo_set_sub_prenode( NULL, &thread );
+		bli_thrinfo_set_sub_node( NULL, &thread );
+
+		func( params, cntx, &thread );
+	}
+
+	bli_thrcomm_cleanup( &gl_comm );
+}
+
+#endif
+
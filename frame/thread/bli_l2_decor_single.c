@@ -0,0 +1,69 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#ifndef BLIS_ENABLE_MULTITHREADING
+
+void bli_l2_thread_decorator
+     (
+       l2int_t func,
+       void*   params,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	thrcomm_t comm;
+	thrinfo_t thread;
+
+	// For sequential execution, we use only one thread.
+	bli_thrcomm_init( 1, &comm );
+
+	bli_thrinfo_set_ocomm( &comm, &thread );
+	bli_thrinfo_set_ocomm_id( 0, &thread );
+	bli_thrinfo_set_n_way( 1, &thread );
+	bli_thrinfo_set_work_id( 0, &thread );
+	bli_thrinfo_set_free_comm( FALSE, &thread );
+	bli_thrinfo_set_bszid( BLIS_NO_PART, &thread );
+	bli_thrinfo_set_sub_prenode( NULL, &thread );
+	bli_thrinfo_set_sub_node( NULL, &thread );
+
+	func( params, cntx, &thread );
+
+	bli_thrcomm_cleanup( &comm );
+}
+
+#endif
+
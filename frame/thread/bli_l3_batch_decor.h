@@ -0,0 +1,65 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef BLIS_L3_BATCH_DECOR_H
+#define BLIS_L3_BATCH_DECOR_H
+
+// -- batch definitions --------------------------------------------------------
+
+// Level-3 batch internal function type. The params argument refers to an
+// operation-specific description of the batch, which each thread of the
+// team is responsible for partitioning (or scheduling) among the threads.
+typedef void (*l3batchint_t)
+     (
+       void*   params,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       dim_t   tid
+     );
+
+// Level-3 batch thread decorator prototype. Unlike the other decorators,
+// this decorator does not create any thrinfo_t structures, since each item
+// of a batch is computed by exactly one thread of the team. Each thread
+// receives its own copy of the rntm_t, with its sba and pba fields set.
+void bli_l3_batch_thread_decorator
+     (
+       l3batchint_t func,
+       void*        params,
+       cntx_t*      cntx,
+       rntm_t*      rntm
+     );
+
+#endif
+
@@ -0,0 +1,143 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#ifdef BLIS_ENABLE_PTHREADS
+
+// The largest number of threads for which the per-thread work descriptors
+// are kept on the stack of the calling thread.
+#ifndef BLIS_L3_BATCH_DECOR_NT_STACK
+#define BLIS_L3_BATCH_DECOR_NT_STACK 64
+#endif
+
+// A data structure to assist in passing the batch to additional threads.
+typedef struct thread_data
+{
+	l3batchint_t func;
+	void*        params;
+	cntx_t*      cntx;
+	rntm_t*      rntm;
+	dim_t        tid;
+	array_t*     array;
+} thread_data_t;
+
+// Entry point for additional threads
+static void* bli_l3_batch_thread_entry( void* data_void )
+{
+	thread_data_t* data   = data_void;
+
+	l3batchint_t   func   = data->func;
+	void*          params = data->params;
+	cntx_t*        cntx   = data->cntx;
+	rntm_t*        rntm   = data->rntm;
+	dim_t          tid    = data->tid;
+	array_t*       array  = data->array;
+
+	// Create a thread-local copy of the master thread's rntm_t so that each
+	// thread can track its own small block pool_t.
+	rntm_t           rntm_l = *rntm;
+	rntm_t* restrict rntm_p = &rntm_l;
+
+	// Set the sba_pool field of the thread-local rntm_t to the pool_t* for
+	// the current thread, and the packing block allocator field to the
+	// membrk_t of the NUMA node on which the thread is running.
+	bli_sba_rntm_set_pool( tid, array, rntm_p );
+	bli_membrk_rntm_set_membrk( rntm_p );
+
+	func( params, cntx, rntm_p, tid );
+
+	return NULL;
+}
+
+void bli_l3_batch_thread_decorator
+     (
+       l3batchint_t func,
+       void*        params,
+       cntx_t*      cntx,
+       rntm_t*      rntm
+     )
+{
+	// Query the total number of threads from the rntm_t object.
+	const dim_t n_threads = bli_rntm_num_threads( rntm );
+
+	// Check out an array_t from the small block allocator. This is done
+	// with an internal lock to ensure only one application thread accesses
+	// the sba at a time.
+	array_t* restrict array = bli_sba_checkout_array( n_threads );
+
+	// Use an array of per-thread work descriptors on the stack, if it is
+	// large enough. Otherwise, allocate the array.
+	thread_data_t  datas_l[ BLIS_L3_BATCH_DECOR_NT_STACK ];
+	thread_data_t* datas = datas_l;
+
+	if ( BLIS_L3_BATCH_DECOR_NT_STACK < n_threads )
+	{
+		#ifdef BLIS_ENABLE_MEM_TRACING
+		printf( "bli_l3_batch_thread_decorator().pth: " );
+		#endif
+		datas = bli_malloc_intl( sizeof( thread_data_t ) * n_threads );
+	}
+
+	for ( dim_t tid = 0; tid < n_threads; tid++ )
+	{
+		// Set up thread data for each thread.
+		datas[tid].func   = func;
+		datas[tid].params = params;
+		datas[tid].cntx   = cntx;
+		datas[tid].rntm   = rntm;
+		datas[tid].tid    = tid;
+		datas[tid].array  = array;
+	}
+
+	// Execute the thread entry function on n_threads threads, with thread 0
+	// being the current thread and the others taken from the persistent
+	// thread pool. This call returns only after all threads have finished.
+	bli_thrpool_run( n_threads, &bli_l3_batch_thread_entry, datas, sizeof( thread_data_t ) );
+
+	// Check the array_t back into the small block allocator.
+	bli_sba_checkin_array( array );
+
+	if ( datas != datas_l )
+	{
+		#ifdef BLIS_ENABLE_MEM_TRACING
+		printf( "bli_l3_batch_thread_decorator().pth: " );
+		#endif
+		bli_free_intl( datas );
+	}
+}
+
+#endif
+
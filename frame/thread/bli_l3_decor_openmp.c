@@ -118,6 +118,10 @@ void bli_l3_thread_decorator
 		// be allocated/initialized.
 		bli_sba_rntm_set_pool( tid, array, rntm_p );
 
+		// Set the packing block allocator field of the thread-local rntm_t to
+		// the membrk_t of the NUMA node on which the thread is running.
+		bli_membrk_rntm_set_membrk( rntm_p );
+
 
 		obj_t      a_t, b_t, c_t;
 		cntl_t*    cntl_use;
@@ -90,6 +90,10 @@ void* bli_l3_thread_entry( void* data_void )
 	// be allocated/initialized.
 	bli_sba_rntm_set_pool( tid, array, rntm_p );
 
+	// Set the packing block allocator field of the thread-local rntm_t to
+	// the membrk_t of the NUMA node on which the thread is running.
+	bli_membrk_rntm_set_membrk( rntm_p );
+
 	obj_t          a_t, b_t, c_t;
 	cntl_t*        cntl_use;
 	thrinfo_t*     thread;
@@ -181,24 +185,17 @@ void bli_l3_thread_decorator
 	// Allocate a global communicator for the root thrinfo_t structures.
 	thrcomm_t* restrict gl_comm = bli_thrcomm_create( rntm, n_threads );
 
-	// Allocate an array of pthread objects and auxiliary data structs to pass
-	// to the thread entry functions.
-
-	#ifdef BLIS_ENABLE_MEM_TRACING
-	printf( "bli_l3_thread_decorator().pth: " );
-	#endif
-	bli_pthread_t* pthreads = bli_malloc_intl( sizeof( bli_pthread_t ) * n_threads );
+	// Allocate an array of auxiliary data structs to pass to the thread
+	// entry functions.
 
 	#ifdef BLIS_ENABLE_MEM_TRACING
 	printf( "bli_l3_thread_decorator().pth: " );
 	#endif
 	thread_data_t* datas    = bli_malloc_intl( sizeof( thread_data_t ) * n_threads );
 
-	// NOTE: We must iterate backwards so that the chief thread (thread id 0)
-	// can spawn all other threads before proceeding with its own computation.
-	for ( dim_t tid = n_threads - 1; 0 <= tid; tid-- )
+	for ( dim_t tid = 0; tid < n_threads; tid++ )
 	{
-		// Set up thread data for additional threads (beyond thread 0).
+		// Set up thread data for each thread.
 		datas[tid].func     = func;
 		datas[tid].family   = family;
 		datas[tid].schema_a = schema_a;
@@ -214,34 +211,23 @@ void bli_l3_thread_decorator
 		datas[tid].tid      = tid;
 		datas[tid].gl_comm  = gl_comm;
 		datas[tid].array    = array;
-
-		// Spawn additional threads for ids greater than 1.
-		if ( tid != 0 )
-			bli_pthread_create( &pthreads[tid], NULL, &bli_l3_thread_entry, &datas[tid] );
-		else
-			bli_l3_thread_entry( ( void* )(&datas[0]) );
 	}
 
+	// Execute the thread entry function on n_threads threads. Thread 0 is
+	// the current thread; the others are taken from the persistent thread
+	// pool, which is grown (if necessary) to accommodate them. This call
+	// returns only after all threads have finished.
+	bli_thrpool_run( n_threads, &bli_l3_thread_entry, datas, sizeof( thread_data_t ) );
+
 	// We shouldn't free the global communicator since it was already freed
 	// by the global communicator's chief thread in bli_l3_thrinfo_free()
 	// (called from the thread entry function).
 
-	// Thread 0 waits for additional threads to finish.
-	for ( dim_t tid = 1; tid < n_threads; tid++ )
-	{
-		bli_pthread_join( pthreads[tid], NULL );
-	}
-
 	// Check the array_t back into the small block allocator. Similar to the
 	// check-out, this is done using a lock embedded within the sba to ensure
 	// mutual exclusion.
 	bli_sba_checkin_array( array );
 
-	#ifdef BLIS_ENABLE_MEM_TRACING
-	printf( "bli_l3_thread_decorator().pth: " );
-	#endif
-	bli_free_intl( pthreads );
-
 	#ifdef BLIS_ENABLE_MEM_TRACING
 	printf( "bli_l3_thread_decorator().pth: " );
 	#endif
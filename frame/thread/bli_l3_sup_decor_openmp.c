@@ -104,6 +104,10 @@ err_t bli_l3_sup_thread_decorator
 		// be allocated/initialized.
 		bli_sba_rntm_set_pool( tid, array, rntm_p );
 
+		// Set the packing block allocator field of the thread-local rntm_t to
+		// the membrk_t of the NUMA node on which the thread is running.
+		bli_membrk_rntm_set_membrk( rntm_p );
+
 		thrinfo_t* thread = NULL;
 
 		// Create the root node of the thread's thrinfo_t structure.
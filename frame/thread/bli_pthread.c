@@ -111,6 +111,46 @@ void bli_pthread_once
 	InitOnceExecuteOnce( once, bli_init_once_wrapper, init, NULL );
 }
 
+int bli_pthread_key_create
+     (
+       bli_pthread_key_t* key,
+       void             (*destructor)(void*)
+     )
+{
+	// Fiber local storage (unlike thread local storage) supports a
+	// callback that is invoked when the thread exits.
+	*key = FlsAlloc( ( PFLS_CALLBACK_FUNCTION )destructor );
+	if ( *key == FLS_OUT_OF_INDEXES ) return EAGAIN;
+	return 0;
+}
+
+int bli_pthread_key_delete
+     (
+       bli_pthread_key_t key
+     )
+{
+	if ( !FlsFree( key ) ) return EINVAL;
+	return 0;
+}
+
+void* bli_pthread_getspecific
+     (
+       bli_pthread_key_t key
+     )
+{
+	return FlsGetValue( key );
+}
+
+int bli_pthread_setspecific
+     (
+       bli_pthread_key_t key,
+       const void*       value
+     )
+{
+	if ( !FlsSetValue( key, ( void* )value ) ) return EINVAL;
+	return 0;
+}
+
 int bli_pthread_cond_init
      (
        bli_pthread_cond_t*           cond,
@@ -314,6 +354,42 @@ void bli_pthread_once
 	pthread_once( once, init );
 }
 
+// -- pthread_key_*(), pthread_getspecific(), pthread_setspecific() --
+
+int bli_pthread_key_create
+     (
+       bli_pthread_key_t* key,
+       void             (*destructor)(void*)
+     )
+{
+	return pthread_key_create( key, destructor );
+}
+
+int bli_pthread_key_delete
+     (
+       bli_pthread_key_t key
+     )
+{
+	return pthread_key_delete( key );
+}
+
+void* bli_pthread_getspecific
+     (
+       bli_pthread_key_t key
+     )
+{
+	return pthread_getspecific( key );
+}
+
+int bli_pthread_setspecific
+     (
+       bli_pthread_key_t key,
+       const void*       value
+     )
+{
+	return pthread_setspecific( key, value );
+}
+
 #endif // _MSC_VER
 
 
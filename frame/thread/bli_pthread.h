@@ -86,6 +86,34 @@ BLIS_EXPORT_BLIS void bli_pthread_once
        void              (*init)(void)
      );
 
+// -- pthread_key_*() --
+
+typedef DWORD bli_pthread_key_t;
+
+// -- pthread_key_*(), pthread_getspecific(), pthread_setspecific() --
+
+BLIS_EXPORT_BLIS int bli_pthread_key_create
+     (
+       bli_pthread_key_t* key,
+       void             (*destructor)(void*)
+     );
+
+BLIS_EXPORT_BLIS int bli_pthread_key_delete
+     (
+       bli_pthread_key_t key
+     );
+
+BLIS_EXPORT_BLIS void* bli_pthread_getspecific
+     (
+       bli_pthread_key_t key
+     );
+
+BLIS_EXPORT_BLIS int bli_pthread_setspecific
+     (
+       bli_pthread_key_t key,
+       const void*       value
+     );
+
 // -- pthread_cond_*() --
 
 typedef CONDITION_VARIABLE bli_pthread_cond_t;
@@ -184,6 +212,7 @@ typedef pthread_mutexattr_t    bli_pthread_mutexattr_t;
 typedef pthread_cond_t         bli_pthread_cond_t;
 typedef pthread_condattr_t     bli_pthread_condattr_t;
 typedef pthread_once_t         bli_pthread_once_t;
+typedef pthread_key_t          bli_pthread_key_t;
 
 #if defined(__APPLE__)
 
@@ -293,6 +322,30 @@ BLIS_EXPORT_BLIS void bli_pthread_once
        void              (*init)(void)
      );
 
+// -- pthread_key_*(), pthread_getspecific(), pthread_setspecific() --
+
+BLIS_EXPORT_BLIS int bli_pthread_key_create
+     (
+       bli_pthread_key_t* key,
+       void             (*destructor)(void*)
+     );
+
+BLIS_EXPORT_BLIS int bli_pthread_key_delete
+     (
+       bli_pthread_key_t key
+     );
+
+BLIS_EXPORT_BLIS void* bli_pthread_getspecific
+     (
+       bli_pthread_key_t key
+     );
+
+BLIS_EXPORT_BLIS int bli_pthread_setspecific
+     (
+       bli_pthread_key_t key,
+       const void*       value
+     );
+
 // -- pthread_barrier_*() --
 
 BLIS_EXPORT_BLIS int bli_pthread_barrier_init
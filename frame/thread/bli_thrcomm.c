@@ -72,6 +72,10 @@ void* bli_thrcomm_bcast
 
 #endif
 
+// The centralized barrier below is not available when tree barriers are
+// enabled since the thrcomm_t does not contain the fields it needs.
+#ifndef BLIS_TREE_BARRIER
+
 void bli_thrcomm_barrier_atomic( dim_t t_id, thrcomm_t* comm )
 {
 	// Return early if the comm is NULL or if there is only one
@@ -116,3 +120,5 @@ void bli_thrcomm_barrier_atomic( dim_t t_id, thrcomm_t* comm )
 	}
 }
 
+#endif
+
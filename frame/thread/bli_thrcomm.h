@@ -52,15 +52,17 @@ BLIS_INLINE dim_t bli_thrcomm_num_threads( thrcomm_t* comm )
 
 
 // Thread communicator prototypes.
-thrcomm_t* bli_thrcomm_create( rntm_t* rntm, dim_t n_threads );
-void       bli_thrcomm_free( rntm_t* rntm, thrcomm_t* comm );
+BLIS_EXPORT_BLIS thrcomm_t* bli_thrcomm_create( rntm_t* rntm, dim_t n_threads );
+BLIS_EXPORT_BLIS void       bli_thrcomm_free( rntm_t* rntm, thrcomm_t* comm );
 void       bli_thrcomm_init( dim_t n_threads, thrcomm_t* comm );
 void       bli_thrcomm_cleanup( thrcomm_t* comm );
 
 BLIS_EXPORT_BLIS void  bli_thrcomm_barrier( dim_t thread_id, thrcomm_t* comm );
 BLIS_EXPORT_BLIS void* bli_thrcomm_bcast( dim_t inside_id, void* to_send, thrcomm_t* comm );
 
+#ifndef BLIS_TREE_BARRIER
 void       bli_thrcomm_barrier_atomic( dim_t thread_id, thrcomm_t* comm );
+#endif
 
 #endif
 
@@ -84,6 +84,131 @@ void bli_thrcomm_barrier( dim_t t_id, thrcomm_t* comm )
 	bli_pthread_barrier_wait( &comm->barrier );
 }
 
+#elif defined(BLIS_TREE_BARRIER)
+
+void bli_thrcomm_init( dim_t n_threads, thrcomm_t* comm )
+{
+	if ( comm == NULL ) return;
+	comm->sent_object = NULL;
+	comm->n_threads = n_threads;
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_thrcomm_init(): " );
+	#endif
+	comm->barriers = bli_malloc_intl( sizeof( barrier_t* ) * n_threads );
+	bli_thrcomm_tree_barrier_create( n_threads, BLIS_TREE_BARRIER_ARITY, comm->barriers, 0 );
+}
+
+barrier_t* bli_thrcomm_tree_barrier_create( int num_threads, int arity, barrier_t** leaves, int leaf_index )
+{
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_thrcomm_tree_barrier_create(): " );
+	#endif
+	barrier_t* me = bli_malloc_intl( sizeof( barrier_t ) );
+
+	me->dad = NULL;
+	me->signal = 0;
+
+	if ( num_threads <= arity )
+	{
+		// This node is a leaf. Register it as the leaf for each of the
+		// (consecutive) threads that arrive at it.
+		for ( int i = 0; i < num_threads; i++ )
+		{
+			leaves[ leaf_index + i ] = me;
+		}
+		me->count = num_threads;
+		me->arity = num_threads;
+	}
+	else
+	{
+		// Otherwise, split the threads as evenly as possible among arity
+		// children.
+		int threads_per_kid = num_threads / arity;
+		int defecit = num_threads - threads_per_kid * arity;
+
+		for ( int i = 0; i < arity; i++ )
+		{
+			int threads_this_kid = threads_per_kid;
+			if ( i < defecit ) threads_this_kid++;
+
+			barrier_t* kid = bli_thrcomm_tree_barrier_create( threads_this_kid, arity, leaves, leaf_index );
+			kid->dad = me;
+
+			leaf_index += threads_this_kid;
+		}
+		me->count = arity;
+		me->arity = arity;
+	}
+
+	return me;
+}
+
+void bli_thrcomm_cleanup( thrcomm_t* comm )
+{
+	if ( comm == NULL ) return;
+	for ( dim_t i = 0; i < comm->n_threads; i++ )
+	{
+		bli_thrcomm_tree_barrier_free( comm->barriers[i] );
+	}
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_thrcomm_cleanup(): " );
+	#endif
+	bli_free_intl( comm->barriers );
+}
+
+void bli_thrcomm_tree_barrier_free( barrier_t* barrier )
+{
+	if ( barrier == NULL ) return;
+
+	// The count field is reused here to track the number of leaves (or
+	// children) that still reference this node. The node is freed after
+	// the last reference is released.
+	barrier->count--;
+	if ( barrier->count == 0 )
+	{
+		bli_thrcomm_tree_barrier_free( barrier->dad );
+
+		#ifdef BLIS_ENABLE_MEM_TRACING
+		printf( "bli_thrcomm_tree_barrier_free(): " );
+		#endif
+		bli_free_intl( barrier );
+	}
+}
+
+void bli_thrcomm_barrier( dim_t t_id, thrcomm_t* comm )
+{
+	if ( comm == NULL || comm->n_threads == 1 ) return;
+
+	bli_thrcomm_tree_barrier( comm->barriers[t_id] );
+}
+
+void bli_thrcomm_tree_barrier( barrier_t* barack )
+{
+	gint_t my_signal = __atomic_load_n( &barack->signal, __ATOMIC_RELAXED );
+
+	gint_t my_count = __atomic_fetch_sub( &barack->count, 1, __ATOMIC_ACQ_REL );
+
+	if ( my_count == 1 )
+	{
+		// We were the last thread to arrive at this node. Proceed up the
+		// tree (if this isn't the root), and once we return from the parent
+		// node, reset this node and release the threads waiting on it.
+		if ( barack->dad != NULL )
+		{
+			bli_thrcomm_tree_barrier( barack->dad );
+		}
+		barack->count = barack->arity;
+		__atomic_fetch_xor( &barack->signal, 1, __ATOMIC_RELEASE );
+	}
+	else
+	{
+		while ( __atomic_load_n( &barack->signal, __ATOMIC_ACQUIRE ) == my_signal )
+			; // Empty loop body.
+	}
+}
+
 #else
 
 void bli_thrcomm_init( dim_t n_threads, thrcomm_t* comm )
@@ -46,6 +46,40 @@ struct thrcomm_s
 
 	bli_pthread_barrier_t barrier;
 };
+#elif defined(BLIS_TREE_BARRIER)
+
+// The tree barrier is an alternative to the centralized barrier below that
+// may scale better for large numbers of threads, particularly across
+// multiple sockets. Threads arrive at the leaves of a tree with fan-in
+// BLIS_TREE_BARRIER_ARITY, where each leaf is shared by threads with
+// consecutive thread ids (and thus, typically, threads that also share
+// sub-communicators and, if bound accordingly, a socket). Only the last
+// thread to arrive at a node proceeds up the tree, and threads spin only
+// on the signal field of their own leaf.
+#ifndef BLIS_TREE_BARRIER_ARITY
+#define BLIS_TREE_BARRIER_ARITY 4
+#endif
+
+struct barrier_s
+{
+	gint_t            arity;
+	gint_t            count;
+	struct barrier_s* dad;
+	gint_t            signal;
+
+	// Each node is allocated separately. Padding the end of each node keeps
+	// the fields of different nodes (which are polled by different groups
+	// of threads) on different cache lines.
+	char              pad[ 128 ];
+};
+typedef struct barrier_s barrier_t;
+
+struct thrcomm_s
+{
+	void*       sent_object;
+	dim_t       n_threads;
+	barrier_t** barriers;
+};
 #else
 struct thrcomm_s
 {
@@ -70,6 +104,13 @@ struct thrcomm_s
 
 typedef struct thrcomm_s thrcomm_t;
 
+// Prototypes specific to tree barriers.
+#ifdef BLIS_TREE_BARRIER
+barrier_t* bli_thrcomm_tree_barrier_create( int num_threads, int arity, barrier_t** leaves, int leaf_index );
+void       bli_thrcomm_tree_barrier_free( barrier_t* barrier );
+void       bli_thrcomm_tree_barrier( barrier_t* barack );
+#endif
+
 #endif
 
 #endif
@@ -57,10 +57,18 @@ void bli_thread_init( void )
 	// Read the environment variables and use them to initialize the
 	// global runtime object.
 	bli_thread_init_rntm_from_env( &global_rntm );
+
+#ifdef BLIS_ENABLE_PTHREADS
+	bli_thrpool_init();
+#endif
 }
 
 void bli_thread_finalize( void )
 {
+#ifdef BLIS_ENABLE_PTHREADS
+	// Join and free any worker threads held by the thread pool.
+	bli_thrpool_finalize();
+#endif
 }
 
 // -----------------------------------------------------------------------------
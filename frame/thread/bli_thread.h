@@ -57,6 +57,13 @@
 // for the sup code path.
 #include "bli_l3_sup_decor.h"
 
+// Include the level-3 thread decorator and related definitions and prototypes
+// for batched operations.
+#include "bli_l3_batch_decor.h"
+
+// Include the level-2 thread decorator and related definitions and prototypes.
+#include "bli_l2_decor.h"
+
 // Initialization-related prototypes.
 void bli_thread_init( void );
 void bli_thread_finalize( void );
@@ -0,0 +1,347 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#ifdef BLIS_ENABLE_PTHREADS
+
+// The bounds on the number of iterations a worker spins, waiting for a new
+// job, before it parks on the condition variable. Within these bounds, the
+// spin count adapts to how quickly new jobs arrive.
+#ifndef BLIS_THRPOOL_SPIN_MIN
+#define BLIS_THRPOOL_SPIN_MIN  ( 1 << 6 )
+#endif
+
+#ifndef BLIS_THRPOOL_SPIN_MAX
+#define BLIS_THRPOOL_SPIN_MAX  ( 1 << 14 )
+#endif
+
+// Use a spin-wait hint, where available, to be friendlier to a sibling
+// hyperthread while a worker waits for work.
+#if defined(__x86_64__) || defined(__i386__)
+  #define bli_thrpool_pause() __asm__ __volatile__ ( "pause" )
+#elif defined(__aarch64__)
+  #define bli_thrpool_pause() __asm__ __volatile__ ( "yield" )
+#else
+  #define bli_thrpool_pause()
+#endif
+
+// The amount of padding placed at the end of each worker. Each worker is
+// allocated separately, and so the padding ensures that the flags polled
+// by different workers do not share a cache line (or an adjacent-line
+// prefetch pair).
+#define BLIS_THRPOOL_PAD_SIZE 128
+
+typedef struct thrpool_worker_s
+{
+	bli_pthread_t  thread;
+
+	// The job most recently posted to the worker. A NULL func tells the
+	// worker to exit.
+	thrpool_func_t func;
+	void*          data;
+
+	// The job sequence number. The posting thread increments this after
+	// writing func and data; the worker compares it against the sequence
+	// number of the last job it executed.
+	gint_t         post;
+
+	// The number of iterations the worker currently spins before parking.
+	dim_t          spin;
+
+	char           pad[ BLIS_THRPOOL_PAD_SIZE ];
+} thrpool_worker_t;
+
+// This mutex is held by the thread that is currently running a job on the
+// pool. It also guards the growth and teardown of the pool.
+static bli_pthread_mutex_t thrpool_run_lock  = BLIS_PTHREAD_MUTEX_INITIALIZER;
+
+// The mutex and condition variable on which idle workers park.
+static bli_pthread_mutex_t thrpool_park_lock = BLIS_PTHREAD_MUTEX_INITIALIZER;
+static bli_pthread_cond_t  thrpool_park_cond = BLIS_PTHREAD_COND_INITIALIZER;
+
+static thrpool_worker_t**  thrpool_workers   = NULL;
+static dim_t               thrpool_n_workers = 0;
+
+// The number of workers currently parked (or about to park) on the
+// condition variable, and the number of workers that have finished the
+// current job.
+static dim_t               thrpool_n_parked  = 0;
+static dim_t               thrpool_n_done    = 0;
+
+// -----------------------------------------------------------------------------
+
+static void* bli_thrpool_worker_main( void* arg )
+{
+	thrpool_worker_t* w    = arg;
+	gint_t            seen = 0;
+	gint_t            post = 0;
+
+	while ( 1 )
+	{
+		dim_t i;
+
+		// Spin for a while in the hope that the next job arrives soon.
+		for ( i = 0; i < w->spin; ++i )
+		{
+			post = __atomic_load_n( &w->post, __ATOMIC_ACQUIRE );
+			if ( post != seen ) break;
+			bli_thrpool_pause();
+		}
+
+		if ( post != seen )
+		{
+			// The job arrived while we were spinning, so spin a little
+			// longer next time.
+			w->spin = bli_min( 2 * w->spin, BLIS_THRPOOL_SPIN_MAX );
+		}
+		else
+		{
+			// Park on the condition variable. We announce ourselves as parked
+			// before re-checking the sequence number so that either we see the
+			// new job or the posting thread sees us and signals the condition
+			// variable (both sides use sequentially consistent accesses).
+			bli_pthread_mutex_lock( &thrpool_park_lock );
+			__atomic_add_fetch( &thrpool_n_parked, 1, __ATOMIC_SEQ_CST );
+
+			while ( ( post = __atomic_load_n( &w->post, __ATOMIC_SEQ_CST ) ) == seen )
+				bli_pthread_cond_wait( &thrpool_park_cond, &thrpool_park_lock );
+
+			__atomic_sub_fetch( &thrpool_n_parked, 1, __ATOMIC_SEQ_CST );
+			bli_pthread_mutex_unlock( &thrpool_park_lock );
+
+			// The job took a while to arrive, so give up the core sooner
+			// next time.
+			w->spin = bli_max( w->spin / 2, BLIS_THRPOOL_SPIN_MIN );
+		}
+
+		seen = post;
+
+		if ( w->func == NULL ) break;
+
+		w->func( w->data );
+
+		__atomic_add_fetch( &thrpool_n_done, 1, __ATOMIC_RELEASE );
+	}
+
+	return NULL;
+}
+
+static void bli_thrpool_wake( void )
+{
+	// Only touch the park mutex if at least one worker may be parked.
+	if ( __atomic_load_n( &thrpool_n_parked, __ATOMIC_SEQ_CST ) > 0 )
+	{
+		bli_pthread_mutex_lock( &thrpool_park_lock );
+		bli_pthread_cond_broadcast( &thrpool_park_cond );
+		bli_pthread_mutex_unlock( &thrpool_park_lock );
+	}
+}
+
+// NOTE: Must be called with thrpool_run_lock held.
+static void bli_thrpool_grow( dim_t n_workers )
+{
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_thrpool_grow(): " );
+	#endif
+	thrpool_worker_t** workers
+	= bli_malloc_intl( sizeof( thrpool_worker_t* ) * n_workers );
+
+	for ( dim_t i = 0; i < thrpool_n_workers; ++i )
+		workers[i] = thrpool_workers[i];
+
+	for ( dim_t i = thrpool_n_workers; i < n_workers; ++i )
+	{
+		#ifdef BLIS_ENABLE_MEM_TRACING
+		printf( "bli_thrpool_grow(): " );
+		#endif
+		thrpool_worker_t* w = bli_malloc_intl( sizeof( thrpool_worker_t ) );
+
+		w->func = NULL;
+		w->data = NULL;
+		w->post = 0;
+		w->spin = BLIS_THRPOOL_SPIN_MIN;
+
+		bli_pthread_create( &w->thread, NULL, &bli_thrpool_worker_main, w );
+
+		workers[i] = w;
+	}
+
+	if ( thrpool_workers != NULL )
+	{
+		#ifdef BLIS_ENABLE_MEM_TRACING
+		printf( "bli_thrpool_grow(): " );
+		#endif
+		bli_free_intl( thrpool_workers );
+	}
+
+	thrpool_workers   = workers;
+	thrpool_n_workers = n_workers;
+}
+
+static void bli_thrpool_run_unpooled
+     (
+       dim_t          n_threads,
+       thrpool_func_t func,
+       char*          datas,
+       siz_t          data_size
+     )
+{
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_thrpool_run_unpooled(): " );
+	#endif
+	bli_pthread_t* pthreads = bli_malloc_intl( sizeof( bli_pthread_t ) * n_threads );
+
+	for ( dim_t tid = 1; tid < n_threads; tid++ )
+		bli_pthread_create( &pthreads[tid], NULL, func, datas + tid * data_size );
+
+	func( datas );
+
+	for ( dim_t tid = 1; tid < n_threads; tid++ )
+		bli_pthread_join( pthreads[tid], NULL );
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_thrpool_run_unpooled(): " );
+	#endif
+	bli_free_intl( pthreads );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_thrpool_init( void )
+{
+	// Nothing to do here. Worker threads are created lazily the first time
+	// bli_thrpool_run() is called with more than one thread.
+}
+
+void bli_thrpool_finalize( void )
+{
+	bli_pthread_mutex_lock( &thrpool_run_lock );
+
+	// Post a NULL job to each worker, which causes it to exit.
+	for ( dim_t i = 0; i < thrpool_n_workers; ++i )
+	{
+		thrpool_worker_t* w = thrpool_workers[i];
+
+		w->func = NULL;
+		w->data = NULL;
+		__atomic_add_fetch( &w->post, 1, __ATOMIC_SEQ_CST );
+	}
+
+	bli_thrpool_wake();
+
+	for ( dim_t i = 0; i < thrpool_n_workers; ++i )
+	{
+		bli_pthread_join( thrpool_workers[i]->thread, NULL );
+
+		#ifdef BLIS_ENABLE_MEM_TRACING
+		printf( "bli_thrpool_finalize(): " );
+		#endif
+		bli_free_intl( thrpool_workers[i] );
+	}
+
+	if ( thrpool_workers != NULL )
+	{
+		#ifdef BLIS_ENABLE_MEM_TRACING
+		printf( "bli_thrpool_finalize(): " );
+		#endif
+		bli_free_intl( thrpool_workers );
+	}
+
+	thrpool_workers   = NULL;
+	thrpool_n_workers = 0;
+
+	bli_pthread_mutex_unlock( &thrpool_run_lock );
+}
+
+void bli_thrpool_run
+     (
+       dim_t          n_threads,
+       thrpool_func_t func,
+       void*          datas,
+       siz_t          data_size
+     )
+{
+	char* datas_c = datas;
+
+	if ( n_threads == 1 ) { func( datas ); return; }
+
+	// If another thread is already using the pool, we fall back to creating
+	// (and later joining) our own threads rather than waiting.
+	if ( bli_pthread_mutex_trylock( &thrpool_run_lock ) != 0 )
+	{
+		bli_thrpool_run_unpooled( n_threads, func, datas_c, data_size );
+		return;
+	}
+
+	const dim_t n_workers = n_threads - 1;
+
+	if ( thrpool_n_workers < n_workers ) bli_thrpool_grow( n_workers );
+
+	__atomic_store_n( &thrpool_n_done, 0, __ATOMIC_RELAXED );
+
+	// Post the job to the first n_workers workers. Thread tid > 0 is
+	// executed by worker tid - 1.
+	for ( dim_t i = 0; i < n_workers; ++i )
+	{
+		thrpool_worker_t* w = thrpool_workers[i];
+
+		w->func = func;
+		w->data = datas_c + ( i + 1 ) * data_size;
+		__atomic_add_fetch( &w->post, 1, __ATOMIC_SEQ_CST );
+	}
+
+	bli_thrpool_wake();
+
+	// The calling thread executes thread 0.
+	func( datas );
+
+	// Wait for the workers to finish.
+	while ( __atomic_load_n( &thrpool_n_done, __ATOMIC_ACQUIRE ) < n_workers )
+		bli_thrpool_pause();
+
+	bli_pthread_mutex_unlock( &thrpool_run_lock );
+}
+
+dim_t bli_thrpool_num_workers( void )
+{
+	bli_pthread_mutex_lock( &thrpool_run_lock );
+	dim_t n_workers = thrpool_n_workers;
+	bli_pthread_mutex_unlock( &thrpool_run_lock );
+
+	return n_workers;
+}
+
+#endif
+
@@ -0,0 +1,75 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_THRPOOL_H
+#define BLIS_THRPOOL_H
+
+// Definitions specific to situations when POSIX multithreading is enabled.
+#ifdef BLIS_ENABLE_PTHREADS
+
+// The thread pool allows the pthreads decorators to reuse a set of
+// persistent worker threads across calls instead of creating and joining
+// n_threads - 1 threads every time a level-3 operation is invoked. Workers
+// are created lazily (the first time a given number of threads is needed)
+// and spin for a while after finishing a job before parking on a condition
+// variable.
+
+// Thread entry function type. This matches the signature expected by
+// bli_pthread_create() so that the same entry function may be used for
+// pooled and non-pooled threads.
+typedef void* (*thrpool_func_t)( void* data );
+
+void bli_thrpool_init( void );
+void bli_thrpool_finalize( void );
+
+// Execute func on n_threads threads, where thread tid receives the address
+// datas + tid * data_size. Thread 0 is always the calling thread. If the
+// pool is already in use (e.g. by another application thread, or because
+// of a nested call from within a pooled thread), the call falls back to
+// creating and joining threads via bli_pthread_create()/_join().
+void bli_thrpool_run
+     (
+       dim_t          n_threads,
+       thrpool_func_t func,
+       void*          datas,
+       siz_t          data_size
+     );
+
+// Query the number of worker threads currently held by the pool.
+BLIS_EXPORT_BLIS dim_t bli_thrpool_num_workers( void );
+
+#endif
+
+#endif
+
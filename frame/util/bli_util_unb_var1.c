@@ -266,7 +266,7 @@ INSERT_GENTFUNCR_BASIC0( norm1v_unb_var1 )
 
 
 #undef  GENTFUNCR
-#define GENTFUNCR( ctype, ctype_r, ch, chr, varname, kername ) \
+#define GENTFUNCR( ctype, ctype_r, ch, chr, varname, kerid ) \
 \
 void PASTEMAC(ch,varname) \
      ( \
@@ -277,170 +277,27 @@ void PASTEMAC(ch,varname) \
        rntm_t*  rntm  \
      ) \
 { \
-	ctype_r* zero       = PASTEMAC(chr,0); \
-	ctype_r* one        = PASTEMAC(chr,1); \
-	ctype_r  scale; \
-	ctype_r  sumsq; \
-	ctype_r  sqrt_sumsq; \
-\
-	/* Initialize scale and sumsq to begin the summation. */ \
-	PASTEMAC(chr,copys)( *zero, scale ); \
-	PASTEMAC(chr,copys)( *one,  sumsq ); \
-\
-	/* Compute the sum of the squares of the vector. */ \
-	PASTEMAC(ch,kername) \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	/* Query the context for the kernel function pointer. */ \
+	PASTECH2(ch,normfv,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
+\
+	/* Compute the norm via the normfv kernel, which is expected to take
+	   care not to overflow unnecessarily (ie: not to overflow when the
+	   norm itself is representable even if the sum of the squares of x
+	   is not). See GitHub issue #332 for discussion. The reference
+	   kernel uses Blue's algorithm, which requires only one pass through
+	   the data and no divisions. */ \
+	f \
 	( \
 	  n, \
 	  x, incx, \
-	  &scale, \
-	  &sumsq, \
-	  cntx, \
-	  rntm  \
+	  norm, \
+	  cntx  \
 	); \
-\
-	/* Compute: norm = scale * sqrt( sumsq ) */ \
-	PASTEMAC(chr,sqrt2s)( sumsq, sqrt_sumsq ); \
-	PASTEMAC(chr,scals)( scale, sqrt_sumsq ); \
-\
-	/* Store the final value to the output variable. */ \
-	PASTEMAC(chr,copys)( sqrt_sumsq, *norm ); \
 }
 
-//INSERT_GENTFUNCR_BASIC( normfv_unb_var1, sumsqv_unb_var1 )
-GENTFUNCR( scomplex, float,  c, s, normfv_unb_var1, sumsqv_unb_var1 )
-GENTFUNCR( dcomplex, double, z, d, normfv_unb_var1, sumsqv_unb_var1 )
-
-#undef  GENTFUNCR
-// We've disabled the dotv-based implementation because that method of
-// computing the sum of the squares of x inherently does not check for
-// overflow. Instead, we use the fallback method based on sumsqv, which
-// takes care to not overflow unnecessarily (ie: takes care for the
-// sqrt( sum of the squares of x ) to not overflow if the sum of the
-// squares of x would normally overflow. See GitHub issue #332 for
-// discussion.
-#if 0 //defined(FE_OVERFLOW) && !defined(__APPLE__)
-#define GENTFUNCR( ctype, ctype_r, ch, chr, varname, kername ) \
-\
-void PASTEMAC(ch,varname) \
-     ( \
-       dim_t    n, \
-       ctype*   x, inc_t incx, \
-       ctype_r* norm, \
-       cntx_t*  cntx, \
-       rntm_t*  rntm  \
-     ) \
-{ \
-	ctype_r* zero       = PASTEMAC(chr,0); \
-	ctype_r* one        = PASTEMAC(chr,1); \
-	ctype_r  scale; \
-	ctype_r  sumsq; \
-	ctype_r  sqrt_sumsq; \
-\
-	/* Initialize scale and sumsq to begin the summation. */ \
-	PASTEMAC(chr,copys)( *zero, scale ); \
-	PASTEMAC(chr,copys)( *one,  sumsq ); \
-\
-	/* An optimization: first try to use dotv to compute the sum of
-	   the squares of the vector. If no floating-point exceptions
-	   (specifically, overflow and invalid exceptions) were produced,
-	   then we accept the computed value and returne early. The cost
-	   of this optimization is the "sunk" cost of the initial dotv
-	   when sumsqv must be used instead. However, we expect that the
-	   vast majority of use cases will not produce exceptions, and
-	   therefore only one pass through the data, via dotv, will be
-	   required. */ \
-	if ( TRUE ) \
-	{ \
-		int      f_exp_raised;\
-		ctype    sumsqc; \
-\
-		feclearexcept( FE_ALL_EXCEPT );\
-\
-		PASTEMAC2(ch,dotv,BLIS_TAPI_EX_SUF) \
-		( \
-		  BLIS_NO_CONJUGATE, \
-		  BLIS_NO_CONJUGATE, \
-		  n,\
-		  x, incx, \
-		  x, incx, \
-		  &sumsqc, \
-		  cntx, \
-		  rntm  \
-		); \
-\
-		PASTEMAC2(ch,chr,copys)( sumsqc, sumsq ); \
-\
-		f_exp_raised = fetestexcept( FE_OVERFLOW | FE_INVALID );\
-\
-		if ( !f_exp_raised ) \
-		{ \
-		    PASTEMAC(chr,sqrt2s)( sumsq, *norm ); \
-		    return; \
-		} \
-	} \
-\
-	/* Compute the sum of the squares of the vector. */ \
-	PASTEMAC(ch,kername) \
-	( \
-	  n, \
-	  x, incx, \
-	  &scale, \
-	  &sumsq, \
-	  cntx, \
-	  rntm  \
-	); \
-\
-	/* Compute: norm = scale * sqrt( sumsq ) */ \
-	PASTEMAC(chr,sqrt2s)( sumsq, sqrt_sumsq ); \
-	PASTEMAC(chr,scals)( scale, sqrt_sumsq ); \
-\
-	/* Store the final value to the output variable. */ \
-	PASTEMAC(chr,copys)( sqrt_sumsq, *norm ); \
-}
-#else
-#define GENTFUNCR( ctype, ctype_r, ch, chr, varname, kername ) \
-\
-void PASTEMAC(ch,varname) \
-     ( \
-       dim_t    n, \
-       ctype*   x, inc_t incx, \
-       ctype_r* norm, \
-       cntx_t*  cntx, \
-       rntm_t*  rntm  \
-     ) \
-{ \
-	ctype_r* zero       = PASTEMAC(chr,0); \
-	ctype_r* one        = PASTEMAC(chr,1); \
-	ctype_r  scale; \
-	ctype_r  sumsq; \
-	ctype_r  sqrt_sumsq; \
-\
-	/* Initialize scale and sumsq to begin the summation. */ \
-	PASTEMAC(chr,copys)( *zero, scale ); \
-	PASTEMAC(chr,copys)( *one,  sumsq ); \
-\
-	/* Compute the sum of the squares of the vector. */ \
-\
-	PASTEMAC(ch,kername) \
-	( \
-	  n, \
-	  x, incx, \
-	  &scale, \
-	  &sumsq, \
-	  cntx, \
-	  rntm  \
-	); \
-\
-	/* Compute: norm = scale * sqrt( sumsq ) */ \
-	PASTEMAC(chr,sqrt2s)( sumsq, sqrt_sumsq ); \
-	PASTEMAC(chr,scals)( scale, sqrt_sumsq ); \
-\
-	/* Store the final value to the output variable. */ \
-	PASTEMAC(chr,copys)( sqrt_sumsq, *norm ); \
-}
-#endif
-GENTFUNCR( float,   float,  s, s, normfv_unb_var1, sumsqv_unb_var1 )
-GENTFUNCR( double,  double, d, d, normfv_unb_var1, sumsqv_unb_var1 )
+INSERT_GENTFUNCR_BASIC( normfv_unb_var1, BLIS_NORMFV_KER )
 
 
 #undef  GENTFUNCR
@@ -0,0 +1,173 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#ifdef __ARM_FEATURE_SVE
+#include <arm_sve.h>
+#else
+#error "No Arm SVE intrinsics support in compiler"
+#endif // __ARM_FEATURE_SVE
+
+// -----------------------------------------------------------------------------
+
+// Vector-length agnostic packm kernel whose micropanel dimension is two SVE
+// vectors of floats (ie: the MR of bli_sgemm_armsve_int_2vx12).
+
+void bli_spackm_armsve_int_2vxk
+     (
+       conj_t           conja,
+       pack_t           schema,
+       dim_t            cdim,
+       dim_t            n,
+       dim_t            n_max,
+       void*   restrict kappa,
+       void*   restrict a, inc_t inca, inc_t lda,
+       void*   restrict p,             inc_t ldp,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t        vl         = svcntw();
+	const dim_t        mnr        = 2 * vl;
+
+	float*    restrict kappa_cast = kappa;
+	float*    restrict a_cast     = a;
+	float*    restrict p_cast     = p;
+
+	const bool         is_kappa1  = bli_seq1( *kappa_cast );
+
+	const svbool_t     pg         = svptrue_b32();
+	const svfloat32_t  zerov      = svdup_n_f32( 0.0f );
+
+	dim_t              k;
+
+	svfloat32_t        x0v, x1v;
+
+	if ( cdim == mnr )
+	{
+		if ( inca == 1 )
+		{
+			// Each column of the micropanel is contiguous in A, so we can
+			// copy it with vector loads and stores.
+			for ( k = 0; k < n; ++k )
+			{
+				float* restrict a0 = a_cast + k*lda;
+				float* restrict p0 = p_cast + k*ldp;
+
+				x0v = svld1_f32( pg, a0      );
+				x1v = svld1_f32( pg, a0 + vl );
+
+				if ( !is_kappa1 )
+				{
+					x0v = svmul_n_f32_x( pg, x0v, *kappa_cast );
+					x1v = svmul_n_f32_x( pg, x1v, *kappa_cast );
+				}
+
+				svst1_f32( pg, p0,      x0v );
+				svst1_f32( pg, p0 + vl, x1v );
+			}
+		}
+		else if ( ( vl - 1 ) * inca * sizeof( float ) <= UINT32_MAX )
+		{
+			// Otherwise, gather each column of the micropanel using byte
+			// offsets that step by inca elements, provided the offsets fit
+			// in the 32-bit lanes of the index vector.
+			const svuint32_t offv = svindex_u32( 0, inca * sizeof( float ) );
+
+			for ( k = 0; k < n; ++k )
+			{
+				float* restrict a0 = a_cast + k*lda;
+				float* restrict p0 = p_cast + k*ldp;
+
+				x0v = svld1_gather_u32offset_f32( pg, a0,           offv );
+				x1v = svld1_gather_u32offset_f32( pg, a0 + vl*inca, offv );
+
+				if ( !is_kappa1 )
+				{
+					x0v = svmul_n_f32_x( pg, x0v, *kappa_cast );
+					x1v = svmul_n_f32_x( pg, x1v, *kappa_cast );
+				}
+
+				svst1_f32( pg, p0,      x0v );
+				svst1_f32( pg, p0 + vl, x1v );
+			}
+		}
+		else
+		{
+			// For very large strides, fall back to scalar code.
+			for ( k = 0; k < n; ++k )
+			{
+				float* restrict a0 = a_cast + k*lda;
+				float* restrict p0 = p_cast + k*ldp;
+
+				for ( dim_t i = 0; i < mnr; ++i )
+					bli_sscal2s( *kappa_cast, *(a0 + i*inca), *(p0 + i) );
+			}
+		}
+	}
+	else /* if ( cdim < mnr ) */
+	{
+		bli_sscal2m_ex
+		(
+		  0,
+		  BLIS_NONUNIT_DIAG,
+		  BLIS_DENSE,
+		  ( trans_t )conja,
+		  cdim,
+		  n,
+		  kappa,
+		  a, inca, lda,
+		  p,    1, ldp,
+		  cntx,
+		  NULL
+		);
+
+		bli_sset0s_mxn
+		(
+		  mnr - cdim,
+		  n_max,
+		  p_cast + cdim, 1, ldp
+		);
+	}
+
+	// Zero-fill the columns of the micropanel beyond n.
+	for ( k = n; k < n_max; ++k )
+	{
+		float* restrict p0 = p_cast + k*ldp;
+
+		svst1_f32( pg, p0,      zerov );
+		svst1_f32( pg, p0 + vl, zerov );
+	}
+}
+
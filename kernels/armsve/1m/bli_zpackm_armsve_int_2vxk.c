@@ -0,0 +1,173 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#ifdef __ARM_FEATURE_SVE
+#include <arm_sve.h>
+#else
+#error "No Arm SVE intrinsics support in compiler"
+#endif // __ARM_FEATURE_SVE
+
+// -----------------------------------------------------------------------------
+
+// Vector-length agnostic packm kernel whose micropanel dimension is two SVE
+// vectors of dcomplex (ie: the MR of bli_zgemm_armsve_int_2vx10).
+
+void bli_zpackm_armsve_int_2vxk
+     (
+       conj_t           conja,
+       pack_t           schema,
+       dim_t            cdim,
+       dim_t            n,
+       dim_t            n_max,
+       void*   restrict kappa,
+       void*   restrict a, inc_t inca, inc_t lda,
+       void*   restrict p,             inc_t ldp,
+       cntx_t* restrict cntx
+     )
+{
+	// NOTE: vl is the number of doubles per vector, which is twice the
+	// number of dcomplex elements per vector.
+	const dim_t        vl         = svcntd();
+	const dim_t        mnr        = vl;
+
+	dcomplex* restrict kappa_cast = kappa;
+	dcomplex* restrict a_cast     = a;
+	dcomplex* restrict p_cast     = p;
+
+	const bool         is_kappa1  = bli_zeq1( *kappa_cast );
+	const bool         is_conj    = bli_is_conj( conja );
+
+	const svbool_t     pg         = svptrue_b64();
+	const svfloat64_t  kappav     = svdupq_n_f64( bli_zreal( *kappa_cast ),
+	                                              bli_zimag( *kappa_cast ) );
+	const svfloat64_t  conjv      = svdupq_n_f64( 1.0, -1.0 );
+	const svfloat64_t  zerov      = svdup_n_f64( 0.0 );
+
+	dim_t              i, k;
+
+	svfloat64_t        x0v, x1v;
+	svfloat64_t        y0v, y1v;
+
+	if ( cdim == mnr )
+	{
+		k = 0;
+
+		if ( inca == 1 )
+		{
+			// Each column of the micropanel is contiguous in A, so we can
+			// copy it with vector loads and stores.
+			for ( ; k < n; ++k )
+			{
+				double* restrict a0 = ( double* )( a_cast + k*lda );
+				double* restrict p0 = ( double* )( p_cast + k*ldp );
+
+				x0v = svld1_f64( pg, a0      );
+				x1v = svld1_f64( pg, a0 + vl );
+
+				if ( is_conj )
+				{
+					x0v = svmul_f64_x( pg, x0v, conjv );
+					x1v = svmul_f64_x( pg, x1v, conjv );
+				}
+
+				if ( !is_kappa1 )
+				{
+					y0v = svcmla_f64_x( pg, zerov, x0v, kappav,  0 );
+					y1v = svcmla_f64_x( pg, zerov, x1v, kappav,  0 );
+					x0v = svcmla_f64_x( pg, y0v,   x0v, kappav, 90 );
+					x1v = svcmla_f64_x( pg, y1v,   x1v, kappav, 90 );
+				}
+
+				svst1_f64( pg, p0,      x0v );
+				svst1_f64( pg, p0 + vl, x1v );
+			}
+		}
+
+		// Pack general-stride cases with scalar code. (A dcomplex element
+		// spans a full 128-bit quadword, which SVE cannot gather as a
+		// single element.)
+		for ( ; k < n; ++k )
+		{
+			dcomplex* restrict a0 = a_cast + k*lda;
+			dcomplex* restrict p0 = p_cast + k*ldp;
+
+			if ( is_conj )
+			{
+				for ( i = 0; i < mnr; ++i )
+					bli_zscal2js( *kappa_cast, *(a0 + i*inca), *(p0 + i) );
+			}
+			else
+			{
+				for ( i = 0; i < mnr; ++i )
+					bli_zscal2s( *kappa_cast, *(a0 + i*inca), *(p0 + i) );
+			}
+		}
+	}
+	else /* if ( cdim < mnr ) */
+	{
+		bli_zscal2m_ex
+		(
+		  0,
+		  BLIS_NONUNIT_DIAG,
+		  BLIS_DENSE,
+		  ( trans_t )conja,
+		  cdim,
+		  n,
+		  kappa,
+		  a, inca, lda,
+		  p,    1, ldp,
+		  cntx,
+		  NULL
+		);
+
+		bli_zset0s_mxn
+		(
+		  mnr - cdim,
+		  n_max,
+		  p_cast + cdim, 1, ldp
+		);
+	}
+
+	// Zero-fill the columns of the micropanel beyond n.
+	for ( k = n; k < n_max; ++k )
+	{
+		double* restrict p0 = ( double* )( p_cast + k*ldp );
+
+		svst1_f64( pg, p0,      zerov );
+		svst1_f64( pg, p0 + vl, zerov );
+	}
+}
+
@@ -0,0 +1,216 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#ifdef __ARM_FEATURE_SVE
+#include <arm_sve.h>
+#else
+#error "No Arm SVE intrinsics support in compiler"
+#endif // __ARM_FEATURE_SVE
+
+/*
+   o 2vx10 scomplex micro-kernel, where v is the number of scomplex
+     elements in one SVE vector (ie: MR = 2 * svcntw() / 2 = svcntw()).
+   o Vector-length agnostic: the same binary runs on any SVE implementation,
+     and MR is queried from the hardware when the context is initialized.
+   o Each column of the microtile is held in two SVE vectors of interleaved
+     real and imaginary parts. Pairs of elements of B are loaded as a
+     quadword replicated across the vector, and the complex multiply-
+     accumulate is performed with a pair of indexed FCMLA instructions
+     (rotations 0 and 90).
+*/
+
+#define CGEMM_ARMSVE_CMLA( acc, x, y ) \
+	acc = svcmla_f32_x( pg, acc, x, y,  0 ); \
+	acc = svcmla_f32_x( pg, acc, x, y, 90 );
+
+#define CGEMM_ARMSVE_CMLA_LANE( acc, x, y, l ) \
+	acc = svcmla_lane_f32( acc, x, y, l,  0 ); \
+	acc = svcmla_lane_f32( acc, x, y, l, 90 );
+
+#define CGEMM_ARMSVE_COL( j, bq, l ) \
+	CGEMM_ARMSVE_CMLA_LANE( ab ## j ## _0, a0v, bq, l ) \
+	CGEMM_ARMSVE_CMLA_LANE( ab ## j ## _1, a1v, bq, l )
+
+#define CGEMM_ARMSVE_ITER \
+	{ \
+		const svfloat32_t a0v = svld1_f32( pg, ( float* )a ); \
+		const svfloat32_t a1v = svld1_f32( pg, ( float* )a + vl ); \
+\
+		const svfloat32_t b0q = svld1rq_f32( pg, ( float* )( b + 0 ) ); \
+		const svfloat32_t b1q = svld1rq_f32( pg, ( float* )( b + 2 ) ); \
+		const svfloat32_t b2q = svld1rq_f32( pg, ( float* )( b + 4 ) ); \
+		const svfloat32_t b3q = svld1rq_f32( pg, ( float* )( b + 6 ) ); \
+		const svfloat32_t b4q = svld1rq_f32( pg, ( float* )( b + 8 ) ); \
+\
+		CGEMM_ARMSVE_COL( 0, b0q, 0 ) \
+		CGEMM_ARMSVE_COL( 1, b0q, 1 ) \
+		CGEMM_ARMSVE_COL( 2, b1q, 0 ) \
+		CGEMM_ARMSVE_COL( 3, b1q, 1 ) \
+		CGEMM_ARMSVE_COL( 4, b2q, 0 ) \
+		CGEMM_ARMSVE_COL( 5, b2q, 1 ) \
+		CGEMM_ARMSVE_COL( 6, b3q, 0 ) \
+		CGEMM_ARMSVE_COL( 7, b3q, 1 ) \
+		CGEMM_ARMSVE_COL( 8, b4q, 0 ) \
+		CGEMM_ARMSVE_COL( 9, b4q, 1 ) \
+\
+		a += mr; \
+		b += nr; \
+	}
+
+// Scale column j of the product by alpha and write it to column j of ct,
+// which has unit row stride, scaling the existing contents by beta unless
+// bz (beta is zero) is TRUE.
+#define CGEMM_ARMSVE_STORE_COL( j, ct, ld_ct, bz ) \
+	{ \
+		float* restrict ctj = ( float* )( ct + j*ld_ct ); \
+\
+		svfloat32_t c0v = zerov; \
+		svfloat32_t c1v = zerov; \
+\
+		CGEMM_ARMSVE_CMLA( c0v, ab ## j ## _0, alphav ) \
+		CGEMM_ARMSVE_CMLA( c1v, ab ## j ## _1, alphav ) \
+\
+		if ( !bz ) \
+		{ \
+			const svfloat32_t y0v = svld1_f32( pg, ctj      ); \
+			const svfloat32_t y1v = svld1_f32( pg, ctj + vl ); \
+\
+			CGEMM_ARMSVE_CMLA( c0v, y0v, betav ) \
+			CGEMM_ARMSVE_CMLA( c1v, y1v, betav ) \
+		} \
+\
+		svst1_f32( pg, ctj,      c0v ); \
+		svst1_f32( pg, ctj + vl, c1v ); \
+	}
+
+#define CGEMM_ARMSVE_STORE( ct, ld_ct, bz ) \
+	CGEMM_ARMSVE_STORE_COL( 0, ct, ld_ct, bz ) \
+	CGEMM_ARMSVE_STORE_COL( 1, ct, ld_ct, bz ) \
+	CGEMM_ARMSVE_STORE_COL( 2, ct, ld_ct, bz ) \
+	CGEMM_ARMSVE_STORE_COL( 3, ct, ld_ct, bz ) \
+	CGEMM_ARMSVE_STORE_COL( 4, ct, ld_ct, bz ) \
+	CGEMM_ARMSVE_STORE_COL( 5, ct, ld_ct, bz ) \
+	CGEMM_ARMSVE_STORE_COL( 6, ct, ld_ct, bz ) \
+	CGEMM_ARMSVE_STORE_COL( 7, ct, ld_ct, bz ) \
+	CGEMM_ARMSVE_STORE_COL( 8, ct, ld_ct, bz ) \
+	CGEMM_ARMSVE_STORE_COL( 9, ct, ld_ct, bz )
+
+void bli_cgemm_armsve_int_2vx10
+     (
+       dim_t               k,
+       scomplex*  restrict alpha,
+       scomplex*  restrict a,
+       scomplex*  restrict b,
+       scomplex*  restrict beta,
+       scomplex*  restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	// NOTE: vl is the number of floats per vector, which is twice the
+	// number of scomplex elements per vector.
+	const dim_t    vl = svcntw();
+	const dim_t    mr = vl;
+	const dim_t    nr = 10;
+
+	const svbool_t pg = svptrue_b32();
+
+	const svfloat32_t zerov = svdup_n_f32( 0.0f );
+
+	svfloat32_t ab0_0 = zerov, ab0_1 = zerov;
+	svfloat32_t ab1_0 = zerov, ab1_1 = zerov;
+	svfloat32_t ab2_0 = zerov, ab2_1 = zerov;
+	svfloat32_t ab3_0 = zerov, ab3_1 = zerov;
+	svfloat32_t ab4_0 = zerov, ab4_1 = zerov;
+	svfloat32_t ab5_0 = zerov, ab5_1 = zerov;
+	svfloat32_t ab6_0 = zerov, ab6_1 = zerov;
+	svfloat32_t ab7_0 = zerov, ab7_1 = zerov;
+	svfloat32_t ab8_0 = zerov, ab8_1 = zerov;
+	svfloat32_t ab9_0 = zerov, ab9_1 = zerov;
+
+	const dim_t k_iter = k / 4;
+	const dim_t k_left = k % 4;
+
+	for ( dim_t p = 0; p < k_iter; ++p )
+	{
+		CGEMM_ARMSVE_ITER
+		CGEMM_ARMSVE_ITER
+		CGEMM_ARMSVE_ITER
+		CGEMM_ARMSVE_ITER
+	}
+
+	for ( dim_t p = 0; p < k_left; ++p )
+	{
+		CGEMM_ARMSVE_ITER
+	}
+
+	const svfloat32_t alphav       = svdupq_n_f32( bli_creal( *alpha ),
+	                                               bli_cimag( *alpha ),
+	                                               bli_creal( *alpha ),
+	                                               bli_cimag( *alpha ) );
+	const svfloat32_t betav        = svdupq_n_f32( bli_creal( *beta ),
+	                                               bli_cimag( *beta ),
+	                                               bli_creal( *beta ),
+	                                               bli_cimag( *beta ) );
+	const bool        beta_is_zero = bli_ceq0( *beta );
+
+	if ( rs_c == 1 )
+	{
+		// C is column-stored, so we can update it in place.
+		CGEMM_ARMSVE_STORE( c, cs_c, beta_is_zero )
+	}
+	else
+	{
+		// Otherwise, compute alpha * A * B into a local column-stored
+		// buffer and then accumulate it into C element by element.
+		scomplex ct[ mr * nr ];
+
+		CGEMM_ARMSVE_STORE( ct, mr, TRUE )
+
+		if ( beta_is_zero )
+		{
+			for ( dim_t j = 0; j < nr; ++j )
+			for ( dim_t i = 0; i < mr; ++i )
+				bli_ccopys( ct[ i + j*mr ], c[ i*rs_c + j*cs_c ] );
+		}
+		else
+		{
+			for ( dim_t j = 0; j < nr; ++j )
+			for ( dim_t i = 0; i < mr; ++i )
+				bli_cxpbys( ct[ i + j*mr ], *beta, c[ i*rs_c + j*cs_c ] );
+		}
+	}
+}
@@ -0,0 +1,191 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#ifdef __ARM_FEATURE_SVE
+#include <arm_sve.h>
+#else
+#error "No Arm SVE intrinsics support in compiler"
+#endif // __ARM_FEATURE_SVE
+
+/*
+   o 2vx10 double precision micro-kernel, where v is the number of doubles
+     in one SVE vector (ie: MR = 2 * svcntd()).
+   o Vector-length agnostic: the same binary runs on any SVE implementation,
+     and MR is queried from the hardware when the context is initialized.
+   o Each column of the microtile is held in two SVE vectors. For each
+     iteration of the k loop, one column of A is loaded into two vectors and
+     the row of B is loaded as quadwords replicated across the vector so
+     that each element of B can be used via an indexed (lane) FMA.
+*/
+
+#define DGEMM_ARMSVE_COL( j, bq, l ) \
+	ab ## j ## _0 = svmla_lane_f64( ab ## j ## _0, a0v, bq, l ); \
+	ab ## j ## _1 = svmla_lane_f64( ab ## j ## _1, a1v, bq, l );
+
+#define DGEMM_ARMSVE_ITER \
+	{ \
+		const svfloat64_t a0v = svld1_f64( pg, a ); \
+		const svfloat64_t a1v = svld1_f64( pg, a + vl ); \
+\
+		const svfloat64_t b0q = svld1rq_f64( pg, b + 0 ); \
+		const svfloat64_t b1q = svld1rq_f64( pg, b + 2 ); \
+		const svfloat64_t b2q = svld1rq_f64( pg, b + 4 ); \
+		const svfloat64_t b3q = svld1rq_f64( pg, b + 6 ); \
+		const svfloat64_t b4q = svld1rq_f64( pg, b + 8 ); \
+\
+		DGEMM_ARMSVE_COL( 0, b0q, 0 ) \
+		DGEMM_ARMSVE_COL( 1, b0q, 1 ) \
+		DGEMM_ARMSVE_COL( 2, b1q, 0 ) \
+		DGEMM_ARMSVE_COL( 3, b1q, 1 ) \
+		DGEMM_ARMSVE_COL( 4, b2q, 0 ) \
+		DGEMM_ARMSVE_COL( 5, b2q, 1 ) \
+		DGEMM_ARMSVE_COL( 6, b3q, 0 ) \
+		DGEMM_ARMSVE_COL( 7, b3q, 1 ) \
+		DGEMM_ARMSVE_COL( 8, b4q, 0 ) \
+		DGEMM_ARMSVE_COL( 9, b4q, 1 ) \
+\
+		a += mr; \
+		b += nr; \
+	}
+
+// Scale column j of the product by alpha and write it to column j of ct,
+// which has unit row stride, scaling the existing contents by beta unless
+// bz (beta is zero) is TRUE.
+#define DGEMM_ARMSVE_STORE_COL( j, ct, ld_ct, bz ) \
+	{ \
+		double* restrict ctj = ct + j*ld_ct; \
+\
+		svfloat64_t c0v = svmul_f64_x( pg, ab ## j ## _0, alphav ); \
+		svfloat64_t c1v = svmul_f64_x( pg, ab ## j ## _1, alphav ); \
+\
+		if ( !bz ) \
+		{ \
+			c0v = svmla_f64_x( pg, c0v, svld1_f64( pg, ctj      ), betav ); \
+			c1v = svmla_f64_x( pg, c1v, svld1_f64( pg, ctj + vl ), betav ); \
+		} \
+\
+		svst1_f64( pg, ctj,      c0v ); \
+		svst1_f64( pg, ctj + vl, c1v ); \
+	}
+
+#define DGEMM_ARMSVE_STORE( ct, ld_ct, bz ) \
+	DGEMM_ARMSVE_STORE_COL( 0, ct, ld_ct, bz ) \
+	DGEMM_ARMSVE_STORE_COL( 1, ct, ld_ct, bz ) \
+	DGEMM_ARMSVE_STORE_COL( 2, ct, ld_ct, bz ) \
+	DGEMM_ARMSVE_STORE_COL( 3, ct, ld_ct, bz ) \
+	DGEMM_ARMSVE_STORE_COL( 4, ct, ld_ct, bz ) \
+	DGEMM_ARMSVE_STORE_COL( 5, ct, ld_ct, bz ) \
+	DGEMM_ARMSVE_STORE_COL( 6, ct, ld_ct, bz ) \
+	DGEMM_ARMSVE_STORE_COL( 7, ct, ld_ct, bz ) \
+	DGEMM_ARMSVE_STORE_COL( 8, ct, ld_ct, bz ) \
+	DGEMM_ARMSVE_STORE_COL( 9, ct, ld_ct, bz )
+
+void bli_dgemm_armsve_int_2vx10
+     (
+       dim_t               k,
+       double*    restrict alpha,
+       double*    restrict a,
+       double*    restrict b,
+       double*    restrict beta,
+       double*    restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const dim_t    vl = svcntd();
+	const dim_t    mr = 2 * vl;
+	const dim_t    nr = 10;
+
+	const svbool_t pg = svptrue_b64();
+
+	svfloat64_t ab0_0 = svdup_n_f64( 0.0 ), ab0_1 = svdup_n_f64( 0.0 );
+	svfloat64_t ab1_0 = svdup_n_f64( 0.0 ), ab1_1 = svdup_n_f64( 0.0 );
+	svfloat64_t ab2_0 = svdup_n_f64( 0.0 ), ab2_1 = svdup_n_f64( 0.0 );
+	svfloat64_t ab3_0 = svdup_n_f64( 0.0 ), ab3_1 = svdup_n_f64( 0.0 );
+	svfloat64_t ab4_0 = svdup_n_f64( 0.0 ), ab4_1 = svdup_n_f64( 0.0 );
+	svfloat64_t ab5_0 = svdup_n_f64( 0.0 ), ab5_1 = svdup_n_f64( 0.0 );
+	svfloat64_t ab6_0 = svdup_n_f64( 0.0 ), ab6_1 = svdup_n_f64( 0.0 );
+	svfloat64_t ab7_0 = svdup_n_f64( 0.0 ), ab7_1 = svdup_n_f64( 0.0 );
+	svfloat64_t ab8_0 = svdup_n_f64( 0.0 ), ab8_1 = svdup_n_f64( 0.0 );
+	svfloat64_t ab9_0 = svdup_n_f64( 0.0 ), ab9_1 = svdup_n_f64( 0.0 );
+
+	const dim_t k_iter = k / 4;
+	const dim_t k_left = k % 4;
+
+	for ( dim_t p = 0; p < k_iter; ++p )
+	{
+		DGEMM_ARMSVE_ITER
+		DGEMM_ARMSVE_ITER
+		DGEMM_ARMSVE_ITER
+		DGEMM_ARMSVE_ITER
+	}
+
+	for ( dim_t p = 0; p < k_left; ++p )
+	{
+		DGEMM_ARMSVE_ITER
+	}
+
+	const svfloat64_t alphav       = svdup_n_f64( *alpha );
+	const svfloat64_t betav        = svdup_n_f64( *beta );
+	const bool        beta_is_zero = bli_deq0( *beta );
+
+	if ( rs_c == 1 )
+	{
+		// C is column-stored, so we can update it in place.
+		DGEMM_ARMSVE_STORE( c, cs_c, beta_is_zero )
+	}
+	else
+	{
+		// Otherwise, compute alpha * A * B into a local column-stored
+		// buffer and then accumulate it into C element by element.
+		double ct[ mr * nr ];
+
+		DGEMM_ARMSVE_STORE( ct, mr, TRUE )
+
+		if ( beta_is_zero )
+		{
+			for ( dim_t j = 0; j < nr; ++j )
+			for ( dim_t i = 0; i < mr; ++i )
+				bli_dcopys( ct[ i + j*mr ], c[ i*rs_c + j*cs_c ] );
+		}
+		else
+		{
+			for ( dim_t j = 0; j < nr; ++j )
+			for ( dim_t i = 0; i < mr; ++i )
+				bli_dxpbys( ct[ i + j*mr ], *beta, c[ i*rs_c + j*cs_c ] );
+		}
+	}
+}
@@ -0,0 +1,195 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#ifdef __ARM_FEATURE_SVE
+#include <arm_sve.h>
+#else
+#error "No Arm SVE intrinsics support in compiler"
+#endif // __ARM_FEATURE_SVE
+
+/*
+   o 2vx12 single precision micro-kernel, where v is the number of floats
+     in one SVE vector (ie: MR = 2 * svcntw()).
+   o Vector-length agnostic: the same binary runs on any SVE implementation,
+     and MR is queried from the hardware when the context is initialized.
+   o Each column of the microtile is held in two SVE vectors. For each
+     iteration of the k loop, one column of A is loaded into two vectors and
+     the row of B is loaded as quadwords replicated across the vector so
+     that each element of B can be used via an indexed (lane) FMA.
+*/
+
+#define SGEMM_ARMSVE_COL( j, bq, l ) \
+	ab ## j ## _0 = svmla_lane_f32( ab ## j ## _0, a0v, bq, l ); \
+	ab ## j ## _1 = svmla_lane_f32( ab ## j ## _1, a1v, bq, l );
+
+#define SGEMM_ARMSVE_ITER \
+	{ \
+		const svfloat32_t a0v = svld1_f32( pg, a ); \
+		const svfloat32_t a1v = svld1_f32( pg, a + vl ); \
+\
+		const svfloat32_t b0q = svld1rq_f32( pg, b + 0 ); \
+		const svfloat32_t b1q = svld1rq_f32( pg, b + 4 ); \
+		const svfloat32_t b2q = svld1rq_f32( pg, b + 8 ); \
+\
+		SGEMM_ARMSVE_COL(  0, b0q, 0 ) \
+		SGEMM_ARMSVE_COL(  1, b0q, 1 ) \
+		SGEMM_ARMSVE_COL(  2, b0q, 2 ) \
+		SGEMM_ARMSVE_COL(  3, b0q, 3 ) \
+		SGEMM_ARMSVE_COL(  4, b1q, 0 ) \
+		SGEMM_ARMSVE_COL(  5, b1q, 1 ) \
+		SGEMM_ARMSVE_COL(  6, b1q, 2 ) \
+		SGEMM_ARMSVE_COL(  7, b1q, 3 ) \
+		SGEMM_ARMSVE_COL(  8, b2q, 0 ) \
+		SGEMM_ARMSVE_COL(  9, b2q, 1 ) \
+		SGEMM_ARMSVE_COL( 10, b2q, 2 ) \
+		SGEMM_ARMSVE_COL( 11, b2q, 3 ) \
+\
+		a += mr; \
+		b += nr; \
+	}
+
+// Scale column j of the product by alpha and write it to column j of ct,
+// which has unit row stride, scaling the existing contents by beta unless
+// bz (beta is zero) is TRUE.
+#define SGEMM_ARMSVE_STORE_COL( j, ct, ld_ct, bz ) \
+	{ \
+		float* restrict ctj = ct + j*ld_ct; \
+\
+		svfloat32_t c0v = svmul_f32_x( pg, ab ## j ## _0, alphav ); \
+		svfloat32_t c1v = svmul_f32_x( pg, ab ## j ## _1, alphav ); \
+\
+		if ( !bz ) \
+		{ \
+			c0v = svmla_f32_x( pg, c0v, svld1_f32( pg, ctj      ), betav ); \
+			c1v = svmla_f32_x( pg, c1v, svld1_f32( pg, ctj + vl ), betav ); \
+		} \
+\
+		svst1_f32( pg, ctj,      c0v ); \
+		svst1_f32( pg, ctj + vl, c1v ); \
+	}
+
+#define SGEMM_ARMSVE_STORE( ct, ld_ct, bz ) \
+	SGEMM_ARMSVE_STORE_COL(  0, ct, ld_ct, bz ) \
+	SGEMM_ARMSVE_STORE_COL(  1, ct, ld_ct, bz ) \
+	SGEMM_ARMSVE_STORE_COL(  2, ct, ld_ct, bz ) \
+	SGEMM_ARMSVE_STORE_COL(  3, ct, ld_ct, bz ) \
+	SGEMM_ARMSVE_STORE_COL(  4, ct, ld_ct, bz ) \
+	SGEMM_ARMSVE_STORE_COL(  5, ct, ld_ct, bz ) \
+	SGEMM_ARMSVE_STORE_COL(  6, ct, ld_ct, bz ) \
+	SGEMM_ARMSVE_STORE_COL(  7, ct, ld_ct, bz ) \
+	SGEMM_ARMSVE_STORE_COL(  8, ct, ld_ct, bz ) \
+	SGEMM_ARMSVE_STORE_COL(  9, ct, ld_ct, bz ) \
+	SGEMM_ARMSVE_STORE_COL( 10, ct, ld_ct, bz ) \
+	SGEMM_ARMSVE_STORE_COL( 11, ct, ld_ct, bz )
+
+void bli_sgemm_armsve_int_2vx12
+     (
+       dim_t               k,
+       float*    restrict alpha,
+       float*    restrict a,
+       float*    restrict b,
+       float*    restrict beta,
+       float*    restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const dim_t    vl = svcntw();
+	const dim_t    mr = 2 * vl;
+	const dim_t    nr = 12;
+
+	const svbool_t pg = svptrue_b32();
+
+	svfloat32_t ab0_0  = svdup_n_f32( 0.0f ), ab0_1  = svdup_n_f32( 0.0f );
+	svfloat32_t ab1_0  = svdup_n_f32( 0.0f ), ab1_1  = svdup_n_f32( 0.0f );
+	svfloat32_t ab2_0  = svdup_n_f32( 0.0f ), ab2_1  = svdup_n_f32( 0.0f );
+	svfloat32_t ab3_0  = svdup_n_f32( 0.0f ), ab3_1  = svdup_n_f32( 0.0f );
+	svfloat32_t ab4_0  = svdup_n_f32( 0.0f ), ab4_1  = svdup_n_f32( 0.0f );
+	svfloat32_t ab5_0  = svdup_n_f32( 0.0f ), ab5_1  = svdup_n_f32( 0.0f );
+	svfloat32_t ab6_0  = svdup_n_f32( 0.0f ), ab6_1  = svdup_n_f32( 0.0f );
+	svfloat32_t ab7_0  = svdup_n_f32( 0.0f ), ab7_1  = svdup_n_f32( 0.0f );
+	svfloat32_t ab8_0  = svdup_n_f32( 0.0f ), ab8_1  = svdup_n_f32( 0.0f );
+	svfloat32_t ab9_0  = svdup_n_f32( 0.0f ), ab9_1  = svdup_n_f32( 0.0f );
+	svfloat32_t ab10_0 = svdup_n_f32( 0.0f ), ab10_1 = svdup_n_f32( 0.0f );
+	svfloat32_t ab11_0 = svdup_n_f32( 0.0f ), ab11_1 = svdup_n_f32( 0.0f );
+
+	const dim_t k_iter = k / 4;
+	const dim_t k_left = k % 4;
+
+	for ( dim_t p = 0; p < k_iter; ++p )
+	{
+		SGEMM_ARMSVE_ITER
+		SGEMM_ARMSVE_ITER
+		SGEMM_ARMSVE_ITER
+		SGEMM_ARMSVE_ITER
+	}
+
+	for ( dim_t p = 0; p < k_left; ++p )
+	{
+		SGEMM_ARMSVE_ITER
+	}
+
+	const svfloat32_t alphav       = svdup_n_f32( *alpha );
+	const svfloat32_t betav        = svdup_n_f32( *beta );
+	const bool        beta_is_zero = bli_seq0( *beta );
+
+	if ( rs_c == 1 )
+	{
+		// C is column-stored, so we can update it in place.
+		SGEMM_ARMSVE_STORE( c, cs_c, beta_is_zero )
+	}
+	else
+	{
+		// Otherwise, compute alpha * A * B into a local column-stored
+		// buffer and then accumulate it into C element by element.
+		float ct[ mr * nr ];
+
+		SGEMM_ARMSVE_STORE( ct, mr, TRUE )
+
+		if ( beta_is_zero )
+		{
+			for ( dim_t j = 0; j < nr; ++j )
+			for ( dim_t i = 0; i < mr; ++i )
+				bli_scopys( ct[ i + j*mr ], c[ i*rs_c + j*cs_c ] );
+		}
+		else
+		{
+			for ( dim_t j = 0; j < nr; ++j )
+			for ( dim_t i = 0; i < mr; ++i )
+				bli_sxpbys( ct[ i + j*mr ], *beta, c[ i*rs_c + j*cs_c ] );
+		}
+	}
+}
@@ -0,0 +1,205 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#ifdef __ARM_FEATURE_SVE
+#include <arm_sve.h>
+#else
+#error "No Arm SVE intrinsics support in compiler"
+#endif // __ARM_FEATURE_SVE
+
+/*
+   o 2vx10 dcomplex micro-kernel, where v is the number of dcomplex
+     elements in one SVE vector (ie: MR = 2 * svcntd() / 2 = svcntd()).
+   o Vector-length agnostic: the same binary runs on any SVE implementation,
+     and MR is queried from the hardware when the context is initialized.
+   o Each column of the microtile is held in two SVE vectors of interleaved
+     real and imaginary parts. Each element of B is loaded as a quadword
+     replicated across the vector, and the complex multiply-accumulate is
+     performed with a pair of FCMLA instructions (rotations 0 and 90).
+*/
+
+#define ZGEMM_ARMSVE_CMLA( acc, x, y ) \
+	acc = svcmla_f64_x( pg, acc, x, y,  0 ); \
+	acc = svcmla_f64_x( pg, acc, x, y, 90 );
+
+#define ZGEMM_ARMSVE_COL( j ) \
+	{ \
+		const svfloat64_t bq = svld1rq_f64( pg, ( double* )( b + j ) ); \
+\
+		ZGEMM_ARMSVE_CMLA( ab ## j ## _0, a0v, bq ) \
+		ZGEMM_ARMSVE_CMLA( ab ## j ## _1, a1v, bq ) \
+	}
+
+#define ZGEMM_ARMSVE_ITER \
+	{ \
+		const svfloat64_t a0v = svld1_f64( pg, ( double* )a ); \
+		const svfloat64_t a1v = svld1_f64( pg, ( double* )a + vl ); \
+\
+		ZGEMM_ARMSVE_COL( 0 ) \
+		ZGEMM_ARMSVE_COL( 1 ) \
+		ZGEMM_ARMSVE_COL( 2 ) \
+		ZGEMM_ARMSVE_COL( 3 ) \
+		ZGEMM_ARMSVE_COL( 4 ) \
+		ZGEMM_ARMSVE_COL( 5 ) \
+		ZGEMM_ARMSVE_COL( 6 ) \
+		ZGEMM_ARMSVE_COL( 7 ) \
+		ZGEMM_ARMSVE_COL( 8 ) \
+		ZGEMM_ARMSVE_COL( 9 ) \
+\
+		a += mr; \
+		b += nr; \
+	}
+
+// Scale column j of the product by alpha and write it to column j of ct,
+// which has unit row stride, scaling the existing contents by beta unless
+// bz (beta is zero) is TRUE.
+#define ZGEMM_ARMSVE_STORE_COL( j, ct, ld_ct, bz ) \
+	{ \
+		double* restrict ctj = ( double* )( ct + j*ld_ct ); \
+\
+		svfloat64_t c0v = zerov; \
+		svfloat64_t c1v = zerov; \
+\
+		ZGEMM_ARMSVE_CMLA( c0v, ab ## j ## _0, alphav ) \
+		ZGEMM_ARMSVE_CMLA( c1v, ab ## j ## _1, alphav ) \
+\
+		if ( !bz ) \
+		{ \
+			const svfloat64_t y0v = svld1_f64( pg, ctj      ); \
+			const svfloat64_t y1v = svld1_f64( pg, ctj + vl ); \
+\
+			ZGEMM_ARMSVE_CMLA( c0v, y0v, betav ) \
+			ZGEMM_ARMSVE_CMLA( c1v, y1v, betav ) \
+		} \
+\
+		svst1_f64( pg, ctj,      c0v ); \
+		svst1_f64( pg, ctj + vl, c1v ); \
+	}
+
+#define ZGEMM_ARMSVE_STORE( ct, ld_ct, bz ) \
+	ZGEMM_ARMSVE_STORE_COL( 0, ct, ld_ct, bz ) \
+	ZGEMM_ARMSVE_STORE_COL( 1, ct, ld_ct, bz ) \
+	ZGEMM_ARMSVE_STORE_COL( 2, ct, ld_ct, bz ) \
+	ZGEMM_ARMSVE_STORE_COL( 3, ct, ld_ct, bz ) \
+	ZGEMM_ARMSVE_STORE_COL( 4, ct, ld_ct, bz ) \
+	ZGEMM_ARMSVE_STORE_COL( 5, ct, ld_ct, bz ) \
+	ZGEMM_ARMSVE_STORE_COL( 6, ct, ld_ct, bz ) \
+	ZGEMM_ARMSVE_STORE_COL( 7, ct, ld_ct, bz ) \
+	ZGEMM_ARMSVE_STORE_COL( 8, ct, ld_ct, bz ) \
+	ZGEMM_ARMSVE_STORE_COL( 9, ct, ld_ct, bz )
+
+void bli_zgemm_armsve_int_2vx10
+     (
+       dim_t               k,
+       dcomplex*  restrict alpha,
+       dcomplex*  restrict a,
+       dcomplex*  restrict b,
+       dcomplex*  restrict beta,
+       dcomplex*  restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	// NOTE: vl is the number of doubles per vector, which is twice the
+	// number of dcomplex elements per vector.
+	const dim_t    vl = svcntd();
+	const dim_t    mr = vl;
+	const dim_t    nr = 10;
+
+	const svbool_t pg = svptrue_b64();
+
+	const svfloat64_t zerov = svdup_n_f64( 0.0 );
+
+	svfloat64_t ab0_0 = zerov, ab0_1 = zerov;
+	svfloat64_t ab1_0 = zerov, ab1_1 = zerov;
+	svfloat64_t ab2_0 = zerov, ab2_1 = zerov;
+	svfloat64_t ab3_0 = zerov, ab3_1 = zerov;
+	svfloat64_t ab4_0 = zerov, ab4_1 = zerov;
+	svfloat64_t ab5_0 = zerov, ab5_1 = zerov;
+	svfloat64_t ab6_0 = zerov, ab6_1 = zerov;
+	svfloat64_t ab7_0 = zerov, ab7_1 = zerov;
+	svfloat64_t ab8_0 = zerov, ab8_1 = zerov;
+	svfloat64_t ab9_0 = zerov, ab9_1 = zerov;
+
+	const dim_t k_iter = k / 4;
+	const dim_t k_left = k % 4;
+
+	for ( dim_t p = 0; p < k_iter; ++p )
+	{
+		ZGEMM_ARMSVE_ITER
+		ZGEMM_ARMSVE_ITER
+		ZGEMM_ARMSVE_ITER
+		ZGEMM_ARMSVE_ITER
+	}
+
+	for ( dim_t p = 0; p < k_left; ++p )
+	{
+		ZGEMM_ARMSVE_ITER
+	}
+
+	const svfloat64_t alphav       = svdupq_n_f64( bli_zreal( *alpha ),
+	                                               bli_zimag( *alpha ) );
+	const svfloat64_t betav        = svdupq_n_f64( bli_zreal( *beta ),
+	                                               bli_zimag( *beta ) );
+	const bool        beta_is_zero = bli_zeq0( *beta );
+
+	if ( rs_c == 1 )
+	{
+		// C is column-stored, so we can update it in place.
+		ZGEMM_ARMSVE_STORE( c, cs_c, beta_is_zero )
+	}
+	else
+	{
+		// Otherwise, compute alpha * A * B into a local column-stored
+		// buffer and then accumulate it into C element by element.
+		dcomplex ct[ mr * nr ];
+
+		ZGEMM_ARMSVE_STORE( ct, mr, TRUE )
+
+		if ( beta_is_zero )
+		{
+			for ( dim_t j = 0; j < nr; ++j )
+			for ( dim_t i = 0; i < mr; ++i )
+				bli_zcopys( ct[ i + j*mr ], c[ i*rs_c + j*cs_c ] );
+		}
+		else
+		{
+			for ( dim_t j = 0; j < nr; ++j )
+			for ( dim_t i = 0; i < mr; ++i )
+				bli_zxpbys( ct[ i + j*mr ], *beta, c[ i*rs_c + j*cs_c ] );
+		}
+	}
+}
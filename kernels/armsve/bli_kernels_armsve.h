@@ -34,4 +34,19 @@
 
 GEMM_UKR_PROT( double,   d, gemm_armsve256_asm_8x8 )
 
+// gemm (intrinsics, vector-length agnostic)
+GEMM_UKR_PROT( float,    s, gemm_armsve_int_2vx12 )
+GEMM_UKR_PROT( double,   d, gemm_armsve_int_2vx10 )
+GEMM_UKR_PROT( scomplex, c, gemm_armsve_int_2vx10 )
+GEMM_UKR_PROT( dcomplex, z, gemm_armsve_int_2vx10 )
+
 PACKM_KER_PROT( double,   d, packm_armsve256_asm_8xk )
+
+// packm (intrinsics, vector-length agnostic)
+PACKM_KER_PROT( float,    s, packm_armsve_int_2vxk )
+PACKM_KER_PROT( double,   d, packm_armsve_int_2vxk )
+PACKM_KER_PROT( scomplex, c, packm_armsve_int_2vxk )
+PACKM_KER_PROT( dcomplex, z, packm_armsve_int_2vxk )
+
+// Query the SVE vector length (in bytes) of the current hardware.
+dim_t bli_armsve_vl_bytes( void );
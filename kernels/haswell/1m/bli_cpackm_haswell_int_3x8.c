@@ -0,0 +1,494 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// -----------------------------------------------------------------------------
+
+void bli_cpackm_haswell_int_3xk
+     (
+       conj_t           conja,
+       pack_t           schema,
+       dim_t            cdim,
+       dim_t            n,
+       dim_t            n_max,
+       void*   restrict kappa,
+       void*   restrict a, inc_t inca, inc_t lda,
+       void*   restrict p,             inc_t ldp,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t        mnr            = 3;
+	const dim_t        n_elem_per_reg = 4;
+
+	// The number of full vectors needed to span a column of the micropanel
+	// and the number of elements left over. The latter are loaded and
+	// stored with vmaskmovps.
+	const dim_t        m_viter        = mnr / n_elem_per_reg;
+	const dim_t        m_left         = mnr % n_elem_per_reg;
+
+	scomplex* restrict kappa_cast     = kappa;
+	scomplex* restrict a_cast         = a;
+	scomplex* restrict p_cast         = p;
+
+	const bool         is_kappa1      = bli_ceq1( *kappa_cast );
+	const bool         is_conj        = bli_is_conj( conja );
+
+	const __m256       kappa_rv       = _mm256_broadcast_ss( &kappa_cast->real );
+	const __m256       kappa_iv       = _mm256_broadcast_ss( &kappa_cast->imag );
+	const __m256       conjv          = _mm256_setr_ps( 0.0f, -0.0f, 0.0f, -0.0f,
+	                                                    0.0f, -0.0f, 0.0f, -0.0f );
+	const __m256       zerov          = _mm256_setzero_ps();
+	const __m256d      zero_dv        = _mm256_setzero_pd();
+	const __m256i      maskv          = _mm256_set_epi32( 0, 0,
+	                                                      -( m_left > 2 ),
+	                                                      -( m_left > 2 ),
+	                                                      -( m_left > 1 ),
+	                                                      -( m_left > 1 ),
+	                                                      -( m_left > 0 ),
+	                                                      -( m_left > 0 ) );
+
+	dim_t              i, k;
+
+	__m256             x0v, x1v, x2v, x3v;
+	__m256d            y0v, y1v, y2v, y3v;
+	__m256d            t0v, t1v, t2v, t3v;
+
+	if ( cdim == mnr )
+	{
+		k = 0;
+
+		if ( inca == 1 )
+		{
+			// Each column of the micropanel is contiguous in A, so we can
+			// copy it with vector loads and stores.
+			for ( ; k < n; ++k )
+			{
+				float* restrict a0 = ( float* )( a_cast + k*lda );
+				float* restrict p0 = ( float* )( p_cast + k*ldp );
+
+				for ( i = 0; i < m_viter; ++i )
+				{
+					x0v = _mm256_loadu_ps( a0 + 2*i*n_elem_per_reg );
+					if ( is_conj ) x0v = _mm256_xor_ps( x0v, conjv );
+					if ( !is_kappa1 )
+						x0v = _mm256_fmaddsub_ps( kappa_rv, x0v, _mm256_mul_ps( kappa_iv, _mm256_permute_ps( x0v, 0xB1 ) ) );
+					_mm256_storeu_ps( p0 + 2*i*n_elem_per_reg, x0v );
+				}
+
+				if ( m_left > 0 )
+				{
+					x0v = _mm256_maskload_ps( a0 + 2*i*n_elem_per_reg, maskv );
+					if ( is_conj ) x0v = _mm256_xor_ps( x0v, conjv );
+					if ( !is_kappa1 )
+						x0v = _mm256_fmaddsub_ps( kappa_rv, x0v, _mm256_mul_ps( kappa_iv, _mm256_permute_ps( x0v, 0xB1 ) ) );
+					_mm256_maskstore_ps( p0 + 2*i*n_elem_per_reg, maskv, x0v );
+				}
+			}
+		}
+		else if ( lda == 1 )
+		{
+			// Each row of the micropanel is contiguous in A (ie: we are
+			// packing from a transposed or row-stored matrix), so we load
+			// 4x4 blocks along the rows and transpose them in registers.
+			// Since each scomplex element occupies 64 bits, the transpose
+			// is performed on double-precision lanes. Rows beyond the
+			// micropanel are treated as zero.
+			for ( ; k + 4 <= n; k += 4 )
+			{
+				for ( i = 0; i < mnr; i += n_elem_per_reg )
+				{
+					const dim_t      m_blk = bli_min( mnr - i, n_elem_per_reg );
+					double* restrict a0    = ( double* )( a_cast + i*inca + k );
+					float*  restrict p0    = ( float*  )( p_cast + i    + k*ldp );
+
+					y0v =                 _mm256_loadu_pd( a0 + 0*inca );
+					y1v = ( m_blk > 1 ) ? _mm256_loadu_pd( a0 + 1*inca ) : zero_dv;
+					y2v = ( m_blk > 2 ) ? _mm256_loadu_pd( a0 + 2*inca ) : zero_dv;
+					y3v = ( m_blk > 3 ) ? _mm256_loadu_pd( a0 + 3*inca ) : zero_dv;
+
+					t0v = _mm256_unpacklo_pd( y0v, y1v );
+					t1v = _mm256_unpackhi_pd( y0v, y1v );
+					t2v = _mm256_unpacklo_pd( y2v, y3v );
+					t3v = _mm256_unpackhi_pd( y2v, y3v );
+
+					x0v = _mm256_castpd_ps( _mm256_permute2f128_pd( t0v, t2v, 0x20 ) );
+					x1v = _mm256_castpd_ps( _mm256_permute2f128_pd( t1v, t3v, 0x20 ) );
+					x2v = _mm256_castpd_ps( _mm256_permute2f128_pd( t0v, t2v, 0x31 ) );
+					x3v = _mm256_castpd_ps( _mm256_permute2f128_pd( t1v, t3v, 0x31 ) );
+
+					if ( is_conj )
+					{
+						x0v = _mm256_xor_ps( x0v, conjv );
+						x1v = _mm256_xor_ps( x1v, conjv );
+						x2v = _mm256_xor_ps( x2v, conjv );
+						x3v = _mm256_xor_ps( x3v, conjv );
+					}
+
+					if ( !is_kappa1 )
+					{
+						x0v = _mm256_fmaddsub_ps( kappa_rv, x0v, _mm256_mul_ps( kappa_iv, _mm256_permute_ps( x0v, 0xB1 ) ) );
+						x1v = _mm256_fmaddsub_ps( kappa_rv, x1v, _mm256_mul_ps( kappa_iv, _mm256_permute_ps( x1v, 0xB1 ) ) );
+						x2v = _mm256_fmaddsub_ps( kappa_rv, x2v, _mm256_mul_ps( kappa_iv, _mm256_permute_ps( x2v, 0xB1 ) ) );
+						x3v = _mm256_fmaddsub_ps( kappa_rv, x3v, _mm256_mul_ps( kappa_iv, _mm256_permute_ps( x3v, 0xB1 ) ) );
+					}
+
+					if ( m_blk == n_elem_per_reg )
+					{
+						_mm256_storeu_ps( p0 + 0*2*ldp, x0v );
+						_mm256_storeu_ps( p0 + 1*2*ldp, x1v );
+						_mm256_storeu_ps( p0 + 2*2*ldp, x2v );
+						_mm256_storeu_ps( p0 + 3*2*ldp, x3v );
+					}
+					else
+					{
+						_mm256_maskstore_ps( p0 + 0*2*ldp, maskv, x0v );
+						_mm256_maskstore_ps( p0 + 1*2*ldp, maskv, x1v );
+						_mm256_maskstore_ps( p0 + 2*2*ldp, maskv, x2v );
+						_mm256_maskstore_ps( p0 + 3*2*ldp, maskv, x3v );
+					}
+				}
+			}
+		}
+
+		// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+		// This avoids a performance penalty caused by false dependencies when
+		// transitioning from from AVX to SSE instructions (which may occur
+		// later, especially if BLIS is compiled with -mfpmath=sse).
+		_mm256_zeroupper();
+
+		// Pack any remaining columns, as well as general-stride cases, with
+		// scalar code.
+		for ( ; k < n; ++k )
+		{
+			scomplex* restrict a0 = a_cast + k*lda;
+			scomplex* restrict p0 = p_cast + k*ldp;
+
+			if ( is_kappa1 )
+			{
+				if ( is_conj )
+				{
+					for ( i = 0; i < mnr; ++i )
+						bli_ccopyjs( *(a0 + i*inca), *(p0 + i) );
+				}
+				else
+				{
+					for ( i = 0; i < mnr; ++i )
+						bli_ccopys( *(a0 + i*inca), *(p0 + i) );
+				}
+			}
+			else
+			{
+				if ( is_conj )
+				{
+					for ( i = 0; i < mnr; ++i )
+						bli_cscal2js( *kappa_cast, *(a0 + i*inca), *(p0 + i) );
+				}
+				else
+				{
+					for ( i = 0; i < mnr; ++i )
+						bli_cscal2s( *kappa_cast, *(a0 + i*inca), *(p0 + i) );
+				}
+			}
+		}
+	}
+	else /* if ( cdim < mnr ) */
+	{
+		bli_cscal2m_ex
+		(
+		  0,
+		  BLIS_NONUNIT_DIAG,
+		  BLIS_DENSE,
+		  ( trans_t )conja,
+		  cdim,
+		  n,
+		  kappa,
+		  a, inca, lda,
+		  p,    1, ldp,
+		  cntx,
+		  NULL
+		);
+
+		bli_cset0s_mxn
+		(
+		  mnr - cdim,
+		  n_max,
+		  p_cast + cdim, 1, ldp
+		);
+	}
+
+	// Zero-fill the columns of the micropanel beyond n.
+	for ( k = n; k < n_max; ++k )
+	{
+		float* restrict p0 = ( float* )( p_cast + k*ldp );
+
+		for ( i = 0; i < m_viter; ++i )
+			_mm256_storeu_ps( p0 + 2*i*n_elem_per_reg, zerov );
+
+		if ( m_left > 0 )
+			_mm256_maskstore_ps( p0 + 2*i*n_elem_per_reg, maskv, zerov );
+	}
+
+	_mm256_zeroupper();
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_cpackm_haswell_int_8xk
+     (
+       conj_t           conja,
+       pack_t           schema,
+       dim_t            cdim,
+       dim_t            n,
+       dim_t            n_max,
+       void*   restrict kappa,
+       void*   restrict a, inc_t inca, inc_t lda,
+       void*   restrict p,             inc_t ldp,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t        mnr            = 8;
+	const dim_t        n_elem_per_reg = 4;
+
+	// The number of full vectors needed to span a column of the micropanel
+	// and the number of elements left over. The latter are loaded and
+	// stored with vmaskmovps.
+	const dim_t        m_viter        = mnr / n_elem_per_reg;
+	const dim_t        m_left         = mnr % n_elem_per_reg;
+
+	scomplex* restrict kappa_cast     = kappa;
+	scomplex* restrict a_cast         = a;
+	scomplex* restrict p_cast         = p;
+
+	const bool         is_kappa1      = bli_ceq1( *kappa_cast );
+	const bool         is_conj        = bli_is_conj( conja );
+
+	const __m256       kappa_rv       = _mm256_broadcast_ss( &kappa_cast->real );
+	const __m256       kappa_iv       = _mm256_broadcast_ss( &kappa_cast->imag );
+	const __m256       conjv          = _mm256_setr_ps( 0.0f, -0.0f, 0.0f, -0.0f,
+	                                                    0.0f, -0.0f, 0.0f, -0.0f );
+	const __m256       zerov          = _mm256_setzero_ps();
+	const __m256d      zero_dv        = _mm256_setzero_pd();
+	const __m256i      maskv          = _mm256_set_epi32( 0, 0,
+	                                                      -( m_left > 2 ),
+	                                                      -( m_left > 2 ),
+	                                                      -( m_left > 1 ),
+	                                                      -( m_left > 1 ),
+	                                                      -( m_left > 0 ),
+	                                                      -( m_left > 0 ) );
+
+	dim_t              i, k;
+
+	__m256             x0v, x1v, x2v, x3v;
+	__m256d            y0v, y1v, y2v, y3v;
+	__m256d            t0v, t1v, t2v, t3v;
+
+	if ( cdim == mnr )
+	{
+		k = 0;
+
+		if ( inca == 1 )
+		{
+			// Each column of the micropanel is contiguous in A, so we can
+			// copy it with vector loads and stores.
+			for ( ; k < n; ++k )
+			{
+				float* restrict a0 = ( float* )( a_cast + k*lda );
+				float* restrict p0 = ( float* )( p_cast + k*ldp );
+
+				for ( i = 0; i < m_viter; ++i )
+				{
+					x0v = _mm256_loadu_ps( a0 + 2*i*n_elem_per_reg );
+					if ( is_conj ) x0v = _mm256_xor_ps( x0v, conjv );
+					if ( !is_kappa1 )
+						x0v = _mm256_fmaddsub_ps( kappa_rv, x0v, _mm256_mul_ps( kappa_iv, _mm256_permute_ps( x0v, 0xB1 ) ) );
+					_mm256_storeu_ps( p0 + 2*i*n_elem_per_reg, x0v );
+				}
+
+				if ( m_left > 0 )
+				{
+					x0v = _mm256_maskload_ps( a0 + 2*i*n_elem_per_reg, maskv );
+					if ( is_conj ) x0v = _mm256_xor_ps( x0v, conjv );
+					if ( !is_kappa1 )
+						x0v = _mm256_fmaddsub_ps( kappa_rv, x0v, _mm256_mul_ps( kappa_iv, _mm256_permute_ps( x0v, 0xB1 ) ) );
+					_mm256_maskstore_ps( p0 + 2*i*n_elem_per_reg, maskv, x0v );
+				}
+			}
+		}
+		else if ( lda == 1 )
+		{
+			// Each row of the micropanel is contiguous in A (ie: we are
+			// packing from a transposed or row-stored matrix), so we load
+			// 4x4 blocks along the rows and transpose them in registers.
+			// Since each scomplex element occupies 64 bits, the transpose
+			// is performed on double-precision lanes. Rows beyond the
+			// micropanel are treated as zero.
+			for ( ; k + 4 <= n; k += 4 )
+			{
+				for ( i = 0; i < mnr; i += n_elem_per_reg )
+				{
+					const dim_t      m_blk = bli_min( mnr - i, n_elem_per_reg );
+					double* restrict a0    = ( double* )( a_cast + i*inca + k );
+					float*  restrict p0    = ( float*  )( p_cast + i    + k*ldp );
+
+					y0v =                 _mm256_loadu_pd( a0 + 0*inca );
+					y1v = ( m_blk > 1 ) ? _mm256_loadu_pd( a0 + 1*inca ) : zero_dv;
+					y2v = ( m_blk > 2 ) ? _mm256_loadu_pd( a0 + 2*inca ) : zero_dv;
+					y3v = ( m_blk > 3 ) ? _mm256_loadu_pd( a0 + 3*inca ) : zero_dv;
+
+					t0v = _mm256_unpacklo_pd( y0v, y1v );
+					t1v = _mm256_unpackhi_pd( y0v, y1v );
+					t2v = _mm256_unpacklo_pd( y2v, y3v );
+					t3v = _mm256_unpackhi_pd( y2v, y3v );
+
+					x0v = _mm256_castpd_ps( _mm256_permute2f128_pd( t0v, t2v, 0x20 ) );
+					x1v = _mm256_castpd_ps( _mm256_permute2f128_pd( t1v, t3v, 0x20 ) );
+					x2v = _mm256_castpd_ps( _mm256_permute2f128_pd( t0v, t2v, 0x31 ) );
+					x3v = _mm256_castpd_ps( _mm256_permute2f128_pd( t1v, t3v, 0x31 ) );
+
+					if ( is_conj )
+					{
+						x0v = _mm256_xor_ps( x0v, conjv );
+						x1v = _mm256_xor_ps( x1v, conjv );
+						x2v = _mm256_xor_ps( x2v, conjv );
+						x3v = _mm256_xor_ps( x3v, conjv );
+					}
+
+					if ( !is_kappa1 )
+					{
+						x0v = _mm256_fmaddsub_ps( kappa_rv, x0v, _mm256_mul_ps( kappa_iv, _mm256_permute_ps( x0v, 0xB1 ) ) );
+						x1v = _mm256_fmaddsub_ps( kappa_rv, x1v, _mm256_mul_ps( kappa_iv, _mm256_permute_ps( x1v, 0xB1 ) ) );
+						x2v = _mm256_fmaddsub_ps( kappa_rv, x2v, _mm256_mul_ps( kappa_iv, _mm256_permute_ps( x2v, 0xB1 ) ) );
+						x3v = _mm256_fmaddsub_ps( kappa_rv, x3v, _mm256_mul_ps( kappa_iv, _mm256_permute_ps( x3v, 0xB1 ) ) );
+					}
+
+					if ( m_blk == n_elem_per_reg )
+					{
+						_mm256_storeu_ps( p0 + 0*2*ldp, x0v );
+						_mm256_storeu_ps( p0 + 1*2*ldp, x1v );
+						_mm256_storeu_ps( p0 + 2*2*ldp, x2v );
+						_mm256_storeu_ps( p0 + 3*2*ldp, x3v );
+					}
+					else
+					{
+						_mm256_maskstore_ps( p0 + 0*2*ldp, maskv, x0v );
+						_mm256_maskstore_ps( p0 + 1*2*ldp, maskv, x1v );
+						_mm256_maskstore_ps( p0 + 2*2*ldp, maskv, x2v );
+						_mm256_maskstore_ps( p0 + 3*2*ldp, maskv, x3v );
+					}
+				}
+			}
+		}
+
+		// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+		// This avoids a performance penalty caused by false dependencies when
+		// transitioning from from AVX to SSE instructions (which may occur
+		// later, especially if BLIS is compiled with -mfpmath=sse).
+		_mm256_zeroupper();
+
+		// Pack any remaining columns, as well as general-stride cases, with
+		// scalar code.
+		for ( ; k < n; ++k )
+		{
+			scomplex* restrict a0 = a_cast + k*lda;
+			scomplex* restrict p0 = p_cast + k*ldp;
+
+			if ( is_kappa1 )
+			{
+				if ( is_conj )
+				{
+					for ( i = 0; i < mnr; ++i )
+						bli_ccopyjs( *(a0 + i*inca), *(p0 + i) );
+				}
+				else
+				{
+					for ( i = 0; i < mnr; ++i )
+						bli_ccopys( *(a0 + i*inca), *(p0 + i) );
+				}
+			}
+			else
+			{
+				if ( is_conj )
+				{
+					for ( i = 0; i < mnr; ++i )
+						bli_cscal2js( *kappa_cast, *(a0 + i*inca), *(p0 + i) );
+				}
+				else
+				{
+					for ( i = 0; i < mnr; ++i )
+						bli_cscal2s( *kappa_cast, *(a0 + i*inca), *(p0 + i) );
+				}
+			}
+		}
+	}
+	else /* if ( cdim < mnr ) */
+	{
+		bli_cscal2m_ex
+		(
+		  0,
+		  BLIS_NONUNIT_DIAG,
+		  BLIS_DENSE,
+		  ( trans_t )conja,
+		  cdim,
+		  n,
+		  kappa,
+		  a, inca, lda,
+		  p,    1, ldp,
+		  cntx,
+		  NULL
+		);
+
+		bli_cset0s_mxn
+		(
+		  mnr - cdim,
+		  n_max,
+		  p_cast + cdim, 1, ldp
+		);
+	}
+
+	// Zero-fill the columns of the micropanel beyond n.
+	for ( k = n; k < n_max; ++k )
+	{
+		float* restrict p0 = ( float* )( p_cast + k*ldp );
+
+		for ( i = 0; i < m_viter; ++i )
+			_mm256_storeu_ps( p0 + 2*i*n_elem_per_reg, zerov );
+
+		if ( m_left > 0 )
+			_mm256_maskstore_ps( p0 + 2*i*n_elem_per_reg, maskv, zerov );
+	}
+
+	_mm256_zeroupper();
+}
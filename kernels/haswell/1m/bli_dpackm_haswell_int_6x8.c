@@ -0,0 +1,416 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// -----------------------------------------------------------------------------
+
+void bli_dpackm_haswell_int_6xk
+     (
+       conj_t           conja,
+       pack_t           schema,
+       dim_t            cdim,
+       dim_t            n,
+       dim_t            n_max,
+       void*   restrict kappa,
+       void*   restrict a, inc_t inca, inc_t lda,
+       void*   restrict p,             inc_t ldp,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      mnr            = 6;
+	const dim_t      n_elem_per_reg = 4;
+
+	// The number of full vectors needed to span a column of the micropanel
+	// and the number of elements left over. The latter are loaded and
+	// stored with vmaskmovpd.
+	const dim_t      m_viter        = mnr / n_elem_per_reg;
+	const dim_t      m_left         = mnr % n_elem_per_reg;
+
+	double* restrict kappa_cast     = kappa;
+	double* restrict a_cast         = a;
+	double* restrict p_cast         = p;
+
+	const bool       is_kappa1      = bli_deq1( *kappa_cast );
+
+	const __m256d    kappav         = _mm256_broadcast_sd( kappa_cast );
+	const __m256d    zerov          = _mm256_setzero_pd();
+	const __m256i    maskv          = _mm256_set_epi64x( 0,
+	                                                     -( m_left > 2 ),
+	                                                     -( m_left > 1 ),
+	                                                     -( m_left > 0 ) );
+
+	dim_t            i, k;
+
+	__m256d          x0v, x1v, x2v, x3v;
+	__m256d          t0v, t1v, t2v, t3v;
+
+	if ( cdim == mnr )
+	{
+		k = 0;
+
+		if ( inca == 1 )
+		{
+			// Each column of the micropanel is contiguous in A, so we can
+			// copy it with vector loads and stores.
+			for ( ; k < n; ++k )
+			{
+				double* restrict a0 = a_cast + k*lda;
+				double* restrict p0 = p_cast + k*ldp;
+
+				for ( i = 0; i < m_viter; ++i )
+				{
+					x0v = _mm256_loadu_pd( a0 + i*n_elem_per_reg );
+					if ( !is_kappa1 ) x0v = _mm256_mul_pd( kappav, x0v );
+					_mm256_storeu_pd( p0 + i*n_elem_per_reg, x0v );
+				}
+
+				if ( m_left > 0 )
+				{
+					x0v = _mm256_maskload_pd( a0 + i*n_elem_per_reg, maskv );
+					if ( !is_kappa1 ) x0v = _mm256_mul_pd( kappav, x0v );
+					_mm256_maskstore_pd( p0 + i*n_elem_per_reg, maskv, x0v );
+				}
+			}
+		}
+		else if ( lda == 1 )
+		{
+			// Each row of the micropanel is contiguous in A (ie: we are
+			// packing from a transposed or row-stored matrix), so we load
+			// 4x4 blocks along the rows and transpose them in registers.
+			// Rows beyond the micropanel are treated as zero.
+			for ( ; k + 4 <= n; k += 4 )
+			{
+				for ( i = 0; i < mnr; i += n_elem_per_reg )
+				{
+					const dim_t      m_blk = bli_min( mnr - i, n_elem_per_reg );
+					double* restrict a0    = a_cast + i*inca + k;
+					double* restrict p0    = p_cast + i    + k*ldp;
+
+					x0v =                 _mm256_loadu_pd( a0 + 0*inca );
+					x1v = ( m_blk > 1 ) ? _mm256_loadu_pd( a0 + 1*inca ) : zerov;
+					x2v = ( m_blk > 2 ) ? _mm256_loadu_pd( a0 + 2*inca ) : zerov;
+					x3v = ( m_blk > 3 ) ? _mm256_loadu_pd( a0 + 3*inca ) : zerov;
+
+					t0v = _mm256_unpacklo_pd( x0v, x1v );
+					t1v = _mm256_unpackhi_pd( x0v, x1v );
+					t2v = _mm256_unpacklo_pd( x2v, x3v );
+					t3v = _mm256_unpackhi_pd( x2v, x3v );
+
+					x0v = _mm256_permute2f128_pd( t0v, t2v, 0x20 );
+					x1v = _mm256_permute2f128_pd( t1v, t3v, 0x20 );
+					x2v = _mm256_permute2f128_pd( t0v, t2v, 0x31 );
+					x3v = _mm256_permute2f128_pd( t1v, t3v, 0x31 );
+
+					if ( !is_kappa1 )
+					{
+						x0v = _mm256_mul_pd( kappav, x0v );
+						x1v = _mm256_mul_pd( kappav, x1v );
+						x2v = _mm256_mul_pd( kappav, x2v );
+						x3v = _mm256_mul_pd( kappav, x3v );
+					}
+
+					if ( m_blk == n_elem_per_reg )
+					{
+						_mm256_storeu_pd( p0 + 0*ldp, x0v );
+						_mm256_storeu_pd( p0 + 1*ldp, x1v );
+						_mm256_storeu_pd( p0 + 2*ldp, x2v );
+						_mm256_storeu_pd( p0 + 3*ldp, x3v );
+					}
+					else
+					{
+						_mm256_maskstore_pd( p0 + 0*ldp, maskv, x0v );
+						_mm256_maskstore_pd( p0 + 1*ldp, maskv, x1v );
+						_mm256_maskstore_pd( p0 + 2*ldp, maskv, x2v );
+						_mm256_maskstore_pd( p0 + 3*ldp, maskv, x3v );
+					}
+				}
+			}
+		}
+
+		// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+		// This avoids a performance penalty caused by false dependencies when
+		// transitioning from from AVX to SSE instructions (which may occur
+		// later, especially if BLIS is compiled with -mfpmath=sse).
+		_mm256_zeroupper();
+
+		// Pack any remaining columns, as well as general-stride cases, with
+		// scalar code.
+		for ( ; k < n; ++k )
+		{
+			double* restrict a0 = a_cast + k*lda;
+			double* restrict p0 = p_cast + k*ldp;
+
+			if ( is_kappa1 )
+			{
+				for ( i = 0; i < mnr; ++i )
+					bli_ddcopys( *(a0 + i*inca), *(p0 + i) );
+			}
+			else
+			{
+				for ( i = 0; i < mnr; ++i )
+					bli_dscal2s( *kappa_cast, *(a0 + i*inca), *(p0 + i) );
+			}
+		}
+	}
+	else /* if ( cdim < mnr ) */
+	{
+		bli_dscal2m_ex
+		(
+		  0,
+		  BLIS_NONUNIT_DIAG,
+		  BLIS_DENSE,
+		  ( trans_t )conja,
+		  cdim,
+		  n,
+		  kappa,
+		  a, inca, lda,
+		  p,    1, ldp,
+		  cntx,
+		  NULL
+		);
+
+		bli_dset0s_mxn
+		(
+		  mnr - cdim,
+		  n_max,
+		  p_cast + cdim, 1, ldp
+		);
+	}
+
+	// Zero-fill the columns of the micropanel beyond n.
+	for ( k = n; k < n_max; ++k )
+	{
+		double* restrict p0 = p_cast + k*ldp;
+
+		for ( i = 0; i < m_viter; ++i )
+			_mm256_storeu_pd( p0 + i*n_elem_per_reg, zerov );
+
+		if ( m_left > 0 )
+			_mm256_maskstore_pd( p0 + i*n_elem_per_reg, maskv, zerov );
+	}
+
+	_mm256_zeroupper();
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_dpackm_haswell_int_8xk
+     (
+       conj_t           conja,
+       pack_t           schema,
+       dim_t            cdim,
+       dim_t            n,
+       dim_t            n_max,
+       void*   restrict kappa,
+       void*   restrict a, inc_t inca, inc_t lda,
+       void*   restrict p,             inc_t ldp,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      mnr            = 8;
+	const dim_t      n_elem_per_reg = 4;
+
+	// The number of full vectors needed to span a column of the micropanel
+	// and the number of elements left over. The latter are loaded and
+	// stored with vmaskmovpd.
+	const dim_t      m_viter        = mnr / n_elem_per_reg;
+	const dim_t      m_left         = mnr % n_elem_per_reg;
+
+	double* restrict kappa_cast     = kappa;
+	double* restrict a_cast         = a;
+	double* restrict p_cast         = p;
+
+	const bool       is_kappa1      = bli_deq1( *kappa_cast );
+
+	const __m256d    kappav         = _mm256_broadcast_sd( kappa_cast );
+	const __m256d    zerov          = _mm256_setzero_pd();
+	const __m256i    maskv          = _mm256_set_epi64x( 0,
+	                                                     -( m_left > 2 ),
+	                                                     -( m_left > 1 ),
+	                                                     -( m_left > 0 ) );
+
+	dim_t            i, k;
+
+	__m256d          x0v, x1v, x2v, x3v;
+	__m256d          t0v, t1v, t2v, t3v;
+
+	if ( cdim == mnr )
+	{
+		k = 0;
+
+		if ( inca == 1 )
+		{
+			// Each column of the micropanel is contiguous in A, so we can
+			// copy it with vector loads and stores.
+			for ( ; k < n; ++k )
+			{
+				double* restrict a0 = a_cast + k*lda;
+				double* restrict p0 = p_cast + k*ldp;
+
+				for ( i = 0; i < m_viter; ++i )
+				{
+					x0v = _mm256_loadu_pd( a0 + i*n_elem_per_reg );
+					if ( !is_kappa1 ) x0v = _mm256_mul_pd( kappav, x0v );
+					_mm256_storeu_pd( p0 + i*n_elem_per_reg, x0v );
+				}
+
+				if ( m_left > 0 )
+				{
+					x0v = _mm256_maskload_pd( a0 + i*n_elem_per_reg, maskv );
+					if ( !is_kappa1 ) x0v = _mm256_mul_pd( kappav, x0v );
+					_mm256_maskstore_pd( p0 + i*n_elem_per_reg, maskv, x0v );
+				}
+			}
+		}
+		else if ( lda == 1 )
+		{
+			// Each row of the micropanel is contiguous in A (ie: we are
+			// packing from a transposed or row-stored matrix), so we load
+			// 4x4 blocks along the rows and transpose them in registers.
+			// Rows beyond the micropanel are treated as zero.
+			for ( ; k + 4 <= n; k += 4 )
+			{
+				for ( i = 0; i < mnr; i += n_elem_per_reg )
+				{
+					const dim_t      m_blk = bli_min( mnr - i, n_elem_per_reg );
+					double* restrict a0    = a_cast + i*inca + k;
+					double* restrict p0    = p_cast + i    + k*ldp;
+
+					x0v =                 _mm256_loadu_pd( a0 + 0*inca );
+					x1v = ( m_blk > 1 ) ? _mm256_loadu_pd( a0 + 1*inca ) : zerov;
+					x2v = ( m_blk > 2 ) ? _mm256_loadu_pd( a0 + 2*inca ) : zerov;
+					x3v = ( m_blk > 3 ) ? _mm256_loadu_pd( a0 + 3*inca ) : zerov;
+
+					t0v = _mm256_unpacklo_pd( x0v, x1v );
+					t1v = _mm256_unpackhi_pd( x0v, x1v );
+					t2v = _mm256_unpacklo_pd( x2v, x3v );
+					t3v = _mm256_unpackhi_pd( x2v, x3v );
+
+					x0v = _mm256_permute2f128_pd( t0v, t2v, 0x20 );
+					x1v = _mm256_permute2f128_pd( t1v, t3v, 0x20 );
+					x2v = _mm256_permute2f128_pd( t0v, t2v, 0x31 );
+					x3v = _mm256_permute2f128_pd( t1v, t3v, 0x31 );
+
+					if ( !is_kappa1 )
+					{
+						x0v = _mm256_mul_pd( kappav, x0v );
+						x1v = _mm256_mul_pd( kappav, x1v );
+						x2v = _mm256_mul_pd( kappav, x2v );
+						x3v = _mm256_mul_pd( kappav, x3v );
+					}
+
+					if ( m_blk == n_elem_per_reg )
+					{
+						_mm256_storeu_pd( p0 + 0*ldp, x0v );
+						_mm256_storeu_pd( p0 + 1*ldp, x1v );
+						_mm256_storeu_pd( p0 + 2*ldp, x2v );
+						_mm256_storeu_pd( p0 + 3*ldp, x3v );
+					}
+					else
+					{
+						_mm256_maskstore_pd( p0 + 0*ldp, maskv, x0v );
+						_mm256_maskstore_pd( p0 + 1*ldp, maskv, x1v );
+						_mm256_maskstore_pd( p0 + 2*ldp, maskv, x2v );
+						_mm256_maskstore_pd( p0 + 3*ldp, maskv, x3v );
+					}
+				}
+			}
+		}
+
+		// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+		// This avoids a performance penalty caused by false dependencies when
+		// transitioning from from AVX to SSE instructions (which may occur
+		// later, especially if BLIS is compiled with -mfpmath=sse).
+		_mm256_zeroupper();
+
+		// Pack any remaining columns, as well as general-stride cases, with
+		// scalar code.
+		for ( ; k < n; ++k )
+		{
+			double* restrict a0 = a_cast + k*lda;
+			double* restrict p0 = p_cast + k*ldp;
+
+			if ( is_kappa1 )
+			{
+				for ( i = 0; i < mnr; ++i )
+					bli_ddcopys( *(a0 + i*inca), *(p0 + i) );
+			}
+			else
+			{
+				for ( i = 0; i < mnr; ++i )
+					bli_dscal2s( *kappa_cast, *(a0 + i*inca), *(p0 + i) );
+			}
+		}
+	}
+	else /* if ( cdim < mnr ) */
+	{
+		bli_dscal2m_ex
+		(
+		  0,
+		  BLIS_NONUNIT_DIAG,
+		  BLIS_DENSE,
+		  ( trans_t )conja,
+		  cdim,
+		  n,
+		  kappa,
+		  a, inca, lda,
+		  p,    1, ldp,
+		  cntx,
+		  NULL
+		);
+
+		bli_dset0s_mxn
+		(
+		  mnr - cdim,
+		  n_max,
+		  p_cast + cdim, 1, ldp
+		);
+	}
+
+	// Zero-fill the columns of the micropanel beyond n.
+	for ( k = n; k < n_max; ++k )
+	{
+		double* restrict p0 = p_cast + k*ldp;
+
+		for ( i = 0; i < m_viter; ++i )
+			_mm256_storeu_pd( p0 + i*n_elem_per_reg, zerov );
+
+		if ( m_left > 0 )
+			_mm256_maskstore_pd( p0 + i*n_elem_per_reg, maskv, zerov );
+	}
+
+	_mm256_zeroupper();
+}
@@ -0,0 +1,204 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// Transpose the 8x8 block of single-precision elements held in r[0:7]
+// (one row per register) into c[0:7] (one column per register).
+static void bli_transpose_8x8_ps( __m256* r, __m256* c )
+{
+	__m256 t0 = _mm256_unpacklo_ps( r[0], r[1] );
+	__m256 t1 = _mm256_unpackhi_ps( r[0], r[1] );
+	__m256 t2 = _mm256_unpacklo_ps( r[2], r[3] );
+	__m256 t3 = _mm256_unpackhi_ps( r[2], r[3] );
+	__m256 t4 = _mm256_unpacklo_ps( r[4], r[5] );
+	__m256 t5 = _mm256_unpackhi_ps( r[4], r[5] );
+	__m256 t6 = _mm256_unpacklo_ps( r[6], r[7] );
+	__m256 t7 = _mm256_unpackhi_ps( r[6], r[7] );
+
+	__m256 s0 = _mm256_shuffle_ps( t0, t2, 0x44 );
+	__m256 s1 = _mm256_shuffle_ps( t0, t2, 0xee );
+	__m256 s2 = _mm256_shuffle_ps( t1, t3, 0x44 );
+	__m256 s3 = _mm256_shuffle_ps( t1, t3, 0xee );
+	__m256 s4 = _mm256_shuffle_ps( t4, t6, 0x44 );
+	__m256 s5 = _mm256_shuffle_ps( t4, t6, 0xee );
+	__m256 s6 = _mm256_shuffle_ps( t5, t7, 0x44 );
+	__m256 s7 = _mm256_shuffle_ps( t5, t7, 0xee );
+
+	c[0] = _mm256_permute2f128_ps( s0, s4, 0x20 );
+	c[1] = _mm256_permute2f128_ps( s1, s5, 0x20 );
+	c[2] = _mm256_permute2f128_ps( s2, s6, 0x20 );
+	c[3] = _mm256_permute2f128_ps( s3, s7, 0x20 );
+	c[4] = _mm256_permute2f128_ps( s0, s4, 0x31 );
+	c[5] = _mm256_permute2f128_ps( s1, s5, 0x31 );
+	c[6] = _mm256_permute2f128_ps( s2, s6, 0x31 );
+	c[7] = _mm256_permute2f128_ps( s3, s7, 0x31 );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_packm_cxk_f16_haswell_int
+     (
+       dim_t             cdim,
+       dim_t             n,
+       dim_t             n_max,
+       float*   restrict kappa,
+       float16* restrict a, inc_t inca, inc_t lda,
+       float*   restrict p,             inc_t ldp,
+       cntx_t*  restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 8;
+
+	const float      kappa_s        = *kappa;
+	const bool       is_kappa1      = ( kappa_s == 1.0F );
+
+	const __m256     kappav         = _mm256_set1_ps( kappa_s );
+	const __m256     zerov          = _mm256_setzero_ps();
+
+	dim_t            i, l;
+
+	if ( inca == 1 )
+	{
+		// Each column of the micropanel is contiguous in A, so we convert
+		// eight elements at a time down each column.
+		const dim_t i_vec = ( cdim / n_elem_per_reg ) * n_elem_per_reg;
+
+		for ( l = 0; l < n; ++l )
+		{
+			float16* restrict a_l = a + l*lda;
+			float*   restrict p_l = p + l*ldp;
+
+			for ( i = 0; i < i_vec; i += n_elem_per_reg )
+			{
+				__m256 xv = _mm256_cvtph_ps
+				(
+				  _mm_loadu_si128( ( __m128i* )( a_l + i ) )
+				);
+
+				if ( !is_kappa1 ) xv = _mm256_mul_ps( kappav, xv );
+
+				_mm256_storeu_ps( p_l + i, xv );
+			}
+
+			for ( ; i < cdim; ++i ) p_l[ i ] = kappa_s * _cvtsh_ss( a_l[ i ] );
+			for ( ; i < ldp;  ++i ) p_l[ i ] = 0.0F;
+		}
+	}
+	else if ( lda == 1 )
+	{
+		// Each row of the micropanel is contiguous in A, so we convert
+		// eight elements at a time along each row and then transpose 8x8
+		// blocks into the micropanel. Rows beyond cdim are zero, which
+		// takes care of the padding up to ldp.
+		const dim_t l_vec = ( n / n_elem_per_reg ) * n_elem_per_reg;
+
+		for ( l = 0; l < l_vec; l += n_elem_per_reg )
+		{
+			for ( dim_t i0 = 0; i0 < ldp; i0 += n_elem_per_reg )
+			{
+				const dim_t i_left = bli_min( n_elem_per_reg, ldp - i0 );
+
+				__m256 rv[ 8 ];
+				__m256 cv[ 8 ];
+
+				for ( i = 0; i < n_elem_per_reg; ++i )
+				{
+					if ( i0 + i < cdim )
+					{
+						rv[ i ] = _mm256_cvtph_ps
+						(
+						  _mm_loadu_si128( ( __m128i* )( a + ( i0 + i )*inca + l ) )
+						);
+
+						if ( !is_kappa1 ) rv[ i ] = _mm256_mul_ps( kappav, rv[ i ] );
+					}
+					else
+					{
+						rv[ i ] = zerov;
+					}
+				}
+
+				bli_transpose_8x8_ps( rv, cv );
+
+				if ( i_left == n_elem_per_reg )
+				{
+					for ( dim_t j = 0; j < n_elem_per_reg; ++j )
+						_mm256_storeu_ps( p + ( l + j )*ldp + i0, cv[ j ] );
+				}
+				else
+				{
+					const __m256i maskv = _mm256_cmpgt_epi32
+					(
+					  _mm256_set1_epi32( ( int )i_left ),
+					  _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 )
+					);
+
+					for ( dim_t j = 0; j < n_elem_per_reg; ++j )
+						_mm256_maskstore_ps( p + ( l + j )*ldp + i0, maskv, cv[ j ] );
+				}
+			}
+		}
+
+		// Convert the remaining columns one element at a time.
+		for ( ; l < n; ++l )
+		{
+			float* restrict p_l = p + l*ldp;
+
+			for ( i = 0; i < cdim; ++i ) p_l[ i ] = kappa_s * _cvtsh_ss( a[ i*inca + l ] );
+			for ( ;      i < ldp;  ++i ) p_l[ i ] = 0.0F;
+		}
+	}
+	else
+	{
+		// General stride.
+		for ( l = 0; l < n; ++l )
+		{
+			float* restrict p_l = p + l*ldp;
+
+			for ( i = 0; i < cdim; ++i ) p_l[ i ] = kappa_s * _cvtsh_ss( a[ i*inca + l*lda ] );
+			for ( ;      i < ldp;  ++i ) p_l[ i ] = 0.0F;
+		}
+	}
+
+	// Zero the columns of the micropanel beyond n.
+	for ( l = n; l < n_max; ++l )
+	{
+		float* restrict p_l = p + l*ldp;
+
+		for ( i = 0; i < ldp; ++i ) p_l[ i ] = 0.0F;
+	}
+}
+
@@ -0,0 +1,490 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// -----------------------------------------------------------------------------
+
+void bli_spackm_haswell_int_6xk
+     (
+       conj_t           conja,
+       pack_t           schema,
+       dim_t            cdim,
+       dim_t            n,
+       dim_t            n_max,
+       void*   restrict kappa,
+       void*   restrict a, inc_t inca, inc_t lda,
+       void*   restrict p,             inc_t ldp,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      mnr            = 6;
+	const dim_t      n_elem_per_reg = 8;
+
+	// The number of full vectors needed to span a column of the micropanel
+	// and the number of elements left over. The latter are loaded and
+	// stored with vmaskmovps.
+	const dim_t      m_viter        = mnr / n_elem_per_reg;
+	const dim_t      m_left         = mnr % n_elem_per_reg;
+
+	float*  restrict kappa_cast     = kappa;
+	float*  restrict a_cast         = a;
+	float*  restrict p_cast         = p;
+
+	const bool       is_kappa1      = bli_seq1( *kappa_cast );
+
+	const __m256     kappav         = _mm256_broadcast_ss( kappa_cast );
+	const __m256     zerov          = _mm256_setzero_ps();
+	const __m256i    maskv          = _mm256_set_epi32( 0,
+	                                                   -( m_left > 6 ),
+	                                                   -( m_left > 5 ),
+	                                                   -( m_left > 4 ),
+	                                                   -( m_left > 3 ),
+	                                                   -( m_left > 2 ),
+	                                                   -( m_left > 1 ),
+	                                                   -( m_left > 0 ) );
+
+	dim_t            i, k;
+
+	__m256           x0v, x1v, x2v, x3v, x4v, x5v, x6v, x7v;
+	__m256           t0v, t1v, t2v, t3v, t4v, t5v, t6v, t7v;
+
+	if ( cdim == mnr )
+	{
+		k = 0;
+
+		if ( inca == 1 )
+		{
+			// Each column of the micropanel is contiguous in A, so we can
+			// copy it with vector loads and stores.
+			for ( ; k < n; ++k )
+			{
+				float*  restrict a0 = a_cast + k*lda;
+				float*  restrict p0 = p_cast + k*ldp;
+
+				for ( i = 0; i < m_viter; ++i )
+				{
+					x0v = _mm256_loadu_ps( a0 + i*n_elem_per_reg );
+					if ( !is_kappa1 ) x0v = _mm256_mul_ps( kappav, x0v );
+					_mm256_storeu_ps( p0 + i*n_elem_per_reg, x0v );
+				}
+
+				if ( m_left > 0 )
+				{
+					x0v = _mm256_maskload_ps( a0 + i*n_elem_per_reg, maskv );
+					if ( !is_kappa1 ) x0v = _mm256_mul_ps( kappav, x0v );
+					_mm256_maskstore_ps( p0 + i*n_elem_per_reg, maskv, x0v );
+				}
+			}
+		}
+		else if ( lda == 1 )
+		{
+			// Each row of the micropanel is contiguous in A (ie: we are
+			// packing from a transposed or row-stored matrix), so we load
+			// 8x8 blocks along the rows and transpose them in registers.
+			// Rows beyond the micropanel are treated as zero.
+			for ( ; k + 8 <= n; k += 8 )
+			{
+				for ( i = 0; i < mnr; i += n_elem_per_reg )
+				{
+					const dim_t      m_blk = bli_min( mnr - i, n_elem_per_reg );
+					float*  restrict a0    = a_cast + i*inca + k;
+					float*  restrict p0    = p_cast + i    + k*ldp;
+
+					x0v =                 _mm256_loadu_ps( a0 + 0*inca );
+					x1v = ( m_blk > 1 ) ? _mm256_loadu_ps( a0 + 1*inca ) : zerov;
+					x2v = ( m_blk > 2 ) ? _mm256_loadu_ps( a0 + 2*inca ) : zerov;
+					x3v = ( m_blk > 3 ) ? _mm256_loadu_ps( a0 + 3*inca ) : zerov;
+					x4v = ( m_blk > 4 ) ? _mm256_loadu_ps( a0 + 4*inca ) : zerov;
+					x5v = ( m_blk > 5 ) ? _mm256_loadu_ps( a0 + 5*inca ) : zerov;
+					x6v = ( m_blk > 6 ) ? _mm256_loadu_ps( a0 + 6*inca ) : zerov;
+					x7v = ( m_blk > 7 ) ? _mm256_loadu_ps( a0 + 7*inca ) : zerov;
+
+					t0v = _mm256_unpacklo_ps( x0v, x1v );
+					t1v = _mm256_unpackhi_ps( x0v, x1v );
+					t2v = _mm256_unpacklo_ps( x2v, x3v );
+					t3v = _mm256_unpackhi_ps( x2v, x3v );
+					t4v = _mm256_unpacklo_ps( x4v, x5v );
+					t5v = _mm256_unpackhi_ps( x4v, x5v );
+					t6v = _mm256_unpacklo_ps( x6v, x7v );
+					t7v = _mm256_unpackhi_ps( x6v, x7v );
+
+					x0v = _mm256_shuffle_ps( t0v, t2v, 0x44 );
+					x1v = _mm256_shuffle_ps( t0v, t2v, 0xEE );
+					x2v = _mm256_shuffle_ps( t1v, t3v, 0x44 );
+					x3v = _mm256_shuffle_ps( t1v, t3v, 0xEE );
+					x4v = _mm256_shuffle_ps( t4v, t6v, 0x44 );
+					x5v = _mm256_shuffle_ps( t4v, t6v, 0xEE );
+					x6v = _mm256_shuffle_ps( t5v, t7v, 0x44 );
+					x7v = _mm256_shuffle_ps( t5v, t7v, 0xEE );
+
+					t0v = _mm256_permute2f128_ps( x0v, x4v, 0x20 );
+					t1v = _mm256_permute2f128_ps( x1v, x5v, 0x20 );
+					t2v = _mm256_permute2f128_ps( x2v, x6v, 0x20 );
+					t3v = _mm256_permute2f128_ps( x3v, x7v, 0x20 );
+					t4v = _mm256_permute2f128_ps( x0v, x4v, 0x31 );
+					t5v = _mm256_permute2f128_ps( x1v, x5v, 0x31 );
+					t6v = _mm256_permute2f128_ps( x2v, x6v, 0x31 );
+					t7v = _mm256_permute2f128_ps( x3v, x7v, 0x31 );
+
+					if ( !is_kappa1 )
+					{
+						t0v = _mm256_mul_ps( kappav, t0v );
+						t1v = _mm256_mul_ps( kappav, t1v );
+						t2v = _mm256_mul_ps( kappav, t2v );
+						t3v = _mm256_mul_ps( kappav, t3v );
+						t4v = _mm256_mul_ps( kappav, t4v );
+						t5v = _mm256_mul_ps( kappav, t5v );
+						t6v = _mm256_mul_ps( kappav, t6v );
+						t7v = _mm256_mul_ps( kappav, t7v );
+					}
+
+					if ( m_blk == n_elem_per_reg )
+					{
+						_mm256_storeu_ps( p0 + 0*ldp, t0v );
+						_mm256_storeu_ps( p0 + 1*ldp, t1v );
+						_mm256_storeu_ps( p0 + 2*ldp, t2v );
+						_mm256_storeu_ps( p0 + 3*ldp, t3v );
+						_mm256_storeu_ps( p0 + 4*ldp, t4v );
+						_mm256_storeu_ps( p0 + 5*ldp, t5v );
+						_mm256_storeu_ps( p0 + 6*ldp, t6v );
+						_mm256_storeu_ps( p0 + 7*ldp, t7v );
+					}
+					else
+					{
+						_mm256_maskstore_ps( p0 + 0*ldp, maskv, t0v );
+						_mm256_maskstore_ps( p0 + 1*ldp, maskv, t1v );
+						_mm256_maskstore_ps( p0 + 2*ldp, maskv, t2v );
+						_mm256_maskstore_ps( p0 + 3*ldp, maskv, t3v );
+						_mm256_maskstore_ps( p0 + 4*ldp, maskv, t4v );
+						_mm256_maskstore_ps( p0 + 5*ldp, maskv, t5v );
+						_mm256_maskstore_ps( p0 + 6*ldp, maskv, t6v );
+						_mm256_maskstore_ps( p0 + 7*ldp, maskv, t7v );
+					}
+				}
+			}
+		}
+
+		// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+		// This avoids a performance penalty caused by false dependencies when
+		// transitioning from from AVX to SSE instructions (which may occur
+		// later, especially if BLIS is compiled with -mfpmath=sse).
+		_mm256_zeroupper();
+
+		// Pack any remaining columns, as well as general-stride cases, with
+		// scalar code.
+		for ( ; k < n; ++k )
+		{
+			float*  restrict a0 = a_cast + k*lda;
+			float*  restrict p0 = p_cast + k*ldp;
+
+			if ( is_kappa1 )
+			{
+				for ( i = 0; i < mnr; ++i )
+					bli_sscopys( *(a0 + i*inca), *(p0 + i) );
+			}
+			else
+			{
+				for ( i = 0; i < mnr; ++i )
+					bli_sscal2s( *kappa_cast, *(a0 + i*inca), *(p0 + i) );
+			}
+		}
+	}
+	else /* if ( cdim < mnr ) */
+	{
+		bli_sscal2m_ex
+		(
+		  0,
+		  BLIS_NONUNIT_DIAG,
+		  BLIS_DENSE,
+		  ( trans_t )conja,
+		  cdim,
+		  n,
+		  kappa,
+		  a, inca, lda,
+		  p,    1, ldp,
+		  cntx,
+		  NULL
+		);
+
+		bli_sset0s_mxn
+		(
+		  mnr - cdim,
+		  n_max,
+		  p_cast + cdim, 1, ldp
+		);
+	}
+
+	// Zero-fill the columns of the micropanel beyond n.
+	for ( k = n; k < n_max; ++k )
+	{
+		float*  restrict p0 = p_cast + k*ldp;
+
+		for ( i = 0; i < m_viter; ++i )
+			_mm256_storeu_ps( p0 + i*n_elem_per_reg, zerov );
+
+		if ( m_left > 0 )
+			_mm256_maskstore_ps( p0 + i*n_elem_per_reg, maskv, zerov );
+	}
+
+	_mm256_zeroupper();
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_spackm_haswell_int_16xk
+     (
+       conj_t           conja,
+       pack_t           schema,
+       dim_t            cdim,
+       dim_t            n,
+       dim_t            n_max,
+       void*   restrict kappa,
+       void*   restrict a, inc_t inca, inc_t lda,
+       void*   restrict p,             inc_t ldp,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      mnr            = 16;
+	const dim_t      n_elem_per_reg = 8;
+
+	// The number of full vectors needed to span a column of the micropanel
+	// and the number of elements left over. The latter are loaded and
+	// stored with vmaskmovps.
+	const dim_t      m_viter        = mnr / n_elem_per_reg;
+	const dim_t      m_left         = mnr % n_elem_per_reg;
+
+	float*  restrict kappa_cast     = kappa;
+	float*  restrict a_cast         = a;
+	float*  restrict p_cast         = p;
+
+	const bool       is_kappa1      = bli_seq1( *kappa_cast );
+
+	const __m256     kappav         = _mm256_broadcast_ss( kappa_cast );
+	const __m256     zerov          = _mm256_setzero_ps();
+	const __m256i    maskv          = _mm256_set_epi32( 0,
+	                                                   -( m_left > 6 ),
+	                                                   -( m_left > 5 ),
+	                                                   -( m_left > 4 ),
+	                                                   -( m_left > 3 ),
+	                                                   -( m_left > 2 ),
+	                                                   -( m_left > 1 ),
+	                                                   -( m_left > 0 ) );
+
+	dim_t            i, k;
+
+	__m256           x0v, x1v, x2v, x3v, x4v, x5v, x6v, x7v;
+	__m256           t0v, t1v, t2v, t3v, t4v, t5v, t6v, t7v;
+
+	if ( cdim == mnr )
+	{
+		k = 0;
+
+		if ( inca == 1 )
+		{
+			// Each column of the micropanel is contiguous in A, so we can
+			// copy it with vector loads and stores.
+			for ( ; k < n; ++k )
+			{
+				float*  restrict a0 = a_cast + k*lda;
+				float*  restrict p0 = p_cast + k*ldp;
+
+				for ( i = 0; i < m_viter; ++i )
+				{
+					x0v = _mm256_loadu_ps( a0 + i*n_elem_per_reg );
+					if ( !is_kappa1 ) x0v = _mm256_mul_ps( kappav, x0v );
+					_mm256_storeu_ps( p0 + i*n_elem_per_reg, x0v );
+				}
+
+				if ( m_left > 0 )
+				{
+					x0v = _mm256_maskload_ps( a0 + i*n_elem_per_reg, maskv );
+					if ( !is_kappa1 ) x0v = _mm256_mul_ps( kappav, x0v );
+					_mm256_maskstore_ps( p0 + i*n_elem_per_reg, maskv, x0v );
+				}
+			}
+		}
+		else if ( lda == 1 )
+		{
+			// Each row of the micropanel is contiguous in A (ie: we are
+			// packing from a transposed or row-stored matrix), so we load
+			// 8x8 blocks along the rows and transpose them in registers.
+			// Rows beyond the micropanel are treated as zero.
+			for ( ; k + 8 <= n; k += 8 )
+			{
+				for ( i = 0; i < mnr; i += n_elem_per_reg )
+				{
+					const dim_t      m_blk = bli_min( mnr - i, n_elem_per_reg );
+					float*  restrict a0    = a_cast + i*inca + k;
+					float*  restrict p0    = p_cast + i    + k*ldp;
+
+					x0v =                 _mm256_loadu_ps( a0 + 0*inca );
+					x1v = ( m_blk > 1 ) ? _mm256_loadu_ps( a0 + 1*inca ) : zerov;
+					x2v = ( m_blk > 2 ) ? _mm256_loadu_ps( a0 + 2*inca ) : zerov;
+					x3v = ( m_blk > 3 ) ? _mm256_loadu_ps( a0 + 3*inca ) : zerov;
+					x4v = ( m_blk > 4 ) ? _mm256_loadu_ps( a0 + 4*inca ) : zerov;
+					x5v = ( m_blk > 5 ) ? _mm256_loadu_ps( a0 + 5*inca ) : zerov;
+					x6v = ( m_blk > 6 ) ? _mm256_loadu_ps( a0 + 6*inca ) : zerov;
+					x7v = ( m_blk > 7 ) ? _mm256_loadu_ps( a0 + 7*inca ) : zerov;
+
+					t0v = _mm256_unpacklo_ps( x0v, x1v );
+					t1v = _mm256_unpackhi_ps( x0v, x1v );
+					t2v = _mm256_unpacklo_ps( x2v, x3v );
+					t3v = _mm256_unpackhi_ps( x2v, x3v );
+					t4v = _mm256_unpacklo_ps( x4v, x5v );
+					t5v = _mm256_unpackhi_ps( x4v, x5v );
+					t6v = _mm256_unpacklo_ps( x6v, x7v );
+					t7v = _mm256_unpackhi_ps( x6v, x7v );
+
+					x0v = _mm256_shuffle_ps( t0v, t2v, 0x44 );
+					x1v = _mm256_shuffle_ps( t0v, t2v, 0xEE );
+					x2v = _mm256_shuffle_ps( t1v, t3v, 0x44 );
+					x3v = _mm256_shuffle_ps( t1v, t3v, 0xEE );
+					x4v = _mm256_shuffle_ps( t4v, t6v, 0x44 );
+					x5v = _mm256_shuffle_ps( t4v, t6v, 0xEE );
+					x6v = _mm256_shuffle_ps( t5v, t7v, 0x44 );
+					x7v = _mm256_shuffle_ps( t5v, t7v, 0xEE );
+
+					t0v = _mm256_permute2f128_ps( x0v, x4v, 0x20 );
+					t1v = _mm256_permute2f128_ps( x1v, x5v, 0x20 );
+					t2v = _mm256_permute2f128_ps( x2v, x6v, 0x20 );
+					t3v = _mm256_permute2f128_ps( x3v, x7v, 0x20 );
+					t4v = _mm256_permute2f128_ps( x0v, x4v, 0x31 );
+					t5v = _mm256_permute2f128_ps( x1v, x5v, 0x31 );
+					t6v = _mm256_permute2f128_ps( x2v, x6v, 0x31 );
+					t7v = _mm256_permute2f128_ps( x3v, x7v, 0x31 );
+
+					if ( !is_kappa1 )
+					{
+						t0v = _mm256_mul_ps( kappav, t0v );
+						t1v = _mm256_mul_ps( kappav, t1v );
+						t2v = _mm256_mul_ps( kappav, t2v );
+						t3v = _mm256_mul_ps( kappav, t3v );
+						t4v = _mm256_mul_ps( kappav, t4v );
+						t5v = _mm256_mul_ps( kappav, t5v );
+						t6v = _mm256_mul_ps( kappav, t6v );
+						t7v = _mm256_mul_ps( kappav, t7v );
+					}
+
+					if ( m_blk == n_elem_per_reg )
+					{
+						_mm256_storeu_ps( p0 + 0*ldp, t0v );
+						_mm256_storeu_ps( p0 + 1*ldp, t1v );
+						_mm256_storeu_ps( p0 + 2*ldp, t2v );
+						_mm256_storeu_ps( p0 + 3*ldp, t3v );
+						_mm256_storeu_ps( p0 + 4*ldp, t4v );
+						_mm256_storeu_ps( p0 + 5*ldp, t5v );
+						_mm256_storeu_ps( p0 + 6*ldp, t6v );
+						_mm256_storeu_ps( p0 + 7*ldp, t7v );
+					}
+					else
+					{
+						_mm256_maskstore_ps( p0 + 0*ldp, maskv, t0v );
+						_mm256_maskstore_ps( p0 + 1*ldp, maskv, t1v );
+						_mm256_maskstore_ps( p0 + 2*ldp, maskv, t2v );
+						_mm256_maskstore_ps( p0 + 3*ldp, maskv, t3v );
+						_mm256_maskstore_ps( p0 + 4*ldp, maskv, t4v );
+						_mm256_maskstore_ps( p0 + 5*ldp, maskv, t5v );
+						_mm256_maskstore_ps( p0 + 6*ldp, maskv, t6v );
+						_mm256_maskstore_ps( p0 + 7*ldp, maskv, t7v );
+					}
+				}
+			}
+		}
+
+		// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+		// This avoids a performance penalty caused by false dependencies when
+		// transitioning from from AVX to SSE instructions (which may occur
+		// later, especially if BLIS is compiled with -mfpmath=sse).
+		_mm256_zeroupper();
+
+		// Pack any remaining columns, as well as general-stride cases, with
+		// scalar code.
+		for ( ; k < n; ++k )
+		{
+			float*  restrict a0 = a_cast + k*lda;
+			float*  restrict p0 = p_cast + k*ldp;
+
+			if ( is_kappa1 )
+			{
+				for ( i = 0; i < mnr; ++i )
+					bli_sscopys( *(a0 + i*inca), *(p0 + i) );
+			}
+			else
+			{
+				for ( i = 0; i < mnr; ++i )
+					bli_sscal2s( *kappa_cast, *(a0 + i*inca), *(p0 + i) );
+			}
+		}
+	}
+	else /* if ( cdim < mnr ) */
+	{
+		bli_sscal2m_ex
+		(
+		  0,
+		  BLIS_NONUNIT_DIAG,
+		  BLIS_DENSE,
+		  ( trans_t )conja,
+		  cdim,
+		  n,
+		  kappa,
+		  a, inca, lda,
+		  p,    1, ldp,
+		  cntx,
+		  NULL
+		);
+
+		bli_sset0s_mxn
+		(
+		  mnr - cdim,
+		  n_max,
+		  p_cast + cdim, 1, ldp
+		);
+	}
+
+	// Zero-fill the columns of the micropanel beyond n.
+	for ( k = n; k < n_max; ++k )
+	{
+		float*  restrict p0 = p_cast + k*ldp;
+
+		for ( i = 0; i < m_viter; ++i )
+			_mm256_storeu_ps( p0 + i*n_elem_per_reg, zerov );
+
+		if ( m_left > 0 )
+			_mm256_maskstore_ps( p0 + i*n_elem_per_reg, maskv, zerov );
+	}
+
+	_mm256_zeroupper();
+}
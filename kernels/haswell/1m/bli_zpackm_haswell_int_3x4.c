@@ -0,0 +1,442 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// -----------------------------------------------------------------------------
+
+void bli_zpackm_haswell_int_3xk
+     (
+       conj_t           conja,
+       pack_t           schema,
+       dim_t            cdim,
+       dim_t            n,
+       dim_t            n_max,
+       void*   restrict kappa,
+       void*   restrict a, inc_t inca, inc_t lda,
+       void*   restrict p,             inc_t ldp,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t        mnr            = 3;
+	const dim_t        n_elem_per_reg = 2;
+
+	// The number of full vectors needed to span a column of the micropanel
+	// and the number of elements left over. The latter are loaded and
+	// stored with vmaskmovpd.
+	const dim_t        m_viter        = mnr / n_elem_per_reg;
+	const dim_t        m_left         = mnr % n_elem_per_reg;
+
+	dcomplex* restrict kappa_cast     = kappa;
+	dcomplex* restrict a_cast         = a;
+	dcomplex* restrict p_cast         = p;
+
+	const bool         is_kappa1      = bli_zeq1( *kappa_cast );
+	const bool         is_conj        = bli_is_conj( conja );
+
+	const __m256d      kappa_rv       = _mm256_broadcast_sd( &kappa_cast->real );
+	const __m256d      kappa_iv       = _mm256_broadcast_sd( &kappa_cast->imag );
+	const __m256d      conjv          = _mm256_setr_pd( 0.0, -0.0, 0.0, -0.0 );
+	const __m256d      zerov          = _mm256_setzero_pd();
+	const __m256i      maskv          = _mm256_set_epi64x( 0, 0,
+	                                                        -( m_left > 0 ),
+	                                                        -( m_left > 0 ) );
+
+	dim_t              i, k;
+
+	__m256d            x0v, x1v;
+	__m256d            y0v, y1v;
+
+	if ( cdim == mnr )
+	{
+		k = 0;
+
+		if ( inca == 1 )
+		{
+			// Each column of the micropanel is contiguous in A, so we can
+			// copy it with vector loads and stores.
+			for ( ; k < n; ++k )
+			{
+				double* restrict a0 = ( double* )( a_cast + k*lda );
+				double* restrict p0 = ( double* )( p_cast + k*ldp );
+
+				for ( i = 0; i < m_viter; ++i )
+				{
+					x0v = _mm256_loadu_pd( a0 + 2*i*n_elem_per_reg );
+					if ( is_conj ) x0v = _mm256_xor_pd( x0v, conjv );
+					if ( !is_kappa1 )
+						x0v = _mm256_fmaddsub_pd( kappa_rv, x0v, _mm256_mul_pd( kappa_iv, _mm256_permute_pd( x0v, 0x5 ) ) );
+					_mm256_storeu_pd( p0 + 2*i*n_elem_per_reg, x0v );
+				}
+
+				if ( m_left > 0 )
+				{
+					x0v = _mm256_maskload_pd( a0 + 2*i*n_elem_per_reg, maskv );
+					if ( is_conj ) x0v = _mm256_xor_pd( x0v, conjv );
+					if ( !is_kappa1 )
+						x0v = _mm256_fmaddsub_pd( kappa_rv, x0v, _mm256_mul_pd( kappa_iv, _mm256_permute_pd( x0v, 0x5 ) ) );
+					_mm256_maskstore_pd( p0 + 2*i*n_elem_per_reg, maskv, x0v );
+				}
+			}
+		}
+		else if ( lda == 1 )
+		{
+			// Each row of the micropanel is contiguous in A (ie: we are
+			// packing from a transposed or row-stored matrix), so we load
+			// 2x2 blocks along the rows and transpose them in registers.
+			// Rows beyond the micropanel are treated as zero.
+			for ( ; k + 2 <= n; k += 2 )
+			{
+				for ( i = 0; i < mnr; i += n_elem_per_reg )
+				{
+					const dim_t      m_blk = bli_min( mnr - i, n_elem_per_reg );
+					double* restrict a0    = ( double* )( a_cast + i*inca + k );
+					double* restrict p0    = ( double* )( p_cast + i    + k*ldp );
+
+					x0v =                 _mm256_loadu_pd( a0 + 0*2*inca );
+					x1v = ( m_blk > 1 ) ? _mm256_loadu_pd( a0 + 1*2*inca ) : zerov;
+
+					y0v = _mm256_permute2f128_pd( x0v, x1v, 0x20 );
+					y1v = _mm256_permute2f128_pd( x0v, x1v, 0x31 );
+
+					if ( is_conj )
+					{
+						y0v = _mm256_xor_pd( y0v, conjv );
+						y1v = _mm256_xor_pd( y1v, conjv );
+					}
+
+					if ( !is_kappa1 )
+					{
+						y0v = _mm256_fmaddsub_pd( kappa_rv, y0v, _mm256_mul_pd( kappa_iv, _mm256_permute_pd( y0v, 0x5 ) ) );
+						y1v = _mm256_fmaddsub_pd( kappa_rv, y1v, _mm256_mul_pd( kappa_iv, _mm256_permute_pd( y1v, 0x5 ) ) );
+					}
+
+					if ( m_blk == n_elem_per_reg )
+					{
+						_mm256_storeu_pd( p0 + 0*2*ldp, y0v );
+						_mm256_storeu_pd( p0 + 1*2*ldp, y1v );
+					}
+					else
+					{
+						_mm256_maskstore_pd( p0 + 0*2*ldp, maskv, y0v );
+						_mm256_maskstore_pd( p0 + 1*2*ldp, maskv, y1v );
+					}
+				}
+			}
+		}
+
+		// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+		// This avoids a performance penalty caused by false dependencies when
+		// transitioning from from AVX to SSE instructions (which may occur
+		// later, especially if BLIS is compiled with -mfpmath=sse).
+		_mm256_zeroupper();
+
+		// Pack any remaining columns, as well as general-stride cases, with
+		// scalar code.
+		for ( ; k < n; ++k )
+		{
+			dcomplex* restrict a0 = a_cast + k*lda;
+			dcomplex* restrict p0 = p_cast + k*ldp;
+
+			if ( is_kappa1 )
+			{
+				if ( is_conj )
+				{
+					for ( i = 0; i < mnr; ++i )
+						bli_zcopyjs( *(a0 + i*inca), *(p0 + i) );
+				}
+				else
+				{
+					for ( i = 0; i < mnr; ++i )
+						bli_zcopys( *(a0 + i*inca), *(p0 + i) );
+				}
+			}
+			else
+			{
+				if ( is_conj )
+				{
+					for ( i = 0; i < mnr; ++i )
+						bli_zscal2js( *kappa_cast, *(a0 + i*inca), *(p0 + i) );
+				}
+				else
+				{
+					for ( i = 0; i < mnr; ++i )
+						bli_zscal2s( *kappa_cast, *(a0 + i*inca), *(p0 + i) );
+				}
+			}
+		}
+	}
+	else /* if ( cdim < mnr ) */
+	{
+		bli_zscal2m_ex
+		(
+		  0,
+		  BLIS_NONUNIT_DIAG,
+		  BLIS_DENSE,
+		  ( trans_t )conja,
+		  cdim,
+		  n,
+		  kappa,
+		  a, inca, lda,
+		  p,    1, ldp,
+		  cntx,
+		  NULL
+		);
+
+		bli_zset0s_mxn
+		(
+		  mnr - cdim,
+		  n_max,
+		  p_cast + cdim, 1, ldp
+		);
+	}
+
+	// Zero-fill the columns of the micropanel beyond n.
+	for ( k = n; k < n_max; ++k )
+	{
+		double* restrict p0 = ( double* )( p_cast + k*ldp );
+
+		for ( i = 0; i < m_viter; ++i )
+			_mm256_storeu_pd( p0 + 2*i*n_elem_per_reg, zerov );
+
+		if ( m_left > 0 )
+			_mm256_maskstore_pd( p0 + 2*i*n_elem_per_reg, maskv, zerov );
+	}
+
+	_mm256_zeroupper();
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_zpackm_haswell_int_4xk
+     (
+       conj_t           conja,
+       pack_t           schema,
+       dim_t            cdim,
+       dim_t            n,
+       dim_t            n_max,
+       void*   restrict kappa,
+       void*   restrict a, inc_t inca, inc_t lda,
+       void*   restrict p,             inc_t ldp,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t        mnr            = 4;
+	const dim_t        n_elem_per_reg = 2;
+
+	// The number of full vectors needed to span a column of the micropanel
+	// and the number of elements left over. The latter are loaded and
+	// stored with vmaskmovpd.
+	const dim_t        m_viter        = mnr / n_elem_per_reg;
+	const dim_t        m_left         = mnr % n_elem_per_reg;
+
+	dcomplex* restrict kappa_cast     = kappa;
+	dcomplex* restrict a_cast         = a;
+	dcomplex* restrict p_cast         = p;
+
+	const bool         is_kappa1      = bli_zeq1( *kappa_cast );
+	const bool         is_conj        = bli_is_conj( conja );
+
+	const __m256d      kappa_rv       = _mm256_broadcast_sd( &kappa_cast->real );
+	const __m256d      kappa_iv       = _mm256_broadcast_sd( &kappa_cast->imag );
+	const __m256d      conjv          = _mm256_setr_pd( 0.0, -0.0, 0.0, -0.0 );
+	const __m256d      zerov          = _mm256_setzero_pd();
+	const __m256i      maskv          = _mm256_set_epi64x( 0, 0,
+	                                                        -( m_left > 0 ),
+	                                                        -( m_left > 0 ) );
+
+	dim_t              i, k;
+
+	__m256d            x0v, x1v;
+	__m256d            y0v, y1v;
+
+	if ( cdim == mnr )
+	{
+		k = 0;
+
+		if ( inca == 1 )
+		{
+			// Each column of the micropanel is contiguous in A, so we can
+			// copy it with vector loads and stores.
+			for ( ; k < n; ++k )
+			{
+				double* restrict a0 = ( double* )( a_cast + k*lda );
+				double* restrict p0 = ( double* )( p_cast + k*ldp );
+
+				for ( i = 0; i < m_viter; ++i )
+				{
+					x0v = _mm256_loadu_pd( a0 + 2*i*n_elem_per_reg );
+					if ( is_conj ) x0v = _mm256_xor_pd( x0v, conjv );
+					if ( !is_kappa1 )
+						x0v = _mm256_fmaddsub_pd( kappa_rv, x0v, _mm256_mul_pd( kappa_iv, _mm256_permute_pd( x0v, 0x5 ) ) );
+					_mm256_storeu_pd( p0 + 2*i*n_elem_per_reg, x0v );
+				}
+
+				if ( m_left > 0 )
+				{
+					x0v = _mm256_maskload_pd( a0 + 2*i*n_elem_per_reg, maskv );
+					if ( is_conj ) x0v = _mm256_xor_pd( x0v, conjv );
+					if ( !is_kappa1 )
+						x0v = _mm256_fmaddsub_pd( kappa_rv, x0v, _mm256_mul_pd( kappa_iv, _mm256_permute_pd( x0v, 0x5 ) ) );
+					_mm256_maskstore_pd( p0 + 2*i*n_elem_per_reg, maskv, x0v );
+				}
+			}
+		}
+		else if ( lda == 1 )
+		{
+			// Each row of the micropanel is contiguous in A (ie: we are
+			// packing from a transposed or row-stored matrix), so we load
+			// 2x2 blocks along the rows and transpose them in registers.
+			// Rows beyond the micropanel are treated as zero.
+			for ( ; k + 2 <= n; k += 2 )
+			{
+				for ( i = 0; i < mnr; i += n_elem_per_reg )
+				{
+					const dim_t      m_blk = bli_min( mnr - i, n_elem_per_reg );
+					double* restrict a0    = ( double* )( a_cast + i*inca + k );
+					double* restrict p0    = ( double* )( p_cast + i    + k*ldp );
+
+					x0v =                 _mm256_loadu_pd( a0 + 0*2*inca );
+					x1v = ( m_blk > 1 ) ? _mm256_loadu_pd( a0 + 1*2*inca ) : zerov;
+
+					y0v = _mm256_permute2f128_pd( x0v, x1v, 0x20 );
+					y1v = _mm256_permute2f128_pd( x0v, x1v, 0x31 );
+
+					if ( is_conj )
+					{
+						y0v = _mm256_xor_pd( y0v, conjv );
+						y1v = _mm256_xor_pd( y1v, conjv );
+					}
+
+					if ( !is_kappa1 )
+					{
+						y0v = _mm256_fmaddsub_pd( kappa_rv, y0v, _mm256_mul_pd( kappa_iv, _mm256_permute_pd( y0v, 0x5 ) ) );
+						y1v = _mm256_fmaddsub_pd( kappa_rv, y1v, _mm256_mul_pd( kappa_iv, _mm256_permute_pd( y1v, 0x5 ) ) );
+					}
+
+					if ( m_blk == n_elem_per_reg )
+					{
+						_mm256_storeu_pd( p0 + 0*2*ldp, y0v );
+						_mm256_storeu_pd( p0 + 1*2*ldp, y1v );
+					}
+					else
+					{
+						_mm256_maskstore_pd( p0 + 0*2*ldp, maskv, y0v );
+						_mm256_maskstore_pd( p0 + 1*2*ldp, maskv, y1v );
+					}
+				}
+			}
+		}
+
+		// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+		// This avoids a performance penalty caused by false dependencies when
+		// transitioning from from AVX to SSE instructions (which may occur
+		// later, especially if BLIS is compiled with -mfpmath=sse).
+		_mm256_zeroupper();
+
+		// Pack any remaining columns, as well as general-stride cases, with
+		// scalar code.
+		for ( ; k < n; ++k )
+		{
+			dcomplex* restrict a0 = a_cast + k*lda;
+			dcomplex* restrict p0 = p_cast + k*ldp;
+
+			if ( is_kappa1 )
+			{
+				if ( is_conj )
+				{
+					for ( i = 0; i < mnr; ++i )
+						bli_zcopyjs( *(a0 + i*inca), *(p0 + i) );
+				}
+				else
+				{
+					for ( i = 0; i < mnr; ++i )
+						bli_zcopys( *(a0 + i*inca), *(p0 + i) );
+				}
+			}
+			else
+			{
+				if ( is_conj )
+				{
+					for ( i = 0; i < mnr; ++i )
+						bli_zscal2js( *kappa_cast, *(a0 + i*inca), *(p0 + i) );
+				}
+				else
+				{
+					for ( i = 0; i < mnr; ++i )
+						bli_zscal2s( *kappa_cast, *(a0 + i*inca), *(p0 + i) );
+				}
+			}
+		}
+	}
+	else /* if ( cdim < mnr ) */
+	{
+		bli_zscal2m_ex
+		(
+		  0,
+		  BLIS_NONUNIT_DIAG,
+		  BLIS_DENSE,
+		  ( trans_t )conja,
+		  cdim,
+		  n,
+		  kappa,
+		  a, inca, lda,
+		  p,    1, ldp,
+		  cntx,
+		  NULL
+		);
+
+		bli_zset0s_mxn
+		(
+		  mnr - cdim,
+		  n_max,
+		  p_cast + cdim, 1, ldp
+		);
+	}
+
+	// Zero-fill the columns of the micropanel beyond n.
+	for ( k = n; k < n_max; ++k )
+	{
+		double* restrict p0 = ( double* )( p_cast + k*ldp );
+
+		for ( i = 0; i < m_viter; ++i )
+			_mm256_storeu_pd( p0 + 2*i*n_elem_per_reg, zerov );
+
+		if ( m_left > 0 )
+			_mm256_maskstore_pd( p0 + 2*i*n_elem_per_reg, maskv, zerov );
+	}
+
+	_mm256_zeroupper();
+}
@@ -0,0 +1,193 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   The kernel computes a 4x16 microtile of C from micro-panels of A and B
+   that were packed in pairs along the k dimension (KR = 2). Each 32-bit
+   lane of a packed pair holds the even element in its low half and the odd
+   element in its high half. Since a bfloat16 value is the upper half of the
+   corresponding float, both elements can be widened without any rounding:
+   the even element by shifting the lane left by 16 bits and the odd element
+   by masking off the low 16 bits. Each row of the microtile is held in two
+   ymm registers and updated with one fma per element of the pair:
+
+     ab(i,:) += a(i,2p+0) * b(2p+0,:) + a(i,2p+1) * b(2p+1,:)
+*/
+
+#define BF16_HSW_EVEN( v ) \
+	_mm256_castsi256_ps( _mm256_slli_epi32( v, 16 ) )
+
+#define BF16_HSW_ODD( v ) \
+	_mm256_castsi256_ps( _mm256_and_si256( v, maskv ) )
+
+#define BF16_HSW_ROW_UPDATE( i ) \
+	{ \
+		const __m256i av  = _mm256_castps_si256 \
+		                    ( _mm256_broadcast_ss( ( float* )( ap + 2*i ) ) ); \
+		const __m256  aev = BF16_HSW_EVEN( av ); \
+		const __m256  aov = BF16_HSW_ODD( av ); \
+\
+		ab ## i ## 0 = _mm256_fmadd_ps( aev, b0ev, ab ## i ## 0 ); \
+		ab ## i ## 1 = _mm256_fmadd_ps( aev, b1ev, ab ## i ## 1 ); \
+		ab ## i ## 0 = _mm256_fmadd_ps( aov, b0ov, ab ## i ## 0 ); \
+		ab ## i ## 1 = _mm256_fmadd_ps( aov, b1ov, ab ## i ## 1 ); \
+	}
+
+#define BF16_HSW_ITER \
+	{ \
+		const __m256i b0v  = _mm256_loadu_si256( ( __m256i* )( bp + 0 ) ); \
+		const __m256i b1v  = _mm256_loadu_si256( ( __m256i* )( bp + 16 ) ); \
+		const __m256  b0ev = BF16_HSW_EVEN( b0v ); \
+		const __m256  b0ov = BF16_HSW_ODD( b0v ); \
+		const __m256  b1ev = BF16_HSW_EVEN( b1v ); \
+		const __m256  b1ov = BF16_HSW_ODD( b1v ); \
+\
+		BF16_HSW_ROW_UPDATE( 0 ) \
+		BF16_HSW_ROW_UPDATE( 1 ) \
+		BF16_HSW_ROW_UPDATE( 2 ) \
+		BF16_HSW_ROW_UPDATE( 3 ) \
+\
+		ap += 2 * 4; \
+		bp += 2 * 16; \
+	}
+
+// Scale row i of the product by alpha and write it to row i of ct, which
+// has unit column stride, scaling the existing contents by beta unless bz
+// (beta is zero) is TRUE.
+#define BF16_HSW_ROW_STORE( i, ct, rs_ct, bz ) \
+	{ \
+		__m256 ab0v = _mm256_mul_ps( ab ## i ## 0, alphav ); \
+		__m256 ab1v = _mm256_mul_ps( ab ## i ## 1, alphav ); \
+\
+		float* restrict cti = ct + i*rs_ct; \
+\
+		if ( !bz ) \
+		{ \
+			ab0v = _mm256_fmadd_ps( _mm256_loadu_ps( cti + 0 ), betav, ab0v ); \
+			ab1v = _mm256_fmadd_ps( _mm256_loadu_ps( cti + 8 ), betav, ab1v ); \
+		} \
+\
+		_mm256_storeu_ps( cti + 0, ab0v ); \
+		_mm256_storeu_ps( cti + 8, ab1v ); \
+	}
+
+void bli_gemm_bf16bf16f32_haswell_int_4x16
+     (
+       dim_t               k,
+       float*     restrict alpha,
+       bfloat16*  restrict a,
+       bfloat16*  restrict b,
+       float*     restrict beta,
+       float*     restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const dim_t mr = 4;
+	const dim_t nr = 16;
+
+	const bfloat16* restrict ap = a;
+	const bfloat16* restrict bp = b;
+
+	const __m256i maskv = _mm256_set1_epi32( ( int32_t )0xFFFF0000 );
+
+	__m256 ab00 = _mm256_setzero_ps(), ab01 = _mm256_setzero_ps();
+	__m256 ab10 = _mm256_setzero_ps(), ab11 = _mm256_setzero_ps();
+	__m256 ab20 = _mm256_setzero_ps(), ab21 = _mm256_setzero_ps();
+	__m256 ab30 = _mm256_setzero_ps(), ab31 = _mm256_setzero_ps();
+
+	// Prefetch the rows of C, assuming row storage.
+	for ( dim_t i = 0; i < mr; ++i )
+		_mm_prefetch( ( char* )( c + i*rs_c ), _MM_HINT_T0 );
+
+	// The packed micro-panels are zero-padded to a multiple of KR.
+	const dim_t k_pairs = ( k + 1 ) / 2;
+	const dim_t k_iter  = k_pairs / 4;
+	const dim_t k_left  = k_pairs % 4;
+
+	for ( dim_t p = 0; p < k_iter; ++p )
+	{
+		BF16_HSW_ITER
+		BF16_HSW_ITER
+		BF16_HSW_ITER
+		BF16_HSW_ITER
+	}
+
+	for ( dim_t p = 0; p < k_left; ++p )
+	{
+		BF16_HSW_ITER
+	}
+
+	const __m256 alphav       = _mm256_broadcast_ss( alpha );
+	const __m256 betav        = _mm256_broadcast_ss( beta );
+	const bool   beta_is_zero = bli_seq0( *beta );
+
+	if ( cs_c == 1 )
+	{
+		// C is row-stored, so we can update it in place.
+		BF16_HSW_ROW_STORE( 0, c, rs_c, beta_is_zero )
+		BF16_HSW_ROW_STORE( 1, c, rs_c, beta_is_zero )
+		BF16_HSW_ROW_STORE( 2, c, rs_c, beta_is_zero )
+		BF16_HSW_ROW_STORE( 3, c, rs_c, beta_is_zero )
+	}
+	else
+	{
+		// Otherwise, compute alpha * A * B into a local row-stored buffer
+		// and then accumulate it into C element by element.
+		float       ct[ 4 * 16 ] __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE)));
+		const inc_t rs_ct = nr;
+
+		BF16_HSW_ROW_STORE( 0, ct, rs_ct, TRUE )
+		BF16_HSW_ROW_STORE( 1, ct, rs_ct, TRUE )
+		BF16_HSW_ROW_STORE( 2, ct, rs_ct, TRUE )
+		BF16_HSW_ROW_STORE( 3, ct, rs_ct, TRUE )
+
+		if ( beta_is_zero )
+		{
+			for ( dim_t j = 0; j < nr; ++j )
+			for ( dim_t i = 0; i < mr; ++i )
+				c[ i*rs_c + j*cs_c ] = ct[ i*rs_ct + j ];
+		}
+		else
+		{
+			for ( dim_t j = 0; j < nr; ++j )
+			for ( dim_t i = 0; i < mr; ++i )
+				c[ i*rs_c + j*cs_c ] = *beta * c[ i*rs_c + j*cs_c ] +
+				                       ct[ i*rs_ct + j ];
+		}
+	}
+}
@@ -0,0 +1,200 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   The kernel computes a 6x16 microtile of C from micro-panels of A and B
+   that were packed in pairs along the k dimension (KR = 2). The unsigned
+   elements of A and the signed elements of B are widened to 16 bits, after
+   which vpmaddwd multiplies them and sums each pair into a 32-bit lane:
+
+     ab(i,:) += a(i,2p+0) * b(2p+0,:) + a(i,2p+1) * b(2p+1,:)
+
+   Unlike vpmaddubsw, which operates on the 8-bit values directly, this
+   never saturates, so the int32 accumulation is exact. Each row of the
+   microtile is held in two ymm registers.
+*/
+
+#define U8S8_HSW_ROW_UPDATE( i ) \
+	{ \
+		const __m256i av = _mm256_set1_epi32 \
+		                   ( ( int32_t )ap[ 2*i + 0 ] | \
+		                     ( ( int32_t )ap[ 2*i + 1 ] << 16 ) ); \
+\
+		ab ## i ## 0 = _mm256_add_epi32( ab ## i ## 0, _mm256_madd_epi16( av, b0v ) ); \
+		ab ## i ## 1 = _mm256_add_epi32( ab ## i ## 1, _mm256_madd_epi16( av, b1v ) ); \
+	}
+
+#define U8S8_HSW_ITER \
+	{ \
+		const __m256i b0v = _mm256_cvtepi8_epi16 \
+		                    ( _mm_loadu_si128( ( __m128i* )( bp + 0 ) ) ); \
+		const __m256i b1v = _mm256_cvtepi8_epi16 \
+		                    ( _mm_loadu_si128( ( __m128i* )( bp + 16 ) ) ); \
+\
+		U8S8_HSW_ROW_UPDATE( 0 ) \
+		U8S8_HSW_ROW_UPDATE( 1 ) \
+		U8S8_HSW_ROW_UPDATE( 2 ) \
+		U8S8_HSW_ROW_UPDATE( 3 ) \
+		U8S8_HSW_ROW_UPDATE( 4 ) \
+		U8S8_HSW_ROW_UPDATE( 5 ) \
+\
+		ap += 2 * 6; \
+		bp += 2 * 16; \
+	}
+
+// Update one vector of eight elements of C at cp with the product abv. The
+// update is exact when alpha is one and beta is zero or one; otherwise, it
+// is computed in single precision and rounded to the nearest integer.
+#define U8S8_HSW_VEC_STORE( abv, cp ) \
+	{ \
+		__m256i rv; \
+\
+		if      ( alpha_is_one && beta_is_zero ) \
+			rv = abv; \
+		else if ( alpha_is_one && beta_is_one ) \
+			rv = _mm256_add_epi32( abv, _mm256_loadu_si256( ( __m256i* )( cp ) ) ); \
+		else \
+		{ \
+			__m256 fv = _mm256_mul_ps( _mm256_cvtepi32_ps( abv ), alphav ); \
+\
+			if ( !beta_is_zero ) \
+				fv = _mm256_fmadd_ps( _mm256_cvtepi32_ps \
+				                      ( _mm256_loadu_si256( ( __m256i* )( cp ) ) ), \
+				                      betav, fv ); \
+\
+			rv = _mm256_cvtps_epi32( fv ); \
+		} \
+\
+		_mm256_storeu_si256( ( __m256i* )( cp ), rv ); \
+	}
+
+#define U8S8_HSW_ROW_STORE( i, ct, rs_ct ) \
+	{ \
+		U8S8_HSW_VEC_STORE( ab ## i ## 0, ct + i*rs_ct + 0 ) \
+		U8S8_HSW_VEC_STORE( ab ## i ## 1, ct + i*rs_ct + 8 ) \
+	}
+
+void bli_gemm_u8s8s32_haswell_int_6x16
+     (
+       dim_t               k,
+       float*     restrict alpha,
+       uint8_t*   restrict a,
+       int8_t*    restrict b,
+       float*     restrict beta,
+       int32_t*   restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const dim_t mr = 6;
+	const dim_t nr = 16;
+
+	const uint8_t* restrict ap = a;
+	const int8_t*  restrict bp = b;
+
+	__m256i ab00 = _mm256_setzero_si256(), ab01 = _mm256_setzero_si256();
+	__m256i ab10 = _mm256_setzero_si256(), ab11 = _mm256_setzero_si256();
+	__m256i ab20 = _mm256_setzero_si256(), ab21 = _mm256_setzero_si256();
+	__m256i ab30 = _mm256_setzero_si256(), ab31 = _mm256_setzero_si256();
+	__m256i ab40 = _mm256_setzero_si256(), ab41 = _mm256_setzero_si256();
+	__m256i ab50 = _mm256_setzero_si256(), ab51 = _mm256_setzero_si256();
+
+	// Prefetch the rows of C, assuming row storage.
+	for ( dim_t i = 0; i < mr; ++i )
+		_mm_prefetch( ( char* )( c + i*rs_c ), _MM_HINT_T0 );
+
+	// The packed micro-panels are zero-padded to a multiple of KR.
+	const dim_t k_pairs = ( k + 1 ) / 2;
+	const dim_t k_iter  = k_pairs / 4;
+	const dim_t k_left  = k_pairs % 4;
+
+	for ( dim_t p = 0; p < k_iter; ++p )
+	{
+		U8S8_HSW_ITER
+		U8S8_HSW_ITER
+		U8S8_HSW_ITER
+		U8S8_HSW_ITER
+	}
+
+	for ( dim_t p = 0; p < k_left; ++p )
+	{
+		U8S8_HSW_ITER
+	}
+
+	const __m256 alphav       = _mm256_broadcast_ss( alpha );
+	const __m256 betav        = _mm256_broadcast_ss( beta );
+	const bool   alpha_is_one = bli_seq1( *alpha );
+	const bool   beta_is_zero = bli_seq0( *beta );
+	const bool   beta_is_one  = bli_seq1( *beta );
+
+	if ( cs_c == 1 )
+	{
+		// C is row-stored, so we can update it in place.
+		U8S8_HSW_ROW_STORE( 0, c, rs_c )
+		U8S8_HSW_ROW_STORE( 1, c, rs_c )
+		U8S8_HSW_ROW_STORE( 2, c, rs_c )
+		U8S8_HSW_ROW_STORE( 3, c, rs_c )
+		U8S8_HSW_ROW_STORE( 4, c, rs_c )
+		U8S8_HSW_ROW_STORE( 5, c, rs_c )
+	}
+	else
+	{
+		// Otherwise, copy C to a local row-stored buffer (unless beta is
+		// zero, in which case C must not be read), update the buffer, and
+		// then copy it back.
+		int32_t     ct[ 6 * 16 ] __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE)));
+		const inc_t rs_ct = nr;
+
+		if ( !beta_is_zero )
+		{
+			for ( dim_t j = 0; j < nr; ++j )
+			for ( dim_t i = 0; i < mr; ++i )
+				ct[ i*rs_ct + j ] = c[ i*rs_c + j*cs_c ];
+		}
+
+		U8S8_HSW_ROW_STORE( 0, ct, rs_ct )
+		U8S8_HSW_ROW_STORE( 1, ct, rs_ct )
+		U8S8_HSW_ROW_STORE( 2, ct, rs_ct )
+		U8S8_HSW_ROW_STORE( 3, ct, rs_ct )
+		U8S8_HSW_ROW_STORE( 4, ct, rs_ct )
+		U8S8_HSW_ROW_STORE( 5, ct, rs_ct )
+
+		for ( dim_t j = 0; j < nr; ++j )
+		for ( dim_t i = 0; i < mr; ++i )
+			c[ i*rs_c + j*cs_c ] = ct[ i*rs_ct + j ];
+	}
+}
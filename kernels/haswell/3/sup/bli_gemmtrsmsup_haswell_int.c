@@ -0,0 +1,494 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   These kernels compute
+
+     b11 := inv( a11 ) * ( alpha * b11 - a1x * bx1 )
+
+   for unpacked operands, as described in bli_gemmtrsmsup_ref.c. Each row of
+   an mr x nr microtile of b11 is held in two ymm registers, so the vector
+   code paths require that B be row-stored. Full (six-row) microtiles are
+   handled by fully unrolled code, while edge cases in either dimension use
+   masked loads and stores. Wider panels of B (for example, those used by
+   configurations with a larger sup NR) are processed nr columns at a time.
+   If B is not row-stored, the kernels fall back to a scalar loop.
+
+   Since the diagonal block is solved row by row, each row of the result is
+   kept in registers after it is computed and reused when eliminating the
+   rows that follow (lower) or precede (upper) it.
+*/
+
+// Perform the rank-1 update of row i of the microtile with broadcast element
+// a1x(i,l) and the two vectors of row l of bx1.
+#define GTSUP_ROW_UPDATE( vtype, vs, i ) \
+	{ \
+		const vtype av = _mm256_broadcast_s ## vs( ap + i*rs_a ); \
+\
+		ab ## i ## 0 = _mm256_fmadd_p ## vs( av, b0v, ab ## i ## 0 ); \
+		ab ## i ## 1 = _mm256_fmadd_p ## vs( av, b1v, ab ## i ## 1 ); \
+	}
+
+// Compute x(i) = alpha * b11(i,:) - ab(i,:) for row i.
+#define GTSUP_ROW_INIT( vs, i ) \
+	{ \
+		ab ## i ## 0 = _mm256_fmsub_p ## vs \
+		( alphav, _mm256_loadu_p ## vs( b11 + i*rs_b + 0*nv ), ab ## i ## 0 ); \
+		ab ## i ## 1 = _mm256_fmsub_p ## vs \
+		( alphav, _mm256_loadu_p ## vs( b11 + i*rs_b + 1*nv ), ab ## i ## 1 ); \
+	}
+
+// Eliminate the contribution of the already-solved row l from row i.
+#define GTSUP_ROW_ELIM( vtype, vs, i, l ) \
+	{ \
+		const vtype av = _mm256_broadcast_s ## vs( a11 + i*rs_a + l*cs_a ); \
+\
+		ab ## i ## 0 = _mm256_fnmadd_p ## vs( av, ab ## l ## 0, ab ## i ## 0 ); \
+		ab ## i ## 1 = _mm256_fnmadd_p ## vs( av, ab ## l ## 1, ab ## i ## 1 ); \
+	}
+
+// Scale row i by the inverted diagonal element and store it to b11.
+#define GTSUP_ROW_FINISH( vtype, vs, i ) \
+	{ \
+		const vtype dv = _mm256_broadcast_s ## vs( d11 + i ); \
+\
+		ab ## i ## 0 = _mm256_mul_p ## vs( dv, ab ## i ## 0 ); \
+		ab ## i ## 1 = _mm256_mul_p ## vs( dv, ab ## i ## 1 ); \
+\
+		_mm256_storeu_p ## vs( b11 + i*rs_b + 0*nv, ab ## i ## 0 ); \
+		_mm256_storeu_p ## vs( b11 + i*rs_b + 1*nv, ab ## i ## 1 ); \
+	}
+
+// Accumulate ab = a1x * bx1 for a 6 x (2*nv) microtile.
+#define GTSUP_GEMM( ctype, vtype, vs ) \
+	vtype ab00 = _mm256_setzero_p ## vs(), ab01 = _mm256_setzero_p ## vs(); \
+	vtype ab10 = _mm256_setzero_p ## vs(), ab11 = _mm256_setzero_p ## vs(); \
+	vtype ab20 = _mm256_setzero_p ## vs(), ab21 = _mm256_setzero_p ## vs(); \
+	vtype ab30 = _mm256_setzero_p ## vs(), ab31 = _mm256_setzero_p ## vs(); \
+	vtype ab40 = _mm256_setzero_p ## vs(), ab41 = _mm256_setzero_p ## vs(); \
+	vtype ab50 = _mm256_setzero_p ## vs(), ab51 = _mm256_setzero_p ## vs(); \
+\
+	for ( dim_t l = 0; l < k; ++l ) \
+	{ \
+		const ctype* restrict ap = a1x + l*cs_a; \
+		const vtype b0v = _mm256_loadu_p ## vs( bx1 + l*rs_b + 0*nv ); \
+		const vtype b1v = _mm256_loadu_p ## vs( bx1 + l*rs_b + 1*nv ); \
+\
+		GTSUP_ROW_UPDATE( vtype, vs, 0 ) \
+		GTSUP_ROW_UPDATE( vtype, vs, 1 ) \
+		GTSUP_ROW_UPDATE( vtype, vs, 2 ) \
+		GTSUP_ROW_UPDATE( vtype, vs, 3 ) \
+		GTSUP_ROW_UPDATE( vtype, vs, 4 ) \
+		GTSUP_ROW_UPDATE( vtype, vs, 5 ) \
+	} \
+\
+	const vtype alphav = _mm256_broadcast_s ## vs( alpha );
+
+// -----------------------------------------------------------------------------
+
+// Return a mask that selects the first n of the elements in a ymm register.
+static inline __m256i bli_gtsup_mask_s( dim_t n )
+{
+	return _mm256_cmpgt_epi32( _mm256_set1_epi32( ( int32_t )n ),
+	                           _mm256_set_epi32( 7, 6, 5, 4, 3, 2, 1, 0 ) );
+}
+
+static inline __m256i bli_gtsup_mask_d( dim_t n )
+{
+	return _mm256_cmpgt_epi64( _mm256_set1_epi64x( ( int64_t )n ),
+	                           _mm256_set_epi64x( 3, 2, 1, 0 ) );
+}
+
+// Masked code path for m <= mr and n <= nr with row-stored B. The rows of
+// the microtile are solved in forward order for the lower triangular case
+// and in backward order for the upper triangular case.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, vtype, vs, nv_, mr_, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       bool             is_upper, \
+       dim_t            m, \
+       dim_t            n, \
+       dim_t            k, \
+       ctype*  restrict alpha, \
+       ctype*  restrict a1x, \
+       ctype*  restrict a11, inc_t rs_a, inc_t cs_a, \
+       ctype*  restrict d11, \
+       ctype*  restrict bx1, \
+       ctype*  restrict b11, inc_t rs_b  \
+     ) \
+{ \
+	const dim_t   nv    = nv_; \
+	const __m256i mask0 = bli_gtsup_mask_ ## ch( n ); \
+	const __m256i mask1 = bli_gtsup_mask_ ## ch( n - nv ); \
+\
+	vtype ab[ mr_ ][ 2 ]; \
+\
+	for ( dim_t i = 0; i < m; ++i ) \
+	{ \
+		ab[ i ][ 0 ] = _mm256_setzero_p ## vs(); \
+		ab[ i ][ 1 ] = _mm256_setzero_p ## vs(); \
+	} \
+\
+	for ( dim_t l = 0; l < k; ++l ) \
+	{ \
+		const vtype b0v = _mm256_maskload_p ## vs( bx1 + l*rs_b + 0*nv, mask0 ); \
+		const vtype b1v = _mm256_maskload_p ## vs( bx1 + l*rs_b + 1*nv, mask1 ); \
+\
+		for ( dim_t i = 0; i < m; ++i ) \
+		{ \
+			const vtype av = _mm256_broadcast_s ## vs( a1x + i*rs_a + l*cs_a ); \
+\
+			ab[ i ][ 0 ] = _mm256_fmadd_p ## vs( av, b0v, ab[ i ][ 0 ] ); \
+			ab[ i ][ 1 ] = _mm256_fmadd_p ## vs( av, b1v, ab[ i ][ 1 ] ); \
+		} \
+	} \
+\
+	const vtype alphav = _mm256_broadcast_s ## vs( alpha ); \
+\
+	for ( dim_t iter = 0; iter < m; ++iter ) \
+	{ \
+		const dim_t i     = ( is_upper ? m - iter - 1 : iter ); \
+		const dim_t l_beg = ( is_upper ? i + 1 : 0 ); \
+		const dim_t l_end = ( is_upper ? m     : i ); \
+\
+		vtype x0 = _mm256_fmsub_p ## vs \
+		( alphav, _mm256_maskload_p ## vs( b11 + i*rs_b + 0*nv, mask0 ), ab[ i ][ 0 ] ); \
+		vtype x1 = _mm256_fmsub_p ## vs \
+		( alphav, _mm256_maskload_p ## vs( b11 + i*rs_b + 1*nv, mask1 ), ab[ i ][ 1 ] ); \
+\
+		for ( dim_t l = l_beg; l < l_end; ++l ) \
+		{ \
+			const vtype av = _mm256_broadcast_s ## vs( a11 + i*rs_a + l*cs_a ); \
+\
+			x0 = _mm256_fnmadd_p ## vs( av, ab[ l ][ 0 ], x0 ); \
+			x1 = _mm256_fnmadd_p ## vs( av, ab[ l ][ 1 ], x1 ); \
+		} \
+\
+		const vtype dv = _mm256_broadcast_s ## vs( d11 + i ); \
+\
+		ab[ i ][ 0 ] = _mm256_mul_p ## vs( dv, x0 ); \
+		ab[ i ][ 1 ] = _mm256_mul_p ## vs( dv, x1 ); \
+\
+		_mm256_maskstore_p ## vs( b11 + i*rs_b + 0*nv, mask0, ab[ i ][ 0 ] ); \
+		_mm256_maskstore_p ## vs( b11 + i*rs_b + 1*nv, mask1, ab[ i ][ 1 ] ); \
+	} \
+}
+
+GENTFUNC( float,  s, __m256,  s, 8, 6, gemmtrsmsup_haswell_int_mask )
+GENTFUNC( double, d, __m256d, d, 4, 6, gemmtrsmsup_haswell_int_mask )
+
+// -----------------------------------------------------------------------------
+
+// Generic (scalar) code paths for column-stored B. The kernels below are
+// only registered for real domains, so conja has no effect.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       dim_t            m, \
+       dim_t            n, \
+       dim_t            k, \
+       ctype*  restrict alpha, \
+       ctype*  restrict a10, \
+       ctype*  restrict a11, inc_t rs_a, inc_t cs_a, \
+       ctype*  restrict d11, \
+       ctype*  restrict b01, \
+       ctype*  restrict b11, inc_t rs_b, inc_t cs_b  \
+     ) \
+{ \
+	for ( dim_t i = 0; i < m; ++i ) \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		{ \
+			ctype rho = 0; \
+\
+			for ( dim_t l = 0; l < k; ++l ) \
+				rho += a10[ i*rs_a + l*cs_a ] * b01[ l*rs_b + j*cs_b ]; \
+\
+			for ( dim_t l = 0; l < i; ++l ) \
+				rho += a11[ i*rs_a + l*cs_a ] * b11[ l*rs_b + j*cs_b ]; \
+\
+			b11[ i*rs_b + j*cs_b ] = \
+			d11[ i ] * ( (*alpha) * b11[ i*rs_b + j*cs_b ] - rho ); \
+		} \
+	} \
+}
+
+GENTFUNC( float,  s, gemmtrsmsup_l_haswell_int_edge )
+GENTFUNC( double, d, gemmtrsmsup_l_haswell_int_edge )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       dim_t            m, \
+       dim_t            n, \
+       dim_t            k, \
+       ctype*  restrict alpha, \
+       ctype*  restrict a12, \
+       ctype*  restrict a11, inc_t rs_a, inc_t cs_a, \
+       ctype*  restrict d11, \
+       ctype*  restrict b21, \
+       ctype*  restrict b11, inc_t rs_b, inc_t cs_b  \
+     ) \
+{ \
+	for ( dim_t i = m - 1; i >= 0; --i ) \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		{ \
+			ctype rho = 0; \
+\
+			for ( dim_t l = 0; l < k; ++l ) \
+				rho += a12[ i*rs_a + l*cs_a ] * b21[ l*rs_b + j*cs_b ]; \
+\
+			for ( dim_t l = i + 1; l < m; ++l ) \
+				rho += a11[ i*rs_a + l*cs_a ] * b11[ l*rs_b + j*cs_b ]; \
+\
+			b11[ i*rs_b + j*cs_b ] = \
+			d11[ i ] * ( (*alpha) * b11[ i*rs_b + j*cs_b ] - rho ); \
+		} \
+	} \
+}
+
+GENTFUNC( float,  s, gemmtrsmsup_u_haswell_int_edge )
+GENTFUNC( double, d, gemmtrsmsup_u_haswell_int_edge )
+
+// -----------------------------------------------------------------------------
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, vtype, vs, nv_, mr_, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       conj_t              conja, \
+       dim_t               m, \
+       dim_t               n, \
+       dim_t               k, \
+       ctype*     restrict alpha, \
+       ctype*     restrict a10, \
+       ctype*     restrict a11, inc_t rs_a, inc_t cs_a, \
+       ctype*     restrict d11, \
+       ctype*     restrict b01, \
+       ctype*     restrict b11, inc_t rs_b, inc_t cs_b, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     ) \
+{ \
+	const dim_t nv = nv_; \
+	const dim_t nr = 2 * nv; \
+	dim_t       j  = 0; \
+\
+	if ( cs_b != 1 ) \
+	{ \
+		PASTEMAC(ch,gemmtrsmsup_l_haswell_int_edge) \
+		( \
+		  m, n, k, alpha, \
+		  a10, a11, rs_a, cs_a, d11, \
+		  b01, b11, rs_b, cs_b \
+		); \
+		return; \
+	} \
+\
+	if ( m == mr_ ) \
+	{ \
+		for ( ; j + nr <= n; j += nr ) \
+		{ \
+			const ctype* restrict a1x = a10; \
+			const ctype* restrict bx1 = b01 + j; \
+			ctype*       restrict b11j = b11 + j; \
+\
+			GTSUP_GEMM( ctype, vtype, vs ) \
+\
+			{ \
+				ctype* restrict b11 = b11j; \
+\
+				GTSUP_ROW_INIT( vs, 0 ) \
+				GTSUP_ROW_FINISH( vtype, vs, 0 ) \
+\
+				GTSUP_ROW_INIT( vs, 1 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 1, 0 ) \
+				GTSUP_ROW_FINISH( vtype, vs, 1 ) \
+\
+				GTSUP_ROW_INIT( vs, 2 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 2, 0 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 2, 1 ) \
+				GTSUP_ROW_FINISH( vtype, vs, 2 ) \
+\
+				GTSUP_ROW_INIT( vs, 3 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 3, 0 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 3, 1 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 3, 2 ) \
+				GTSUP_ROW_FINISH( vtype, vs, 3 ) \
+\
+				GTSUP_ROW_INIT( vs, 4 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 4, 0 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 4, 1 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 4, 2 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 4, 3 ) \
+				GTSUP_ROW_FINISH( vtype, vs, 4 ) \
+\
+				GTSUP_ROW_INIT( vs, 5 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 5, 0 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 5, 1 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 5, 2 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 5, 3 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 5, 4 ) \
+				GTSUP_ROW_FINISH( vtype, vs, 5 ) \
+			} \
+		} \
+	} \
+\
+	for ( ; j < n; j += nr ) \
+	{ \
+		PASTEMAC(ch,gemmtrsmsup_haswell_int_mask) \
+		( \
+		  FALSE, m, bli_min( nr, n - j ), k, alpha, \
+		  a10, a11, rs_a, cs_a, d11, \
+		  b01 + j, b11 + j, rs_b \
+		); \
+	} \
+}
+
+GENTFUNC( float,  s, __m256,  s, 8, 6, gemmtrsmsup_l_haswell_int_6x16 )
+GENTFUNC( double, d, __m256d, d, 4, 6, gemmtrsmsup_l_haswell_int_6x8 )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, vtype, vs, nv_, mr_, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       conj_t              conja, \
+       dim_t               m, \
+       dim_t               n, \
+       dim_t               k, \
+       ctype*     restrict alpha, \
+       ctype*     restrict a12, \
+       ctype*     restrict a11, inc_t rs_a, inc_t cs_a, \
+       ctype*     restrict d11, \
+       ctype*     restrict b21, \
+       ctype*     restrict b11, inc_t rs_b, inc_t cs_b, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     ) \
+{ \
+	const dim_t nv = nv_; \
+	const dim_t nr = 2 * nv; \
+	dim_t       j  = 0; \
+\
+	if ( cs_b != 1 ) \
+	{ \
+		PASTEMAC(ch,gemmtrsmsup_u_haswell_int_edge) \
+		( \
+		  m, n, k, alpha, \
+		  a12, a11, rs_a, cs_a, d11, \
+		  b21, b11, rs_b, cs_b \
+		); \
+		return; \
+	} \
+\
+	if ( m == mr_ ) \
+	{ \
+		for ( ; j + nr <= n; j += nr ) \
+		{ \
+			const ctype* restrict a1x = a12; \
+			const ctype* restrict bx1 = b21 + j; \
+			ctype*       restrict b11j = b11 + j; \
+\
+			GTSUP_GEMM( ctype, vtype, vs ) \
+\
+			{ \
+				ctype* restrict b11 = b11j; \
+\
+				GTSUP_ROW_INIT( vs, 5 ) \
+				GTSUP_ROW_FINISH( vtype, vs, 5 ) \
+\
+				GTSUP_ROW_INIT( vs, 4 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 4, 5 ) \
+				GTSUP_ROW_FINISH( vtype, vs, 4 ) \
+\
+				GTSUP_ROW_INIT( vs, 3 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 3, 5 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 3, 4 ) \
+				GTSUP_ROW_FINISH( vtype, vs, 3 ) \
+\
+				GTSUP_ROW_INIT( vs, 2 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 2, 5 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 2, 4 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 2, 3 ) \
+				GTSUP_ROW_FINISH( vtype, vs, 2 ) \
+\
+				GTSUP_ROW_INIT( vs, 1 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 1, 5 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 1, 4 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 1, 3 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 1, 2 ) \
+				GTSUP_ROW_FINISH( vtype, vs, 1 ) \
+\
+				GTSUP_ROW_INIT( vs, 0 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 0, 5 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 0, 4 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 0, 3 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 0, 2 ) \
+				GTSUP_ROW_ELIM( vtype, vs, 0, 1 ) \
+				GTSUP_ROW_FINISH( vtype, vs, 0 ) \
+			} \
+		} \
+	} \
+\
+	for ( ; j < n; j += nr ) \
+	{ \
+		PASTEMAC(ch,gemmtrsmsup_haswell_int_mask) \
+		( \
+		  TRUE, m, bli_min( nr, n - j ), k, alpha, \
+		  a12, a11, rs_a, cs_a, d11, \
+		  b21 + j, b11 + j, rs_b \
+		); \
+	} \
+}
+
+GENTFUNC( float,  s, __m256,  s, 8, 6, gemmtrsmsup_u_haswell_int_6x16 )
+GENTFUNC( double, d, __m256d, d, 4, 6, gemmtrsmsup_u_haswell_int_6x8 )
+
@@ -33,6 +33,21 @@
 
 */
 
+// -- level-1m -----------------------------------------------------------------
+
+// packm (intrinsics)
+PACKM_KER_PROT( float,    s, packm_haswell_int_6xk )
+PACKM_KER_PROT( float,    s, packm_haswell_int_16xk )
+PACKM_KER_PROT( double,   d, packm_haswell_int_6xk )
+PACKM_KER_PROT( double,   d, packm_haswell_int_8xk )
+PACKM_KER_PROT( scomplex, c, packm_haswell_int_3xk )
+PACKM_KER_PROT( scomplex, c, packm_haswell_int_8xk )
+PACKM_KER_PROT( dcomplex, z, packm_haswell_int_3xk )
+PACKM_KER_PROT( dcomplex, z, packm_haswell_int_4xk )
+
+// packm (half-precision, intrinsics)
+PACKM_F16_KER_PROT( packm_cxk_f16_haswell_int )
+
 // -- level-3 ------------------------------------------------------------------
 
 // gemm (asm d6x8)
@@ -55,6 +70,10 @@ GEMMTRSM_UKR_PROT( double,   d, gemmtrsm_l_haswell_asm_6x8 )
 GEMMTRSM_UKR_PROT( float,    s, gemmtrsm_u_haswell_asm_6x16 )
 GEMMTRSM_UKR_PROT( double,   d, gemmtrsm_u_haswell_asm_6x8 )
 
+// gemm (low-precision, intrinsics)
+GEMM_BF16BF16F32_UKR_PROT( gemm_bf16bf16f32_haswell_int_4x16 )
+GEMM_U8S8S32_UKR_PROT( gemm_u8s8s32_haswell_int_6x16 )
+
 
 // gemm (asm d8x6)
 //GEMM_UKR_PROT( float,    s, gemm_haswell_asm_16x6 )
@@ -155,3 +174,10 @@ GEMMSUP_KER_PROT( double,   d, gemmsup_rd_haswell_asm_3x8n )
 GEMMSUP_KER_PROT( double,   d, gemmsup_rd_haswell_asm_2x8n )
 GEMMSUP_KER_PROT( double,   d, gemmsup_rd_haswell_asm_1x8n )
 
+// -- gemmtrsmsup --
+
+GEMMTRSMSUP_KER_PROT( float,    s, gemmtrsmsup_l_haswell_int_6x16 )
+GEMMTRSMSUP_KER_PROT( double,   d, gemmtrsmsup_l_haswell_int_6x8 )
+GEMMTRSMSUP_KER_PROT( float,    s, gemmtrsmsup_u_haswell_int_6x16 )
+GEMMTRSMSUP_KER_PROT( double,   d, gemmtrsmsup_u_haswell_int_6x8 )
+
@@ -0,0 +1,279 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+// -----------------------------------------------------------------------------
+
+void bli_srotv_skx_int
+     (
+       dim_t            n,
+       float*  restrict c,
+       float*  restrict s,
+       float*  restrict x, inc_t incx,
+       float*  restrict y, inc_t incy,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 16;
+	const dim_t      n_iter_unroll  = 4;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_vleft;
+	dim_t            n_left;
+
+	float*  restrict x0;
+	float*  restrict y0;
+
+	__m512           cv, sv;
+	__m512           x0v, x1v, x2v, x3v;
+	__m512           y0v, y1v, y2v, y3v;
+
+	// If the vector dimension is zero, return early.
+	if ( bli_zero_dim1( n ) ) return;
+
+	const float      c0 = *c;
+	const float      s0 = *s;
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, use scalar code for all iterations.
+	if ( incx != 1 || incy != 1 )
+	{
+		for ( i = 0; i < n; ++i )
+		{
+			const float x0c = *x;
+			const float y0c = *y;
+
+			*x = c0 * x0c + s0 * y0c;
+			*y = c0 * y0c - s0 * x0c;
+
+			x += incx;
+			y += incy;
+		}
+
+		return;
+	}
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of unrolled and single-register vectorized
+	// iterations, and the number of leftover elements.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_vleft = ( n ) % ( n_elem_per_reg * n_iter_unroll ) / n_elem_per_reg;
+	n_left  = ( n ) % ( n_elem_per_reg );
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	// Broadcast c and s to all elements of vector registers.
+	cv = _mm512_set1_ps( c0 );
+	sv = _mm512_set1_ps( s0 );
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v = _mm512_loadu_ps( x0 + 0*n_elem_per_reg );
+		x1v = _mm512_loadu_ps( x0 + 1*n_elem_per_reg );
+		x2v = _mm512_loadu_ps( x0 + 2*n_elem_per_reg );
+		x3v = _mm512_loadu_ps( x0 + 3*n_elem_per_reg );
+
+		y0v = _mm512_loadu_ps( y0 + 0*n_elem_per_reg );
+		y1v = _mm512_loadu_ps( y0 + 1*n_elem_per_reg );
+		y2v = _mm512_loadu_ps( y0 + 2*n_elem_per_reg );
+		y3v = _mm512_loadu_ps( y0 + 3*n_elem_per_reg );
+
+		// x := c * x + s * y; y := c * y - s * x
+		_mm512_storeu_ps( (x0 + 0*n_elem_per_reg), _mm512_fmadd_ps( cv, x0v, _mm512_mul_ps( sv, y0v ) ) );
+		_mm512_storeu_ps( (x0 + 1*n_elem_per_reg), _mm512_fmadd_ps( cv, x1v, _mm512_mul_ps( sv, y1v ) ) );
+		_mm512_storeu_ps( (x0 + 2*n_elem_per_reg), _mm512_fmadd_ps( cv, x2v, _mm512_mul_ps( sv, y2v ) ) );
+		_mm512_storeu_ps( (x0 + 3*n_elem_per_reg), _mm512_fmadd_ps( cv, x3v, _mm512_mul_ps( sv, y3v ) ) );
+
+		_mm512_storeu_ps( (y0 + 0*n_elem_per_reg), _mm512_fnmadd_ps( sv, x0v, _mm512_mul_ps( cv, y0v ) ) );
+		_mm512_storeu_ps( (y0 + 1*n_elem_per_reg), _mm512_fnmadd_ps( sv, x1v, _mm512_mul_ps( cv, y1v ) ) );
+		_mm512_storeu_ps( (y0 + 2*n_elem_per_reg), _mm512_fnmadd_ps( sv, x2v, _mm512_mul_ps( cv, y2v ) ) );
+		_mm512_storeu_ps( (y0 + 3*n_elem_per_reg), _mm512_fnmadd_ps( sv, x3v, _mm512_mul_ps( cv, y3v ) ) );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+		y0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	for ( i = 0; i < n_vleft; ++i )
+	{
+		x0v = _mm512_loadu_ps( x0 );
+		y0v = _mm512_loadu_ps( y0 );
+
+		_mm512_storeu_ps( x0, _mm512_fmadd_ps( cv, x0v, _mm512_mul_ps( sv, y0v ) ) );
+		_mm512_storeu_ps( y0, _mm512_fnmadd_ps( sv, x0v, _mm512_mul_ps( cv, y0v ) ) );
+
+		x0 += n_elem_per_reg;
+		y0 += n_elem_per_reg;
+	}
+
+	// Handle the leftover elements with masked loads and stores, which
+	// never touch memory beyond the ends of x and y.
+	if ( n_left > 0 )
+	{
+		const __mmask16 mask = ( __mmask16 )( ( 1U << n_left ) - 1 );
+
+		x0v = _mm512_maskz_loadu_ps( mask, x0 );
+		y0v = _mm512_maskz_loadu_ps( mask, y0 );
+
+		_mm512_mask_storeu_ps( x0, mask, _mm512_fmadd_ps( cv, x0v, _mm512_mul_ps( sv, y0v ) ) );
+		_mm512_mask_storeu_ps( y0, mask, _mm512_fnmadd_ps( sv, x0v, _mm512_mul_ps( cv, y0v ) ) );
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_drotv_skx_int
+     (
+       dim_t            n,
+       double* restrict c,
+       double* restrict s,
+       double* restrict x, inc_t incx,
+       double* restrict y, inc_t incy,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 8;
+	const dim_t      n_iter_unroll  = 4;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_vleft;
+	dim_t            n_left;
+
+	double* restrict x0;
+	double* restrict y0;
+
+	__m512d          cv, sv;
+	__m512d          x0v, x1v, x2v, x3v;
+	__m512d          y0v, y1v, y2v, y3v;
+
+	// If the vector dimension is zero, return early.
+	if ( bli_zero_dim1( n ) ) return;
+
+	const double     c0 = *c;
+	const double     s0 = *s;
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, use scalar code for all iterations.
+	if ( incx != 1 || incy != 1 )
+	{
+		for ( i = 0; i < n; ++i )
+		{
+			const double x0c = *x;
+			const double y0c = *y;
+
+			*x = c0 * x0c + s0 * y0c;
+			*y = c0 * y0c - s0 * x0c;
+
+			x += incx;
+			y += incy;
+		}
+
+		return;
+	}
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of unrolled and single-register vectorized
+	// iterations, and the number of leftover elements.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_vleft = ( n ) % ( n_elem_per_reg * n_iter_unroll ) / n_elem_per_reg;
+	n_left  = ( n ) % ( n_elem_per_reg );
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	// Broadcast c and s to all elements of vector registers.
+	cv = _mm512_set1_pd( c0 );
+	sv = _mm512_set1_pd( s0 );
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v = _mm512_loadu_pd( x0 + 0*n_elem_per_reg );
+		x1v = _mm512_loadu_pd( x0 + 1*n_elem_per_reg );
+		x2v = _mm512_loadu_pd( x0 + 2*n_elem_per_reg );
+		x3v = _mm512_loadu_pd( x0 + 3*n_elem_per_reg );
+
+		y0v = _mm512_loadu_pd( y0 + 0*n_elem_per_reg );
+		y1v = _mm512_loadu_pd( y0 + 1*n_elem_per_reg );
+		y2v = _mm512_loadu_pd( y0 + 2*n_elem_per_reg );
+		y3v = _mm512_loadu_pd( y0 + 3*n_elem_per_reg );
+
+		// x := c * x + s * y; y := c * y - s * x
+		_mm512_storeu_pd( (x0 + 0*n_elem_per_reg), _mm512_fmadd_pd( cv, x0v, _mm512_mul_pd( sv, y0v ) ) );
+		_mm512_storeu_pd( (x0 + 1*n_elem_per_reg), _mm512_fmadd_pd( cv, x1v, _mm512_mul_pd( sv, y1v ) ) );
+		_mm512_storeu_pd( (x0 + 2*n_elem_per_reg), _mm512_fmadd_pd( cv, x2v, _mm512_mul_pd( sv, y2v ) ) );
+		_mm512_storeu_pd( (x0 + 3*n_elem_per_reg), _mm512_fmadd_pd( cv, x3v, _mm512_mul_pd( sv, y3v ) ) );
+
+		_mm512_storeu_pd( (y0 + 0*n_elem_per_reg), _mm512_fnmadd_pd( sv, x0v, _mm512_mul_pd( cv, y0v ) ) );
+		_mm512_storeu_pd( (y0 + 1*n_elem_per_reg), _mm512_fnmadd_pd( sv, x1v, _mm512_mul_pd( cv, y1v ) ) );
+		_mm512_storeu_pd( (y0 + 2*n_elem_per_reg), _mm512_fnmadd_pd( sv, x2v, _mm512_mul_pd( cv, y2v ) ) );
+		_mm512_storeu_pd( (y0 + 3*n_elem_per_reg), _mm512_fnmadd_pd( sv, x3v, _mm512_mul_pd( cv, y3v ) ) );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+		y0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	for ( i = 0; i < n_vleft; ++i )
+	{
+		x0v = _mm512_loadu_pd( x0 );
+		y0v = _mm512_loadu_pd( y0 );
+
+		_mm512_storeu_pd( x0, _mm512_fmadd_pd( cv, x0v, _mm512_mul_pd( sv, y0v ) ) );
+		_mm512_storeu_pd( y0, _mm512_fnmadd_pd( sv, x0v, _mm512_mul_pd( cv, y0v ) ) );
+
+		x0 += n_elem_per_reg;
+		y0 += n_elem_per_reg;
+	}
+
+	// Handle the leftover elements with masked loads and stores, which
+	// never touch memory beyond the ends of x and y.
+	if ( n_left > 0 )
+	{
+		const __mmask8  mask = ( __mmask8 )( ( 1U << n_left ) - 1 );
+
+		x0v = _mm512_maskz_loadu_pd( mask, x0 );
+		y0v = _mm512_maskz_loadu_pd( mask, y0 );
+
+		_mm512_mask_storeu_pd( x0, mask, _mm512_fmadd_pd( cv, x0v, _mm512_mul_pd( sv, y0v ) ) );
+		_mm512_mask_storeu_pd( y0, mask, _mm512_fnmadd_pd( sv, x0v, _mm512_mul_pd( cv, y0v ) ) );
+	}
+}
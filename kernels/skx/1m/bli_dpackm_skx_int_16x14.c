@@ -0,0 +1,472 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// -----------------------------------------------------------------------------
+
+void bli_dpackm_skx_int_16xk
+     (
+       conj_t           conja,
+       pack_t           schema,
+       dim_t            cdim,
+       dim_t            n,
+       dim_t            n_max,
+       void*   restrict kappa,
+       void*   restrict a, inc_t inca, inc_t lda,
+       void*   restrict p,             inc_t ldp,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      mnr            = 16;
+	const dim_t      n_elem_per_reg = 8;
+
+	// The number of full vectors needed to span a column of the micropanel
+	// and the number of elements left over. The latter are loaded and
+	// stored under an opmask.
+	const dim_t      m_viter        = mnr / n_elem_per_reg;
+	const dim_t      m_left         = mnr % n_elem_per_reg;
+
+	double* restrict kappa_cast     = kappa;
+	double* restrict a_cast         = a;
+	double* restrict p_cast         = p;
+
+	const bool       is_kappa1      = bli_deq1( *kappa_cast );
+
+	const __m512d    kappav         = _mm512_set1_pd( *kappa_cast );
+	const __m512d    zerov          = _mm512_setzero_pd();
+	const __mmask8   mask           = ( __mmask8 )( ( 1 << m_left ) - 1 );
+
+	dim_t            i, k;
+
+	__m512d          x0v, x1v, x2v, x3v, x4v, x5v, x6v, x7v;
+	__m512d          t0v, t1v, t2v, t3v, t4v, t5v, t6v, t7v;
+
+	if ( cdim == mnr )
+	{
+		k = 0;
+
+		if ( inca == 1 )
+		{
+			// Each column of the micropanel is contiguous in A, so we can
+			// copy it with vector loads and stores.
+			for ( ; k < n; ++k )
+			{
+				double* restrict a0 = a_cast + k*lda;
+				double* restrict p0 = p_cast + k*ldp;
+
+				for ( i = 0; i < m_viter; ++i )
+				{
+					x0v = _mm512_loadu_pd( a0 + i*n_elem_per_reg );
+					if ( !is_kappa1 ) x0v = _mm512_mul_pd( kappav, x0v );
+					_mm512_storeu_pd( p0 + i*n_elem_per_reg, x0v );
+				}
+
+				if ( m_left > 0 )
+				{
+					x0v = _mm512_maskz_loadu_pd( mask, a0 + i*n_elem_per_reg );
+					if ( !is_kappa1 ) x0v = _mm512_mul_pd( kappav, x0v );
+					_mm512_mask_storeu_pd( p0 + i*n_elem_per_reg, mask, x0v );
+				}
+			}
+		}
+		else if ( lda == 1 )
+		{
+			// Each row of the micropanel is contiguous in A (ie: we are
+			// packing from a transposed or row-stored matrix), so we load
+			// 8x8 blocks along the rows and transpose them in registers.
+			// Rows beyond the micropanel are treated as zero.
+			for ( ; k + 8 <= n; k += 8 )
+			{
+				for ( i = 0; i < mnr; i += n_elem_per_reg )
+				{
+					const dim_t      m_blk = bli_min( mnr - i, n_elem_per_reg );
+					double* restrict a0    = a_cast + i*inca + k;
+					double* restrict p0    = p_cast + i    + k*ldp;
+
+					x0v =                 _mm512_loadu_pd( a0 + 0*inca );
+					x1v = ( m_blk > 1 ) ? _mm512_loadu_pd( a0 + 1*inca ) : zerov;
+					x2v = ( m_blk > 2 ) ? _mm512_loadu_pd( a0 + 2*inca ) : zerov;
+					x3v = ( m_blk > 3 ) ? _mm512_loadu_pd( a0 + 3*inca ) : zerov;
+					x4v = ( m_blk > 4 ) ? _mm512_loadu_pd( a0 + 4*inca ) : zerov;
+					x5v = ( m_blk > 5 ) ? _mm512_loadu_pd( a0 + 5*inca ) : zerov;
+					x6v = ( m_blk > 6 ) ? _mm512_loadu_pd( a0 + 6*inca ) : zerov;
+					x7v = ( m_blk > 7 ) ? _mm512_loadu_pd( a0 + 7*inca ) : zerov;
+
+					t0v = _mm512_unpacklo_pd( x0v, x1v );
+					t1v = _mm512_unpackhi_pd( x0v, x1v );
+					t2v = _mm512_unpacklo_pd( x2v, x3v );
+					t3v = _mm512_unpackhi_pd( x2v, x3v );
+					t4v = _mm512_unpacklo_pd( x4v, x5v );
+					t5v = _mm512_unpackhi_pd( x4v, x5v );
+					t6v = _mm512_unpacklo_pd( x6v, x7v );
+					t7v = _mm512_unpackhi_pd( x6v, x7v );
+
+					x0v = _mm512_shuffle_f64x2( t0v, t2v, 0x88 );
+					x1v = _mm512_shuffle_f64x2( t1v, t3v, 0x88 );
+					x2v = _mm512_shuffle_f64x2( t0v, t2v, 0xDD );
+					x3v = _mm512_shuffle_f64x2( t1v, t3v, 0xDD );
+					x4v = _mm512_shuffle_f64x2( t4v, t6v, 0x88 );
+					x5v = _mm512_shuffle_f64x2( t5v, t7v, 0x88 );
+					x6v = _mm512_shuffle_f64x2( t4v, t6v, 0xDD );
+					x7v = _mm512_shuffle_f64x2( t5v, t7v, 0xDD );
+
+					t0v = _mm512_shuffle_f64x2( x0v, x4v, 0x88 );
+					t1v = _mm512_shuffle_f64x2( x1v, x5v, 0x88 );
+					t2v = _mm512_shuffle_f64x2( x2v, x6v, 0x88 );
+					t3v = _mm512_shuffle_f64x2( x3v, x7v, 0x88 );
+					t4v = _mm512_shuffle_f64x2( x0v, x4v, 0xDD );
+					t5v = _mm512_shuffle_f64x2( x1v, x5v, 0xDD );
+					t6v = _mm512_shuffle_f64x2( x2v, x6v, 0xDD );
+					t7v = _mm512_shuffle_f64x2( x3v, x7v, 0xDD );
+
+					if ( !is_kappa1 )
+					{
+						t0v = _mm512_mul_pd( kappav, t0v );
+						t1v = _mm512_mul_pd( kappav, t1v );
+						t2v = _mm512_mul_pd( kappav, t2v );
+						t3v = _mm512_mul_pd( kappav, t3v );
+						t4v = _mm512_mul_pd( kappav, t4v );
+						t5v = _mm512_mul_pd( kappav, t5v );
+						t6v = _mm512_mul_pd( kappav, t6v );
+						t7v = _mm512_mul_pd( kappav, t7v );
+					}
+
+					if ( m_blk == n_elem_per_reg )
+					{
+						_mm512_storeu_pd( p0 + 0*ldp, t0v );
+						_mm512_storeu_pd( p0 + 1*ldp, t1v );
+						_mm512_storeu_pd( p0 + 2*ldp, t2v );
+						_mm512_storeu_pd( p0 + 3*ldp, t3v );
+						_mm512_storeu_pd( p0 + 4*ldp, t4v );
+						_mm512_storeu_pd( p0 + 5*ldp, t5v );
+						_mm512_storeu_pd( p0 + 6*ldp, t6v );
+						_mm512_storeu_pd( p0 + 7*ldp, t7v );
+					}
+					else
+					{
+						_mm512_mask_storeu_pd( p0 + 0*ldp, mask, t0v );
+						_mm512_mask_storeu_pd( p0 + 1*ldp, mask, t1v );
+						_mm512_mask_storeu_pd( p0 + 2*ldp, mask, t2v );
+						_mm512_mask_storeu_pd( p0 + 3*ldp, mask, t3v );
+						_mm512_mask_storeu_pd( p0 + 4*ldp, mask, t4v );
+						_mm512_mask_storeu_pd( p0 + 5*ldp, mask, t5v );
+						_mm512_mask_storeu_pd( p0 + 6*ldp, mask, t6v );
+						_mm512_mask_storeu_pd( p0 + 7*ldp, mask, t7v );
+					}
+				}
+			}
+		}
+
+		// Issue vzeroupper instruction to clear upper lanes of the vector
+		// registers before any scalar (and possibly SSE) code that follows.
+		_mm256_zeroupper();
+
+		// Pack any remaining columns, as well as general-stride cases, with
+		// scalar code.
+		for ( ; k < n; ++k )
+		{
+			double* restrict a0 = a_cast + k*lda;
+			double* restrict p0 = p_cast + k*ldp;
+
+			if ( is_kappa1 )
+			{
+				for ( i = 0; i < mnr; ++i )
+					bli_ddcopys( *(a0 + i*inca), *(p0 + i) );
+			}
+			else
+			{
+				for ( i = 0; i < mnr; ++i )
+					bli_dscal2s( *kappa_cast, *(a0 + i*inca), *(p0 + i) );
+			}
+		}
+	}
+	else /* if ( cdim < mnr ) */
+	{
+		bli_dscal2m_ex
+		(
+		  0,
+		  BLIS_NONUNIT_DIAG,
+		  BLIS_DENSE,
+		  ( trans_t )conja,
+		  cdim,
+		  n,
+		  kappa,
+		  a, inca, lda,
+		  p,    1, ldp,
+		  cntx,
+		  NULL
+		);
+
+		bli_dset0s_mxn
+		(
+		  mnr - cdim,
+		  n_max,
+		  p_cast + cdim, 1, ldp
+		);
+	}
+
+	// Zero-fill the columns of the micropanel beyond n.
+	for ( k = n; k < n_max; ++k )
+	{
+		double* restrict p0 = p_cast + k*ldp;
+
+		for ( i = 0; i < m_viter; ++i )
+			_mm512_storeu_pd( p0 + i*n_elem_per_reg, zerov );
+
+		if ( m_left > 0 )
+			_mm512_mask_storeu_pd( p0 + i*n_elem_per_reg, mask, zerov );
+	}
+
+	_mm256_zeroupper();
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_dpackm_skx_int_14xk
+     (
+       conj_t           conja,
+       pack_t           schema,
+       dim_t            cdim,
+       dim_t            n,
+       dim_t            n_max,
+       void*   restrict kappa,
+       void*   restrict a, inc_t inca, inc_t lda,
+       void*   restrict p,             inc_t ldp,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      mnr            = 14;
+	const dim_t      n_elem_per_reg = 8;
+
+	// The number of full vectors needed to span a column of the micropanel
+	// and the number of elements left over. The latter are loaded and
+	// stored under an opmask.
+	const dim_t      m_viter        = mnr / n_elem_per_reg;
+	const dim_t      m_left         = mnr % n_elem_per_reg;
+
+	double* restrict kappa_cast     = kappa;
+	double* restrict a_cast         = a;
+	double* restrict p_cast         = p;
+
+	const bool       is_kappa1      = bli_deq1( *kappa_cast );
+
+	const __m512d    kappav         = _mm512_set1_pd( *kappa_cast );
+	const __m512d    zerov          = _mm512_setzero_pd();
+	const __mmask8   mask           = ( __mmask8 )( ( 1 << m_left ) - 1 );
+
+	dim_t            i, k;
+
+	__m512d          x0v, x1v, x2v, x3v, x4v, x5v, x6v, x7v;
+	__m512d          t0v, t1v, t2v, t3v, t4v, t5v, t6v, t7v;
+
+	if ( cdim == mnr )
+	{
+		k = 0;
+
+		if ( inca == 1 )
+		{
+			// Each column of the micropanel is contiguous in A, so we can
+			// copy it with vector loads and stores.
+			for ( ; k < n; ++k )
+			{
+				double* restrict a0 = a_cast + k*lda;
+				double* restrict p0 = p_cast + k*ldp;
+
+				for ( i = 0; i < m_viter; ++i )
+				{
+					x0v = _mm512_loadu_pd( a0 + i*n_elem_per_reg );
+					if ( !is_kappa1 ) x0v = _mm512_mul_pd( kappav, x0v );
+					_mm512_storeu_pd( p0 + i*n_elem_per_reg, x0v );
+				}
+
+				if ( m_left > 0 )
+				{
+					x0v = _mm512_maskz_loadu_pd( mask, a0 + i*n_elem_per_reg );
+					if ( !is_kappa1 ) x0v = _mm512_mul_pd( kappav, x0v );
+					_mm512_mask_storeu_pd( p0 + i*n_elem_per_reg, mask, x0v );
+				}
+			}
+		}
+		else if ( lda == 1 )
+		{
+			// Each row of the micropanel is contiguous in A (ie: we are
+			// packing from a transposed or row-stored matrix), so we load
+			// 8x8 blocks along the rows and transpose them in registers.
+			// Rows beyond the micropanel are treated as zero.
+			for ( ; k + 8 <= n; k += 8 )
+			{
+				for ( i = 0; i < mnr; i += n_elem_per_reg )
+				{
+					const dim_t      m_blk = bli_min( mnr - i, n_elem_per_reg );
+					double* restrict a0    = a_cast + i*inca + k;
+					double* restrict p0    = p_cast + i    + k*ldp;
+
+					x0v =                 _mm512_loadu_pd( a0 + 0*inca );
+					x1v = ( m_blk > 1 ) ? _mm512_loadu_pd( a0 + 1*inca ) : zerov;
+					x2v = ( m_blk > 2 ) ? _mm512_loadu_pd( a0 + 2*inca ) : zerov;
+					x3v = ( m_blk > 3 ) ? _mm512_loadu_pd( a0 + 3*inca ) : zerov;
+					x4v = ( m_blk > 4 ) ? _mm512_loadu_pd( a0 + 4*inca ) : zerov;
+					x5v = ( m_blk > 5 ) ? _mm512_loadu_pd( a0 + 5*inca ) : zerov;
+					x6v = ( m_blk > 6 ) ? _mm512_loadu_pd( a0 + 6*inca ) : zerov;
+					x7v = ( m_blk > 7 ) ? _mm512_loadu_pd( a0 + 7*inca ) : zerov;
+
+					t0v = _mm512_unpacklo_pd( x0v, x1v );
+					t1v = _mm512_unpackhi_pd( x0v, x1v );
+					t2v = _mm512_unpacklo_pd( x2v, x3v );
+					t3v = _mm512_unpackhi_pd( x2v, x3v );
+					t4v = _mm512_unpacklo_pd( x4v, x5v );
+					t5v = _mm512_unpackhi_pd( x4v, x5v );
+					t6v = _mm512_unpacklo_pd( x6v, x7v );
+					t7v = _mm512_unpackhi_pd( x6v, x7v );
+
+					x0v = _mm512_shuffle_f64x2( t0v, t2v, 0x88 );
+					x1v = _mm512_shuffle_f64x2( t1v, t3v, 0x88 );
+					x2v = _mm512_shuffle_f64x2( t0v, t2v, 0xDD );
+					x3v = _mm512_shuffle_f64x2( t1v, t3v, 0xDD );
+					x4v = _mm512_shuffle_f64x2( t4v, t6v, 0x88 );
+					x5v = _mm512_shuffle_f64x2( t5v, t7v, 0x88 );
+					x6v = _mm512_shuffle_f64x2( t4v, t6v, 0xDD );
+					x7v = _mm512_shuffle_f64x2( t5v, t7v, 0xDD );
+
+					t0v = _mm512_shuffle_f64x2( x0v, x4v, 0x88 );
+					t1v = _mm512_shuffle_f64x2( x1v, x5v, 0x88 );
+					t2v = _mm512_shuffle_f64x2( x2v, x6v, 0x88 );
+					t3v = _mm512_shuffle_f64x2( x3v, x7v, 0x88 );
+					t4v = _mm512_shuffle_f64x2( x0v, x4v, 0xDD );
+					t5v = _mm512_shuffle_f64x2( x1v, x5v, 0xDD );
+					t6v = _mm512_shuffle_f64x2( x2v, x6v, 0xDD );
+					t7v = _mm512_shuffle_f64x2( x3v, x7v, 0xDD );
+
+					if ( !is_kappa1 )
+					{
+						t0v = _mm512_mul_pd( kappav, t0v );
+						t1v = _mm512_mul_pd( kappav, t1v );
+						t2v = _mm512_mul_pd( kappav, t2v );
+						t3v = _mm512_mul_pd( kappav, t3v );
+						t4v = _mm512_mul_pd( kappav, t4v );
+						t5v = _mm512_mul_pd( kappav, t5v );
+						t6v = _mm512_mul_pd( kappav, t6v );
+						t7v = _mm512_mul_pd( kappav, t7v );
+					}
+
+					if ( m_blk == n_elem_per_reg )
+					{
+						_mm512_storeu_pd( p0 + 0*ldp, t0v );
+						_mm512_storeu_pd( p0 + 1*ldp, t1v );
+						_mm512_storeu_pd( p0 + 2*ldp, t2v );
+						_mm512_storeu_pd( p0 + 3*ldp, t3v );
+						_mm512_storeu_pd( p0 + 4*ldp, t4v );
+						_mm512_storeu_pd( p0 + 5*ldp, t5v );
+						_mm512_storeu_pd( p0 + 6*ldp, t6v );
+						_mm512_storeu_pd( p0 + 7*ldp, t7v );
+					}
+					else
+					{
+						_mm512_mask_storeu_pd( p0 + 0*ldp, mask, t0v );
+						_mm512_mask_storeu_pd( p0 + 1*ldp, mask, t1v );
+						_mm512_mask_storeu_pd( p0 + 2*ldp, mask, t2v );
+						_mm512_mask_storeu_pd( p0 + 3*ldp, mask, t3v );
+						_mm512_mask_storeu_pd( p0 + 4*ldp, mask, t4v );
+						_mm512_mask_storeu_pd( p0 + 5*ldp, mask, t5v );
+						_mm512_mask_storeu_pd( p0 + 6*ldp, mask, t6v );
+						_mm512_mask_storeu_pd( p0 + 7*ldp, mask, t7v );
+					}
+				}
+			}
+		}
+
+		// Issue vzeroupper instruction to clear upper lanes of the vector
+		// registers before any scalar (and possibly SSE) code that follows.
+		_mm256_zeroupper();
+
+		// Pack any remaining columns, as well as general-stride cases, with
+		// scalar code.
+		for ( ; k < n; ++k )
+		{
+			double* restrict a0 = a_cast + k*lda;
+			double* restrict p0 = p_cast + k*ldp;
+
+			if ( is_kappa1 )
+			{
+				for ( i = 0; i < mnr; ++i )
+					bli_ddcopys( *(a0 + i*inca), *(p0 + i) );
+			}
+			else
+			{
+				for ( i = 0; i < mnr; ++i )
+					bli_dscal2s( *kappa_cast, *(a0 + i*inca), *(p0 + i) );
+			}
+		}
+	}
+	else /* if ( cdim < mnr ) */
+	{
+		bli_dscal2m_ex
+		(
+		  0,
+		  BLIS_NONUNIT_DIAG,
+		  BLIS_DENSE,
+		  ( trans_t )conja,
+		  cdim,
+		  n,
+		  kappa,
+		  a, inca, lda,
+		  p,    1, ldp,
+		  cntx,
+		  NULL
+		);
+
+		bli_dset0s_mxn
+		(
+		  mnr - cdim,
+		  n_max,
+		  p_cast + cdim, 1, ldp
+		);
+	}
+
+	// Zero-fill the columns of the micropanel beyond n.
+	for ( k = n; k < n_max; ++k )
+	{
+		double* restrict p0 = p_cast + k*ldp;
+
+		for ( i = 0; i < m_viter; ++i )
+			_mm512_storeu_pd( p0 + i*n_elem_per_reg, zerov );
+
+		if ( m_left > 0 )
+			_mm512_mask_storeu_pd( p0 + i*n_elem_per_reg, mask, zerov );
+	}
+
+	_mm256_zeroupper();
+}
@@ -0,0 +1,492 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// -----------------------------------------------------------------------------
+
+void bli_spackm_skx_int_32xk
+     (
+       conj_t           conja,
+       pack_t           schema,
+       dim_t            cdim,
+       dim_t            n,
+       dim_t            n_max,
+       void*   restrict kappa,
+       void*   restrict a, inc_t inca, inc_t lda,
+       void*   restrict p,             inc_t ldp,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      mnr            = 32;
+	const dim_t      n_elem_per_reg = 16;
+
+	// The number of full vectors needed to span a column of the micropanel
+	// and the number of elements left over. The latter are loaded and
+	// stored under an opmask.
+	const dim_t      m_viter        = mnr / n_elem_per_reg;
+	const dim_t      m_left         = mnr % n_elem_per_reg;
+
+	float*  restrict kappa_cast     = kappa;
+	float*  restrict a_cast         = a;
+	float*  restrict p_cast         = p;
+
+	const bool       is_kappa1      = bli_seq1( *kappa_cast );
+
+	const __m512     kappav         = _mm512_set1_ps( *kappa_cast );
+	const __m512     zerov          = _mm512_setzero_ps();
+	const __mmask16  mask           = ( __mmask16 )( ( 1 << m_left ) - 1 );
+
+	// When packing from a transposed source, the micropanel is processed in
+	// blocks of eight rows held in ymm registers.
+	const dim_t      n_elem_per_blk = 8;
+	const dim_t      m_left_b       = mnr % n_elem_per_blk;
+
+	const __m256     kappa_bv       = _mm256_broadcast_ss( kappa_cast );
+	const __m256     zero_bv        = _mm256_setzero_ps();
+	const __mmask8   mask_b         = ( __mmask8 )( ( 1 << m_left_b ) - 1 );
+
+	dim_t            i, k;
+
+	__m512           x0v;
+	__m256           y0v, y1v, y2v, y3v, y4v, y5v, y6v, y7v;
+	__m256           u0v, u1v, u2v, u3v, u4v, u5v, u6v, u7v;
+
+	if ( cdim == mnr )
+	{
+		k = 0;
+
+		if ( inca == 1 )
+		{
+			// Each column of the micropanel is contiguous in A, so we can
+			// copy it with vector loads and stores.
+			for ( ; k < n; ++k )
+			{
+				float*  restrict a0 = a_cast + k*lda;
+				float*  restrict p0 = p_cast + k*ldp;
+
+				for ( i = 0; i < m_viter; ++i )
+				{
+					x0v = _mm512_loadu_ps( a0 + i*n_elem_per_reg );
+					if ( !is_kappa1 ) x0v = _mm512_mul_ps( kappav, x0v );
+					_mm512_storeu_ps( p0 + i*n_elem_per_reg, x0v );
+				}
+
+				if ( m_left > 0 )
+				{
+					x0v = _mm512_maskz_loadu_ps( mask, a0 + i*n_elem_per_reg );
+					if ( !is_kappa1 ) x0v = _mm512_mul_ps( kappav, x0v );
+					_mm512_mask_storeu_ps( p0 + i*n_elem_per_reg, mask, x0v );
+				}
+			}
+		}
+		else if ( lda == 1 )
+		{
+			// Each row of the micropanel is contiguous in A (ie: we are
+			// packing from a transposed or row-stored matrix), so we load
+			// 8x8 blocks along the rows and transpose them in ymm registers.
+			// Rows beyond the micropanel are treated as zero.
+			for ( ; k + 8 <= n; k += 8 )
+			{
+				for ( i = 0; i < mnr; i += n_elem_per_blk )
+				{
+					const dim_t      m_blk = bli_min( mnr - i, n_elem_per_blk );
+					float*  restrict a0    = a_cast + i*inca + k;
+					float*  restrict p0    = p_cast + i    + k*ldp;
+
+					y0v =                 _mm256_loadu_ps( a0 + 0*inca );
+					y1v = ( m_blk > 1 ) ? _mm256_loadu_ps( a0 + 1*inca ) : zero_bv;
+					y2v = ( m_blk > 2 ) ? _mm256_loadu_ps( a0 + 2*inca ) : zero_bv;
+					y3v = ( m_blk > 3 ) ? _mm256_loadu_ps( a0 + 3*inca ) : zero_bv;
+					y4v = ( m_blk > 4 ) ? _mm256_loadu_ps( a0 + 4*inca ) : zero_bv;
+					y5v = ( m_blk > 5 ) ? _mm256_loadu_ps( a0 + 5*inca ) : zero_bv;
+					y6v = ( m_blk > 6 ) ? _mm256_loadu_ps( a0 + 6*inca ) : zero_bv;
+					y7v = ( m_blk > 7 ) ? _mm256_loadu_ps( a0 + 7*inca ) : zero_bv;
+
+					u0v = _mm256_unpacklo_ps( y0v, y1v );
+					u1v = _mm256_unpackhi_ps( y0v, y1v );
+					u2v = _mm256_unpacklo_ps( y2v, y3v );
+					u3v = _mm256_unpackhi_ps( y2v, y3v );
+					u4v = _mm256_unpacklo_ps( y4v, y5v );
+					u5v = _mm256_unpackhi_ps( y4v, y5v );
+					u6v = _mm256_unpacklo_ps( y6v, y7v );
+					u7v = _mm256_unpackhi_ps( y6v, y7v );
+
+					y0v = _mm256_shuffle_ps( u0v, u2v, 0x44 );
+					y1v = _mm256_shuffle_ps( u0v, u2v, 0xEE );
+					y2v = _mm256_shuffle_ps( u1v, u3v, 0x44 );
+					y3v = _mm256_shuffle_ps( u1v, u3v, 0xEE );
+					y4v = _mm256_shuffle_ps( u4v, u6v, 0x44 );
+					y5v = _mm256_shuffle_ps( u4v, u6v, 0xEE );
+					y6v = _mm256_shuffle_ps( u5v, u7v, 0x44 );
+					y7v = _mm256_shuffle_ps( u5v, u7v, 0xEE );
+
+					u0v = _mm256_permute2f128_ps( y0v, y4v, 0x20 );
+					u1v = _mm256_permute2f128_ps( y1v, y5v, 0x20 );
+					u2v = _mm256_permute2f128_ps( y2v, y6v, 0x20 );
+					u3v = _mm256_permute2f128_ps( y3v, y7v, 0x20 );
+					u4v = _mm256_permute2f128_ps( y0v, y4v, 0x31 );
+					u5v = _mm256_permute2f128_ps( y1v, y5v, 0x31 );
+					u6v = _mm256_permute2f128_ps( y2v, y6v, 0x31 );
+					u7v = _mm256_permute2f128_ps( y3v, y7v, 0x31 );
+
+					if ( !is_kappa1 )
+					{
+						u0v = _mm256_mul_ps( kappa_bv, u0v );
+						u1v = _mm256_mul_ps( kappa_bv, u1v );
+						u2v = _mm256_mul_ps( kappa_bv, u2v );
+						u3v = _mm256_mul_ps( kappa_bv, u3v );
+						u4v = _mm256_mul_ps( kappa_bv, u4v );
+						u5v = _mm256_mul_ps( kappa_bv, u5v );
+						u6v = _mm256_mul_ps( kappa_bv, u6v );
+						u7v = _mm256_mul_ps( kappa_bv, u7v );
+					}
+
+					if ( m_blk == n_elem_per_blk )
+					{
+						_mm256_storeu_ps( p0 + 0*ldp, u0v );
+						_mm256_storeu_ps( p0 + 1*ldp, u1v );
+						_mm256_storeu_ps( p0 + 2*ldp, u2v );
+						_mm256_storeu_ps( p0 + 3*ldp, u3v );
+						_mm256_storeu_ps( p0 + 4*ldp, u4v );
+						_mm256_storeu_ps( p0 + 5*ldp, u5v );
+						_mm256_storeu_ps( p0 + 6*ldp, u6v );
+						_mm256_storeu_ps( p0 + 7*ldp, u7v );
+					}
+					else
+					{
+						_mm256_mask_storeu_ps( p0 + 0*ldp, mask_b, u0v );
+						_mm256_mask_storeu_ps( p0 + 1*ldp, mask_b, u1v );
+						_mm256_mask_storeu_ps( p0 + 2*ldp, mask_b, u2v );
+						_mm256_mask_storeu_ps( p0 + 3*ldp, mask_b, u3v );
+						_mm256_mask_storeu_ps( p0 + 4*ldp, mask_b, u4v );
+						_mm256_mask_storeu_ps( p0 + 5*ldp, mask_b, u5v );
+						_mm256_mask_storeu_ps( p0 + 6*ldp, mask_b, u6v );
+						_mm256_mask_storeu_ps( p0 + 7*ldp, mask_b, u7v );
+					}
+				}
+			}
+		}
+
+		// Issue vzeroupper instruction to clear upper lanes of the vector
+		// registers before any scalar (and possibly SSE) code that follows.
+		_mm256_zeroupper();
+
+		// Pack any remaining columns, as well as general-stride cases, with
+		// scalar code.
+		for ( ; k < n; ++k )
+		{
+			float*  restrict a0 = a_cast + k*lda;
+			float*  restrict p0 = p_cast + k*ldp;
+
+			if ( is_kappa1 )
+			{
+				for ( i = 0; i < mnr; ++i )
+					bli_sscopys( *(a0 + i*inca), *(p0 + i) );
+			}
+			else
+			{
+				for ( i = 0; i < mnr; ++i )
+					bli_sscal2s( *kappa_cast, *(a0 + i*inca), *(p0 + i) );
+			}
+		}
+	}
+	else /* if ( cdim < mnr ) */
+	{
+		bli_sscal2m_ex
+		(
+		  0,
+		  BLIS_NONUNIT_DIAG,
+		  BLIS_DENSE,
+		  ( trans_t )conja,
+		  cdim,
+		  n,
+		  kappa,
+		  a, inca, lda,
+		  p,    1, ldp,
+		  cntx,
+		  NULL
+		);
+
+		bli_sset0s_mxn
+		(
+		  mnr - cdim,
+		  n_max,
+		  p_cast + cdim, 1, ldp
+		);
+	}
+
+	// Zero-fill the columns of the micropanel beyond n.
+	for ( k = n; k < n_max; ++k )
+	{
+		float*  restrict p0 = p_cast + k*ldp;
+
+		for ( i = 0; i < m_viter; ++i )
+			_mm512_storeu_ps( p0 + i*n_elem_per_reg, zerov );
+
+		if ( m_left > 0 )
+			_mm512_mask_storeu_ps( p0 + i*n_elem_per_reg, mask, zerov );
+	}
+
+	_mm256_zeroupper();
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_spackm_skx_int_12xk
+     (
+       conj_t           conja,
+       pack_t           schema,
+       dim_t            cdim,
+       dim_t            n,
+       dim_t            n_max,
+       void*   restrict kappa,
+       void*   restrict a, inc_t inca, inc_t lda,
+       void*   restrict p,             inc_t ldp,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      mnr            = 12;
+	const dim_t      n_elem_per_reg = 16;
+
+	// The number of full vectors needed to span a column of the micropanel
+	// and the number of elements left over. The latter are loaded and
+	// stored under an opmask.
+	const dim_t      m_viter        = mnr / n_elem_per_reg;
+	const dim_t      m_left         = mnr % n_elem_per_reg;
+
+	float*  restrict kappa_cast     = kappa;
+	float*  restrict a_cast         = a;
+	float*  restrict p_cast         = p;
+
+	const bool       is_kappa1      = bli_seq1( *kappa_cast );
+
+	const __m512     kappav         = _mm512_set1_ps( *kappa_cast );
+	const __m512     zerov          = _mm512_setzero_ps();
+	const __mmask16  mask           = ( __mmask16 )( ( 1 << m_left ) - 1 );
+
+	// When packing from a transposed source, the micropanel is processed in
+	// blocks of eight rows held in ymm registers.
+	const dim_t      n_elem_per_blk = 8;
+	const dim_t      m_left_b       = mnr % n_elem_per_blk;
+
+	const __m256     kappa_bv       = _mm256_broadcast_ss( kappa_cast );
+	const __m256     zero_bv        = _mm256_setzero_ps();
+	const __mmask8   mask_b         = ( __mmask8 )( ( 1 << m_left_b ) - 1 );
+
+	dim_t            i, k;
+
+	__m512           x0v;
+	__m256           y0v, y1v, y2v, y3v, y4v, y5v, y6v, y7v;
+	__m256           u0v, u1v, u2v, u3v, u4v, u5v, u6v, u7v;
+
+	if ( cdim == mnr )
+	{
+		k = 0;
+
+		if ( inca == 1 )
+		{
+			// Each column of the micropanel is contiguous in A, so we can
+			// copy it with vector loads and stores.
+			for ( ; k < n; ++k )
+			{
+				float*  restrict a0 = a_cast + k*lda;
+				float*  restrict p0 = p_cast + k*ldp;
+
+				for ( i = 0; i < m_viter; ++i )
+				{
+					x0v = _mm512_loadu_ps( a0 + i*n_elem_per_reg );
+					if ( !is_kappa1 ) x0v = _mm512_mul_ps( kappav, x0v );
+					_mm512_storeu_ps( p0 + i*n_elem_per_reg, x0v );
+				}
+
+				if ( m_left > 0 )
+				{
+					x0v = _mm512_maskz_loadu_ps( mask, a0 + i*n_elem_per_reg );
+					if ( !is_kappa1 ) x0v = _mm512_mul_ps( kappav, x0v );
+					_mm512_mask_storeu_ps( p0 + i*n_elem_per_reg, mask, x0v );
+				}
+			}
+		}
+		else if ( lda == 1 )
+		{
+			// Each row of the micropanel is contiguous in A (ie: we are
+			// packing from a transposed or row-stored matrix), so we load
+			// 8x8 blocks along the rows and transpose them in ymm registers.
+			// Rows beyond the micropanel are treated as zero.
+			for ( ; k + 8 <= n; k += 8 )
+			{
+				for ( i = 0; i < mnr; i += n_elem_per_blk )
+				{
+					const dim_t      m_blk = bli_min( mnr - i, n_elem_per_blk );
+					float*  restrict a0    = a_cast + i*inca + k;
+					float*  restrict p0    = p_cast + i    + k*ldp;
+
+					y0v =                 _mm256_loadu_ps( a0 + 0*inca );
+					y1v = ( m_blk > 1 ) ? _mm256_loadu_ps( a0 + 1*inca ) : zero_bv;
+					y2v = ( m_blk > 2 ) ? _mm256_loadu_ps( a0 + 2*inca ) : zero_bv;
+					y3v = ( m_blk > 3 ) ? _mm256_loadu_ps( a0 + 3*inca ) : zero_bv;
+					y4v = ( m_blk > 4 ) ? _mm256_loadu_ps( a0 + 4*inca ) : zero_bv;
+					y5v = ( m_blk > 5 ) ? _mm256_loadu_ps( a0 + 5*inca ) : zero_bv;
+					y6v = ( m_blk > 6 ) ? _mm256_loadu_ps( a0 + 6*inca ) : zero_bv;
+					y7v = ( m_blk > 7 ) ? _mm256_loadu_ps( a0 + 7*inca ) : zero_bv;
+
+					u0v = _mm256_unpacklo_ps( y0v, y1v );
+					u1v = _mm256_unpackhi_ps( y0v, y1v );
+					u2v = _mm256_unpacklo_ps( y2v, y3v );
+					u3v = _mm256_unpackhi_ps( y2v, y3v );
+					u4v = _mm256_unpacklo_ps( y4v, y5v );
+					u5v = _mm256_unpackhi_ps( y4v, y5v );
+					u6v = _mm256_unpacklo_ps( y6v, y7v );
+					u7v = _mm256_unpackhi_ps( y6v, y7v );
+
+					y0v = _mm256_shuffle_ps( u0v, u2v, 0x44 );
+					y1v = _mm256_shuffle_ps( u0v, u2v, 0xEE );
+					y2v = _mm256_shuffle_ps( u1v, u3v, 0x44 );
+					y3v = _mm256_shuffle_ps( u1v, u3v, 0xEE );
+					y4v = _mm256_shuffle_ps( u4v, u6v, 0x44 );
+					y5v = _mm256_shuffle_ps( u4v, u6v, 0xEE );
+					y6v = _mm256_shuffle_ps( u5v, u7v, 0x44 );
+					y7v = _mm256_shuffle_ps( u5v, u7v, 0xEE );
+
+					u0v = _mm256_permute2f128_ps( y0v, y4v, 0x20 );
+					u1v = _mm256_permute2f128_ps( y1v, y5v, 0x20 );
+					u2v = _mm256_permute2f128_ps( y2v, y6v, 0x20 );
+					u3v = _mm256_permute2f128_ps( y3v, y7v, 0x20 );
+					u4v = _mm256_permute2f128_ps( y0v, y4v, 0x31 );
+					u5v = _mm256_permute2f128_ps( y1v, y5v, 0x31 );
+					u6v = _mm256_permute2f128_ps( y2v, y6v, 0x31 );
+					u7v = _mm256_permute2f128_ps( y3v, y7v, 0x31 );
+
+					if ( !is_kappa1 )
+					{
+						u0v = _mm256_mul_ps( kappa_bv, u0v );
+						u1v = _mm256_mul_ps( kappa_bv, u1v );
+						u2v = _mm256_mul_ps( kappa_bv, u2v );
+						u3v = _mm256_mul_ps( kappa_bv, u3v );
+						u4v = _mm256_mul_ps( kappa_bv, u4v );
+						u5v = _mm256_mul_ps( kappa_bv, u5v );
+						u6v = _mm256_mul_ps( kappa_bv, u6v );
+						u7v = _mm256_mul_ps( kappa_bv, u7v );
+					}
+
+					if ( m_blk == n_elem_per_blk )
+					{
+						_mm256_storeu_ps( p0 + 0*ldp, u0v );
+						_mm256_storeu_ps( p0 + 1*ldp, u1v );
+						_mm256_storeu_ps( p0 + 2*ldp, u2v );
+						_mm256_storeu_ps( p0 + 3*ldp, u3v );
+						_mm256_storeu_ps( p0 + 4*ldp, u4v );
+						_mm256_storeu_ps( p0 + 5*ldp, u5v );
+						_mm256_storeu_ps( p0 + 6*ldp, u6v );
+						_mm256_storeu_ps( p0 + 7*ldp, u7v );
+					}
+					else
+					{
+						_mm256_mask_storeu_ps( p0 + 0*ldp, mask_b, u0v );
+						_mm256_mask_storeu_ps( p0 + 1*ldp, mask_b, u1v );
+						_mm256_mask_storeu_ps( p0 + 2*ldp, mask_b, u2v );
+						_mm256_mask_storeu_ps( p0 + 3*ldp, mask_b, u3v );
+						_mm256_mask_storeu_ps( p0 + 4*ldp, mask_b, u4v );
+						_mm256_mask_storeu_ps( p0 + 5*ldp, mask_b, u5v );
+						_mm256_mask_storeu_ps( p0 + 6*ldp, mask_b, u6v );
+						_mm256_mask_storeu_ps( p0 + 7*ldp, mask_b, u7v );
+					}
+				}
+			}
+		}
+
+		// Issue vzeroupper instruction to clear upper lanes of the vector
+		// registers before any scalar (and possibly SSE) code that follows.
+		_mm256_zeroupper();
+
+		// Pack any remaining columns, as well as general-stride cases, with
+		// scalar code.
+		for ( ; k < n; ++k )
+		{
+			float*  restrict a0 = a_cast + k*lda;
+			float*  restrict p0 = p_cast + k*ldp;
+
+			if ( is_kappa1 )
+			{
+				for ( i = 0; i < mnr; ++i )
+					bli_sscopys( *(a0 + i*inca), *(p0 + i) );
+			}
+			else
+			{
+				for ( i = 0; i < mnr; ++i )
+					bli_sscal2s( *kappa_cast, *(a0 + i*inca), *(p0 + i) );
+			}
+		}
+	}
+	else /* if ( cdim < mnr ) */
+	{
+		bli_sscal2m_ex
+		(
+		  0,
+		  BLIS_NONUNIT_DIAG,
+		  BLIS_DENSE,
+		  ( trans_t )conja,
+		  cdim,
+		  n,
+		  kappa,
+		  a, inca, lda,
+		  p,    1, ldp,
+		  cntx,
+		  NULL
+		);
+
+		bli_sset0s_mxn
+		(
+		  mnr - cdim,
+		  n_max,
+		  p_cast + cdim, 1, ldp
+		);
+	}
+
+	// Zero-fill the columns of the micropanel beyond n.
+	for ( k = n; k < n_max; ++k )
+	{
+		float*  restrict p0 = p_cast + k*ldp;
+
+		for ( i = 0; i < m_viter; ++i )
+			_mm512_storeu_ps( p0 + i*n_elem_per_reg, zerov );
+
+		if ( m_left > 0 )
+			_mm512_mask_storeu_ps( p0 + i*n_elem_per_reg, mask, zerov );
+	}
+
+	_mm256_zeroupper();
+}
@@ -0,0 +1,211 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   The kernel computes a 6x16 microtile of C, where each row of the microtile
+   is held in two zmm registers (eight scomplex elements each). For each
+   iteration of the k loop, one row of B is loaded and the real and
+   imaginary parts of each element of the current column of A are broadcast
+   and multiplied against it, accumulating into separate sets of registers:
+
+     abr(i,:) += real( a(i,p) ) * b(p,:)
+     abi(i,:) += imag( a(i,p) ) * b(p,:)
+
+   The complex product is then formed once, after the k loop, by swapping
+   the real and imaginary parts within abi and combining it with abr via
+   fmaddsub. This keeps the inner loop free of any permutations.
+*/
+
+// Multiply each scomplex element of v by the complex scalar whose real and
+// imaginary parts are broadcast in sr and si, respectively.
+#define CGEMM_SKX_CMUL( v, sr, si ) \
+	_mm512_fmaddsub_ps( v, sr, _mm512_mul_ps( _mm512_permute_ps( v, 0xB1 ), si ) )
+
+// Combine the accumulators for one row segment into complex products.
+#define CGEMM_SKX_REDUCE( abr, abi ) \
+	_mm512_fmaddsub_ps( abr, onev, _mm512_permute_ps( abi, 0xB1 ) )
+
+#define CGEMM_SKX_ROW_UPDATE( i ) \
+	{ \
+		const __m512 arv = _mm512_set1_ps( ap[ 2*i + 0 ] ); \
+		const __m512 aiv = _mm512_set1_ps( ap[ 2*i + 1 ] ); \
+\
+		abr ## i ## 0 = _mm512_fmadd_ps( arv, b0v, abr ## i ## 0 ); \
+		abr ## i ## 1 = _mm512_fmadd_ps( arv, b1v, abr ## i ## 1 ); \
+		abi ## i ## 0 = _mm512_fmadd_ps( aiv, b0v, abi ## i ## 0 ); \
+		abi ## i ## 1 = _mm512_fmadd_ps( aiv, b1v, abi ## i ## 1 ); \
+	}
+
+#define CGEMM_SKX_ITER \
+	{ \
+		const __m512 b0v = _mm512_loadu_ps( bp + 0 ); \
+		const __m512 b1v = _mm512_loadu_ps( bp + 16 ); \
+\
+		CGEMM_SKX_ROW_UPDATE( 0 ) \
+		CGEMM_SKX_ROW_UPDATE( 1 ) \
+		CGEMM_SKX_ROW_UPDATE( 2 ) \
+		CGEMM_SKX_ROW_UPDATE( 3 ) \
+		CGEMM_SKX_ROW_UPDATE( 4 ) \
+		CGEMM_SKX_ROW_UPDATE( 5 ) \
+\
+		ap += 2 * 6; \
+		bp += 2 * 16; \
+	}
+
+// Scale row i of the product by alpha and write it to row i of ct, which
+// has unit column stride, scaling the existing contents by beta unless bz
+// (beta is zero) is TRUE.
+#define CGEMM_SKX_ROW_STORE( i, ct, rs_ct, bz ) \
+	{ \
+		__m512 ab0v = CGEMM_SKX_REDUCE( abr ## i ## 0, abi ## i ## 0 ); \
+		__m512 ab1v = CGEMM_SKX_REDUCE( abr ## i ## 1, abi ## i ## 1 ); \
+\
+		ab0v = CGEMM_SKX_CMUL( ab0v, alpharv, alphaiv ); \
+		ab1v = CGEMM_SKX_CMUL( ab1v, alpharv, alphaiv ); \
+\
+		float* restrict cti = ( float* )( ct + i*rs_ct ); \
+\
+		if ( !bz ) \
+		{ \
+			const __m512 c0v = _mm512_loadu_ps( cti + 0 ); \
+			const __m512 c1v = _mm512_loadu_ps( cti + 16 ); \
+\
+			ab0v = _mm512_add_ps( ab0v, CGEMM_SKX_CMUL( c0v, betarv, betaiv ) ); \
+			ab1v = _mm512_add_ps( ab1v, CGEMM_SKX_CMUL( c1v, betarv, betaiv ) ); \
+		} \
+\
+		_mm512_storeu_ps( cti + 0, ab0v ); \
+		_mm512_storeu_ps( cti + 16, ab1v ); \
+	}
+
+void bli_cgemm_skx_int_6x16
+     (
+       dim_t               k,
+       scomplex*  restrict alpha,
+       scomplex*  restrict a,
+       scomplex*  restrict b,
+       scomplex*  restrict beta,
+       scomplex*  restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const dim_t mr = 6;
+	const dim_t nr = 16;
+
+	const float* restrict ap = ( float* )a;
+	const float* restrict bp = ( float* )b;
+
+	__m512 abr00 = _mm512_setzero_ps(), abr01 = _mm512_setzero_ps();
+	__m512 abr10 = _mm512_setzero_ps(), abr11 = _mm512_setzero_ps();
+	__m512 abr20 = _mm512_setzero_ps(), abr21 = _mm512_setzero_ps();
+	__m512 abr30 = _mm512_setzero_ps(), abr31 = _mm512_setzero_ps();
+	__m512 abr40 = _mm512_setzero_ps(), abr41 = _mm512_setzero_ps();
+	__m512 abr50 = _mm512_setzero_ps(), abr51 = _mm512_setzero_ps();
+
+	__m512 abi00 = _mm512_setzero_ps(), abi01 = _mm512_setzero_ps();
+	__m512 abi10 = _mm512_setzero_ps(), abi11 = _mm512_setzero_ps();
+	__m512 abi20 = _mm512_setzero_ps(), abi21 = _mm512_setzero_ps();
+	__m512 abi30 = _mm512_setzero_ps(), abi31 = _mm512_setzero_ps();
+	__m512 abi40 = _mm512_setzero_ps(), abi41 = _mm512_setzero_ps();
+	__m512 abi50 = _mm512_setzero_ps(), abi51 = _mm512_setzero_ps();
+
+	// Prefetch the rows of C, assuming row storage.
+	for ( dim_t i = 0; i < mr; ++i )
+		_mm_prefetch( ( char* )( c + i*rs_c ), _MM_HINT_T0 );
+
+	const dim_t k_iter = k / 4;
+	const dim_t k_left = k % 4;
+
+	for ( dim_t p = 0; p < k_iter; ++p )
+	{
+		CGEMM_SKX_ITER
+		CGEMM_SKX_ITER
+		CGEMM_SKX_ITER
+		CGEMM_SKX_ITER
+	}
+
+	for ( dim_t p = 0; p < k_left; ++p )
+	{
+		CGEMM_SKX_ITER
+	}
+
+	const __m512 onev         = _mm512_set1_ps( 1.0 );
+	const __m512 alpharv      = _mm512_set1_ps( bli_creal( *alpha ) );
+	const __m512 alphaiv      = _mm512_set1_ps( bli_cimag( *alpha ) );
+	const __m512 betarv       = _mm512_set1_ps( bli_creal( *beta ) );
+	const __m512 betaiv       = _mm512_set1_ps( bli_cimag( *beta ) );
+	const bool   beta_is_zero = bli_ceq0( *beta );
+
+	if ( cs_c == 1 )
+	{
+		// C is row-stored, so we can update it in place.
+		CGEMM_SKX_ROW_STORE( 0, c, rs_c, beta_is_zero )
+		CGEMM_SKX_ROW_STORE( 1, c, rs_c, beta_is_zero )
+		CGEMM_SKX_ROW_STORE( 2, c, rs_c, beta_is_zero )
+		CGEMM_SKX_ROW_STORE( 3, c, rs_c, beta_is_zero )
+		CGEMM_SKX_ROW_STORE( 4, c, rs_c, beta_is_zero )
+		CGEMM_SKX_ROW_STORE( 5, c, rs_c, beta_is_zero )
+	}
+	else
+	{
+		// Otherwise, compute alpha * A * B into a local row-stored buffer
+		// and then accumulate it into C element by element.
+		scomplex    ct[ 6 * 16 ] __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE)));
+		const inc_t rs_ct = nr;
+
+		CGEMM_SKX_ROW_STORE( 0, ct, rs_ct, TRUE )
+		CGEMM_SKX_ROW_STORE( 1, ct, rs_ct, TRUE )
+		CGEMM_SKX_ROW_STORE( 2, ct, rs_ct, TRUE )
+		CGEMM_SKX_ROW_STORE( 3, ct, rs_ct, TRUE )
+		CGEMM_SKX_ROW_STORE( 4, ct, rs_ct, TRUE )
+		CGEMM_SKX_ROW_STORE( 5, ct, rs_ct, TRUE )
+
+		if ( beta_is_zero )
+		{
+			for ( dim_t j = 0; j < nr; ++j )
+			for ( dim_t i = 0; i < mr; ++i )
+				bli_ccopys( ct[ i*rs_ct + j ], c[ i*rs_c + j*cs_c ] );
+		}
+		else
+		{
+			for ( dim_t j = 0; j < nr; ++j )
+			for ( dim_t i = 0; i < mr; ++i )
+				bli_cxpbys( ct[ i*rs_ct + j ], *beta, c[ i*rs_c + j*cs_c ] );
+		}
+	}
+}
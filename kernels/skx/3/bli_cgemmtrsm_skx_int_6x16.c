@@ -0,0 +1,233 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// Multiply each scomplex element of v by the complex scalar whose real and
+// imaginary parts are broadcast in sr and si, respectively.
+#define CTRSM_SKX_CMUL( v, sr, si ) \
+	_mm512_fmaddsub_ps( v, sr, _mm512_mul_ps( _mm512_permute_ps( v, 0xB1 ), si ) )
+
+// Subtract alpha * x from the scomplex elements of y, where alpha is the
+// scalar pointed to by alphap.
+#define CTRSM_SKX_CNEGAXPY( alphap, x, y ) \
+	{ \
+		const __m512 arv = _mm512_set1_ps( bli_creal( *(alphap) ) ); \
+		const __m512 aiv = _mm512_set1_ps( bli_cimag( *(alphap) ) ); \
+\
+		y = _mm512_sub_ps( y, CTRSM_SKX_CMUL( x, arv, aiv ) ); \
+	}
+
+// Scale x by the (inverted) diagonal element pointed to by alphap.
+#define CTRSM_SKX_CSCAL( alphap, x ) \
+	{ \
+		const __m512 arv = _mm512_set1_ps( bli_creal( *(alphap) ) ); \
+		const __m512 aiv = _mm512_set1_ps( bli_cimag( *(alphap) ) ); \
+\
+		x = CTRSM_SKX_CMUL( x, arv, aiv ); \
+	}
+
+// Write row i of the solution, held in x0v and x1v, to b11 and c11.
+BLIS_INLINE void bli_ctrsm_skx_int_6x16_store_row
+     (
+       const dim_t        i,
+       const __m512       x0v,
+       const __m512       x1v,
+       scomplex* restrict b, const inc_t rs_b,
+       scomplex* restrict c, const inc_t rs_c, const inc_t cs_c
+     )
+{
+	float* restrict bi = ( float* )( b + i*rs_b );
+
+	_mm512_storeu_ps( bi + 0, x0v );
+	_mm512_storeu_ps( bi + 16, x1v );
+
+	if ( cs_c == 1 )
+	{
+		float* restrict ci = ( float* )( c + i*rs_c );
+
+		_mm512_storeu_ps( ci + 0, x0v );
+		_mm512_storeu_ps( ci + 16, x1v );
+	}
+	else
+	{
+		scomplex* restrict bc = b + i*rs_b;
+		scomplex* restrict ci = c + i*rs_c;
+
+		for ( dim_t j = 0; j < 16; ++j )
+			bli_ccopys( bc[ j ], ci[ j*cs_c ] );
+	}
+}
+
+// The gemmtrsm kernels below first compute b11 = alpha * b11 - a1x * bx1
+// with the 6x16 gemm micro-kernel (which updates b11 in place since it is
+// row-stored with unit column stride), and then solve the 6x16 triangular
+// system with a11 with the rows of b11 held in zmm registers. As with the
+// reference trsm micro-kernels, the diagonal of a11 is assumed to hold the
+// inverses of the diagonal elements of the triangular matrix.
+
+void bli_cgemmtrsm_l_skx_int_6x16
+     (
+       dim_t               k,
+       scomplex*  restrict alpha,
+       scomplex*  restrict a10,
+       scomplex*  restrict a11,
+       scomplex*  restrict b01,
+       scomplex*  restrict b11,
+       scomplex*  restrict c11, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const inc_t packmr = bli_cntx_get_blksz_max_dt( BLIS_SCOMPLEX, BLIS_MR, cntx );
+	const inc_t packnr = bli_cntx_get_blksz_max_dt( BLIS_SCOMPLEX, BLIS_NR, cntx );
+
+	const inc_t rs_a   = 1;
+	const inc_t cs_a   = packmr;
+
+	const inc_t rs_b   = packnr;
+
+	// b11 = alpha * b11 - a10 * b01;
+	bli_cgemm_skx_int_6x16
+	(
+	  k,
+	  bli_cm1,
+	  a10,
+	  b01,
+	  alpha,
+	  b11, rs_b, 1,
+	  data,
+	  cntx
+	);
+
+	// b11 = inv(a11) * b11;
+	// c11 = b11;
+	__m512 x0v[ 6 ], x1v[ 6 ];
+
+	for ( dim_t i = 0; i < 6; ++i )
+	{
+		float* restrict bi = ( float* )( b11 + i*rs_b );
+
+		x0v[ i ] = _mm512_loadu_ps( bi + 0 );
+		x1v[ i ] = _mm512_loadu_ps( bi + 16 );
+
+		for ( dim_t l = 0; l < i; ++l )
+		{
+			scomplex* restrict alpha10 = a11 + i*rs_a + l*cs_a;
+
+			CTRSM_SKX_CNEGAXPY( alpha10, x0v[ l ], x0v[ i ] )
+			CTRSM_SKX_CNEGAXPY( alpha10, x1v[ l ], x1v[ i ] )
+		}
+
+		scomplex* restrict alpha11 = a11 + i*rs_a + i*cs_a;
+
+		CTRSM_SKX_CSCAL( alpha11, x0v[ i ] )
+		CTRSM_SKX_CSCAL( alpha11, x1v[ i ] )
+
+		bli_ctrsm_skx_int_6x16_store_row
+		(
+		  i, x0v[ i ], x1v[ i ],
+		  b11, rs_b,
+		  c11, rs_c, cs_c
+		);
+	}
+}
+
+void bli_cgemmtrsm_u_skx_int_6x16
+     (
+       dim_t               k,
+       scomplex*  restrict alpha,
+       scomplex*  restrict a12,
+       scomplex*  restrict a11,
+       scomplex*  restrict b21,
+       scomplex*  restrict b11,
+       scomplex*  restrict c11, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const inc_t packmr = bli_cntx_get_blksz_max_dt( BLIS_SCOMPLEX, BLIS_MR, cntx );
+	const inc_t packnr = bli_cntx_get_blksz_max_dt( BLIS_SCOMPLEX, BLIS_NR, cntx );
+
+	const inc_t rs_a   = 1;
+	const inc_t cs_a   = packmr;
+
+	const inc_t rs_b   = packnr;
+
+	// b11 = alpha * b11 - a12 * b21;
+	bli_cgemm_skx_int_6x16
+	(
+	  k,
+	  bli_cm1,
+	  a12,
+	  b21,
+	  alpha,
+	  b11, rs_b, 1,
+	  data,
+	  cntx
+	);
+
+	// b11 = inv(a11) * b11;
+	// c11 = b11;
+	__m512 x0v[ 6 ], x1v[ 6 ];
+
+	for ( dim_t i = 5; i >= 0; --i )
+	{
+		float* restrict bi = ( float* )( b11 + i*rs_b );
+
+		x0v[ i ] = _mm512_loadu_ps( bi + 0 );
+		x1v[ i ] = _mm512_loadu_ps( bi + 16 );
+
+		for ( dim_t l = i + 1; l < 6; ++l )
+		{
+			scomplex* restrict alpha12 = a11 + i*rs_a + l*cs_a;
+
+			CTRSM_SKX_CNEGAXPY( alpha12, x0v[ l ], x0v[ i ] )
+			CTRSM_SKX_CNEGAXPY( alpha12, x1v[ l ], x1v[ i ] )
+		}
+
+		scomplex* restrict alpha11 = a11 + i*rs_a + i*cs_a;
+
+		CTRSM_SKX_CSCAL( alpha11, x0v[ i ] )
+		CTRSM_SKX_CSCAL( alpha11, x1v[ i ] )
+
+		bli_ctrsm_skx_int_6x16_store_row
+		(
+		  i, x0v[ i ], x1v[ i ],
+		  b11, rs_b,
+		  c11, rs_c, cs_c
+		);
+	}
+}
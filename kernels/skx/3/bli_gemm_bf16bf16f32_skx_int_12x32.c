@@ -0,0 +1,208 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+#ifdef BLIS_ENABLE_SKX_LPGEMM_KERS
+
+/*
+   The kernel computes a 12x32 microtile of C from micro-panels of A and B
+   that were packed in pairs along the k dimension (KR = 2), using the
+   avx512_bf16 dot-product instruction. For each pair, vdpbf16ps multiplies
+   the two bfloat16 elements of each 32-bit lane of its sources and adds
+   both products to the corresponding single-precision lane of the
+   accumulator:
+
+     ab(i,:) += a(i,2p+0) * b(2p+0,:) + a(i,2p+1) * b(2p+1,:)
+
+   Each row of the microtile is held in two zmm registers, and the pair of
+   elements from each row of A is broadcast as a single 32-bit value.
+*/
+
+#define BF16_SKX_ROW_UPDATE( i ) \
+	{ \
+		const __m512bh av = ( __m512bh )_mm512_set1_epi32( *( int32_t* )( ap + 2*i ) ); \
+\
+		ab ## i ## _0 = _mm512_dpbf16_ps( ab ## i ## _0, av, b0v ); \
+		ab ## i ## _1 = _mm512_dpbf16_ps( ab ## i ## _1, av, b1v ); \
+	}
+
+#define BF16_SKX_ITER \
+	{ \
+		const __m512bh b0v = ( __m512bh )_mm512_loadu_si512( bp + 0 ); \
+		const __m512bh b1v = ( __m512bh )_mm512_loadu_si512( bp + 32 ); \
+\
+		BF16_SKX_ROW_UPDATE( 0 ) \
+		BF16_SKX_ROW_UPDATE( 1 ) \
+		BF16_SKX_ROW_UPDATE( 2 ) \
+		BF16_SKX_ROW_UPDATE( 3 ) \
+		BF16_SKX_ROW_UPDATE( 4 ) \
+		BF16_SKX_ROW_UPDATE( 5 ) \
+		BF16_SKX_ROW_UPDATE( 6 ) \
+		BF16_SKX_ROW_UPDATE( 7 ) \
+		BF16_SKX_ROW_UPDATE( 8 ) \
+		BF16_SKX_ROW_UPDATE( 9 ) \
+		BF16_SKX_ROW_UPDATE( 10 ) \
+		BF16_SKX_ROW_UPDATE( 11 ) \
+\
+		ap += 2 * 12; \
+		bp += 2 * 32; \
+	}
+
+// Scale row i of the product by alpha and write it to row i of ct, which
+// has unit column stride, scaling the existing contents by beta unless bz
+// (beta is zero) is TRUE.
+#define BF16_SKX_ROW_STORE( i, ct, rs_ct, bz ) \
+	{ \
+		__m512 ab0v = _mm512_mul_ps( ab ## i ## _0, alphav ); \
+		__m512 ab1v = _mm512_mul_ps( ab ## i ## _1, alphav ); \
+\
+		float* restrict cti = ct + i*rs_ct; \
+\
+		if ( !bz ) \
+		{ \
+			ab0v = _mm512_fmadd_ps( _mm512_loadu_ps( cti + 0 ), betav, ab0v ); \
+			ab1v = _mm512_fmadd_ps( _mm512_loadu_ps( cti + 16 ), betav, ab1v ); \
+		} \
+\
+		_mm512_storeu_ps( cti + 0, ab0v ); \
+		_mm512_storeu_ps( cti + 16, ab1v ); \
+	}
+
+#define BF16_SKX_STORE( ct, rs_ct, bz ) \
+	{ \
+		BF16_SKX_ROW_STORE( 0, ct, rs_ct, bz ) \
+		BF16_SKX_ROW_STORE( 1, ct, rs_ct, bz ) \
+		BF16_SKX_ROW_STORE( 2, ct, rs_ct, bz ) \
+		BF16_SKX_ROW_STORE( 3, ct, rs_ct, bz ) \
+		BF16_SKX_ROW_STORE( 4, ct, rs_ct, bz ) \
+		BF16_SKX_ROW_STORE( 5, ct, rs_ct, bz ) \
+		BF16_SKX_ROW_STORE( 6, ct, rs_ct, bz ) \
+		BF16_SKX_ROW_STORE( 7, ct, rs_ct, bz ) \
+		BF16_SKX_ROW_STORE( 8, ct, rs_ct, bz ) \
+		BF16_SKX_ROW_STORE( 9, ct, rs_ct, bz ) \
+		BF16_SKX_ROW_STORE( 10, ct, rs_ct, bz ) \
+		BF16_SKX_ROW_STORE( 11, ct, rs_ct, bz ) \
+	}
+
+__attribute__((target("avx512bf16")))
+void bli_gemm_bf16bf16f32_skx_int_12x32
+     (
+       dim_t               k,
+       float*     restrict alpha,
+       bfloat16*  restrict a,
+       bfloat16*  restrict b,
+       float*     restrict beta,
+       float*     restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const dim_t mr = 12;
+	const dim_t nr = 32;
+
+	const bfloat16* restrict ap = a;
+	const bfloat16* restrict bp = b;
+
+	__m512 ab0_0  = _mm512_setzero_ps(), ab0_1  = _mm512_setzero_ps();
+	__m512 ab1_0  = _mm512_setzero_ps(), ab1_1  = _mm512_setzero_ps();
+	__m512 ab2_0  = _mm512_setzero_ps(), ab2_1  = _mm512_setzero_ps();
+	__m512 ab3_0  = _mm512_setzero_ps(), ab3_1  = _mm512_setzero_ps();
+	__m512 ab4_0  = _mm512_setzero_ps(), ab4_1  = _mm512_setzero_ps();
+	__m512 ab5_0  = _mm512_setzero_ps(), ab5_1  = _mm512_setzero_ps();
+	__m512 ab6_0  = _mm512_setzero_ps(), ab6_1  = _mm512_setzero_ps();
+	__m512 ab7_0  = _mm512_setzero_ps(), ab7_1  = _mm512_setzero_ps();
+	__m512 ab8_0  = _mm512_setzero_ps(), ab8_1  = _mm512_setzero_ps();
+	__m512 ab9_0  = _mm512_setzero_ps(), ab9_1  = _mm512_setzero_ps();
+	__m512 ab10_0 = _mm512_setzero_ps(), ab10_1 = _mm512_setzero_ps();
+	__m512 ab11_0 = _mm512_setzero_ps(), ab11_1 = _mm512_setzero_ps();
+
+	// Prefetch the rows of C, assuming row storage.
+	for ( dim_t i = 0; i < mr; ++i )
+		_mm_prefetch( ( char* )( c + i*rs_c ), _MM_HINT_T0 );
+
+	// The packed micro-panels are zero-padded to a multiple of KR.
+	const dim_t k_pairs = ( k + 1 ) / 2;
+	const dim_t k_iter  = k_pairs / 4;
+	const dim_t k_left  = k_pairs % 4;
+
+	for ( dim_t p = 0; p < k_iter; ++p )
+	{
+		BF16_SKX_ITER
+		BF16_SKX_ITER
+		BF16_SKX_ITER
+		BF16_SKX_ITER
+	}
+
+	for ( dim_t p = 0; p < k_left; ++p )
+	{
+		BF16_SKX_ITER
+	}
+
+	const __m512 alphav       = _mm512_set1_ps( *alpha );
+	const __m512 betav        = _mm512_set1_ps( *beta );
+	const bool   beta_is_zero = bli_seq0( *beta );
+
+	if ( cs_c == 1 )
+	{
+		// C is row-stored, so we can update it in place.
+		BF16_SKX_STORE( c, rs_c, beta_is_zero )
+	}
+	else
+	{
+		// Otherwise, compute alpha * A * B into a local row-stored buffer
+		// and then accumulate it into C element by element.
+		float       ct[ 12 * 32 ] __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE)));
+		const inc_t rs_ct = nr;
+
+		BF16_SKX_STORE( ct, rs_ct, TRUE )
+
+		if ( beta_is_zero )
+		{
+			for ( dim_t j = 0; j < nr; ++j )
+			for ( dim_t i = 0; i < mr; ++i )
+				c[ i*rs_c + j*cs_c ] = ct[ i*rs_ct + j ];
+		}
+		else
+		{
+			for ( dim_t j = 0; j < nr; ++j )
+			for ( dim_t i = 0; i < mr; ++i )
+				c[ i*rs_c + j*cs_c ] = *beta * c[ i*rs_c + j*cs_c ] +
+				                       ct[ i*rs_ct + j ];
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,219 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+#ifdef BLIS_ENABLE_SKX_LPGEMM_KERS
+
+/*
+   The kernel computes a 12x32 microtile of C from micro-panels of A and B
+   that were packed in groups of four along the k dimension (KR = 4), using
+   the avx512_vnni dot-product instruction. For each group, vpdpbusd
+   multiplies the four unsigned bytes of each 32-bit lane of A by the four
+   signed bytes of the corresponding lane of B and adds the sum of the
+   products to the int32 lane of the accumulator without saturation:
+
+     ab(i,:) += a(i,4p+0) * b(4p+0,:) + ... + a(i,4p+3) * b(4p+3,:)
+
+   Each row of the microtile is held in two zmm registers, and the group of
+   elements from each row of A is broadcast as a single 32-bit value.
+*/
+
+#define U8S8_SKX_ROW_UPDATE( i ) \
+	{ \
+		const __m512i av = _mm512_set1_epi32( *( int32_t* )( ap + 4*i ) ); \
+\
+		ab ## i ## _0 = _mm512_dpbusd_epi32( ab ## i ## _0, av, b0v ); \
+		ab ## i ## _1 = _mm512_dpbusd_epi32( ab ## i ## _1, av, b1v ); \
+	}
+
+#define U8S8_SKX_ITER \
+	{ \
+		const __m512i b0v = _mm512_loadu_si512( bp + 0 ); \
+		const __m512i b1v = _mm512_loadu_si512( bp + 64 ); \
+\
+		U8S8_SKX_ROW_UPDATE( 0 ) \
+		U8S8_SKX_ROW_UPDATE( 1 ) \
+		U8S8_SKX_ROW_UPDATE( 2 ) \
+		U8S8_SKX_ROW_UPDATE( 3 ) \
+		U8S8_SKX_ROW_UPDATE( 4 ) \
+		U8S8_SKX_ROW_UPDATE( 5 ) \
+		U8S8_SKX_ROW_UPDATE( 6 ) \
+		U8S8_SKX_ROW_UPDATE( 7 ) \
+		U8S8_SKX_ROW_UPDATE( 8 ) \
+		U8S8_SKX_ROW_UPDATE( 9 ) \
+		U8S8_SKX_ROW_UPDATE( 10 ) \
+		U8S8_SKX_ROW_UPDATE( 11 ) \
+\
+		ap += 4 * 12; \
+		bp += 4 * 32; \
+	}
+
+// Update one vector of sixteen elements of C at cp with the product abv.
+// The update is exact when alpha is one and beta is zero or one; otherwise,
+// it is computed in single precision and rounded to the nearest integer.
+#define U8S8_SKX_VEC_STORE( abv, cp ) \
+	{ \
+		__m512i rv; \
+\
+		if      ( alpha_is_one && beta_is_zero ) \
+			rv = abv; \
+		else if ( alpha_is_one && beta_is_one ) \
+			rv = _mm512_add_epi32( abv, _mm512_loadu_si512( cp ) ); \
+		else \
+		{ \
+			__m512 fv = _mm512_mul_ps( _mm512_cvtepi32_ps( abv ), alphav ); \
+\
+			if ( !beta_is_zero ) \
+				fv = _mm512_fmadd_ps( _mm512_cvtepi32_ps( _mm512_loadu_si512( cp ) ), \
+				                      betav, fv ); \
+\
+			rv = _mm512_cvtps_epi32( fv ); \
+		} \
+\
+		_mm512_storeu_si512( cp, rv ); \
+	}
+
+#define U8S8_SKX_ROW_STORE( i, ct, rs_ct ) \
+	{ \
+		U8S8_SKX_VEC_STORE( ab ## i ## _0, ct + i*rs_ct + 0 ) \
+		U8S8_SKX_VEC_STORE( ab ## i ## _1, ct + i*rs_ct + 16 ) \
+	}
+
+#define U8S8_SKX_STORE( ct, rs_ct ) \
+	{ \
+		U8S8_SKX_ROW_STORE( 0, ct, rs_ct ) \
+		U8S8_SKX_ROW_STORE( 1, ct, rs_ct ) \
+		U8S8_SKX_ROW_STORE( 2, ct, rs_ct ) \
+		U8S8_SKX_ROW_STORE( 3, ct, rs_ct ) \
+		U8S8_SKX_ROW_STORE( 4, ct, rs_ct ) \
+		U8S8_SKX_ROW_STORE( 5, ct, rs_ct ) \
+		U8S8_SKX_ROW_STORE( 6, ct, rs_ct ) \
+		U8S8_SKX_ROW_STORE( 7, ct, rs_ct ) \
+		U8S8_SKX_ROW_STORE( 8, ct, rs_ct ) \
+		U8S8_SKX_ROW_STORE( 9, ct, rs_ct ) \
+		U8S8_SKX_ROW_STORE( 10, ct, rs_ct ) \
+		U8S8_SKX_ROW_STORE( 11, ct, rs_ct ) \
+	}
+
+__attribute__((target("avx512vnni")))
+void bli_gemm_u8s8s32_skx_int_12x32
+     (
+       dim_t               k,
+       float*     restrict alpha,
+       uint8_t*   restrict a,
+       int8_t*    restrict b,
+       float*     restrict beta,
+       int32_t*   restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const dim_t mr = 12;
+	const dim_t nr = 32;
+
+	const uint8_t* restrict ap = a;
+	const int8_t*  restrict bp = b;
+
+	__m512i ab0_0  = _mm512_setzero_si512(), ab0_1  = _mm512_setzero_si512();
+	__m512i ab1_0  = _mm512_setzero_si512(), ab1_1  = _mm512_setzero_si512();
+	__m512i ab2_0  = _mm512_setzero_si512(), ab2_1  = _mm512_setzero_si512();
+	__m512i ab3_0  = _mm512_setzero_si512(), ab3_1  = _mm512_setzero_si512();
+	__m512i ab4_0  = _mm512_setzero_si512(), ab4_1  = _mm512_setzero_si512();
+	__m512i ab5_0  = _mm512_setzero_si512(), ab5_1  = _mm512_setzero_si512();
+	__m512i ab6_0  = _mm512_setzero_si512(), ab6_1  = _mm512_setzero_si512();
+	__m512i ab7_0  = _mm512_setzero_si512(), ab7_1  = _mm512_setzero_si512();
+	__m512i ab8_0  = _mm512_setzero_si512(), ab8_1  = _mm512_setzero_si512();
+	__m512i ab9_0  = _mm512_setzero_si512(), ab9_1  = _mm512_setzero_si512();
+	__m512i ab10_0 = _mm512_setzero_si512(), ab10_1 = _mm512_setzero_si512();
+	__m512i ab11_0 = _mm512_setzero_si512(), ab11_1 = _mm512_setzero_si512();
+
+	// Prefetch the rows of C, assuming row storage.
+	for ( dim_t i = 0; i < mr; ++i )
+		_mm_prefetch( ( char* )( c + i*rs_c ), _MM_HINT_T0 );
+
+	// The packed micro-panels are zero-padded to a multiple of KR.
+	const dim_t k_quads = ( k + 3 ) / 4;
+	const dim_t k_iter  = k_quads / 4;
+	const dim_t k_left  = k_quads % 4;
+
+	for ( dim_t p = 0; p < k_iter; ++p )
+	{
+		U8S8_SKX_ITER
+		U8S8_SKX_ITER
+		U8S8_SKX_ITER
+		U8S8_SKX_ITER
+	}
+
+	for ( dim_t p = 0; p < k_left; ++p )
+	{
+		U8S8_SKX_ITER
+	}
+
+	const __m512 alphav       = _mm512_set1_ps( *alpha );
+	const __m512 betav        = _mm512_set1_ps( *beta );
+	const bool   alpha_is_one = bli_seq1( *alpha );
+	const bool   beta_is_zero = bli_seq0( *beta );
+	const bool   beta_is_one  = bli_seq1( *beta );
+
+	if ( cs_c == 1 )
+	{
+		// C is row-stored, so we can update it in place.
+		U8S8_SKX_STORE( c, rs_c )
+	}
+	else
+	{
+		// Otherwise, copy C to a local row-stored buffer (unless beta is
+		// zero, in which case C must not be read), update the buffer, and
+		// then copy it back.
+		int32_t     ct[ 12 * 32 ] __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE)));
+		const inc_t rs_ct = nr;
+
+		if ( !beta_is_zero )
+		{
+			for ( dim_t j = 0; j < nr; ++j )
+			for ( dim_t i = 0; i < mr; ++i )
+				ct[ i*rs_ct + j ] = c[ i*rs_c + j*cs_c ];
+		}
+
+		U8S8_SKX_STORE( ct, rs_ct )
+
+		for ( dim_t j = 0; j < nr; ++j )
+		for ( dim_t i = 0; i < mr; ++i )
+			c[ i*rs_c + j*cs_c ] = ct[ i*rs_ct + j ];
+	}
+}
+
+#endif
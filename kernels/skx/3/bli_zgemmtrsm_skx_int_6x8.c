@@ -0,0 +1,233 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// Multiply each dcomplex element of v by the complex scalar whose real and
+// imaginary parts are broadcast in sr and si, respectively.
+#define ZTRSM_SKX_CMUL( v, sr, si ) \
+	_mm512_fmaddsub_pd( v, sr, _mm512_mul_pd( _mm512_permute_pd( v, 0x55 ), si ) )
+
+// Subtract alpha * x from the dcomplex elements of y, where alpha is the
+// scalar pointed to by alphap.
+#define ZTRSM_SKX_CNEGAXPY( alphap, x, y ) \
+	{ \
+		const __m512d arv = _mm512_set1_pd( bli_zreal( *(alphap) ) ); \
+		const __m512d aiv = _mm512_set1_pd( bli_zimag( *(alphap) ) ); \
+\
+		y = _mm512_sub_pd( y, ZTRSM_SKX_CMUL( x, arv, aiv ) ); \
+	}
+
+// Scale x by the (inverted) diagonal element pointed to by alphap.
+#define ZTRSM_SKX_CSCAL( alphap, x ) \
+	{ \
+		const __m512d arv = _mm512_set1_pd( bli_zreal( *(alphap) ) ); \
+		const __m512d aiv = _mm512_set1_pd( bli_zimag( *(alphap) ) ); \
+\
+		x = ZTRSM_SKX_CMUL( x, arv, aiv ); \
+	}
+
+// Write row i of the solution, held in x0v and x1v, to b11 and c11.
+BLIS_INLINE void bli_ztrsm_skx_int_6x8_store_row
+     (
+       const dim_t        i,
+       const __m512d      x0v,
+       const __m512d      x1v,
+       dcomplex* restrict b, const inc_t rs_b,
+       dcomplex* restrict c, const inc_t rs_c, const inc_t cs_c
+     )
+{
+	double* restrict bi = ( double* )( b + i*rs_b );
+
+	_mm512_storeu_pd( bi + 0, x0v );
+	_mm512_storeu_pd( bi + 8, x1v );
+
+	if ( cs_c == 1 )
+	{
+		double* restrict ci = ( double* )( c + i*rs_c );
+
+		_mm512_storeu_pd( ci + 0, x0v );
+		_mm512_storeu_pd( ci + 8, x1v );
+	}
+	else
+	{
+		dcomplex* restrict bc = b + i*rs_b;
+		dcomplex* restrict ci = c + i*rs_c;
+
+		for ( dim_t j = 0; j < 8; ++j )
+			bli_zcopys( bc[ j ], ci[ j*cs_c ] );
+	}
+}
+
+// The gemmtrsm kernels below first compute b11 = alpha * b11 - a1x * bx1
+// with the 6x8 gemm micro-kernel (which updates b11 in place since it is
+// row-stored with unit column stride), and then solve the 6x8 triangular
+// system with a11 with the rows of b11 held in zmm registers. As with the
+// reference trsm micro-kernels, the diagonal of a11 is assumed to hold the
+// inverses of the diagonal elements of the triangular matrix.
+
+void bli_zgemmtrsm_l_skx_int_6x8
+     (
+       dim_t               k,
+       dcomplex*  restrict alpha,
+       dcomplex*  restrict a10,
+       dcomplex*  restrict a11,
+       dcomplex*  restrict b01,
+       dcomplex*  restrict b11,
+       dcomplex*  restrict c11, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const inc_t packmr = bli_cntx_get_blksz_max_dt( BLIS_DCOMPLEX, BLIS_MR, cntx );
+	const inc_t packnr = bli_cntx_get_blksz_max_dt( BLIS_DCOMPLEX, BLIS_NR, cntx );
+
+	const inc_t rs_a   = 1;
+	const inc_t cs_a   = packmr;
+
+	const inc_t rs_b   = packnr;
+
+	// b11 = alpha * b11 - a10 * b01;
+	bli_zgemm_skx_int_6x8
+	(
+	  k,
+	  bli_zm1,
+	  a10,
+	  b01,
+	  alpha,
+	  b11, rs_b, 1,
+	  data,
+	  cntx
+	);
+
+	// b11 = inv(a11) * b11;
+	// c11 = b11;
+	__m512d x0v[ 6 ], x1v[ 6 ];
+
+	for ( dim_t i = 0; i < 6; ++i )
+	{
+		double* restrict bi = ( double* )( b11 + i*rs_b );
+
+		x0v[ i ] = _mm512_loadu_pd( bi + 0 );
+		x1v[ i ] = _mm512_loadu_pd( bi + 8 );
+
+		for ( dim_t l = 0; l < i; ++l )
+		{
+			dcomplex* restrict alpha10 = a11 + i*rs_a + l*cs_a;
+
+			ZTRSM_SKX_CNEGAXPY( alpha10, x0v[ l ], x0v[ i ] )
+			ZTRSM_SKX_CNEGAXPY( alpha10, x1v[ l ], x1v[ i ] )
+		}
+
+		dcomplex* restrict alpha11 = a11 + i*rs_a + i*cs_a;
+
+		ZTRSM_SKX_CSCAL( alpha11, x0v[ i ] )
+		ZTRSM_SKX_CSCAL( alpha11, x1v[ i ] )
+
+		bli_ztrsm_skx_int_6x8_store_row
+		(
+		  i, x0v[ i ], x1v[ i ],
+		  b11, rs_b,
+		  c11, rs_c, cs_c
+		);
+	}
+}
+
+void bli_zgemmtrsm_u_skx_int_6x8
+     (
+       dim_t               k,
+       dcomplex*  restrict alpha,
+       dcomplex*  restrict a12,
+       dcomplex*  restrict a11,
+       dcomplex*  restrict b21,
+       dcomplex*  restrict b11,
+       dcomplex*  restrict c11, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const inc_t packmr = bli_cntx_get_blksz_max_dt( BLIS_DCOMPLEX, BLIS_MR, cntx );
+	const inc_t packnr = bli_cntx_get_blksz_max_dt( BLIS_DCOMPLEX, BLIS_NR, cntx );
+
+	const inc_t rs_a   = 1;
+	const inc_t cs_a   = packmr;
+
+	const inc_t rs_b   = packnr;
+
+	// b11 = alpha * b11 - a12 * b21;
+	bli_zgemm_skx_int_6x8
+	(
+	  k,
+	  bli_zm1,
+	  a12,
+	  b21,
+	  alpha,
+	  b11, rs_b, 1,
+	  data,
+	  cntx
+	);
+
+	// b11 = inv(a11) * b11;
+	// c11 = b11;
+	__m512d x0v[ 6 ], x1v[ 6 ];
+
+	for ( dim_t i = 5; i >= 0; --i )
+	{
+		double* restrict bi = ( double* )( b11 + i*rs_b );
+
+		x0v[ i ] = _mm512_loadu_pd( bi + 0 );
+		x1v[ i ] = _mm512_loadu_pd( bi + 8 );
+
+		for ( dim_t l = i + 1; l < 6; ++l )
+		{
+			dcomplex* restrict alpha12 = a11 + i*rs_a + l*cs_a;
+
+			ZTRSM_SKX_CNEGAXPY( alpha12, x0v[ l ], x0v[ i ] )
+			ZTRSM_SKX_CNEGAXPY( alpha12, x1v[ l ], x1v[ i ] )
+		}
+
+		dcomplex* restrict alpha11 = a11 + i*rs_a + i*cs_a;
+
+		ZTRSM_SKX_CSCAL( alpha11, x0v[ i ] )
+		ZTRSM_SKX_CSCAL( alpha11, x1v[ i ] )
+
+		bli_ztrsm_skx_int_6x8_store_row
+		(
+		  i, x0v[ i ], x1v[ i ],
+		  b11, rs_b,
+		  c11, rs_c, cs_c
+		);
+	}
+}
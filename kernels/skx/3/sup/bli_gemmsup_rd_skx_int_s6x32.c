@@ -0,0 +1,347 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   rrc:
+     --------        ------        | | | | | | | |
+     --------        ------        | | | | | | | |
+     --------   +=   ------ ...    | | | | | | | |
+     --------        ------        | | | | | | | |
+     --------        ------        | | | | | | | |
+     --------        ------        | | | | | | | |
+
+   The rd kernels compute each element of the microtile as a dot product
+   of a row of A with a column of B, vectorized along the k dimension. They
+   require A to have unit column stride and B to have unit row stride. The
+   microtile is computed in blocks of 3x4 dot products, with the partial
+   sums of each block reduced horizontally once the k loop is complete.
+*/
+
+// Return a mask with the first n (of sixteen) elements enabled.
+BLIS_INLINE __mmask16 bli_sgemmsup_rd_skx_int_mask( dim_t n )
+{
+	return ( __mmask16 )( n <= 0 ? 0 : ( n >= 16 ? 0xFFFF : ( 1 << n ) - 1 ) );
+}
+
+// Reduce the four accumulators of one row of a block to a vector of four
+// dot products, one for each column of the block.
+BLIS_INLINE __m128 bli_sgemmsup_rd_skx_int_hsum4
+     (
+       __m512 ab0, __m512 ab1, __m512 ab2, __m512 ab3
+     )
+{
+	const __m256 s0   = _mm256_add_ps( _mm512_castps512_ps256( ab0 ),
+	                                   _mm512_extractf32x8_ps( ab0, 1 ) );
+	const __m256 s1   = _mm256_add_ps( _mm512_castps512_ps256( ab1 ),
+	                                   _mm512_extractf32x8_ps( ab1, 1 ) );
+	const __m256 s2   = _mm256_add_ps( _mm512_castps512_ps256( ab2 ),
+	                                   _mm512_extractf32x8_ps( ab2, 1 ) );
+	const __m256 s3   = _mm256_add_ps( _mm512_castps512_ps256( ab3 ),
+	                                   _mm512_extractf32x8_ps( ab3, 1 ) );
+
+	const __m256 t01  = _mm256_hadd_ps( s0, s1 );
+	const __m256 t23  = _mm256_hadd_ps( s2, s3 );
+	const __m256 t    = _mm256_hadd_ps( t01, t23 );
+
+	return _mm_add_ps( _mm256_castps256_ps128( t ),
+	                   _mm256_extractf128_ps( t, 1 ) );
+}
+
+// Macros used to unroll the block computation over its rows. Any row index
+// at or beyond mr is skipped at compile time since mr is constant.
+#define SGEMMSUP_RD_LOADA( i, load ) \
+	const __m512 a ## i ## v = ( i < mr ? load( a ## i ## p + l ) : zerov );
+
+#define SGEMMSUP_RD_FMA( i, j ) \
+	if ( i < mr ) ab ## i ## j = _mm512_fmadd_ps( a ## i ## v, bv, ab ## i ## j );
+
+#define SGEMMSUP_RD_COL( j, load ) \
+	{ \
+		const __m512 bv = load( b ## j ## p + l ); \
+\
+		SGEMMSUP_RD_FMA( 0, j ) \
+		SGEMMSUP_RD_FMA( 1, j ) \
+		SGEMMSUP_RD_FMA( 2, j ) \
+	}
+
+#define SGEMMSUP_RD_STORE_ROW( i ) \
+	if ( i < mr ) \
+	{ \
+		__m128 s = bli_sgemmsup_rd_skx_int_hsum4( ab ## i ## 0, ab ## i ## 1, \
+		                                          ab ## i ## 2, ab ## i ## 3 ); \
+		float* restrict ci = c + i*rs_c; \
+\
+		s = _mm_mul_ps( alphav, s ); \
+\
+		if ( n == 4 && cs_c == 1 ) \
+		{ \
+			if ( !beta_is_zero ) s = _mm_fmadd_ps( betav, _mm_loadu_ps( ci ), s ); \
+			_mm_storeu_ps( ci, s ); \
+		} \
+		else \
+		{ \
+			float st[ 4 ]; \
+\
+			_mm_storeu_ps( st, s ); \
+\
+			for ( dim_t j = 0; j < n; ++j ) \
+			{ \
+				if ( beta_is_zero ) { PASTEMAC(s,copys)( st[ j ], ci[ j*cs_c ] ); } \
+				else                { PASTEMAC(s,xpbys)( st[ j ], *beta, ci[ j*cs_c ] ); } \
+			} \
+		} \
+	}
+
+// Compute an mr x n block of C, where mr <= 3 and n <= 4. This function is
+// always inlined with a constant mr so that the compiler generates a fully
+// specialized instance for each row count. Columns at or beyond n alias the
+// last valid column of B; their dot products are computed but discarded.
+static inline __attribute__((always_inline)) void bli_sgemmsup_rd_skx_int_mx4
+     (
+       const dim_t        mr,
+       const dim_t        n,
+       const dim_t        k,
+       float*    restrict alpha,
+       float*    restrict a, const inc_t rs_a,
+       float*    restrict b, const inc_t cs_b,
+       float*    restrict beta,
+       float*    restrict c, const inc_t rs_c, const inc_t cs_c
+     )
+{
+	float* restrict a0p = a;
+	float* restrict a1p = a + bli_min( 1, mr - 1 ) * rs_a;
+	float* restrict a2p = a + bli_min( 2, mr - 1 ) * rs_a;
+
+	float* restrict b0p = b;
+	float* restrict b1p = b + bli_min( 1, n - 1 ) * cs_b;
+	float* restrict b2p = b + bli_min( 2, n - 1 ) * cs_b;
+	float* restrict b3p = b + bli_min( 3, n - 1 ) * cs_b;
+
+	const __m512 zerov = _mm512_setzero_ps();
+
+	__m512 ab00 = zerov, ab01 = zerov, ab02 = zerov, ab03 = zerov;
+	__m512 ab10 = zerov, ab11 = zerov, ab12 = zerov, ab13 = zerov;
+	__m512 ab20 = zerov, ab21 = zerov, ab22 = zerov, ab23 = zerov;
+
+	const dim_t k_iter = k / 16;
+	const dim_t k_left = k % 16;
+
+	dim_t l = 0;
+
+	for ( dim_t kk = 0; kk < k_iter; ++kk, l += 16 )
+	{
+		SGEMMSUP_RD_LOADA( 0, _mm512_loadu_ps )
+		SGEMMSUP_RD_LOADA( 1, _mm512_loadu_ps )
+		SGEMMSUP_RD_LOADA( 2, _mm512_loadu_ps )
+
+		SGEMMSUP_RD_COL( 0, _mm512_loadu_ps )
+		SGEMMSUP_RD_COL( 1, _mm512_loadu_ps )
+		SGEMMSUP_RD_COL( 2, _mm512_loadu_ps )
+		SGEMMSUP_RD_COL( 3, _mm512_loadu_ps )
+	}
+
+	if ( k_left )
+	{
+		// Use masked loads for the k edge so that we never touch elements
+		// of A or B beyond the end of the current rows and columns.
+		const __mmask16 mask = bli_sgemmsup_rd_skx_int_mask( k_left );
+
+		#define SGEMMSUP_RD_MASKLOAD( p ) _mm512_maskz_loadu_ps( mask, p )
+
+		SGEMMSUP_RD_LOADA( 0, SGEMMSUP_RD_MASKLOAD )
+		SGEMMSUP_RD_LOADA( 1, SGEMMSUP_RD_MASKLOAD )
+		SGEMMSUP_RD_LOADA( 2, SGEMMSUP_RD_MASKLOAD )
+
+		SGEMMSUP_RD_COL( 0, SGEMMSUP_RD_MASKLOAD )
+		SGEMMSUP_RD_COL( 1, SGEMMSUP_RD_MASKLOAD )
+		SGEMMSUP_RD_COL( 2, SGEMMSUP_RD_MASKLOAD )
+		SGEMMSUP_RD_COL( 3, SGEMMSUP_RD_MASKLOAD )
+
+		#undef SGEMMSUP_RD_MASKLOAD
+	}
+
+	const __m128 alphav       = _mm_broadcast_ss( alpha );
+	const __m128 betav        = _mm_broadcast_ss( beta );
+	const bool   beta_is_zero = PASTEMAC(s,eq0)( *beta );
+
+	SGEMMSUP_RD_STORE_ROW( 0 )
+	SGEMMSUP_RD_STORE_ROW( 1 )
+	SGEMMSUP_RD_STORE_ROW( 2 )
+}
+
+// Compute an m x n block of C, where m <= 6 and n <= 16, in blocks of 3x4.
+static void bli_sgemmsup_rd_skx_int_6x32_tile
+     (
+       const dim_t        m,
+       const dim_t        n,
+       const dim_t        k,
+       float*    restrict alpha,
+       float*    restrict a, const inc_t rs_a,
+       float*    restrict b, const inc_t cs_b,
+       float*    restrict beta,
+       float*    restrict c, const inc_t rs_c, const inc_t cs_c
+     )
+{
+	for ( dim_t i = 0; i < m; i += 3 )
+	{
+		const dim_t mr_cur = bli_min( 3, m - i );
+
+		float* restrict ai = a + i*rs_a;
+		float* restrict ci = c + i*rs_c;
+
+		for ( dim_t j = 0; j < n; j += 4 )
+		{
+			const dim_t nr_cur = bli_min( 4, n - j );
+
+			float* restrict bj  = b  + j*cs_b;
+			float* restrict cij = ci + j*cs_c;
+
+			if      ( mr_cur == 3 )
+				bli_sgemmsup_rd_skx_int_mx4( 3, nr_cur, k, alpha, ai, rs_a, bj, cs_b, beta, cij, rs_c, cs_c );
+			else if ( mr_cur == 2 )
+				bli_sgemmsup_rd_skx_int_mx4( 2, nr_cur, k, alpha, ai, rs_a, bj, cs_b, beta, cij, rs_c, cs_c );
+			else
+				bli_sgemmsup_rd_skx_int_mx4( 1, nr_cur, k, alpha, ai, rs_a, bj, cs_b, beta, cij, rs_c, cs_c );
+		}
+	}
+}
+
+// Iterate over micropanels of B (in steps of ps_b) and, within each one,
+// over micropanels of A (in steps of ps_a).
+static void bli_sgemmsup_rd_skx_int_6x32
+     (
+       dim_t              m0,
+       dim_t              n0,
+       dim_t              k0,
+       float*    restrict alpha,
+       float*    restrict a, inc_t rs_a0, inc_t ps_a0,
+       float*    restrict b, inc_t cs_b0, inc_t ps_b0,
+       float*    restrict beta,
+       float*    restrict c, inc_t rs_c0, inc_t cs_c0
+     )
+{
+	const dim_t mr = 6;
+	const dim_t nr = 32;
+
+	for ( dim_t j = 0; j < n0; j += nr )
+	{
+		const dim_t nr_cur = bli_min( nr, n0 - j );
+
+		float* restrict bj = b + ( j / nr ) * ps_b0;
+
+		for ( dim_t i = 0; i < m0; i += mr )
+		{
+			const dim_t mr_cur = bli_min( mr, m0 - i );
+
+			float* restrict ai  = a + ( i / mr ) * ps_a0;
+			float* restrict cij = c + i*rs_c0 + j*cs_c0;
+
+			bli_sgemmsup_rd_skx_int_6x32_tile
+			(
+			  mr_cur, nr_cur, k0,
+			  alpha, ai, rs_a0, bj, cs_b0,
+			  beta, cij, rs_c0, cs_c0
+			);
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_sgemmsup_rd_skx_int_6x32m
+     (
+       conj_t              conja,
+       conj_t              conjb,
+       dim_t               m0,
+       dim_t               n0,
+       dim_t               k0,
+       float*     restrict alpha,
+       float*     restrict a, inc_t rs_a0, inc_t cs_a0,
+       float*     restrict b, inc_t rs_b0, inc_t cs_b0,
+       float*     restrict beta,
+       float*     restrict c, inc_t rs_c0, inc_t cs_c0,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	// This millikernel iterates over the m dimension, stepping through
+	// micropanels of A according to the panel stride embedded in the
+	// auxinfo_t object.
+	const inc_t ps_a0 = bli_auxinfo_ps_a( data );
+	const inc_t ps_b0 = 32 * cs_b0;
+
+	bli_sgemmsup_rd_skx_int_6x32
+	(
+	  m0, n0, k0,
+	  alpha, a, rs_a0, ps_a0,
+	         b, cs_b0, ps_b0,
+	  beta,  c, rs_c0, cs_c0
+	);
+}
+
+void bli_sgemmsup_rd_skx_int_6x32n
+     (
+       conj_t              conja,
+       conj_t              conjb,
+       dim_t               m0,
+       dim_t               n0,
+       dim_t               k0,
+       float*     restrict alpha,
+       float*     restrict a, inc_t rs_a0, inc_t cs_a0,
+       float*     restrict b, inc_t rs_b0, inc_t cs_b0,
+       float*     restrict beta,
+       float*     restrict c, inc_t rs_c0, inc_t cs_c0,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	// This millikernel iterates over the n dimension, stepping through
+	// micropanels of B according to the panel stride embedded in the
+	// auxinfo_t object.
+	const inc_t ps_a0 = 6 * rs_a0;
+	const inc_t ps_b0 = bli_auxinfo_ps_b( data );
+
+	bli_sgemmsup_rd_skx_int_6x32
+	(
+	  m0, n0, k0,
+	  alpha, a, rs_a0, ps_a0,
+	         b, cs_b0, ps_b0,
+	  beta,  c, rs_c0, cs_c0
+	);
+}
+
@@ -0,0 +1,315 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   rrr:
+     --------        ------        --------
+     --------        ------        --------
+     --------   +=   ------ ...    --------
+     --------        ------        --------
+     --------        ------        --------
+     --------        ------        --------
+
+   The rv kernels compute each row of the microtile as a sequence of rank-1
+   updates, broadcasting one element of A at a time against a row of B. They
+   require B to have unit column stride. A may be stored by rows or columns
+   (or packed), and C may be stored by rows or columns. When C is stored by
+   columns, the microtile is written back through a small temporary buffer.
+*/
+
+// Return a mask with the first n (of eight) elements enabled.
+BLIS_INLINE __mmask8 bli_dgemmsup_rv_skx_int_mask( dim_t n )
+{
+	return ( __mmask8 )( n <= 0 ? 0 : ( n >= 8 ? 0xFF : ( 1 << n ) - 1 ) );
+}
+
+// Macros used to unroll the microtile computation over the rows of C. Each
+// row of the microtile is held in a pair of accumulators, abi0 and abi1. Any
+// row index at or beyond mr is skipped at compile time since mr is constant.
+#define DGEMMSUP_RV_FMA( i ) \
+	if ( i < mr ) \
+	{ \
+		const __m512d ai = _mm512_set1_pd( *(a + i*rs_a) ); \
+\
+		ab ## i ## 0 = _mm512_fmadd_pd( ai, b0, ab ## i ## 0 ); \
+		ab ## i ## 1 = _mm512_fmadd_pd( ai, b1, ab ## i ## 1 ); \
+	}
+
+#define DGEMMSUP_RV_SCALE( i ) \
+	if ( i < mr ) \
+	{ \
+		ab ## i ## 0 = _mm512_mul_pd( alphav, ab ## i ## 0 ); \
+		ab ## i ## 1 = _mm512_mul_pd( alphav, ab ## i ## 1 ); \
+	}
+
+#define DGEMMSUP_RV_STORE_ROW( i ) \
+	if ( i < mr ) \
+	{ \
+		double* restrict ci = c + i*rs_c; \
+\
+		if ( is_full ) \
+		{ \
+			if ( !beta_is_zero ) \
+			{ \
+				ab ## i ## 0 = _mm512_fmadd_pd( betav, _mm512_loadu_pd( ci + 0 ), ab ## i ## 0 ); \
+				ab ## i ## 1 = _mm512_fmadd_pd( betav, _mm512_loadu_pd( ci + 8 ), ab ## i ## 1 ); \
+			} \
+			_mm512_storeu_pd( ci + 0, ab ## i ## 0 ); \
+			_mm512_storeu_pd( ci + 8, ab ## i ## 1 ); \
+		} \
+		else \
+		{ \
+			if ( !beta_is_zero ) \
+			{ \
+				ab ## i ## 0 = _mm512_fmadd_pd( betav, _mm512_maskz_loadu_pd( mask0, ci + 0 ), ab ## i ## 0 ); \
+				ab ## i ## 1 = _mm512_fmadd_pd( betav, _mm512_maskz_loadu_pd( mask1, ci + 8 ), ab ## i ## 1 ); \
+			} \
+			_mm512_mask_storeu_pd( ci + 0, mask0, ab ## i ## 0 ); \
+			_mm512_mask_storeu_pd( ci + 8, mask1, ab ## i ## 1 ); \
+		} \
+	}
+
+#define DGEMMSUP_RV_STORE_BUF( i ) \
+	if ( i < mr ) \
+	{ \
+		_mm512_storeu_pd( &ct[ i ][ 0 ], ab ## i ## 0 ); \
+		_mm512_storeu_pd( &ct[ i ][ 8 ], ab ## i ## 1 ); \
+	}
+
+// Compute an mr x n microtile, where mr <= 6 and n <= 16. This function is
+// always inlined with a constant mr so that the compiler generates a fully
+// specialized instance (with all accumulators in registers) for each row
+// count.
+static inline __attribute__((always_inline)) void bli_dgemmsup_rv_skx_int_mx16
+     (
+       const dim_t        mr,
+       const dim_t        n,
+       const dim_t        k,
+       double*   restrict alpha,
+       double*   restrict a, const inc_t rs_a, const inc_t cs_a,
+       double*   restrict b, const inc_t rs_b,
+       double*   restrict beta,
+       double*   restrict c, const inc_t rs_c, const inc_t cs_c
+     )
+{
+	__m512d ab00 = _mm512_setzero_pd(), ab01 = _mm512_setzero_pd();
+	__m512d ab10 = _mm512_setzero_pd(), ab11 = _mm512_setzero_pd();
+	__m512d ab20 = _mm512_setzero_pd(), ab21 = _mm512_setzero_pd();
+	__m512d ab30 = _mm512_setzero_pd(), ab31 = _mm512_setzero_pd();
+	__m512d ab40 = _mm512_setzero_pd(), ab41 = _mm512_setzero_pd();
+	__m512d ab50 = _mm512_setzero_pd(), ab51 = _mm512_setzero_pd();
+
+	const bool     is_full = ( n == 16 );
+	const __mmask8 mask0   = bli_dgemmsup_rv_skx_int_mask( n     );
+	const __mmask8 mask1   = bli_dgemmsup_rv_skx_int_mask( n - 8 );
+
+	if ( is_full )
+	{
+		for ( dim_t l = 0; l < k; ++l )
+		{
+			const __m512d b0 = _mm512_loadu_pd( b + 0 );
+			const __m512d b1 = _mm512_loadu_pd( b + 8 );
+
+			DGEMMSUP_RV_FMA( 0 ) DGEMMSUP_RV_FMA( 1 ) DGEMMSUP_RV_FMA( 2 )
+			DGEMMSUP_RV_FMA( 3 ) DGEMMSUP_RV_FMA( 4 ) DGEMMSUP_RV_FMA( 5 )
+
+			a += cs_a;
+			b += rs_b;
+		}
+	}
+	else
+	{
+		// Use masked loads so that we never touch elements of B beyond
+		// the n columns of the current micropanel.
+		for ( dim_t l = 0; l < k; ++l )
+		{
+			const __m512d b0 = _mm512_maskz_loadu_pd( mask0, b + 0 );
+			const __m512d b1 = _mm512_maskz_loadu_pd( mask1, b + 8 );
+
+			DGEMMSUP_RV_FMA( 0 ) DGEMMSUP_RV_FMA( 1 ) DGEMMSUP_RV_FMA( 2 )
+			DGEMMSUP_RV_FMA( 3 ) DGEMMSUP_RV_FMA( 4 ) DGEMMSUP_RV_FMA( 5 )
+
+			a += cs_a;
+			b += rs_b;
+		}
+	}
+
+	// Scale the accumulated product by alpha.
+	const __m512d alphav = _mm512_set1_pd( *alpha );
+
+	DGEMMSUP_RV_SCALE( 0 ) DGEMMSUP_RV_SCALE( 1 ) DGEMMSUP_RV_SCALE( 2 )
+	DGEMMSUP_RV_SCALE( 3 ) DGEMMSUP_RV_SCALE( 4 ) DGEMMSUP_RV_SCALE( 5 )
+
+	const bool beta_is_zero = PASTEMAC(d,eq0)( *beta );
+
+	if ( cs_c == 1 )
+	{
+		// C is row-stored, so we can update it directly with vector loads
+		// and stores. If beta is zero, C is overwritten without being read.
+		const __m512d betav = _mm512_set1_pd( *beta );
+
+		DGEMMSUP_RV_STORE_ROW( 0 ) DGEMMSUP_RV_STORE_ROW( 1 ) DGEMMSUP_RV_STORE_ROW( 2 )
+		DGEMMSUP_RV_STORE_ROW( 3 ) DGEMMSUP_RV_STORE_ROW( 4 ) DGEMMSUP_RV_STORE_ROW( 5 )
+	}
+	else
+	{
+		// C is column-stored (or general-stored), so we write the microtile
+		// to a temporary buffer and then update C one element at a time.
+		double ct[ 6 ][ 16 ];
+
+		DGEMMSUP_RV_STORE_BUF( 0 ) DGEMMSUP_RV_STORE_BUF( 1 ) DGEMMSUP_RV_STORE_BUF( 2 )
+		DGEMMSUP_RV_STORE_BUF( 3 ) DGEMMSUP_RV_STORE_BUF( 4 ) DGEMMSUP_RV_STORE_BUF( 5 )
+
+		for ( dim_t j = 0; j < n; ++j )
+		for ( dim_t i = 0; i < mr; ++i )
+		{
+			double* restrict cij = c + i*rs_c + j*cs_c;
+
+			if ( beta_is_zero ) { PASTEMAC(d,copys)( ct[ i ][ j ], *cij ); }
+			else                { PASTEMAC(d,xpbys)( ct[ i ][ j ], *beta, *cij ); }
+		}
+	}
+}
+
+// Iterate over micropanels of B (in steps of ps_b) and, within each one,
+// over micropanels of A (in steps of ps_a).
+static void bli_dgemmsup_rv_skx_int_6x16
+     (
+       dim_t              m0,
+       dim_t              n0,
+       dim_t              k0,
+       double*   restrict alpha,
+       double*   restrict a, inc_t rs_a0, inc_t cs_a0, inc_t ps_a0,
+       double*   restrict b, inc_t rs_b0,               inc_t ps_b0,
+       double*   restrict beta,
+       double*   restrict c, inc_t rs_c0, inc_t cs_c0
+     )
+{
+	const dim_t mr = 6;
+	const dim_t nr = 16;
+
+	for ( dim_t j = 0; j < n0; j += nr )
+	{
+		const dim_t nr_cur = bli_min( nr, n0 - j );
+
+		double* restrict bj = b + ( j / nr ) * ps_b0;
+
+		for ( dim_t i = 0; i < m0; i += mr )
+		{
+			const dim_t mr_cur = bli_min( mr, m0 - i );
+
+			double* restrict ai  = a + ( i / mr ) * ps_a0;
+			double* restrict cij = c + i*rs_c0 + j*cs_c0;
+
+			switch ( mr_cur )
+			{
+				case 6: bli_dgemmsup_rv_skx_int_mx16( 6, nr_cur, k0, alpha, ai, rs_a0, cs_a0, bj, rs_b0, beta, cij, rs_c0, cs_c0 ); break;
+				case 5: bli_dgemmsup_rv_skx_int_mx16( 5, nr_cur, k0, alpha, ai, rs_a0, cs_a0, bj, rs_b0, beta, cij, rs_c0, cs_c0 ); break;
+				case 4: bli_dgemmsup_rv_skx_int_mx16( 4, nr_cur, k0, alpha, ai, rs_a0, cs_a0, bj, rs_b0, beta, cij, rs_c0, cs_c0 ); break;
+				case 3: bli_dgemmsup_rv_skx_int_mx16( 3, nr_cur, k0, alpha, ai, rs_a0, cs_a0, bj, rs_b0, beta, cij, rs_c0, cs_c0 ); break;
+				case 2: bli_dgemmsup_rv_skx_int_mx16( 2, nr_cur, k0, alpha, ai, rs_a0, cs_a0, bj, rs_b0, beta, cij, rs_c0, cs_c0 ); break;
+				default: bli_dgemmsup_rv_skx_int_mx16( 1, nr_cur, k0, alpha, ai, rs_a0, cs_a0, bj, rs_b0, beta, cij, rs_c0, cs_c0 ); break;
+			}
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_dgemmsup_rv_skx_int_6x16m
+     (
+       conj_t              conja,
+       conj_t              conjb,
+       dim_t               m0,
+       dim_t               n0,
+       dim_t               k0,
+       double*    restrict alpha,
+       double*    restrict a, inc_t rs_a0, inc_t cs_a0,
+       double*    restrict b, inc_t rs_b0, inc_t cs_b0,
+       double*    restrict beta,
+       double*    restrict c, inc_t rs_c0, inc_t cs_c0,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	// This millikernel iterates over the m dimension, stepping through
+	// micropanels of A according to the panel stride embedded in the
+	// auxinfo_t object.
+	const inc_t ps_a0 = bli_auxinfo_ps_a( data );
+	const inc_t ps_b0 = 16 * cs_b0;
+
+	bli_dgemmsup_rv_skx_int_6x16
+	(
+	  m0, n0, k0,
+	  alpha, a, rs_a0, cs_a0, ps_a0,
+	         b, rs_b0,        ps_b0,
+	  beta,  c, rs_c0, cs_c0
+	);
+}
+
+void bli_dgemmsup_rv_skx_int_6x16n
+     (
+       conj_t              conja,
+       conj_t              conjb,
+       dim_t               m0,
+       dim_t               n0,
+       dim_t               k0,
+       double*    restrict alpha,
+       double*    restrict a, inc_t rs_a0, inc_t cs_a0,
+       double*    restrict b, inc_t rs_b0, inc_t cs_b0,
+       double*    restrict beta,
+       double*    restrict c, inc_t rs_c0, inc_t cs_c0,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	// This millikernel iterates over the n dimension, stepping through
+	// micropanels of B according to the panel stride embedded in the
+	// auxinfo_t object.
+	const inc_t ps_a0 = 6 * rs_a0;
+	const inc_t ps_b0 = bli_auxinfo_ps_b( data );
+
+	bli_dgemmsup_rv_skx_int_6x16
+	(
+	  m0, n0, k0,
+	  alpha, a, rs_a0, cs_a0, ps_a0,
+	         b, rs_b0,        ps_b0,
+	  beta,  c, rs_c0, cs_c0
+	);
+}
+
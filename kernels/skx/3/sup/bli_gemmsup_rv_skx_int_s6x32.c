@@ -0,0 +1,315 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   rrr:
+     --------        ------        --------
+     --------        ------        --------
+     --------   +=   ------ ...    --------
+     --------        ------        --------
+     --------        ------        --------
+     --------        ------        --------
+
+   The rv kernels compute each row of the microtile as a sequence of rank-1
+   updates, broadcasting one element of A at a time against a row of B. They
+   require B to have unit column stride. A may be stored by rows or columns
+   (or packed), and C may be stored by rows or columns. When C is stored by
+   columns, the microtile is written back through a small temporary buffer.
+*/
+
+// Return a mask with the first n (of sixteen) elements enabled.
+BLIS_INLINE __mmask16 bli_sgemmsup_rv_skx_int_mask( dim_t n )
+{
+	return ( __mmask16 )( n <= 0 ? 0 : ( n >= 16 ? 0xFFFF : ( 1 << n ) - 1 ) );
+}
+
+// Macros used to unroll the microtile computation over the rows of C. Each
+// row of the microtile is held in a pair of accumulators, abi0 and abi1. Any
+// row index at or beyond mr is skipped at compile time since mr is constant.
+#define SGEMMSUP_RV_FMA( i ) \
+	if ( i < mr ) \
+	{ \
+		const __m512 ai = _mm512_set1_ps( *(a + i*rs_a) ); \
+\
+		ab ## i ## 0 = _mm512_fmadd_ps( ai, b0, ab ## i ## 0 ); \
+		ab ## i ## 1 = _mm512_fmadd_ps( ai, b1, ab ## i ## 1 ); \
+	}
+
+#define SGEMMSUP_RV_SCALE( i ) \
+	if ( i < mr ) \
+	{ \
+		ab ## i ## 0 = _mm512_mul_ps( alphav, ab ## i ## 0 ); \
+		ab ## i ## 1 = _mm512_mul_ps( alphav, ab ## i ## 1 ); \
+	}
+
+#define SGEMMSUP_RV_STORE_ROW( i ) \
+	if ( i < mr ) \
+	{ \
+		float* restrict ci = c + i*rs_c; \
+\
+		if ( is_full ) \
+		{ \
+			if ( !beta_is_zero ) \
+			{ \
+				ab ## i ## 0 = _mm512_fmadd_ps( betav, _mm512_loadu_ps( ci + 0 ), ab ## i ## 0 ); \
+				ab ## i ## 1 = _mm512_fmadd_ps( betav, _mm512_loadu_ps( ci + 16 ), ab ## i ## 1 ); \
+			} \
+			_mm512_storeu_ps( ci + 0, ab ## i ## 0 ); \
+			_mm512_storeu_ps( ci + 16, ab ## i ## 1 ); \
+		} \
+		else \
+		{ \
+			if ( !beta_is_zero ) \
+			{ \
+				ab ## i ## 0 = _mm512_fmadd_ps( betav, _mm512_maskz_loadu_ps( mask0, ci + 0 ), ab ## i ## 0 ); \
+				ab ## i ## 1 = _mm512_fmadd_ps( betav, _mm512_maskz_loadu_ps( mask1, ci + 16 ), ab ## i ## 1 ); \
+			} \
+			_mm512_mask_storeu_ps( ci + 0, mask0, ab ## i ## 0 ); \
+			_mm512_mask_storeu_ps( ci + 16, mask1, ab ## i ## 1 ); \
+		} \
+	}
+
+#define SGEMMSUP_RV_STORE_BUF( i ) \
+	if ( i < mr ) \
+	{ \
+		_mm512_storeu_ps( &ct[ i ][ 0 ], ab ## i ## 0 ); \
+		_mm512_storeu_ps( &ct[ i ][ 16 ], ab ## i ## 1 ); \
+	}
+
+// Compute an mr x n microtile, where mr <= 6 and n <= 32. This function is
+// always inlined with a constant mr so that the compiler generates a fully
+// specialized instance (with all accumulators in registers) for each row
+// count.
+static inline __attribute__((always_inline)) void bli_sgemmsup_rv_skx_int_mx32
+     (
+       const dim_t        mr,
+       const dim_t        n,
+       const dim_t        k,
+       float*    restrict alpha,
+       float*    restrict a, const inc_t rs_a, const inc_t cs_a,
+       float*    restrict b, const inc_t rs_b,
+       float*    restrict beta,
+       float*    restrict c, const inc_t rs_c, const inc_t cs_c
+     )
+{
+	__m512 ab00 = _mm512_setzero_ps(), ab01 = _mm512_setzero_ps();
+	__m512 ab10 = _mm512_setzero_ps(), ab11 = _mm512_setzero_ps();
+	__m512 ab20 = _mm512_setzero_ps(), ab21 = _mm512_setzero_ps();
+	__m512 ab30 = _mm512_setzero_ps(), ab31 = _mm512_setzero_ps();
+	__m512 ab40 = _mm512_setzero_ps(), ab41 = _mm512_setzero_ps();
+	__m512 ab50 = _mm512_setzero_ps(), ab51 = _mm512_setzero_ps();
+
+	const bool      is_full = ( n == 32 );
+	const __mmask16 mask0   = bli_sgemmsup_rv_skx_int_mask( n      );
+	const __mmask16 mask1   = bli_sgemmsup_rv_skx_int_mask( n - 16 );
+
+	if ( is_full )
+	{
+		for ( dim_t l = 0; l < k; ++l )
+		{
+			const __m512 b0 = _mm512_loadu_ps( b + 0 );
+			const __m512 b1 = _mm512_loadu_ps( b + 16 );
+
+			SGEMMSUP_RV_FMA( 0 ) SGEMMSUP_RV_FMA( 1 ) SGEMMSUP_RV_FMA( 2 )
+			SGEMMSUP_RV_FMA( 3 ) SGEMMSUP_RV_FMA( 4 ) SGEMMSUP_RV_FMA( 5 )
+
+			a += cs_a;
+			b += rs_b;
+		}
+	}
+	else
+	{
+		// Use masked loads so that we never touch elements of B beyond
+		// the n columns of the current micropanel.
+		for ( dim_t l = 0; l < k; ++l )
+		{
+			const __m512 b0 = _mm512_maskz_loadu_ps( mask0, b + 0 );
+			const __m512 b1 = _mm512_maskz_loadu_ps( mask1, b + 16 );
+
+			SGEMMSUP_RV_FMA( 0 ) SGEMMSUP_RV_FMA( 1 ) SGEMMSUP_RV_FMA( 2 )
+			SGEMMSUP_RV_FMA( 3 ) SGEMMSUP_RV_FMA( 4 ) SGEMMSUP_RV_FMA( 5 )
+
+			a += cs_a;
+			b += rs_b;
+		}
+	}
+
+	// Scale the accumulated product by alpha.
+	const __m512 alphav = _mm512_set1_ps( *alpha );
+
+	SGEMMSUP_RV_SCALE( 0 ) SGEMMSUP_RV_SCALE( 1 ) SGEMMSUP_RV_SCALE( 2 )
+	SGEMMSUP_RV_SCALE( 3 ) SGEMMSUP_RV_SCALE( 4 ) SGEMMSUP_RV_SCALE( 5 )
+
+	const bool beta_is_zero = PASTEMAC(s,eq0)( *beta );
+
+	if ( cs_c == 1 )
+	{
+		// C is row-stored, so we can update it directly with vector loads
+		// and stores. If beta is zero, C is overwritten without being read.
+		const __m512 betav = _mm512_set1_ps( *beta );
+
+		SGEMMSUP_RV_STORE_ROW( 0 ) SGEMMSUP_RV_STORE_ROW( 1 ) SGEMMSUP_RV_STORE_ROW( 2 )
+		SGEMMSUP_RV_STORE_ROW( 3 ) SGEMMSUP_RV_STORE_ROW( 4 ) SGEMMSUP_RV_STORE_ROW( 5 )
+	}
+	else
+	{
+		// C is column-stored (or general-stored), so we write the microtile
+		// to a temporary buffer and then update C one element at a time.
+		float ct[ 6 ][ 32 ];
+
+		SGEMMSUP_RV_STORE_BUF( 0 ) SGEMMSUP_RV_STORE_BUF( 1 ) SGEMMSUP_RV_STORE_BUF( 2 )
+		SGEMMSUP_RV_STORE_BUF( 3 ) SGEMMSUP_RV_STORE_BUF( 4 ) SGEMMSUP_RV_STORE_BUF( 5 )
+
+		for ( dim_t j = 0; j < n; ++j )
+		for ( dim_t i = 0; i < mr; ++i )
+		{
+			float* restrict cij = c + i*rs_c + j*cs_c;
+
+			if ( beta_is_zero ) { PASTEMAC(s,copys)( ct[ i ][ j ], *cij ); }
+			else                { PASTEMAC(s,xpbys)( ct[ i ][ j ], *beta, *cij ); }
+		}
+	}
+}
+
+// Iterate over micropanels of B (in steps of ps_b) and, within each one,
+// over micropanels of A (in steps of ps_a).
+static void bli_sgemmsup_rv_skx_int_6x32
+     (
+       dim_t              m0,
+       dim_t              n0,
+       dim_t              k0,
+       float*    restrict alpha,
+       float*    restrict a, inc_t rs_a0, inc_t cs_a0, inc_t ps_a0,
+       float*    restrict b, inc_t rs_b0,               inc_t ps_b0,
+       float*    restrict beta,
+       float*    restrict c, inc_t rs_c0, inc_t cs_c0
+     )
+{
+	const dim_t mr = 6;
+	const dim_t nr = 32;
+
+	for ( dim_t j = 0; j < n0; j += nr )
+	{
+		const dim_t nr_cur = bli_min( nr, n0 - j );
+
+		float* restrict bj = b + ( j / nr ) * ps_b0;
+
+		for ( dim_t i = 0; i < m0; i += mr )
+		{
+			const dim_t mr_cur = bli_min( mr, m0 - i );
+
+			float* restrict ai  = a + ( i / mr ) * ps_a0;
+			float* restrict cij = c + i*rs_c0 + j*cs_c0;
+
+			switch ( mr_cur )
+			{
+				case 6: bli_sgemmsup_rv_skx_int_mx32( 6, nr_cur, k0, alpha, ai, rs_a0, cs_a0, bj, rs_b0, beta, cij, rs_c0, cs_c0 ); break;
+				case 5: bli_sgemmsup_rv_skx_int_mx32( 5, nr_cur, k0, alpha, ai, rs_a0, cs_a0, bj, rs_b0, beta, cij, rs_c0, cs_c0 ); break;
+				case 4: bli_sgemmsup_rv_skx_int_mx32( 4, nr_cur, k0, alpha, ai, rs_a0, cs_a0, bj, rs_b0, beta, cij, rs_c0, cs_c0 ); break;
+				case 3: bli_sgemmsup_rv_skx_int_mx32( 3, nr_cur, k0, alpha, ai, rs_a0, cs_a0, bj, rs_b0, beta, cij, rs_c0, cs_c0 ); break;
+				case 2: bli_sgemmsup_rv_skx_int_mx32( 2, nr_cur, k0, alpha, ai, rs_a0, cs_a0, bj, rs_b0, beta, cij, rs_c0, cs_c0 ); break;
+				default: bli_sgemmsup_rv_skx_int_mx32( 1, nr_cur, k0, alpha, ai, rs_a0, cs_a0, bj, rs_b0, beta, cij, rs_c0, cs_c0 ); break;
+			}
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_sgemmsup_rv_skx_int_6x32m
+     (
+       conj_t              conja,
+       conj_t              conjb,
+       dim_t               m0,
+       dim_t               n0,
+       dim_t               k0,
+       float*     restrict alpha,
+       float*     restrict a, inc_t rs_a0, inc_t cs_a0,
+       float*     restrict b, inc_t rs_b0, inc_t cs_b0,
+       float*     restrict beta,
+       float*     restrict c, inc_t rs_c0, inc_t cs_c0,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	// This millikernel iterates over the m dimension, stepping through
+	// micropanels of A according to the panel stride embedded in the
+	// auxinfo_t object.
+	const inc_t ps_a0 = bli_auxinfo_ps_a( data );
+	const inc_t ps_b0 = 32 * cs_b0;
+
+	bli_sgemmsup_rv_skx_int_6x32
+	(
+	  m0, n0, k0,
+	  alpha, a, rs_a0, cs_a0, ps_a0,
+	         b, rs_b0,        ps_b0,
+	  beta,  c, rs_c0, cs_c0
+	);
+}
+
+void bli_sgemmsup_rv_skx_int_6x32n
+     (
+       conj_t              conja,
+       conj_t              conjb,
+       dim_t               m0,
+       dim_t               n0,
+       dim_t               k0,
+       float*     restrict alpha,
+       float*     restrict a, inc_t rs_a0, inc_t cs_a0,
+       float*     restrict b, inc_t rs_b0, inc_t cs_b0,
+       float*     restrict beta,
+       float*     restrict c, inc_t rs_c0, inc_t cs_c0,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	// This millikernel iterates over the n dimension, stepping through
+	// micropanels of B according to the panel stride embedded in the
+	// auxinfo_t object.
+	const inc_t ps_a0 = 6 * rs_a0;
+	const inc_t ps_b0 = bli_auxinfo_ps_b( data );
+
+	bli_sgemmsup_rv_skx_int_6x32
+	(
+	  m0, n0, k0,
+	  alpha, a, rs_a0, cs_a0, ps_a0,
+	         b, rs_b0,        ps_b0,
+	  beta,  c, rs_c0, cs_c0
+	);
+}
+
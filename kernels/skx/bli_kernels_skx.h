@@ -32,10 +32,67 @@
 
 */
 
+// -- level-1v -----------------------------------------------------------------
+
+// rotv (intrinsics)
+ROTV_KER_PROT( float,    float,  s, s, rotv_skx_int )
+ROTV_KER_PROT( double,   double, d, d, rotv_skx_int )
+
+// rotmv (intrinsics)
+ROTMV_KER_PROT( float,    s, rotmv_skx_int )
+ROTMV_KER_PROT( double,   d, rotmv_skx_int )
+
+// -- level-3 ------------------------------------------------------------------
+
 GEMM_UKR_PROT( float ,   s, gemm_skx_asm_32x12_l2 )
 GEMM_UKR_PROT( float ,   s, gemm_skx_asm_12x32_l2 )
 
 GEMM_UKR_PROT( double,   d, gemm_skx_asm_16x12_l2 )
 GEMM_UKR_PROT( double,   d, gemm_skx_asm_16x14 )
 
+// gemm (intrinsics)
+GEMM_UKR_PROT( scomplex, c, gemm_skx_int_6x16 )
+GEMM_UKR_PROT( dcomplex, z, gemm_skx_int_6x8 )
+
+// gemmtrsm_l (intrinsics)
+GEMMTRSM_UKR_PROT( scomplex, c, gemmtrsm_l_skx_int_6x16 )
+GEMMTRSM_UKR_PROT( dcomplex, z, gemmtrsm_l_skx_int_6x8 )
+
+// gemmtrsm_u (intrinsics)
+GEMMTRSM_UKR_PROT( scomplex, c, gemmtrsm_u_skx_int_6x16 )
+GEMMTRSM_UKR_PROT( dcomplex, z, gemmtrsm_u_skx_int_6x8 )
+
+// gemm (low-precision, intrinsics)
+// These kernels use the avx512_bf16 and avx512_vnni extensions, which are
+// enabled only for the kernels themselves (via target attributes) since the
+// skx flags do not include them. Compilers that cannot target these
+// extensions skip the kernels, and the context falls back to the reference
+// implementations.
+#if ( defined(__clang__) && __clang_major__ >= 9 ) || \
+    ( defined(__GNUC__) && !defined(__clang__) && \
+      !defined(__INTEL_COMPILER) && __GNUC__ >= 10 )
+#define BLIS_ENABLE_SKX_LPGEMM_KERS
+GEMM_BF16BF16F32_UKR_PROT( gemm_bf16bf16f32_skx_int_12x32 )
+GEMM_U8S8S32_UKR_PROT( gemm_u8s8s32_skx_int_12x32 )
+#endif
+
+PACKM_KER_PROT( float,    s, packm_skx_int_32xk )
+PACKM_KER_PROT( float,    s, packm_skx_int_12xk )
+
+PACKM_KER_PROT( double,   d, packm_skx_int_16xk )
+PACKM_KER_PROT( double,   d, packm_skx_int_14xk )
+
+// -- level-3 sup --------------------------------------------------------------
+
+// gemmsup_rv (intrinsics)
+GEMMSUP_KER_PROT( float,    s, gemmsup_rv_skx_int_6x32m )
+GEMMSUP_KER_PROT( float,    s, gemmsup_rv_skx_int_6x32n )
+GEMMSUP_KER_PROT( double,   d, gemmsup_rv_skx_int_6x16m )
+GEMMSUP_KER_PROT( double,   d, gemmsup_rv_skx_int_6x16n )
+
+// gemmsup_rd (intrinsics)
+GEMMSUP_KER_PROT( float,    s, gemmsup_rd_skx_int_6x32m )
+GEMMSUP_KER_PROT( float,    s, gemmsup_rd_skx_int_6x32n )
+GEMMSUP_KER_PROT( double,   d, gemmsup_rd_skx_int_6x16m )
+GEMMSUP_KER_PROT( double,   d, gemmsup_rd_skx_int_6x16n )
 
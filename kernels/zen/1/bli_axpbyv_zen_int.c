@@ -0,0 +1,344 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// -----------------------------------------------------------------------------
+
+void bli_saxpbyv_zen_int
+     (
+       conj_t           conjx,
+       dim_t            n,
+       float*  restrict alpha,
+       float*  restrict x, inc_t incx,
+       float*  restrict beta,
+       float*  restrict y, inc_t incy,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 8;
+	const dim_t      n_iter_unroll  = 4;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_left;
+
+	float*  restrict x0;
+	float*  restrict y0;
+
+	__m256           alphav, betav;
+	__m256           x0v, x1v, x2v, x3v;
+	__m256           y0v, y1v, y2v, y3v;
+
+	// If the vector dimension is zero, return early.
+	if ( bli_zero_dim1( n ) ) return;
+
+	// If alpha is zero, y is only scaled by beta. (This also handles the
+	// case of beta being zero, in which case scalv uses setv.)
+	if ( PASTEMAC(s,eq0)( *alpha ) )
+	{
+		sscalv_ker_ft f = bli_cntx_get_l1v_ker_dt( BLIS_FLOAT, BLIS_SCALV_KER, cntx );
+
+		f
+		(
+		  BLIS_NO_CONJUGATE,
+		  n,
+		  beta,
+		  y, incy,
+		  cntx
+		);
+		return;
+	}
+
+	// If beta is zero, use scal2v (in case y contains NaN or Inf).
+	if ( PASTEMAC(s,eq0)( *beta ) )
+	{
+		sscal2v_ker_ft f = bli_cntx_get_l1v_ker_dt( BLIS_FLOAT, BLIS_SCAL2V_KER, cntx );
+
+		f
+		(
+		  conjx,
+		  n,
+		  alpha,
+		  x, incx,
+		  y, incy,
+		  cntx
+		);
+		return;
+	}
+
+	// If beta is one, use axpyv.
+	if ( PASTEMAC(s,eq1)( *beta ) )
+	{
+		saxpyv_ker_ft f = bli_cntx_get_l1v_ker_dt( BLIS_FLOAT, BLIS_AXPYV_KER, cntx );
+
+		f
+		(
+		  conjx,
+		  n,
+		  alpha,
+		  x, incx,
+		  y, incy,
+		  cntx
+		);
+		return;
+	}
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter and n_left to use scalar code
+	// for all iterations.
+	if ( incx != 1 || incy != 1 )
+	{
+		n_viter = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	// Broadcast the alpha and beta scalars to all elements of a vector
+	// register.
+	alphav = _mm256_broadcast_ss( alpha );
+	betav  = _mm256_broadcast_ss( beta );
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v = _mm256_loadu_ps( x0 + 0*n_elem_per_reg );
+		x1v = _mm256_loadu_ps( x0 + 1*n_elem_per_reg );
+		x2v = _mm256_loadu_ps( x0 + 2*n_elem_per_reg );
+		x3v = _mm256_loadu_ps( x0 + 3*n_elem_per_reg );
+
+		y0v = _mm256_loadu_ps( y0 + 0*n_elem_per_reg );
+		y1v = _mm256_loadu_ps( y0 + 1*n_elem_per_reg );
+		y2v = _mm256_loadu_ps( y0 + 2*n_elem_per_reg );
+		y3v = _mm256_loadu_ps( y0 + 3*n_elem_per_reg );
+
+		// perform : y := beta * y + alpha * x;
+		y0v = _mm256_mul_ps( betav, y0v );
+		y1v = _mm256_mul_ps( betav, y1v );
+		y2v = _mm256_mul_ps( betav, y2v );
+		y3v = _mm256_mul_ps( betav, y3v );
+
+		y0v = _mm256_fmadd_ps( alphav, x0v, y0v );
+		y1v = _mm256_fmadd_ps( alphav, x1v, y1v );
+		y2v = _mm256_fmadd_ps( alphav, x2v, y2v );
+		y3v = _mm256_fmadd_ps( alphav, x3v, y3v );
+
+		// Store the output.
+		_mm256_storeu_ps( (y0 + 0*n_elem_per_reg), y0v );
+		_mm256_storeu_ps( (y0 + 1*n_elem_per_reg), y1v );
+		_mm256_storeu_ps( (y0 + 2*n_elem_per_reg), y2v );
+		_mm256_storeu_ps( (y0 + 3*n_elem_per_reg), y3v );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+		y0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+	// This avoids a performance penalty caused by false dependencies when
+	// transitioning from from AVX to SSE instructions (which may occur
+	// later, especially if BLIS is compiled with -mfpmath=sse).
+	_mm256_zeroupper();
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( i = 0; i < n_left; ++i )
+	{
+		PASTEMAC(s,axpbys)( *alpha, *x0, *beta, *y0 );
+
+		x0 += incx;
+		y0 += incy;
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_daxpbyv_zen_int
+     (
+       conj_t           conjx,
+       dim_t            n,
+       double* restrict alpha,
+       double* restrict x, inc_t incx,
+       double* restrict beta,
+       double* restrict y, inc_t incy,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 4;
+	const dim_t      n_iter_unroll  = 4;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_left;
+
+	double* restrict x0;
+	double* restrict y0;
+
+	__m256d          alphav, betav;
+	__m256d          x0v, x1v, x2v, x3v;
+	__m256d          y0v, y1v, y2v, y3v;
+
+	// If the vector dimension is zero, return early.
+	if ( bli_zero_dim1( n ) ) return;
+
+	// If alpha is zero, y is only scaled by beta. (This also handles the
+	// case of beta being zero, in which case scalv uses setv.)
+	if ( PASTEMAC(d,eq0)( *alpha ) )
+	{
+		dscalv_ker_ft f = bli_cntx_get_l1v_ker_dt( BLIS_DOUBLE, BLIS_SCALV_KER, cntx );
+
+		f
+		(
+		  BLIS_NO_CONJUGATE,
+		  n,
+		  beta,
+		  y, incy,
+		  cntx
+		);
+		return;
+	}
+
+	// If beta is zero, use scal2v (in case y contains NaN or Inf).
+	if ( PASTEMAC(d,eq0)( *beta ) )
+	{
+		dscal2v_ker_ft f = bli_cntx_get_l1v_ker_dt( BLIS_DOUBLE, BLIS_SCAL2V_KER, cntx );
+
+		f
+		(
+		  conjx,
+		  n,
+		  alpha,
+		  x, incx,
+		  y, incy,
+		  cntx
+		);
+		return;
+	}
+
+	// If beta is one, use axpyv.
+	if ( PASTEMAC(d,eq1)( *beta ) )
+	{
+		daxpyv_ker_ft f = bli_cntx_get_l1v_ker_dt( BLIS_DOUBLE, BLIS_AXPYV_KER, cntx );
+
+		f
+		(
+		  conjx,
+		  n,
+		  alpha,
+		  x, incx,
+		  y, incy,
+		  cntx
+		);
+		return;
+	}
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter and n_left to use scalar code
+	// for all iterations.
+	if ( incx != 1 || incy != 1 )
+	{
+		n_viter = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	// Broadcast the alpha and beta scalars to all elements of a vector
+	// register.
+	alphav = _mm256_broadcast_sd( alpha );
+	betav  = _mm256_broadcast_sd( beta );
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v = _mm256_loadu_pd( x0 + 0*n_elem_per_reg );
+		x1v = _mm256_loadu_pd( x0 + 1*n_elem_per_reg );
+		x2v = _mm256_loadu_pd( x0 + 2*n_elem_per_reg );
+		x3v = _mm256_loadu_pd( x0 + 3*n_elem_per_reg );
+
+		y0v = _mm256_loadu_pd( y0 + 0*n_elem_per_reg );
+		y1v = _mm256_loadu_pd( y0 + 1*n_elem_per_reg );
+		y2v = _mm256_loadu_pd( y0 + 2*n_elem_per_reg );
+		y3v = _mm256_loadu_pd( y0 + 3*n_elem_per_reg );
+
+		// perform : y := beta * y + alpha * x;
+		y0v = _mm256_mul_pd( betav, y0v );
+		y1v = _mm256_mul_pd( betav, y1v );
+		y2v = _mm256_mul_pd( betav, y2v );
+		y3v = _mm256_mul_pd( betav, y3v );
+
+		y0v = _mm256_fmadd_pd( alphav, x0v, y0v );
+		y1v = _mm256_fmadd_pd( alphav, x1v, y1v );
+		y2v = _mm256_fmadd_pd( alphav, x2v, y2v );
+		y3v = _mm256_fmadd_pd( alphav, x3v, y3v );
+
+		// Store the output.
+		_mm256_storeu_pd( (y0 + 0*n_elem_per_reg), y0v );
+		_mm256_storeu_pd( (y0 + 1*n_elem_per_reg), y1v );
+		_mm256_storeu_pd( (y0 + 2*n_elem_per_reg), y2v );
+		_mm256_storeu_pd( (y0 + 3*n_elem_per_reg), y3v );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+		y0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+	// This avoids a performance penalty caused by false dependencies when
+	// transitioning from from AVX to SSE instructions (which may occur
+	// later, especially if BLIS is compiled with -mfpmath=sse).
+	_mm256_zeroupper();
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( i = 0; i < n_left; ++i )
+	{
+		PASTEMAC(d,axpbys)( *alpha, *x0, *beta, *y0 );
+
+		x0 += incx;
+		y0 += incy;
+	}
+}
@@ -261,3 +261,282 @@ void bli_daxpyv_zen_int
 	}
 }
 
+// -----------------------------------------------------------------------------
+
+void bli_caxpyv_zen_int
+     (
+       conj_t           conjx,
+       dim_t            n,
+       scomplex* restrict alpha,
+       scomplex* restrict x, inc_t incx,
+       scomplex* restrict y, inc_t incy,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 8 / 2;
+	const dim_t      n_iter_unroll  = 4;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_left;
+
+	scomplex* restrict x0;
+	scomplex* restrict y0;
+
+	__m256           alphaRv, alphaIv;
+	__m256           maskv;
+	__m256           x0v, x1v, x2v, x3v;
+	__m256           y0v, y1v, y2v, y3v;
+
+	// If the vector dimension is zero, or if alpha is zero, return early.
+	if ( bli_zero_dim1( n ) || PASTEMAC(c,eq0)( *alpha ) ) return;
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter and n_left to use scalar code
+	// for all iterations.
+	if ( incx != 1 || incy != 1 )
+	{
+		n_viter = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	// Broadcast the real and imaginary components of alpha to all elements
+	// of separate vector registers.
+	alphaRv = _mm256_broadcast_ss( &bli_creal( *alpha ) );
+	alphaIv = _mm256_broadcast_ss( &bli_cimag( *alpha ) );
+
+	// If x is to be conjugated, flip the sign bits of its imaginary
+	// components as it is loaded.
+	if ( bli_is_conj( conjx ) ) maskv = _mm256_setr_ps( 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f );
+	else                        maskv = _mm256_setzero_ps();
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v = _mm256_loadu_ps( ( float* )( x0 + 0*n_elem_per_reg ) );
+		x1v = _mm256_loadu_ps( ( float* )( x0 + 1*n_elem_per_reg ) );
+		x2v = _mm256_loadu_ps( ( float* )( x0 + 2*n_elem_per_reg ) );
+		x3v = _mm256_loadu_ps( ( float* )( x0 + 3*n_elem_per_reg ) );
+
+		y0v = _mm256_loadu_ps( ( float* )( y0 + 0*n_elem_per_reg ) );
+		y1v = _mm256_loadu_ps( ( float* )( y0 + 1*n_elem_per_reg ) );
+		y2v = _mm256_loadu_ps( ( float* )( y0 + 2*n_elem_per_reg ) );
+		y3v = _mm256_loadu_ps( ( float* )( y0 + 3*n_elem_per_reg ) );
+
+		x0v = _mm256_xor_ps( x0v, maskv );
+		x1v = _mm256_xor_ps( x1v, maskv );
+		x2v = _mm256_xor_ps( x2v, maskv );
+		x3v = _mm256_xor_ps( x3v, maskv );
+
+		// perform : y := y + alpha_r * x;
+		y0v = _mm256_fmadd_ps( alphaRv, x0v, y0v );
+		y1v = _mm256_fmadd_ps( alphaRv, x1v, y1v );
+		y2v = _mm256_fmadd_ps( alphaRv, x2v, y2v );
+		y3v = _mm256_fmadd_ps( alphaRv, x3v, y3v );
+
+		// Swap the real and imaginary components of x.
+		x0v = _mm256_permute_ps( x0v, 0xB1 );
+		x1v = _mm256_permute_ps( x1v, 0xB1 );
+		x2v = _mm256_permute_ps( x2v, 0xB1 );
+		x3v = _mm256_permute_ps( x3v, 0xB1 );
+
+		// perform : y := y + alpha_i * swap( x ), where the product is
+		// subtracted from the real components and added to the imaginary
+		// components.
+		x0v = _mm256_mul_ps( alphaIv, x0v );
+		x1v = _mm256_mul_ps( alphaIv, x1v );
+		x2v = _mm256_mul_ps( alphaIv, x2v );
+		x3v = _mm256_mul_ps( alphaIv, x3v );
+
+		y0v = _mm256_addsub_ps( y0v, x0v );
+		y1v = _mm256_addsub_ps( y1v, x1v );
+		y2v = _mm256_addsub_ps( y2v, x2v );
+		y3v = _mm256_addsub_ps( y3v, x3v );
+
+		// Store the output.
+		_mm256_storeu_ps( ( float* )( y0 + 0*n_elem_per_reg ), y0v );
+		_mm256_storeu_ps( ( float* )( y0 + 1*n_elem_per_reg ), y1v );
+		_mm256_storeu_ps( ( float* )( y0 + 2*n_elem_per_reg ), y2v );
+		_mm256_storeu_ps( ( float* )( y0 + 3*n_elem_per_reg ), y3v );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+		y0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+	// This avoids a performance penalty caused by false dependencies when
+	// transitioning from from AVX to SSE instructions (which may occur
+	// later, especially if BLIS is compiled with -mfpmath=sse).
+	_mm256_zeroupper();
+
+	// If there are leftover iterations, perform them with scalar code.
+	if ( bli_is_conj( conjx ) )
+	{
+		for ( i = 0; i < n_left; ++i )
+		{
+			PASTEMAC(c,axpyjs)( *alpha, *x0, *y0 );
+
+			x0 += incx;
+			y0 += incy;
+		}
+	}
+	else
+	{
+		for ( i = 0; i < n_left; ++i )
+		{
+			PASTEMAC(c,axpys)( *alpha, *x0, *y0 );
+
+			x0 += incx;
+			y0 += incy;
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_zaxpyv_zen_int
+     (
+       conj_t           conjx,
+       dim_t            n,
+       dcomplex* restrict alpha,
+       dcomplex* restrict x, inc_t incx,
+       dcomplex* restrict y, inc_t incy,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 4 / 2;
+	const dim_t      n_iter_unroll  = 4;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_left;
+
+	dcomplex* restrict x0;
+	dcomplex* restrict y0;
+
+	__m256d          alphaRv, alphaIv;
+	__m256d          maskv;
+	__m256d          x0v, x1v, x2v, x3v;
+	__m256d          y0v, y1v, y2v, y3v;
+
+	// If the vector dimension is zero, or if alpha is zero, return early.
+	if ( bli_zero_dim1( n ) || PASTEMAC(z,eq0)( *alpha ) ) return;
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter and n_left to use scalar code
+	// for all iterations.
+	if ( incx != 1 || incy != 1 )
+	{
+		n_viter = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	// Broadcast the real and imaginary components of alpha to all elements
+	// of separate vector registers.
+	alphaRv = _mm256_broadcast_sd( &bli_zreal( *alpha ) );
+	alphaIv = _mm256_broadcast_sd( &bli_zimag( *alpha ) );
+
+	// If x is to be conjugated, flip the sign bits of its imaginary
+	// components as it is loaded.
+	if ( bli_is_conj( conjx ) ) maskv = _mm256_setr_pd( 0.0, -0.0, 0.0, -0.0 );
+	else                        maskv = _mm256_setzero_pd();
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v = _mm256_loadu_pd( ( double* )( x0 + 0*n_elem_per_reg ) );
+		x1v = _mm256_loadu_pd( ( double* )( x0 + 1*n_elem_per_reg ) );
+		x2v = _mm256_loadu_pd( ( double* )( x0 + 2*n_elem_per_reg ) );
+		x3v = _mm256_loadu_pd( ( double* )( x0 + 3*n_elem_per_reg ) );
+
+		y0v = _mm256_loadu_pd( ( double* )( y0 + 0*n_elem_per_reg ) );
+		y1v = _mm256_loadu_pd( ( double* )( y0 + 1*n_elem_per_reg ) );
+		y2v = _mm256_loadu_pd( ( double* )( y0 + 2*n_elem_per_reg ) );
+		y3v = _mm256_loadu_pd( ( double* )( y0 + 3*n_elem_per_reg ) );
+
+		x0v = _mm256_xor_pd( x0v, maskv );
+		x1v = _mm256_xor_pd( x1v, maskv );
+		x2v = _mm256_xor_pd( x2v, maskv );
+		x3v = _mm256_xor_pd( x3v, maskv );
+
+		// perform : y := y + alpha_r * x;
+		y0v = _mm256_fmadd_pd( alphaRv, x0v, y0v );
+		y1v = _mm256_fmadd_pd( alphaRv, x1v, y1v );
+		y2v = _mm256_fmadd_pd( alphaRv, x2v, y2v );
+		y3v = _mm256_fmadd_pd( alphaRv, x3v, y3v );
+
+		// Swap the real and imaginary components of x.
+		x0v = _mm256_permute_pd( x0v, 0x5 );
+		x1v = _mm256_permute_pd( x1v, 0x5 );
+		x2v = _mm256_permute_pd( x2v, 0x5 );
+		x3v = _mm256_permute_pd( x3v, 0x5 );
+
+		// perform : y := y + alpha_i * swap( x ), where the product is
+		// subtracted from the real components and added to the imaginary
+		// components.
+		x0v = _mm256_mul_pd( alphaIv, x0v );
+		x1v = _mm256_mul_pd( alphaIv, x1v );
+		x2v = _mm256_mul_pd( alphaIv, x2v );
+		x3v = _mm256_mul_pd( alphaIv, x3v );
+
+		y0v = _mm256_addsub_pd( y0v, x0v );
+		y1v = _mm256_addsub_pd( y1v, x1v );
+		y2v = _mm256_addsub_pd( y2v, x2v );
+		y3v = _mm256_addsub_pd( y3v, x3v );
+
+		// Store the output.
+		_mm256_storeu_pd( ( double* )( y0 + 0*n_elem_per_reg ), y0v );
+		_mm256_storeu_pd( ( double* )( y0 + 1*n_elem_per_reg ), y1v );
+		_mm256_storeu_pd( ( double* )( y0 + 2*n_elem_per_reg ), y2v );
+		_mm256_storeu_pd( ( double* )( y0 + 3*n_elem_per_reg ), y3v );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+		y0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+	// This avoids a performance penalty caused by false dependencies when
+	// transitioning from from AVX to SSE instructions (which may occur
+	// later, especially if BLIS is compiled with -mfpmath=sse).
+	_mm256_zeroupper();
+
+	// If there are leftover iterations, perform them with scalar code.
+	if ( bli_is_conj( conjx ) )
+	{
+		for ( i = 0; i < n_left; ++i )
+		{
+			PASTEMAC(z,axpyjs)( *alpha, *x0, *y0 );
+
+			x0 += incx;
+			y0 += incy;
+		}
+	}
+	else
+	{
+		for ( i = 0; i < n_left; ++i )
+		{
+			PASTEMAC(z,axpys)( *alpha, *x0, *y0 );
+
+			x0 += incx;
+			y0 += incy;
+		}
+	}
+}
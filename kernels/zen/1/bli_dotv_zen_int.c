@@ -295,3 +295,330 @@ void bli_ddotv_zen_int
 	PASTEMAC(d,copys)( rho0, *rho );
 }
 
+// -----------------------------------------------------------------------------
+
+void bli_cdotv_zen_int
+     (
+       conj_t           conjx,
+       conj_t           conjy,
+       dim_t            n,
+       scomplex* restrict x, inc_t incx,
+       scomplex* restrict y, inc_t incy,
+       scomplex* restrict rho,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 8 / 2;
+	const dim_t      n_iter_unroll  = 2;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_left;
+
+	scomplex* restrict x0;
+	scomplex* restrict y0;
+	scomplex           rho0;
+	conj_t           conjx_use;
+
+	__m256           x0v, x1v;
+	__m256           y0v, y1v;
+	__m256           rhoa0v, rhoa1v;
+	__m256           rhob0v, rhob1v;
+
+	float            rhoa[ 8 ] __attribute__((aligned(64)));
+	float            rhob[ 8 ] __attribute__((aligned(64)));
+	float            rr, ii, ri, ir;
+
+	// If the vector dimension is zero, set rho to zero and return early.
+	if ( bli_zero_dim1( n ) )
+	{
+		PASTEMAC(c,set0s)( *rho );
+		return;
+	}
+
+	// If y must be conjugated, we do so indirectly by first toggling the
+	// effective conjugation of x and then conjugating the resulting dot
+	// product.
+	conjx_use = conjx;
+
+	if ( bli_is_conj( conjy ) )
+		bli_toggle_conj( &conjx_use );
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter and n_left to use scalar code
+	// for all iterations.
+	if ( incx != 1 || incy != 1 )
+	{
+		n_viter = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	// Initialize the accumulators to zero. The "a" vectors accumulate the
+	// element-wise products of x and y, i.e., (xr*yr, xi*yi) pairs, while
+	// the "b" vectors accumulate products of x and y with the real and
+	// imaginary components of y swapped, i.e., (xr*yi, xi*yr) pairs.
+	rhoa0v = _mm256_setzero_ps();
+	rhoa1v = _mm256_setzero_ps();
+	rhob0v = _mm256_setzero_ps();
+	rhob1v = _mm256_setzero_ps();
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the x and y input vector elements.
+		x0v = _mm256_loadu_ps( ( float* )( x0 + 0*n_elem_per_reg ) );
+		y0v = _mm256_loadu_ps( ( float* )( y0 + 0*n_elem_per_reg ) );
+
+		x1v = _mm256_loadu_ps( ( float* )( x0 + 1*n_elem_per_reg ) );
+		y1v = _mm256_loadu_ps( ( float* )( y0 + 1*n_elem_per_reg ) );
+
+		rhoa0v = _mm256_fmadd_ps( x0v, y0v, rhoa0v );
+		rhoa1v = _mm256_fmadd_ps( x1v, y1v, rhoa1v );
+
+		// Swap the real and imaginary components of y.
+		y0v = _mm256_permute_ps( y0v, 0xB1 );
+		y1v = _mm256_permute_ps( y1v, 0xB1 );
+
+		rhob0v = _mm256_fmadd_ps( x0v, y0v, rhob0v );
+		rhob1v = _mm256_fmadd_ps( x1v, y1v, rhob1v );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+		y0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	// Accumulate the unrolled rho vectors into a single vector each.
+	rhoa0v = _mm256_add_ps( rhoa0v, rhoa1v );
+	rhob0v = _mm256_add_ps( rhob0v, rhob1v );
+
+	_mm256_store_ps( rhoa, rhoa0v );
+	_mm256_store_ps( rhob, rhob0v );
+
+	// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+	// This avoids a performance penalty caused by false dependencies when
+	// transitioning from from AVX to SSE instructions (which may occur
+	// as soon as the n_left cleanup loop below if BLIS is compiled with
+	// -mfpmath=sse).
+	_mm256_zeroupper();
+
+	// Sum the even and odd elements of each accumulator separately.
+	rr = 0; ii = 0; ri = 0; ir = 0;
+
+	for ( i = 0; i < 8; i += 2 )
+	{
+		rr += rhoa[ i + 0 ];
+		ii += rhoa[ i + 1 ];
+		ri += rhob[ i + 0 ];
+		ir += rhob[ i + 1 ];
+	}
+
+	// Combine the partial sums into the dot product of the vectorized
+	// portion of x and y (with x conjugated, if requested).
+	if ( bli_is_conj( conjx_use ) )
+	{
+		PASTEMAC(c,sets)( rr + ii, ri - ir, rho0 );
+	}
+	else
+	{
+		PASTEMAC(c,sets)( rr - ii, ri + ir, rho0 );
+	}
+
+	// If there are leftover iterations, perform them with scalar code.
+	if ( bli_is_conj( conjx_use ) )
+	{
+		for ( i = 0; i < n_left; ++i )
+		{
+			PASTEMAC(c,dotjs)( *x0, *y0, rho0 );
+
+			x0 += incx;
+			y0 += incy;
+		}
+	}
+	else
+	{
+		for ( i = 0; i < n_left; ++i )
+		{
+			PASTEMAC(c,dots)( *x0, *y0, rho0 );
+
+			x0 += incx;
+			y0 += incy;
+		}
+	}
+
+	if ( bli_is_conj( conjy ) )
+		PASTEMAC(c,conjs)( rho0 );
+
+	// Copy the final result into the output variable.
+	PASTEMAC(c,copys)( rho0, *rho );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_zdotv_zen_int
+     (
+       conj_t           conjx,
+       conj_t           conjy,
+       dim_t            n,
+       dcomplex* restrict x, inc_t incx,
+       dcomplex* restrict y, inc_t incy,
+       dcomplex* restrict rho,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 4 / 2;
+	const dim_t      n_iter_unroll  = 2;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_left;
+
+	dcomplex* restrict x0;
+	dcomplex* restrict y0;
+	dcomplex           rho0;
+	conj_t           conjx_use;
+
+	__m256d          x0v, x1v;
+	__m256d          y0v, y1v;
+	__m256d          rhoa0v, rhoa1v;
+	__m256d          rhob0v, rhob1v;
+
+	double           rhoa[ 4 ] __attribute__((aligned(64)));
+	double           rhob[ 4 ] __attribute__((aligned(64)));
+	double           rr, ii, ri, ir;
+
+	// If the vector dimension is zero, set rho to zero and return early.
+	if ( bli_zero_dim1( n ) )
+	{
+		PASTEMAC(z,set0s)( *rho );
+		return;
+	}
+
+	// If y must be conjugated, we do so indirectly by first toggling the
+	// effective conjugation of x and then conjugating the resulting dot
+	// product.
+	conjx_use = conjx;
+
+	if ( bli_is_conj( conjy ) )
+		bli_toggle_conj( &conjx_use );
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter and n_left to use scalar code
+	// for all iterations.
+	if ( incx != 1 || incy != 1 )
+	{
+		n_viter = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	// Initialize the accumulators to zero. The "a" vectors accumulate the
+	// element-wise products of x and y, i.e., (xr*yr, xi*yi) pairs, while
+	// the "b" vectors accumulate products of x and y with the real and
+	// imaginary components of y swapped, i.e., (xr*yi, xi*yr) pairs.
+	rhoa0v = _mm256_setzero_pd();
+	rhoa1v = _mm256_setzero_pd();
+	rhob0v = _mm256_setzero_pd();
+	rhob1v = _mm256_setzero_pd();
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the x and y input vector elements.
+		x0v = _mm256_loadu_pd( ( double* )( x0 + 0*n_elem_per_reg ) );
+		y0v = _mm256_loadu_pd( ( double* )( y0 + 0*n_elem_per_reg ) );
+
+		x1v = _mm256_loadu_pd( ( double* )( x0 + 1*n_elem_per_reg ) );
+		y1v = _mm256_loadu_pd( ( double* )( y0 + 1*n_elem_per_reg ) );
+
+		rhoa0v = _mm256_fmadd_pd( x0v, y0v, rhoa0v );
+		rhoa1v = _mm256_fmadd_pd( x1v, y1v, rhoa1v );
+
+		// Swap the real and imaginary components of y.
+		y0v = _mm256_permute_pd( y0v, 0x5 );
+		y1v = _mm256_permute_pd( y1v, 0x5 );
+
+		rhob0v = _mm256_fmadd_pd( x0v, y0v, rhob0v );
+		rhob1v = _mm256_fmadd_pd( x1v, y1v, rhob1v );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+		y0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	// Accumulate the unrolled rho vectors into a single vector each.
+	rhoa0v = _mm256_add_pd( rhoa0v, rhoa1v );
+	rhob0v = _mm256_add_pd( rhob0v, rhob1v );
+
+	_mm256_store_pd( rhoa, rhoa0v );
+	_mm256_store_pd( rhob, rhob0v );
+
+	// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+	// This avoids a performance penalty caused by false dependencies when
+	// transitioning from from AVX to SSE instructions (which may occur
+	// as soon as the n_left cleanup loop below if BLIS is compiled with
+	// -mfpmath=sse).
+	_mm256_zeroupper();
+
+	// Sum the even and odd elements of each accumulator separately.
+	rr = 0; ii = 0; ri = 0; ir = 0;
+
+	for ( i = 0; i < 4; i += 2 )
+	{
+		rr += rhoa[ i + 0 ];
+		ii += rhoa[ i + 1 ];
+		ri += rhob[ i + 0 ];
+		ir += rhob[ i + 1 ];
+	}
+
+	// Combine the partial sums into the dot product of the vectorized
+	// portion of x and y (with x conjugated, if requested).
+	if ( bli_is_conj( conjx_use ) )
+	{
+		PASTEMAC(z,sets)( rr + ii, ri - ir, rho0 );
+	}
+	else
+	{
+		PASTEMAC(z,sets)( rr - ii, ri + ir, rho0 );
+	}
+
+	// If there are leftover iterations, perform them with scalar code.
+	if ( bli_is_conj( conjx_use ) )
+	{
+		for ( i = 0; i < n_left; ++i )
+		{
+			PASTEMAC(z,dotjs)( *x0, *y0, rho0 );
+
+			x0 += incx;
+			y0 += incy;
+		}
+	}
+	else
+	{
+		for ( i = 0; i < n_left; ++i )
+		{
+			PASTEMAC(z,dots)( *x0, *y0, rho0 );
+
+			x0 += incx;
+			y0 += incy;
+		}
+	}
+
+	if ( bli_is_conj( conjy ) )
+		PASTEMAC(z,conjs)( rho0 );
+
+	// Copy the final result into the output variable.
+	PASTEMAC(z,copys)( rho0, *rho );
+}
@@ -0,0 +1,443 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/* Union data structure to access AVX registers
+   One 256-bit AVX register holds 8 SP elements. */
+typedef union
+{
+	__m256  v;
+	float   f[8] __attribute__((aligned(64)));
+} v8sf_t;
+
+/* Union data structure to access AVX registers
+*  One 256-bit AVX register holds 4 DP elements. */
+typedef union
+{
+	__m256d v;
+	double  d[4] __attribute__((aligned(64)));
+} v4df_t;
+
+// -----------------------------------------------------------------------------
+
+void bli_snormfv_zen_int
+     (
+       dim_t            n,
+       float*  restrict x, inc_t incx,
+       float*  restrict norm,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 8;
+	const dim_t      n_iter_unroll  = 2;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_left;
+
+	float*  restrict x0;
+	float            asml, amed, abig;
+
+	v8sf_t           sml0v, med0v, big0v;
+	v8sf_t           sml1v, med1v, big1v;
+	__m256           x0v, x1v;
+	__m256           s0v, s1v, b0v, b1v;
+	__m256           e0v, e1v;
+
+	// If the vector dimension is zero, set the norm to zero and return
+	// early.
+	if ( bli_zero_dim1( n ) )
+	{
+		PASTEMAC(s,set0s)( *norm );
+		return;
+	}
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter and n_left to use scalar code
+	// for all iterations.
+	if ( incx != 1 )
+	{
+		n_viter = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+
+	// Initialize the accumulators of the small, medium, and big values.
+	asml = 0; amed = 0; abig = 0;
+
+	sml0v.v = _mm256_setzero_ps(); med0v.v = _mm256_setzero_ps(); big0v.v = _mm256_setzero_ps();
+	sml1v.v = _mm256_setzero_ps(); med1v.v = _mm256_setzero_ps(); big1v.v = _mm256_setzero_ps();
+
+	// Broadcast the sign bit mask and the scaling constants of Blue's
+	// algorithm (see bli_l1v_nrm2.h).
+	const __m256  signv = _mm256_set1_ps( -0.0f );
+	const __m256  tsmlv = _mm256_set1_ps( bli_snrm2_tsml );
+	const __m256  tbigv = _mm256_set1_ps( bli_snrm2_tbig );
+	const __m256  ssmlv = _mm256_set1_ps( bli_snrm2_ssml );
+	const __m256  sbigv = _mm256_set1_ps( bli_snrm2_sbig );
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the x vector elements and compute their absolute values.
+		x0v = _mm256_andnot_ps( signv, _mm256_loadu_ps( x0 + 0*n_elem_per_reg ) );
+		x1v = _mm256_andnot_ps( signv, _mm256_loadu_ps( x0 + 1*n_elem_per_reg ) );
+
+		// Identify the small and big elements. NaN elements are neither
+		// and are thus propagated through the medium accumulators.
+		s0v = _mm256_cmp_ps( x0v, tsmlv, _CMP_LT_OQ );
+		s1v = _mm256_cmp_ps( x1v, tsmlv, _CMP_LT_OQ );
+		b0v = _mm256_cmp_ps( x0v, tbigv, _CMP_GT_OQ );
+		b1v = _mm256_cmp_ps( x1v, tbigv, _CMP_GT_OQ );
+
+		e0v = _mm256_or_ps( s0v, b0v );
+		e1v = _mm256_or_ps( s1v, b1v );
+
+		if ( _mm256_testz_ps( e0v, e0v ) && _mm256_testz_ps( e1v, e1v ) )
+		{
+			// In the common case, every element is of medium size and
+			// may be squared without scaling.
+			med0v.v = _mm256_fmadd_ps( x0v, x0v, med0v.v );
+			med1v.v = _mm256_fmadd_ps( x1v, x1v, med1v.v );
+		}
+		else
+		{
+			// Otherwise, scale the small and big elements and accumulate
+			// each class of elements separately.
+			s0v = _mm256_mul_ps( _mm256_and_ps( s0v, x0v ), ssmlv );
+			s1v = _mm256_mul_ps( _mm256_and_ps( s1v, x1v ), ssmlv );
+			b0v = _mm256_mul_ps( _mm256_and_ps( b0v, x0v ), sbigv );
+			b1v = _mm256_mul_ps( _mm256_and_ps( b1v, x1v ), sbigv );
+			x0v = _mm256_andnot_ps( e0v, x0v );
+			x1v = _mm256_andnot_ps( e1v, x1v );
+
+			sml0v.v = _mm256_fmadd_ps( s0v, s0v, sml0v.v );
+			sml1v.v = _mm256_fmadd_ps( s1v, s1v, sml1v.v );
+			med0v.v = _mm256_fmadd_ps( x0v, x0v, med0v.v );
+			med1v.v = _mm256_fmadd_ps( x1v, x1v, med1v.v );
+			big0v.v = _mm256_fmadd_ps( b0v, b0v, big0v.v );
+			big1v.v = _mm256_fmadd_ps( b1v, b1v, big1v.v );
+		}
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	// Accumulate the unrolled accumulator vectors into the first ones.
+	sml0v.v = _mm256_add_ps( sml0v.v, sml1v.v );
+	med0v.v = _mm256_add_ps( med0v.v, med1v.v );
+	big0v.v = _mm256_add_ps( big0v.v, big1v.v );
+
+	// Accumulate the elements of the accumulator vectors into the scalars.
+	for ( i = 0; i < n_elem_per_reg; ++i )
+	{
+		asml += sml0v.f[i];
+		amed += med0v.f[i];
+		abig += big0v.f[i];
+	}
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( i = 0; i < n_left; ++i )
+	{
+		bli_snrm2_blue_accum( *x0, &asml, &amed, &abig );
+
+		x0 += incx;
+	}
+
+	// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+	// This avoids a performance penalty caused by false dependencies when
+	// transitioning from from AVX to SSE instructions (which may occur
+	// later, especially if BLIS is compiled with -mfpmath=sse).
+	_mm256_zeroupper();
+
+	// Combine the accumulators into the norm.
+	*norm = bli_snrm2_blue_finalize( asml, amed, abig );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_dnormfv_zen_int
+     (
+       dim_t            n,
+       double* restrict x, inc_t incx,
+       double* restrict norm,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 4;
+	const dim_t      n_iter_unroll  = 2;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_left;
+
+	double* restrict x0;
+	double           asml, amed, abig;
+
+	v4df_t           sml0v, med0v, big0v;
+	v4df_t           sml1v, med1v, big1v;
+	__m256d          x0v, x1v;
+	__m256d          s0v, s1v, b0v, b1v;
+	__m256d          e0v, e1v;
+
+	// If the vector dimension is zero, set the norm to zero and return
+	// early.
+	if ( bli_zero_dim1( n ) )
+	{
+		PASTEMAC(d,set0s)( *norm );
+		return;
+	}
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter and n_left to use scalar code
+	// for all iterations.
+	if ( incx != 1 )
+	{
+		n_viter = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+
+	// Initialize the accumulators of the small, medium, and big values.
+	asml = 0; amed = 0; abig = 0;
+
+	sml0v.v = _mm256_setzero_pd(); med0v.v = _mm256_setzero_pd(); big0v.v = _mm256_setzero_pd();
+	sml1v.v = _mm256_setzero_pd(); med1v.v = _mm256_setzero_pd(); big1v.v = _mm256_setzero_pd();
+
+	// Broadcast the sign bit mask and the scaling constants of Blue's
+	// algorithm (see bli_l1v_nrm2.h).
+	const __m256d signv = _mm256_set1_pd( -0.0 );
+	const __m256d tsmlv = _mm256_set1_pd( bli_dnrm2_tsml );
+	const __m256d tbigv = _mm256_set1_pd( bli_dnrm2_tbig );
+	const __m256d ssmlv = _mm256_set1_pd( bli_dnrm2_ssml );
+	const __m256d sbigv = _mm256_set1_pd( bli_dnrm2_sbig );
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the x vector elements and compute their absolute values.
+		x0v = _mm256_andnot_pd( signv, _mm256_loadu_pd( x0 + 0*n_elem_per_reg ) );
+		x1v = _mm256_andnot_pd( signv, _mm256_loadu_pd( x0 + 1*n_elem_per_reg ) );
+
+		// Identify the small and big elements. NaN elements are neither
+		// and are thus propagated through the medium accumulators.
+		s0v = _mm256_cmp_pd( x0v, tsmlv, _CMP_LT_OQ );
+		s1v = _mm256_cmp_pd( x1v, tsmlv, _CMP_LT_OQ );
+		b0v = _mm256_cmp_pd( x0v, tbigv, _CMP_GT_OQ );
+		b1v = _mm256_cmp_pd( x1v, tbigv, _CMP_GT_OQ );
+
+		e0v = _mm256_or_pd( s0v, b0v );
+		e1v = _mm256_or_pd( s1v, b1v );
+
+		if ( _mm256_testz_pd( e0v, e0v ) && _mm256_testz_pd( e1v, e1v ) )
+		{
+			// In the common case, every element is of medium size and
+			// may be squared without scaling.
+			med0v.v = _mm256_fmadd_pd( x0v, x0v, med0v.v );
+			med1v.v = _mm256_fmadd_pd( x1v, x1v, med1v.v );
+		}
+		else
+		{
+			// Otherwise, scale the small and big elements and accumulate
+			// each class of elements separately.
+			s0v = _mm256_mul_pd( _mm256_and_pd( s0v, x0v ), ssmlv );
+			s1v = _mm256_mul_pd( _mm256_and_pd( s1v, x1v ), ssmlv );
+			b0v = _mm256_mul_pd( _mm256_and_pd( b0v, x0v ), sbigv );
+			b1v = _mm256_mul_pd( _mm256_and_pd( b1v, x1v ), sbigv );
+			x0v = _mm256_andnot_pd( e0v, x0v );
+			x1v = _mm256_andnot_pd( e1v, x1v );
+
+			sml0v.v = _mm256_fmadd_pd( s0v, s0v, sml0v.v );
+			sml1v.v = _mm256_fmadd_pd( s1v, s1v, sml1v.v );
+			med0v.v = _mm256_fmadd_pd( x0v, x0v, med0v.v );
+			med1v.v = _mm256_fmadd_pd( x1v, x1v, med1v.v );
+			big0v.v = _mm256_fmadd_pd( b0v, b0v, big0v.v );
+			big1v.v = _mm256_fmadd_pd( b1v, b1v, big1v.v );
+		}
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	// Accumulate the unrolled accumulator vectors into the first ones.
+	sml0v.v = _mm256_add_pd( sml0v.v, sml1v.v );
+	med0v.v = _mm256_add_pd( med0v.v, med1v.v );
+	big0v.v = _mm256_add_pd( big0v.v, big1v.v );
+
+	// Accumulate the elements of the accumulator vectors into the scalars.
+	for ( i = 0; i < n_elem_per_reg; ++i )
+	{
+		asml += sml0v.d[i];
+		amed += med0v.d[i];
+		abig += big0v.d[i];
+	}
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( i = 0; i < n_left; ++i )
+	{
+		bli_dnrm2_blue_accum( *x0, &asml, &amed, &abig );
+
+		x0 += incx;
+	}
+
+	// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+	// This avoids a performance penalty caused by false dependencies when
+	// transitioning from from AVX to SSE instructions (which may occur
+	// later, especially if BLIS is compiled with -mfpmath=sse).
+	_mm256_zeroupper();
+
+	// Combine the accumulators into the norm.
+	*norm = bli_dnrm2_blue_finalize( asml, amed, abig );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_cnormfv_zen_int
+     (
+       dim_t              n,
+       scomplex* restrict x, inc_t incx,
+       float*    restrict norm,
+       cntx_t*   restrict cntx
+     )
+{
+	dim_t              i;
+
+	scomplex* restrict chi1;
+	float              asml, amed, abig;
+
+	// If the vector dimension is zero, set the norm to zero and return
+	// early.
+	if ( bli_zero_dim1( n ) )
+	{
+		PASTEMAC(s,set0s)( *norm );
+		return;
+	}
+
+	// The norm of a complex vector is the norm of the real vector formed
+	// by its interleaved real and imaginary parts. If x is stored
+	// contiguously, we can use the real domain kernel directly.
+	if ( incx == 1 )
+	{
+		bli_snormfv_zen_int
+		(
+		  2 * n,
+		  ( float* )x, 1,
+		  norm,
+		  cntx
+		);
+		return;
+	}
+
+	asml = 0; amed = 0; abig = 0;
+
+	chi1 = x;
+
+	for ( i = 0; i < n; ++i )
+	{
+		bli_snrm2_blue_accum( chi1->real, &asml, &amed, &abig );
+		bli_snrm2_blue_accum( chi1->imag, &asml, &amed, &abig );
+
+		chi1 += incx;
+	}
+
+	// Combine the accumulators into the norm.
+	*norm = bli_snrm2_blue_finalize( asml, amed, abig );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_znormfv_zen_int
+     (
+       dim_t              n,
+       dcomplex* restrict x, inc_t incx,
+       double*   restrict norm,
+       cntx_t*   restrict cntx
+     )
+{
+	dim_t              i;
+
+	dcomplex* restrict chi1;
+	double             asml, amed, abig;
+
+	// If the vector dimension is zero, set the norm to zero and return
+	// early.
+	if ( bli_zero_dim1( n ) )
+	{
+		PASTEMAC(d,set0s)( *norm );
+		return;
+	}
+
+	// The norm of a complex vector is the norm of the real vector formed
+	// by its interleaved real and imaginary parts. If x is stored
+	// contiguously, we can use the real domain kernel directly.
+	if ( incx == 1 )
+	{
+		bli_dnormfv_zen_int
+		(
+		  2 * n,
+		  ( double* )x, 1,
+		  norm,
+		  cntx
+		);
+		return;
+	}
+
+	asml = 0; amed = 0; abig = 0;
+
+	chi1 = x;
+
+	for ( i = 0; i < n; ++i )
+	{
+		bli_dnrm2_blue_accum( chi1->real, &asml, &amed, &abig );
+		bli_dnrm2_blue_accum( chi1->imag, &asml, &amed, &abig );
+
+		chi1 += incx;
+	}
+
+	// Combine the accumulators into the norm.
+	*norm = bli_dnrm2_blue_finalize( asml, amed, abig );
+}
+
@@ -0,0 +1,281 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+// -----------------------------------------------------------------------------
+
+void bli_srotmv_zen_int
+     (
+       dim_t            n,
+       float*  restrict h,
+       float*  restrict x, inc_t incx,
+       float*  restrict y, inc_t incy,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 8;
+	const dim_t      n_iter_unroll  = 4;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_vleft;
+	dim_t            n_left;
+
+	float*  restrict x0;
+	float*  restrict y0;
+
+	__m256           h11v, h21v, h12v, h22v;
+	__m256           x0v, x1v, x2v, x3v;
+	__m256           y0v, y1v, y2v, y3v;
+
+	// If the vector dimension is zero, return early.
+	if ( bli_zero_dim1( n ) ) return;
+
+	// h holds the 2x2 transformation in column-major order.
+	const float      h11 = h[0];
+	const float      h21 = h[1];
+	const float      h12 = h[2];
+	const float      h22 = h[3];
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of unrolled and single-register vectorized
+	// iterations, and the number of leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_vleft = ( n ) % ( n_elem_per_reg * n_iter_unroll ) / n_elem_per_reg;
+	n_left  = ( n ) % ( n_elem_per_reg );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter, n_vleft, and n_left to use
+	// scalar code for all iterations.
+	if ( incx != 1 || incy != 1 )
+	{
+		n_viter = 0;
+		n_vleft = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	// Broadcast the elements of h to all elements of vector registers.
+	h11v = _mm256_broadcast_ss( h + 0 );
+	h21v = _mm256_broadcast_ss( h + 1 );
+	h12v = _mm256_broadcast_ss( h + 2 );
+	h22v = _mm256_broadcast_ss( h + 3 );
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v = _mm256_loadu_ps( x0 + 0*n_elem_per_reg );
+		x1v = _mm256_loadu_ps( x0 + 1*n_elem_per_reg );
+		x2v = _mm256_loadu_ps( x0 + 2*n_elem_per_reg );
+		x3v = _mm256_loadu_ps( x0 + 3*n_elem_per_reg );
+
+		y0v = _mm256_loadu_ps( y0 + 0*n_elem_per_reg );
+		y1v = _mm256_loadu_ps( y0 + 1*n_elem_per_reg );
+		y2v = _mm256_loadu_ps( y0 + 2*n_elem_per_reg );
+		y3v = _mm256_loadu_ps( y0 + 3*n_elem_per_reg );
+
+		// x := h11 * x + h12 * y; y := h21 * x + h22 * y
+		_mm256_storeu_ps( (x0 + 0*n_elem_per_reg), _mm256_fmadd_ps( h11v, x0v, _mm256_mul_ps( h12v, y0v ) ) );
+		_mm256_storeu_ps( (x0 + 1*n_elem_per_reg), _mm256_fmadd_ps( h11v, x1v, _mm256_mul_ps( h12v, y1v ) ) );
+		_mm256_storeu_ps( (x0 + 2*n_elem_per_reg), _mm256_fmadd_ps( h11v, x2v, _mm256_mul_ps( h12v, y2v ) ) );
+		_mm256_storeu_ps( (x0 + 3*n_elem_per_reg), _mm256_fmadd_ps( h11v, x3v, _mm256_mul_ps( h12v, y3v ) ) );
+
+		_mm256_storeu_ps( (y0 + 0*n_elem_per_reg), _mm256_fmadd_ps( h21v, x0v, _mm256_mul_ps( h22v, y0v ) ) );
+		_mm256_storeu_ps( (y0 + 1*n_elem_per_reg), _mm256_fmadd_ps( h21v, x1v, _mm256_mul_ps( h22v, y1v ) ) );
+		_mm256_storeu_ps( (y0 + 2*n_elem_per_reg), _mm256_fmadd_ps( h21v, x2v, _mm256_mul_ps( h22v, y2v ) ) );
+		_mm256_storeu_ps( (y0 + 3*n_elem_per_reg), _mm256_fmadd_ps( h21v, x3v, _mm256_mul_ps( h22v, y3v ) ) );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+		y0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	for ( i = 0; i < n_vleft; ++i )
+	{
+		x0v = _mm256_loadu_ps( x0 );
+		y0v = _mm256_loadu_ps( y0 );
+
+		_mm256_storeu_ps( x0, _mm256_fmadd_ps( h11v, x0v, _mm256_mul_ps( h12v, y0v ) ) );
+		_mm256_storeu_ps( y0, _mm256_fmadd_ps( h21v, x0v, _mm256_mul_ps( h22v, y0v ) ) );
+
+		x0 += n_elem_per_reg;
+		y0 += n_elem_per_reg;
+	}
+
+	// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+	// This avoids a performance penalty caused by false dependencies when
+	// transitioning from from AVX to SSE instructions (which may occur
+	// later, especially if BLIS is compiled with -mfpmath=sse).
+	_mm256_zeroupper();
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( i = 0; i < n_left; ++i )
+	{
+		const float x0c = *x0;
+		const float y0c = *y0;
+
+		*x0 = h11 * x0c + h12 * y0c;
+		*y0 = h21 * x0c + h22 * y0c;
+
+		x0 += incx;
+		y0 += incy;
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_drotmv_zen_int
+     (
+       dim_t            n,
+       double* restrict h,
+       double* restrict x, inc_t incx,
+       double* restrict y, inc_t incy,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 4;
+	const dim_t      n_iter_unroll  = 4;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_vleft;
+	dim_t            n_left;
+
+	double* restrict x0;
+	double* restrict y0;
+
+	__m256d          h11v, h21v, h12v, h22v;
+	__m256d          x0v, x1v, x2v, x3v;
+	__m256d          y0v, y1v, y2v, y3v;
+
+	// If the vector dimension is zero, return early.
+	if ( bli_zero_dim1( n ) ) return;
+
+	// h holds the 2x2 transformation in column-major order.
+	const double     h11 = h[0];
+	const double     h21 = h[1];
+	const double     h12 = h[2];
+	const double     h22 = h[3];
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of unrolled and single-register vectorized
+	// iterations, and the number of leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_vleft = ( n ) % ( n_elem_per_reg * n_iter_unroll ) / n_elem_per_reg;
+	n_left  = ( n ) % ( n_elem_per_reg );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter, n_vleft, and n_left to use
+	// scalar code for all iterations.
+	if ( incx != 1 || incy != 1 )
+	{
+		n_viter = 0;
+		n_vleft = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	// Broadcast the elements of h to all elements of vector registers.
+	h11v = _mm256_broadcast_sd( h + 0 );
+	h21v = _mm256_broadcast_sd( h + 1 );
+	h12v = _mm256_broadcast_sd( h + 2 );
+	h22v = _mm256_broadcast_sd( h + 3 );
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v = _mm256_loadu_pd( x0 + 0*n_elem_per_reg );
+		x1v = _mm256_loadu_pd( x0 + 1*n_elem_per_reg );
+		x2v = _mm256_loadu_pd( x0 + 2*n_elem_per_reg );
+		x3v = _mm256_loadu_pd( x0 + 3*n_elem_per_reg );
+
+		y0v = _mm256_loadu_pd( y0 + 0*n_elem_per_reg );
+		y1v = _mm256_loadu_pd( y0 + 1*n_elem_per_reg );
+		y2v = _mm256_loadu_pd( y0 + 2*n_elem_per_reg );
+		y3v = _mm256_loadu_pd( y0 + 3*n_elem_per_reg );
+
+		// x := h11 * x + h12 * y; y := h21 * x + h22 * y
+		_mm256_storeu_pd( (x0 + 0*n_elem_per_reg), _mm256_fmadd_pd( h11v, x0v, _mm256_mul_pd( h12v, y0v ) ) );
+		_mm256_storeu_pd( (x0 + 1*n_elem_per_reg), _mm256_fmadd_pd( h11v, x1v, _mm256_mul_pd( h12v, y1v ) ) );
+		_mm256_storeu_pd( (x0 + 2*n_elem_per_reg), _mm256_fmadd_pd( h11v, x2v, _mm256_mul_pd( h12v, y2v ) ) );
+		_mm256_storeu_pd( (x0 + 3*n_elem_per_reg), _mm256_fmadd_pd( h11v, x3v, _mm256_mul_pd( h12v, y3v ) ) );
+
+		_mm256_storeu_pd( (y0 + 0*n_elem_per_reg), _mm256_fmadd_pd( h21v, x0v, _mm256_mul_pd( h22v, y0v ) ) );
+		_mm256_storeu_pd( (y0 + 1*n_elem_per_reg), _mm256_fmadd_pd( h21v, x1v, _mm256_mul_pd( h22v, y1v ) ) );
+		_mm256_storeu_pd( (y0 + 2*n_elem_per_reg), _mm256_fmadd_pd( h21v, x2v, _mm256_mul_pd( h22v, y2v ) ) );
+		_mm256_storeu_pd( (y0 + 3*n_elem_per_reg), _mm256_fmadd_pd( h21v, x3v, _mm256_mul_pd( h22v, y3v ) ) );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+		y0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	for ( i = 0; i < n_vleft; ++i )
+	{
+		x0v = _mm256_loadu_pd( x0 );
+		y0v = _mm256_loadu_pd( y0 );
+
+		_mm256_storeu_pd( x0, _mm256_fmadd_pd( h11v, x0v, _mm256_mul_pd( h12v, y0v ) ) );
+		_mm256_storeu_pd( y0, _mm256_fmadd_pd( h21v, x0v, _mm256_mul_pd( h22v, y0v ) ) );
+
+		x0 += n_elem_per_reg;
+		y0 += n_elem_per_reg;
+	}
+
+	// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+	// This avoids a performance penalty caused by false dependencies when
+	// transitioning from from AVX to SSE instructions (which may occur
+	// later, especially if BLIS is compiled with -mfpmath=sse).
+	_mm256_zeroupper();
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( i = 0; i < n_left; ++i )
+	{
+		const double x0c = *x0;
+		const double y0c = *y0;
+
+		*x0 = h11 * x0c + h12 * y0c;
+		*y0 = h21 * x0c + h22 * y0c;
+
+		x0 += incx;
+		y0 += incy;
+	}
+}
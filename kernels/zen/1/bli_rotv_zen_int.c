@@ -0,0 +1,523 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+// -----------------------------------------------------------------------------
+
+void bli_srotv_zen_int
+     (
+       dim_t            n,
+       float*  restrict c,
+       float*  restrict s,
+       float*  restrict x, inc_t incx,
+       float*  restrict y, inc_t incy,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 8;
+	const dim_t      n_iter_unroll  = 4;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_vleft;
+	dim_t            n_left;
+
+	float*  restrict x0;
+	float*  restrict y0;
+
+	__m256           cv, sv;
+	__m256           x0v, x1v, x2v, x3v;
+	__m256           y0v, y1v, y2v, y3v;
+
+	// If the vector dimension is zero, return early.
+	if ( bli_zero_dim1( n ) ) return;
+
+	const float      c0 = *c;
+	const float      s0 = *s;
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of unrolled and single-register vectorized
+	// iterations, and the number of leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_vleft = ( n ) % ( n_elem_per_reg * n_iter_unroll ) / n_elem_per_reg;
+	n_left  = ( n ) % ( n_elem_per_reg );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter, n_vleft, and n_left to use
+	// scalar code for all iterations.
+	if ( incx != 1 || incy != 1 )
+	{
+		n_viter = 0;
+		n_vleft = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	// Broadcast c and s to all elements of vector registers.
+	cv = _mm256_broadcast_ss( c );
+	sv = _mm256_broadcast_ss( s );
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v = _mm256_loadu_ps( x0 + 0*n_elem_per_reg );
+		x1v = _mm256_loadu_ps( x0 + 1*n_elem_per_reg );
+		x2v = _mm256_loadu_ps( x0 + 2*n_elem_per_reg );
+		x3v = _mm256_loadu_ps( x0 + 3*n_elem_per_reg );
+
+		y0v = _mm256_loadu_ps( y0 + 0*n_elem_per_reg );
+		y1v = _mm256_loadu_ps( y0 + 1*n_elem_per_reg );
+		y2v = _mm256_loadu_ps( y0 + 2*n_elem_per_reg );
+		y3v = _mm256_loadu_ps( y0 + 3*n_elem_per_reg );
+
+		// x := c * x + s * y; y := c * y - s * x
+		_mm256_storeu_ps( (x0 + 0*n_elem_per_reg), _mm256_fmadd_ps( cv, x0v, _mm256_mul_ps( sv, y0v ) ) );
+		_mm256_storeu_ps( (x0 + 1*n_elem_per_reg), _mm256_fmadd_ps( cv, x1v, _mm256_mul_ps( sv, y1v ) ) );
+		_mm256_storeu_ps( (x0 + 2*n_elem_per_reg), _mm256_fmadd_ps( cv, x2v, _mm256_mul_ps( sv, y2v ) ) );
+		_mm256_storeu_ps( (x0 + 3*n_elem_per_reg), _mm256_fmadd_ps( cv, x3v, _mm256_mul_ps( sv, y3v ) ) );
+
+		_mm256_storeu_ps( (y0 + 0*n_elem_per_reg), _mm256_fnmadd_ps( sv, x0v, _mm256_mul_ps( cv, y0v ) ) );
+		_mm256_storeu_ps( (y0 + 1*n_elem_per_reg), _mm256_fnmadd_ps( sv, x1v, _mm256_mul_ps( cv, y1v ) ) );
+		_mm256_storeu_ps( (y0 + 2*n_elem_per_reg), _mm256_fnmadd_ps( sv, x2v, _mm256_mul_ps( cv, y2v ) ) );
+		_mm256_storeu_ps( (y0 + 3*n_elem_per_reg), _mm256_fnmadd_ps( sv, x3v, _mm256_mul_ps( cv, y3v ) ) );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+		y0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	for ( i = 0; i < n_vleft; ++i )
+	{
+		x0v = _mm256_loadu_ps( x0 );
+		y0v = _mm256_loadu_ps( y0 );
+
+		_mm256_storeu_ps( x0, _mm256_fmadd_ps( cv, x0v, _mm256_mul_ps( sv, y0v ) ) );
+		_mm256_storeu_ps( y0, _mm256_fnmadd_ps( sv, x0v, _mm256_mul_ps( cv, y0v ) ) );
+
+		x0 += n_elem_per_reg;
+		y0 += n_elem_per_reg;
+	}
+
+	// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+	// This avoids a performance penalty caused by false dependencies when
+	// transitioning from from AVX to SSE instructions (which may occur
+	// later, especially if BLIS is compiled with -mfpmath=sse).
+	_mm256_zeroupper();
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( i = 0; i < n_left; ++i )
+	{
+		const float x0c = *x0;
+		const float y0c = *y0;
+
+		*x0 = c0 * x0c + s0 * y0c;
+		*y0 = c0 * y0c - s0 * x0c;
+
+		x0 += incx;
+		y0 += incy;
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_drotv_zen_int
+     (
+       dim_t            n,
+       double* restrict c,
+       double* restrict s,
+       double* restrict x, inc_t incx,
+       double* restrict y, inc_t incy,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 4;
+	const dim_t      n_iter_unroll  = 4;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_vleft;
+	dim_t            n_left;
+
+	double* restrict x0;
+	double* restrict y0;
+
+	__m256d          cv, sv;
+	__m256d          x0v, x1v, x2v, x3v;
+	__m256d          y0v, y1v, y2v, y3v;
+
+	// If the vector dimension is zero, return early.
+	if ( bli_zero_dim1( n ) ) return;
+
+	const double     c0 = *c;
+	const double     s0 = *s;
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of unrolled and single-register vectorized
+	// iterations, and the number of leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_vleft = ( n ) % ( n_elem_per_reg * n_iter_unroll ) / n_elem_per_reg;
+	n_left  = ( n ) % ( n_elem_per_reg );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter, n_vleft, and n_left to use
+	// scalar code for all iterations.
+	if ( incx != 1 || incy != 1 )
+	{
+		n_viter = 0;
+		n_vleft = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	// Broadcast c and s to all elements of vector registers.
+	cv = _mm256_broadcast_sd( c );
+	sv = _mm256_broadcast_sd( s );
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v = _mm256_loadu_pd( x0 + 0*n_elem_per_reg );
+		x1v = _mm256_loadu_pd( x0 + 1*n_elem_per_reg );
+		x2v = _mm256_loadu_pd( x0 + 2*n_elem_per_reg );
+		x3v = _mm256_loadu_pd( x0 + 3*n_elem_per_reg );
+
+		y0v = _mm256_loadu_pd( y0 + 0*n_elem_per_reg );
+		y1v = _mm256_loadu_pd( y0 + 1*n_elem_per_reg );
+		y2v = _mm256_loadu_pd( y0 + 2*n_elem_per_reg );
+		y3v = _mm256_loadu_pd( y0 + 3*n_elem_per_reg );
+
+		// x := c * x + s * y; y := c * y - s * x
+		_mm256_storeu_pd( (x0 + 0*n_elem_per_reg), _mm256_fmadd_pd( cv, x0v, _mm256_mul_pd( sv, y0v ) ) );
+		_mm256_storeu_pd( (x0 + 1*n_elem_per_reg), _mm256_fmadd_pd( cv, x1v, _mm256_mul_pd( sv, y1v ) ) );
+		_mm256_storeu_pd( (x0 + 2*n_elem_per_reg), _mm256_fmadd_pd( cv, x2v, _mm256_mul_pd( sv, y2v ) ) );
+		_mm256_storeu_pd( (x0 + 3*n_elem_per_reg), _mm256_fmadd_pd( cv, x3v, _mm256_mul_pd( sv, y3v ) ) );
+
+		_mm256_storeu_pd( (y0 + 0*n_elem_per_reg), _mm256_fnmadd_pd( sv, x0v, _mm256_mul_pd( cv, y0v ) ) );
+		_mm256_storeu_pd( (y0 + 1*n_elem_per_reg), _mm256_fnmadd_pd( sv, x1v, _mm256_mul_pd( cv, y1v ) ) );
+		_mm256_storeu_pd( (y0 + 2*n_elem_per_reg), _mm256_fnmadd_pd( sv, x2v, _mm256_mul_pd( cv, y2v ) ) );
+		_mm256_storeu_pd( (y0 + 3*n_elem_per_reg), _mm256_fnmadd_pd( sv, x3v, _mm256_mul_pd( cv, y3v ) ) );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+		y0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	for ( i = 0; i < n_vleft; ++i )
+	{
+		x0v = _mm256_loadu_pd( x0 );
+		y0v = _mm256_loadu_pd( y0 );
+
+		_mm256_storeu_pd( x0, _mm256_fmadd_pd( cv, x0v, _mm256_mul_pd( sv, y0v ) ) );
+		_mm256_storeu_pd( y0, _mm256_fnmadd_pd( sv, x0v, _mm256_mul_pd( cv, y0v ) ) );
+
+		x0 += n_elem_per_reg;
+		y0 += n_elem_per_reg;
+	}
+
+	// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+	// This avoids a performance penalty caused by false dependencies when
+	// transitioning from from AVX to SSE instructions (which may occur
+	// later, especially if BLIS is compiled with -mfpmath=sse).
+	_mm256_zeroupper();
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( i = 0; i < n_left; ++i )
+	{
+		const double x0c = *x0;
+		const double y0c = *y0;
+
+		*x0 = c0 * x0c + s0 * y0c;
+		*y0 = c0 * y0c - s0 * x0c;
+
+		x0 += incx;
+		y0 += incy;
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_crotv_zen_int
+     (
+       dim_t              n,
+       float*    restrict c,
+       scomplex* restrict s,
+       scomplex* restrict x, inc_t incx,
+       scomplex* restrict y, inc_t incy,
+       cntx_t*   restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 4;
+	const dim_t      n_iter_unroll  = 2;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_left;
+
+	float*  restrict x0;
+	float*  restrict y0;
+
+	__m256           cv, srv, siv;
+	__m256           x0v, x1v, xs0v, xs1v;
+	__m256           y0v, y1v, ys0v, ys1v;
+
+	// If the vector dimension is zero, return early.
+	if ( bli_zero_dim1( n ) ) return;
+
+	const float      c0  = *c;
+	const float      s_r = bli_creal( *s );
+	const float      s_i = bli_cimag( *s );
+
+	// When s is real (as with the BLAS csrot), the rotation acts on the
+	// real and imaginary components independently, so contiguous vectors
+	// can be rotated with the real kernel as vectors of length 2n.
+	if ( s_i == 0.0F && incx == 1 && incy == 1 )
+	{
+		float s0 = s_r;
+
+		bli_srotv_zen_int( 2*n, c, &s0, ( float* )x, 1, ( float* )y, 1, cntx );
+		return;
+	}
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter and n_left to use scalar code
+	// for all iterations.
+	if ( incx != 1 || incy != 1 )
+	{
+		n_viter = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = ( float* )x;
+	y0 = ( float* )y;
+
+	// Broadcast c and the real and imaginary components of s.
+	cv  = _mm256_set1_ps( c0 );
+	srv = _mm256_set1_ps( s_r );
+	siv = _mm256_set1_ps( s_i );
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v = _mm256_loadu_ps( x0 + 0*2*n_elem_per_reg );
+		x1v = _mm256_loadu_ps( x0 + 1*2*n_elem_per_reg );
+
+		y0v = _mm256_loadu_ps( y0 + 0*2*n_elem_per_reg );
+		y1v = _mm256_loadu_ps( y0 + 1*2*n_elem_per_reg );
+
+		// Swap the real and imaginary components of each element.
+		xs0v = _mm256_permute_ps( x0v, 0xB1 );
+		xs1v = _mm256_permute_ps( x1v, 0xB1 );
+
+		ys0v = _mm256_permute_ps( y0v, 0xB1 );
+		ys1v = _mm256_permute_ps( y1v, 0xB1 );
+
+		// Compute s * y and conj(s) * x.
+		ys0v = _mm256_fmaddsub_ps( srv, y0v, _mm256_mul_ps( siv, ys0v ) );
+		ys1v = _mm256_fmaddsub_ps( srv, y1v, _mm256_mul_ps( siv, ys1v ) );
+
+		xs0v = _mm256_fmsubadd_ps( srv, x0v, _mm256_mul_ps( siv, xs0v ) );
+		xs1v = _mm256_fmsubadd_ps( srv, x1v, _mm256_mul_ps( siv, xs1v ) );
+
+		// x := c * x + s * y; y := c * y - conj(s) * x
+		_mm256_storeu_ps( (x0 + 0*2*n_elem_per_reg), _mm256_fmadd_ps( cv, x0v, ys0v ) );
+		_mm256_storeu_ps( (x0 + 1*2*n_elem_per_reg), _mm256_fmadd_ps( cv, x1v, ys1v ) );
+
+		_mm256_storeu_ps( (y0 + 0*2*n_elem_per_reg), _mm256_fmsub_ps( cv, y0v, xs0v ) );
+		_mm256_storeu_ps( (y0 + 1*2*n_elem_per_reg), _mm256_fmsub_ps( cv, y1v, xs1v ) );
+
+		x0 += 2 * n_elem_per_reg * n_iter_unroll;
+		y0 += 2 * n_elem_per_reg * n_iter_unroll;
+	}
+
+	// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+	// This avoids a performance penalty caused by false dependencies when
+	// transitioning from from AVX to SSE instructions (which may occur
+	// later, especially if BLIS is compiled with -mfpmath=sse).
+	_mm256_zeroupper();
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( i = 0; i < n_left; ++i )
+	{
+		const float x0r = *(x0 + 0);
+		const float x0i = *(x0 + 1);
+		const float y0r = *(y0 + 0);
+		const float y0i = *(y0 + 1);
+
+		*(x0 + 0) = c0 * x0r + s_r * y0r - s_i * y0i;
+		*(x0 + 1) = c0 * x0i + s_r * y0i + s_i * y0r;
+		*(y0 + 0) = c0 * y0r - s_r * x0r - s_i * x0i;
+		*(y0 + 1) = c0 * y0i - s_r * x0i + s_i * x0r;
+
+		x0 += 2 * incx;
+		y0 += 2 * incy;
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_zrotv_zen_int
+     (
+       dim_t              n,
+       double*   restrict c,
+       dcomplex* restrict s,
+       dcomplex* restrict x, inc_t incx,
+       dcomplex* restrict y, inc_t incy,
+       cntx_t*   restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 2;
+	const dim_t      n_iter_unroll  = 2;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_left;
+
+	double* restrict x0;
+	double* restrict y0;
+
+	__m256d          cv, srv, siv;
+	__m256d          x0v, x1v, xs0v, xs1v;
+	__m256d          y0v, y1v, ys0v, ys1v;
+
+	// If the vector dimension is zero, return early.
+	if ( bli_zero_dim1( n ) ) return;
+
+	const double     c0  = *c;
+	const double     s_r = bli_zreal( *s );
+	const double     s_i = bli_zimag( *s );
+
+	// When s is real (as with the BLAS zdrot), the rotation acts on the
+	// real and imaginary components independently, so contiguous vectors
+	// can be rotated with the real kernel as vectors of length 2n.
+	if ( s_i == 0.0 && incx == 1 && incy == 1 )
+	{
+		double s0 = s_r;
+
+		bli_drotv_zen_int( 2*n, c, &s0, ( double* )x, 1, ( double* )y, 1, cntx );
+		return;
+	}
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter and n_left to use scalar code
+	// for all iterations.
+	if ( incx != 1 || incy != 1 )
+	{
+		n_viter = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = ( double* )x;
+	y0 = ( double* )y;
+
+	// Broadcast c and the real and imaginary components of s.
+	cv  = _mm256_set1_pd( c0 );
+	srv = _mm256_set1_pd( s_r );
+	siv = _mm256_set1_pd( s_i );
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v = _mm256_loadu_pd( x0 + 0*2*n_elem_per_reg );
+		x1v = _mm256_loadu_pd( x0 + 1*2*n_elem_per_reg );
+
+		y0v = _mm256_loadu_pd( y0 + 0*2*n_elem_per_reg );
+		y1v = _mm256_loadu_pd( y0 + 1*2*n_elem_per_reg );
+
+		// Swap the real and imaginary components of each element.
+		xs0v = _mm256_permute_pd( x0v, 0x5 );
+		xs1v = _mm256_permute_pd( x1v, 0x5 );
+
+		ys0v = _mm256_permute_pd( y0v, 0x5 );
+		ys1v = _mm256_permute_pd( y1v, 0x5 );
+
+		// Compute s * y and conj(s) * x.
+		ys0v = _mm256_fmaddsub_pd( srv, y0v, _mm256_mul_pd( siv, ys0v ) );
+		ys1v = _mm256_fmaddsub_pd( srv, y1v, _mm256_mul_pd( siv, ys1v ) );
+
+		xs0v = _mm256_fmsubadd_pd( srv, x0v, _mm256_mul_pd( siv, xs0v ) );
+		xs1v = _mm256_fmsubadd_pd( srv, x1v, _mm256_mul_pd( siv, xs1v ) );
+
+		// x := c * x + s * y; y := c * y - conj(s) * x
+		_mm256_storeu_pd( (x0 + 0*2*n_elem_per_reg), _mm256_fmadd_pd( cv, x0v, ys0v ) );
+		_mm256_storeu_pd( (x0 + 1*2*n_elem_per_reg), _mm256_fmadd_pd( cv, x1v, ys1v ) );
+
+		_mm256_storeu_pd( (y0 + 0*2*n_elem_per_reg), _mm256_fmsub_pd( cv, y0v, xs0v ) );
+		_mm256_storeu_pd( (y0 + 1*2*n_elem_per_reg), _mm256_fmsub_pd( cv, y1v, xs1v ) );
+
+		x0 += 2 * n_elem_per_reg * n_iter_unroll;
+		y0 += 2 * n_elem_per_reg * n_iter_unroll;
+	}
+
+	// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+	// This avoids a performance penalty caused by false dependencies when
+	// transitioning from from AVX to SSE instructions (which may occur
+	// later, especially if BLIS is compiled with -mfpmath=sse).
+	_mm256_zeroupper();
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( i = 0; i < n_left; ++i )
+	{
+		const double x0r = *(x0 + 0);
+		const double x0i = *(x0 + 1);
+		const double y0r = *(y0 + 0);
+		const double y0i = *(y0 + 1);
+
+		*(x0 + 0) = c0 * x0r + s_r * y0r - s_i * y0i;
+		*(x0 + 1) = c0 * x0i + s_r * y0i + s_i * y0r;
+		*(y0 + 0) = c0 * y0r - s_r * x0r - s_i * x0i;
+		*(y0 + 1) = c0 * y0i - s_r * x0i + s_i * x0r;
+
+		x0 += 2 * incx;
+		y0 += 2 * incy;
+	}
+}
@@ -251,3 +251,228 @@ void bli_dscalv_zen_int
 	}
 }
 
+// -----------------------------------------------------------------------------
+
+void bli_cscalv_zen_int
+     (
+       conj_t           conjalpha,
+       dim_t            n,
+       scomplex* restrict alpha,
+       scomplex* restrict x, inc_t incx,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 8 / 2;
+	const dim_t      n_iter_unroll  = 4;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_left;
+
+	scomplex* restrict x0;
+	scomplex           alpha_conj;
+
+	__m256           alphaRv, alphaIv;
+	__m256           x0v, x1v, x2v, x3v;
+	__m256           z0v, z1v, z2v, z3v;
+
+	// If the vector dimension is zero, or if alpha is unit, return early.
+	if ( bli_zero_dim1( n ) || PASTEMAC(c,eq1)( *alpha ) ) return;
+
+	// If alpha is zero, use setv (in case y contains NaN or Inf).
+	if ( PASTEMAC(c,eq0)( *alpha ) )
+	{
+		scomplex*    zero = bli_c0;
+		csetv_ker_ft f    = bli_cntx_get_l1v_ker_dt( BLIS_SCOMPLEX, BLIS_SETV_KER, cntx );
+
+		f
+		(
+		  BLIS_NO_CONJUGATE,
+		  n,
+		  zero,
+		  x, incx,
+		  cntx
+		);
+		return;
+	}
+
+	PASTEMAC(c,copycjs)( conjalpha, *alpha, alpha_conj );
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter and n_left to use scalar code
+	// for all iterations.
+	if ( incx != 1 )
+	{
+		n_viter = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+
+	// Broadcast the real and imaginary components of alpha to all elements
+	// of separate vector registers.
+	alphaRv = _mm256_broadcast_ss( &bli_creal( alpha_conj ) );
+	alphaIv = _mm256_broadcast_ss( &bli_cimag( alpha_conj ) );
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v = _mm256_loadu_ps( ( float* )( x0 + 0*n_elem_per_reg ) );
+		x1v = _mm256_loadu_ps( ( float* )( x0 + 1*n_elem_per_reg ) );
+		x2v = _mm256_loadu_ps( ( float* )( x0 + 2*n_elem_per_reg ) );
+		x3v = _mm256_loadu_ps( ( float* )( x0 + 3*n_elem_per_reg ) );
+
+		// Compute alpha_i * swap( x ).
+		z0v = _mm256_mul_ps( alphaIv, _mm256_permute_ps( x0v, 0xB1 ) );
+		z1v = _mm256_mul_ps( alphaIv, _mm256_permute_ps( x1v, 0xB1 ) );
+		z2v = _mm256_mul_ps( alphaIv, _mm256_permute_ps( x2v, 0xB1 ) );
+		z3v = _mm256_mul_ps( alphaIv, _mm256_permute_ps( x3v, 0xB1 ) );
+
+		// perform : x := alpha_r * x -/+ alpha_i * swap( x );
+		x0v = _mm256_fmaddsub_ps( alphaRv, x0v, z0v );
+		x1v = _mm256_fmaddsub_ps( alphaRv, x1v, z1v );
+		x2v = _mm256_fmaddsub_ps( alphaRv, x2v, z2v );
+		x3v = _mm256_fmaddsub_ps( alphaRv, x3v, z3v );
+
+		// Store the output.
+		_mm256_storeu_ps( ( float* )( x0 + 0*n_elem_per_reg ), x0v );
+		_mm256_storeu_ps( ( float* )( x0 + 1*n_elem_per_reg ), x1v );
+		_mm256_storeu_ps( ( float* )( x0 + 2*n_elem_per_reg ), x2v );
+		_mm256_storeu_ps( ( float* )( x0 + 3*n_elem_per_reg ), x3v );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+	// This avoids a performance penalty caused by false dependencies when
+	// transitioning from from AVX to SSE instructions (which may occur
+	// later, especially if BLIS is compiled with -mfpmath=sse).
+	_mm256_zeroupper();
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( i = 0; i < n_left; ++i )
+	{
+		PASTEMAC(c,scals)( alpha_conj, *x0 );
+
+		x0 += incx;
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_zscalv_zen_int
+     (
+       conj_t           conjalpha,
+       dim_t            n,
+       dcomplex* restrict alpha,
+       dcomplex* restrict x, inc_t incx,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 4 / 2;
+	const dim_t      n_iter_unroll  = 4;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_left;
+
+	dcomplex* restrict x0;
+	dcomplex           alpha_conj;
+
+	__m256d          alphaRv, alphaIv;
+	__m256d          x0v, x1v, x2v, x3v;
+	__m256d          z0v, z1v, z2v, z3v;
+
+	// If the vector dimension is zero, or if alpha is unit, return early.
+	if ( bli_zero_dim1( n ) || PASTEMAC(z,eq1)( *alpha ) ) return;
+
+	// If alpha is zero, use setv (in case y contains NaN or Inf).
+	if ( PASTEMAC(z,eq0)( *alpha ) )
+	{
+		dcomplex*    zero = bli_z0;
+		zsetv_ker_ft f    = bli_cntx_get_l1v_ker_dt( BLIS_DCOMPLEX, BLIS_SETV_KER, cntx );
+
+		f
+		(
+		  BLIS_NO_CONJUGATE,
+		  n,
+		  zero,
+		  x, incx,
+		  cntx
+		);
+		return;
+	}
+
+	PASTEMAC(z,copycjs)( conjalpha, *alpha, alpha_conj );
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter and n_left to use scalar code
+	// for all iterations.
+	if ( incx != 1 )
+	{
+		n_viter = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+
+	// Broadcast the real and imaginary components of alpha to all elements
+	// of separate vector registers.
+	alphaRv = _mm256_broadcast_sd( &bli_zreal( alpha_conj ) );
+	alphaIv = _mm256_broadcast_sd( &bli_zimag( alpha_conj ) );
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v = _mm256_loadu_pd( ( double* )( x0 + 0*n_elem_per_reg ) );
+		x1v = _mm256_loadu_pd( ( double* )( x0 + 1*n_elem_per_reg ) );
+		x2v = _mm256_loadu_pd( ( double* )( x0 + 2*n_elem_per_reg ) );
+		x3v = _mm256_loadu_pd( ( double* )( x0 + 3*n_elem_per_reg ) );
+
+		// Compute alpha_i * swap( x ).
+		z0v = _mm256_mul_pd( alphaIv, _mm256_permute_pd( x0v, 0x5 ) );
+		z1v = _mm256_mul_pd( alphaIv, _mm256_permute_pd( x1v, 0x5 ) );
+		z2v = _mm256_mul_pd( alphaIv, _mm256_permute_pd( x2v, 0x5 ) );
+		z3v = _mm256_mul_pd( alphaIv, _mm256_permute_pd( x3v, 0x5 ) );
+
+		// perform : x := alpha_r * x -/+ alpha_i * swap( x );
+		x0v = _mm256_fmaddsub_pd( alphaRv, x0v, z0v );
+		x1v = _mm256_fmaddsub_pd( alphaRv, x1v, z1v );
+		x2v = _mm256_fmaddsub_pd( alphaRv, x2v, z2v );
+		x3v = _mm256_fmaddsub_pd( alphaRv, x3v, z3v );
+
+		// Store the output.
+		_mm256_storeu_pd( ( double* )( x0 + 0*n_elem_per_reg ), x0v );
+		_mm256_storeu_pd( ( double* )( x0 + 1*n_elem_per_reg ), x1v );
+		_mm256_storeu_pd( ( double* )( x0 + 2*n_elem_per_reg ), x2v );
+		_mm256_storeu_pd( ( double* )( x0 + 3*n_elem_per_reg ), x3v );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+	// This avoids a performance penalty caused by false dependencies when
+	// transitioning from from AVX to SSE instructions (which may occur
+	// later, especially if BLIS is compiled with -mfpmath=sse).
+	_mm256_zeroupper();
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( i = 0; i < n_left; ++i )
+	{
+		PASTEMAC(z,scals)( alpha_conj, *x0 );
+
+		x0 += incx;
+	}
+}
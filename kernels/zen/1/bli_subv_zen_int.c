@@ -0,0 +1,470 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// -----------------------------------------------------------------------------
+
+void bli_ssubv_zen_int
+     (
+       conj_t           conjx,
+       dim_t            n,
+       float*  restrict x, inc_t incx,
+       float*  restrict y, inc_t incy,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 8;
+	const dim_t      n_iter_unroll  = 4;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_left;
+
+	float*  restrict x0;
+	float*  restrict y0;
+
+	__m256           x0v, x1v, x2v, x3v;
+	__m256           y0v, y1v, y2v, y3v;
+
+	// If the vector dimension is zero, return early.
+	if ( bli_zero_dim1( n ) ) return;
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter and n_left to use scalar code
+	// for all iterations.
+	if ( incx != 1 || incy != 1 )
+	{
+		n_viter = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v = _mm256_loadu_ps( x0 + 0*n_elem_per_reg );
+		x1v = _mm256_loadu_ps( x0 + 1*n_elem_per_reg );
+		x2v = _mm256_loadu_ps( x0 + 2*n_elem_per_reg );
+		x3v = _mm256_loadu_ps( x0 + 3*n_elem_per_reg );
+
+		y0v = _mm256_loadu_ps( y0 + 0*n_elem_per_reg );
+		y1v = _mm256_loadu_ps( y0 + 1*n_elem_per_reg );
+		y2v = _mm256_loadu_ps( y0 + 2*n_elem_per_reg );
+		y3v = _mm256_loadu_ps( y0 + 3*n_elem_per_reg );
+
+		// perform : y := y - x;
+		y0v = _mm256_sub_ps( y0v, x0v );
+		y1v = _mm256_sub_ps( y1v, x1v );
+		y2v = _mm256_sub_ps( y2v, x2v );
+		y3v = _mm256_sub_ps( y3v, x3v );
+
+		// Store the output.
+		_mm256_storeu_ps( (y0 + 0*n_elem_per_reg), y0v );
+		_mm256_storeu_ps( (y0 + 1*n_elem_per_reg), y1v );
+		_mm256_storeu_ps( (y0 + 2*n_elem_per_reg), y2v );
+		_mm256_storeu_ps( (y0 + 3*n_elem_per_reg), y3v );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+		y0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+	// This avoids a performance penalty caused by false dependencies when
+	// transitioning from from AVX to SSE instructions (which may occur
+	// later, especially if BLIS is compiled with -mfpmath=sse).
+	_mm256_zeroupper();
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( i = 0; i < n_left; ++i )
+	{
+		*y0 -= *x0;
+
+		x0 += incx;
+		y0 += incy;
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_dsubv_zen_int
+     (
+       conj_t           conjx,
+       dim_t            n,
+       double* restrict x, inc_t incx,
+       double* restrict y, inc_t incy,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 4;
+	const dim_t      n_iter_unroll  = 4;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_left;
+
+	double* restrict x0;
+	double* restrict y0;
+
+	__m256d          x0v, x1v, x2v, x3v;
+	__m256d          y0v, y1v, y2v, y3v;
+
+	// If the vector dimension is zero, return early.
+	if ( bli_zero_dim1( n ) ) return;
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter and n_left to use scalar code
+	// for all iterations.
+	if ( incx != 1 || incy != 1 )
+	{
+		n_viter = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v = _mm256_loadu_pd( x0 + 0*n_elem_per_reg );
+		x1v = _mm256_loadu_pd( x0 + 1*n_elem_per_reg );
+		x2v = _mm256_loadu_pd( x0 + 2*n_elem_per_reg );
+		x3v = _mm256_loadu_pd( x0 + 3*n_elem_per_reg );
+
+		y0v = _mm256_loadu_pd( y0 + 0*n_elem_per_reg );
+		y1v = _mm256_loadu_pd( y0 + 1*n_elem_per_reg );
+		y2v = _mm256_loadu_pd( y0 + 2*n_elem_per_reg );
+		y3v = _mm256_loadu_pd( y0 + 3*n_elem_per_reg );
+
+		// perform : y := y - x;
+		y0v = _mm256_sub_pd( y0v, x0v );
+		y1v = _mm256_sub_pd( y1v, x1v );
+		y2v = _mm256_sub_pd( y2v, x2v );
+		y3v = _mm256_sub_pd( y3v, x3v );
+
+		// Store the output.
+		_mm256_storeu_pd( (y0 + 0*n_elem_per_reg), y0v );
+		_mm256_storeu_pd( (y0 + 1*n_elem_per_reg), y1v );
+		_mm256_storeu_pd( (y0 + 2*n_elem_per_reg), y2v );
+		_mm256_storeu_pd( (y0 + 3*n_elem_per_reg), y3v );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+		y0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+	// This avoids a performance penalty caused by false dependencies when
+	// transitioning from from AVX to SSE instructions (which may occur
+	// later, especially if BLIS is compiled with -mfpmath=sse).
+	_mm256_zeroupper();
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( i = 0; i < n_left; ++i )
+	{
+		*y0 -= *x0;
+
+		x0 += incx;
+		y0 += incy;
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_csubv_zen_int
+     (
+       conj_t           conjx,
+       dim_t            n,
+       scomplex* restrict x, inc_t incx,
+       scomplex* restrict y, inc_t incy,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 8 / 2;
+	const dim_t      n_iter_unroll  = 4;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_left;
+
+	scomplex* restrict x0;
+	scomplex* restrict y0;
+
+	__m256           maskv;
+	__m256           x0v, x1v, x2v, x3v;
+	__m256           y0v, y1v, y2v, y3v;
+
+	// If the vector dimension is zero, return early.
+	if ( bli_zero_dim1( n ) ) return;
+
+	// Without conjugation, this operation is the same as its real
+	// counterpart applied to vectors of twice the length.
+	if ( bli_is_noconj( conjx ) && incx == 1 && incy == 1 )
+	{
+		bli_ssubv_zen_int
+		(
+		  BLIS_NO_CONJUGATE,
+		  2 * n,
+		  ( float* )x, 1,
+		  ( float* )y, 1,
+		  cntx
+		);
+		return;
+	}
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter and n_left to use scalar code
+	// for all iterations.
+	if ( incx != 1 || incy != 1 )
+	{
+		n_viter = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	// Conjugate x by flipping the sign bits of its imaginary components.
+	maskv = _mm256_setr_ps( 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f );
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v = _mm256_loadu_ps( ( float* )( x0 + 0*n_elem_per_reg ) );
+		x1v = _mm256_loadu_ps( ( float* )( x0 + 1*n_elem_per_reg ) );
+		x2v = _mm256_loadu_ps( ( float* )( x0 + 2*n_elem_per_reg ) );
+		x3v = _mm256_loadu_ps( ( float* )( x0 + 3*n_elem_per_reg ) );
+
+		y0v = _mm256_loadu_ps( ( float* )( y0 + 0*n_elem_per_reg ) );
+		y1v = _mm256_loadu_ps( ( float* )( y0 + 1*n_elem_per_reg ) );
+		y2v = _mm256_loadu_ps( ( float* )( y0 + 2*n_elem_per_reg ) );
+		y3v = _mm256_loadu_ps( ( float* )( y0 + 3*n_elem_per_reg ) );
+
+		// perform : y := y - conj( x );
+		x0v = _mm256_xor_ps( x0v, maskv );
+		x1v = _mm256_xor_ps( x1v, maskv );
+		x2v = _mm256_xor_ps( x2v, maskv );
+		x3v = _mm256_xor_ps( x3v, maskv );
+
+		y0v = _mm256_sub_ps( y0v, x0v );
+		y1v = _mm256_sub_ps( y1v, x1v );
+		y2v = _mm256_sub_ps( y2v, x2v );
+		y3v = _mm256_sub_ps( y3v, x3v );
+
+		// Store the output.
+		_mm256_storeu_ps( ( float* )( y0 + 0*n_elem_per_reg ), y0v );
+		_mm256_storeu_ps( ( float* )( y0 + 1*n_elem_per_reg ), y1v );
+		_mm256_storeu_ps( ( float* )( y0 + 2*n_elem_per_reg ), y2v );
+		_mm256_storeu_ps( ( float* )( y0 + 3*n_elem_per_reg ), y3v );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+		y0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+	// This avoids a performance penalty caused by false dependencies when
+	// transitioning from from AVX to SSE instructions (which may occur
+	// later, especially if BLIS is compiled with -mfpmath=sse).
+	_mm256_zeroupper();
+
+	// If there are leftover iterations, perform them with scalar code.
+	if ( bli_is_conj( conjx ) )
+	{
+		for ( i = 0; i < n_left; ++i )
+		{
+			PASTEMAC(c,subjs)( *x0, *y0 );
+
+			x0 += incx;
+			y0 += incy;
+		}
+	}
+	else
+	{
+		for ( i = 0; i < n_left; ++i )
+		{
+			PASTEMAC(c,subs)( *x0, *y0 );
+
+			x0 += incx;
+			y0 += incy;
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_zsubv_zen_int
+     (
+       conj_t           conjx,
+       dim_t            n,
+       dcomplex* restrict x, inc_t incx,
+       dcomplex* restrict y, inc_t incy,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 4 / 2;
+	const dim_t      n_iter_unroll  = 4;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_left;
+
+	dcomplex* restrict x0;
+	dcomplex* restrict y0;
+
+	__m256d          maskv;
+	__m256d          x0v, x1v, x2v, x3v;
+	__m256d          y0v, y1v, y2v, y3v;
+
+	// If the vector dimension is zero, return early.
+	if ( bli_zero_dim1( n ) ) return;
+
+	// Without conjugation, this operation is the same as its real
+	// counterpart applied to vectors of twice the length.
+	if ( bli_is_noconj( conjx ) && incx == 1 && incy == 1 )
+	{
+		bli_dsubv_zen_int
+		(
+		  BLIS_NO_CONJUGATE,
+		  2 * n,
+		  ( double* )x, 1,
+		  ( double* )y, 1,
+		  cntx
+		);
+		return;
+	}
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter and n_left to use scalar code
+	// for all iterations.
+	if ( incx != 1 || incy != 1 )
+	{
+		n_viter = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	// Conjugate x by flipping the sign bits of its imaginary components.
+	maskv = _mm256_setr_pd( 0.0, -0.0, 0.0, -0.0 );
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v = _mm256_loadu_pd( ( double* )( x0 + 0*n_elem_per_reg ) );
+		x1v = _mm256_loadu_pd( ( double* )( x0 + 1*n_elem_per_reg ) );
+		x2v = _mm256_loadu_pd( ( double* )( x0 + 2*n_elem_per_reg ) );
+		x3v = _mm256_loadu_pd( ( double* )( x0 + 3*n_elem_per_reg ) );
+
+		y0v = _mm256_loadu_pd( ( double* )( y0 + 0*n_elem_per_reg ) );
+		y1v = _mm256_loadu_pd( ( double* )( y0 + 1*n_elem_per_reg ) );
+		y2v = _mm256_loadu_pd( ( double* )( y0 + 2*n_elem_per_reg ) );
+		y3v = _mm256_loadu_pd( ( double* )( y0 + 3*n_elem_per_reg ) );
+
+		// perform : y := y - conj( x );
+		x0v = _mm256_xor_pd( x0v, maskv );
+		x1v = _mm256_xor_pd( x1v, maskv );
+		x2v = _mm256_xor_pd( x2v, maskv );
+		x3v = _mm256_xor_pd( x3v, maskv );
+
+		y0v = _mm256_sub_pd( y0v, x0v );
+		y1v = _mm256_sub_pd( y1v, x1v );
+		y2v = _mm256_sub_pd( y2v, x2v );
+		y3v = _mm256_sub_pd( y3v, x3v );
+
+		// Store the output.
+		_mm256_storeu_pd( ( double* )( y0 + 0*n_elem_per_reg ), y0v );
+		_mm256_storeu_pd( ( double* )( y0 + 1*n_elem_per_reg ), y1v );
+		_mm256_storeu_pd( ( double* )( y0 + 2*n_elem_per_reg ), y2v );
+		_mm256_storeu_pd( ( double* )( y0 + 3*n_elem_per_reg ), y3v );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+		y0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+	// This avoids a performance penalty caused by false dependencies when
+	// transitioning from from AVX to SSE instructions (which may occur
+	// later, especially if BLIS is compiled with -mfpmath=sse).
+	_mm256_zeroupper();
+
+	// If there are leftover iterations, perform them with scalar code.
+	if ( bli_is_conj( conjx ) )
+	{
+		for ( i = 0; i < n_left; ++i )
+		{
+			PASTEMAC(z,subjs)( *x0, *y0 );
+
+			x0 += incx;
+			y0 += incy;
+		}
+	}
+	else
+	{
+		for ( i = 0; i < n_left; ++i )
+		{
+			PASTEMAC(z,subs)( *x0, *y0 );
+
+			x0 += incx;
+			y0 += incy;
+		}
+	}
+}
@@ -0,0 +1,313 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   The rd kernels compute each element of the microtile as a dot product
+   of a row of A with a column of B, vectorized along the k dimension. They
+   require A to have unit column stride and B to have unit row stride. The
+   microtile is computed in blocks of 3x2 dot products.
+
+   Each dot product is accumulated into two vectors: one holding a .* b,
+   whose even and odd elements sum to ar*br and ai*bi, respectively, and
+   one holding a .* swap( b ), whose even and odd elements sum to ar*bi and
+   ai*br. The two are reduced (and any conjugation of A or B is applied)
+   only after the k loop completes.
+*/
+
+// Return a mask with the first n (of eight) 32-bit elements enabled.
+BLIS_INLINE __m256i bli_cgemmsup_rd_zen_int_mask( dim_t n )
+{
+	const __m256i idx = _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 );
+
+	return _mm256_cmpgt_epi32( _mm256_set1_epi32( ( int )n ), idx );
+}
+
+// Reduce the two accumulators of one dot product and update the
+// corresponding element of C.
+BLIS_INLINE void bli_cgemmsup_rd_zen_int_update
+     (
+       const float          sa,
+       const float          sb,
+       __m256               ab1,
+       __m256               ab2,
+       scomplex*   restrict alpha,
+       scomplex*   restrict beta,
+       scomplex*   restrict cij
+     )
+{
+	const __m128 s1 = _mm_add_ps( _mm256_castps256_ps128( ab1 ),
+	                              _mm256_extractf128_ps( ab1, 1 ) );
+	const __m128 s2 = _mm_add_ps( _mm256_castps256_ps128( ab2 ),
+	                              _mm256_extractf128_ps( ab2, 1 ) );
+	const __m128 s  = _mm_add_ps( _mm_shuffle_ps( s1, s2, _MM_SHUFFLE( 1, 0, 1, 0 ) ),
+	                              _mm_shuffle_ps( s1, s2, _MM_SHUFFLE( 3, 2, 3, 2 ) ) );
+	float        st[ 4 ];
+	scomplex     ab;
+
+	_mm_storeu_ps( st, s );
+
+	// st = ( sum(ar*br), sum(ai*bi), sum(ar*bi), sum(ai*br) ).
+	bli_csets( st[ 0 ] - sa*sb*st[ 1 ],
+	           sb*st[ 2 ] + sa*st[ 3 ], ab );
+
+	if ( PASTEMAC(c,eq0)( *beta ) )
+	{
+		PASTEMAC(c,scal2s)( *alpha, ab, *cij );
+	}
+	else
+	{
+		PASTEMAC(c,axpbys)( *alpha, ab, *beta, *cij );
+	}
+}
+
+// Macros used to unroll the block computation over its rows. Any row index
+// at or beyond mr is skipped at compile time since mr is constant.
+#define CGEMMSUP_RD_LOADA( i, load ) \
+	const __m256 a ## i ## v = ( i < mr ? load( ( float* )( a ## i ## p + l ) ) : zerov );
+
+#define CGEMMSUP_RD_FMA( i, j ) \
+	if ( i < mr ) \
+	{ \
+		ab1 ## i ## j = _mm256_fmadd_ps( a ## i ## v, bv,  ab1 ## i ## j ); \
+		ab2 ## i ## j = _mm256_fmadd_ps( a ## i ## v, bsv, ab2 ## i ## j ); \
+	}
+
+#define CGEMMSUP_RD_COL( j, load ) \
+	{ \
+		const __m256 bv  = load( ( float* )( b ## j ## p + l ) ); \
+		const __m256 bsv = _mm256_permute_ps( bv, 0xB1 ); \
+\
+		CGEMMSUP_RD_FMA( 0, j ) \
+		CGEMMSUP_RD_FMA( 1, j ) \
+		CGEMMSUP_RD_FMA( 2, j ) \
+	}
+
+#define CGEMMSUP_RD_STORE( i, j ) \
+	if ( i < mr && j < n ) \
+	{ \
+		bli_cgemmsup_rd_zen_int_update( sa, sb, ab1 ## i ## j, ab2 ## i ## j, \
+		                                alpha, beta, c + i*rs_c + j*cs_c ); \
+	}
+
+// Compute an mr x n block of C, where mr <= 3 and n <= 2. This function is
+// always inlined with a constant mr so that the compiler generates a fully
+// specialized instance for each row count. If n is one, the second column
+// aliases the first; its dot products are computed but discarded.
+static inline __attribute__((always_inline)) void bli_cgemmsup_rd_zen_int_mx2
+     (
+       const dim_t          mr,
+       const conj_t         conja,
+       const conj_t         conjb,
+       const dim_t          n,
+       const dim_t          k,
+       scomplex*   restrict alpha,
+       scomplex*   restrict a, const inc_t rs_a,
+       scomplex*   restrict b, const inc_t cs_b,
+       scomplex*   restrict beta,
+       scomplex*   restrict c, const inc_t rs_c, const inc_t cs_c
+     )
+{
+	scomplex* restrict a0p = a;
+	scomplex* restrict a1p = a + bli_min( 1, mr - 1 ) * rs_a;
+	scomplex* restrict a2p = a + bli_min( 2, mr - 1 ) * rs_a;
+
+	scomplex* restrict b0p = b;
+	scomplex* restrict b1p = b + bli_min( 1, n - 1 ) * cs_b;
+
+	const __m256 zerov = _mm256_setzero_ps();
+
+	__m256 ab100 = zerov, ab101 = zerov, ab200 = zerov, ab201 = zerov;
+	__m256 ab110 = zerov, ab111 = zerov, ab210 = zerov, ab211 = zerov;
+	__m256 ab120 = zerov, ab121 = zerov, ab220 = zerov, ab221 = zerov;
+
+	const dim_t k_iter = k / 4;
+	const dim_t k_left = k % 4;
+
+	dim_t l = 0;
+
+	for ( dim_t kk = 0; kk < k_iter; ++kk, l += 4 )
+	{
+		CGEMMSUP_RD_LOADA( 0, _mm256_loadu_ps )
+		CGEMMSUP_RD_LOADA( 1, _mm256_loadu_ps )
+		CGEMMSUP_RD_LOADA( 2, _mm256_loadu_ps )
+
+		CGEMMSUP_RD_COL( 0, _mm256_loadu_ps )
+		CGEMMSUP_RD_COL( 1, _mm256_loadu_ps )
+	}
+
+	if ( k_left )
+	{
+		// Use masked loads for the k edge so that we never touch elements
+		// of A or B beyond the end of the current rows and columns.
+		const __m256i mask = bli_cgemmsup_rd_zen_int_mask( 2*k_left );
+
+		#define CGEMMSUP_RD_MASKLOAD( p ) _mm256_maskload_ps( p, mask )
+
+		CGEMMSUP_RD_LOADA( 0, CGEMMSUP_RD_MASKLOAD )
+		CGEMMSUP_RD_LOADA( 1, CGEMMSUP_RD_MASKLOAD )
+		CGEMMSUP_RD_LOADA( 2, CGEMMSUP_RD_MASKLOAD )
+
+		CGEMMSUP_RD_COL( 0, CGEMMSUP_RD_MASKLOAD )
+		CGEMMSUP_RD_COL( 1, CGEMMSUP_RD_MASKLOAD )
+
+		#undef CGEMMSUP_RD_MASKLOAD
+	}
+
+	const float sa = ( bli_is_conj( conja ) ? -1.0F : 1.0F );
+	const float sb = ( bli_is_conj( conjb ) ? -1.0F : 1.0F );
+
+	CGEMMSUP_RD_STORE( 0, 0 ) CGEMMSUP_RD_STORE( 0, 1 )
+	CGEMMSUP_RD_STORE( 1, 0 ) CGEMMSUP_RD_STORE( 1, 1 )
+	CGEMMSUP_RD_STORE( 2, 0 ) CGEMMSUP_RD_STORE( 2, 1 )
+}
+
+// Iterate over micropanels of B (in steps of ps_b) and, within each one,
+// over micropanels of A (in steps of ps_a). Each microtile is computed in
+// blocks of 3x2.
+static void bli_cgemmsup_rd_zen_int_3x8
+     (
+       conj_t               conja,
+       conj_t               conjb,
+       dim_t                m0,
+       dim_t                n0,
+       dim_t                k0,
+       scomplex*   restrict alpha,
+       scomplex*   restrict a, inc_t rs_a0, inc_t ps_a0,
+       scomplex*   restrict b, inc_t cs_b0, inc_t ps_b0,
+       scomplex*   restrict beta,
+       scomplex*   restrict c, inc_t rs_c0, inc_t cs_c0
+     )
+{
+	const dim_t mr = 3;
+	const dim_t nr = 8;
+
+	for ( dim_t j = 0; j < n0; j += nr )
+	{
+		const dim_t nr_cur = bli_min( nr, n0 - j );
+
+		scomplex* restrict bj = b + ( j / nr ) * ps_b0;
+
+		for ( dim_t i = 0; i < m0; i += mr )
+		{
+			const dim_t mr_cur = bli_min( mr, m0 - i );
+
+			scomplex* restrict ai = a + ( i / mr ) * ps_a0;
+			scomplex* restrict ci = c + i*rs_c0 + j*cs_c0;
+
+			for ( dim_t jj = 0; jj < nr_cur; jj += 2 )
+			{
+				const dim_t nr_blk = bli_min( 2, nr_cur - jj );
+
+				scomplex* restrict bjj = bj + jj*cs_b0;
+				scomplex* restrict cij = ci + jj*cs_c0;
+
+				if      ( mr_cur == 3 )
+					bli_cgemmsup_rd_zen_int_mx2( 3, conja, conjb, nr_blk, k0, alpha, ai, rs_a0, bjj, cs_b0, beta, cij, rs_c0, cs_c0 );
+				else if ( mr_cur == 2 )
+					bli_cgemmsup_rd_zen_int_mx2( 2, conja, conjb, nr_blk, k0, alpha, ai, rs_a0, bjj, cs_b0, beta, cij, rs_c0, cs_c0 );
+				else
+					bli_cgemmsup_rd_zen_int_mx2( 1, conja, conjb, nr_blk, k0, alpha, ai, rs_a0, bjj, cs_b0, beta, cij, rs_c0, cs_c0 );
+			}
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_cgemmsup_rd_zen_int_3x8m
+     (
+       conj_t              conja,
+       conj_t              conjb,
+       dim_t               m0,
+       dim_t               n0,
+       dim_t               k0,
+       scomplex*  restrict alpha,
+       scomplex*  restrict a, inc_t rs_a0, inc_t cs_a0,
+       scomplex*  restrict b, inc_t rs_b0, inc_t cs_b0,
+       scomplex*  restrict beta,
+       scomplex*  restrict c, inc_t rs_c0, inc_t cs_c0,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	// This millikernel iterates over the m dimension, stepping through
+	// micropanels of A according to the panel stride embedded in the
+	// auxinfo_t object.
+	const inc_t ps_a0 = bli_auxinfo_ps_a( data );
+	const inc_t ps_b0 = 8 * cs_b0;
+
+	bli_cgemmsup_rd_zen_int_3x8
+	(
+	  conja, conjb, m0, n0, k0,
+	  alpha, a, rs_a0, ps_a0,
+	         b, cs_b0, ps_b0,
+	  beta,  c, rs_c0, cs_c0
+	);
+}
+
+void bli_cgemmsup_rd_zen_int_3x8n
+     (
+       conj_t              conja,
+       conj_t              conjb,
+       dim_t               m0,
+       dim_t               n0,
+       dim_t               k0,
+       scomplex*  restrict alpha,
+       scomplex*  restrict a, inc_t rs_a0, inc_t cs_a0,
+       scomplex*  restrict b, inc_t rs_b0, inc_t cs_b0,
+       scomplex*  restrict beta,
+       scomplex*  restrict c, inc_t rs_c0, inc_t cs_c0,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	// This millikernel iterates over the n dimension, stepping through
+	// micropanels of B according to the panel stride embedded in the
+	// auxinfo_t object.
+	const inc_t ps_a0 = 3 * rs_a0;
+	const inc_t ps_b0 = bli_auxinfo_ps_b( data );
+
+	bli_cgemmsup_rd_zen_int_3x8
+	(
+	  conja, conjb, m0, n0, k0,
+	  alpha, a, rs_a0, ps_a0,
+	         b, cs_b0, ps_b0,
+	  beta,  c, rs_c0, cs_c0
+	);
+}
+
@@ -0,0 +1,312 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   The rd kernels compute each element of the microtile as a dot product
+   of a row of A with a column of B, vectorized along the k dimension. They
+   require A to have unit column stride and B to have unit row stride. The
+   microtile is computed in blocks of 3x2 dot products.
+
+   Each dot product is accumulated into two vectors: one holding a .* b,
+   whose even and odd elements sum to ar*br and ai*bi, respectively, and
+   one holding a .* swap( b ), whose even and odd elements sum to ar*bi and
+   ai*br. The two are reduced (and any conjugation of A or B is applied)
+   only after the k loop completes.
+*/
+
+// Return a mask with the first n (of four) 64-bit elements enabled.
+BLIS_INLINE __m256i bli_zgemmsup_rd_zen_int_mask( dim_t n )
+{
+	const __m256i idx = _mm256_setr_epi64x( 0, 1, 2, 3 );
+
+	return _mm256_cmpgt_epi64( _mm256_set1_epi64x( ( int64_t )n ), idx );
+}
+
+// Reduce the two accumulators of one dot product and update the
+// corresponding element of C.
+BLIS_INLINE void bli_zgemmsup_rd_zen_int_update
+     (
+       const double         sa,
+       const double         sb,
+       __m256d              ab1,
+       __m256d              ab2,
+       dcomplex*   restrict alpha,
+       dcomplex*   restrict beta,
+       dcomplex*   restrict cij
+     )
+{
+	const __m128d s1 = _mm_add_pd( _mm256_castpd256_pd128( ab1 ),
+	                               _mm256_extractf128_pd( ab1, 1 ) );
+	const __m128d s2 = _mm_add_pd( _mm256_castpd256_pd128( ab2 ),
+	                               _mm256_extractf128_pd( ab2, 1 ) );
+	double        st[ 4 ];
+	dcomplex      ab;
+
+	_mm_storeu_pd( st + 0, s1 );
+	_mm_storeu_pd( st + 2, s2 );
+
+	// st = ( sum(ar*br), sum(ai*bi), sum(ar*bi), sum(ai*br) ).
+	bli_zsets( st[ 0 ] - sa*sb*st[ 1 ],
+	           sb*st[ 2 ] + sa*st[ 3 ], ab );
+
+	if ( PASTEMAC(z,eq0)( *beta ) )
+	{
+		PASTEMAC(z,scal2s)( *alpha, ab, *cij );
+	}
+	else
+	{
+		PASTEMAC(z,axpbys)( *alpha, ab, *beta, *cij );
+	}
+}
+
+// Macros used to unroll the block computation over its rows. Any row index
+// at or beyond mr is skipped at compile time since mr is constant.
+#define ZGEMMSUP_RD_LOADA( i, load ) \
+	const __m256d a ## i ## v = ( i < mr ? load( ( double* )( a ## i ## p + l ) ) : zerov );
+
+#define ZGEMMSUP_RD_FMA( i, j ) \
+	if ( i < mr ) \
+	{ \
+		ab1 ## i ## j = _mm256_fmadd_pd( a ## i ## v, bv,  ab1 ## i ## j ); \
+		ab2 ## i ## j = _mm256_fmadd_pd( a ## i ## v, bsv, ab2 ## i ## j ); \
+	}
+
+#define ZGEMMSUP_RD_COL( j, load ) \
+	{ \
+		const __m256d bv  = load( ( double* )( b ## j ## p + l ) ); \
+		const __m256d bsv = _mm256_permute_pd( bv, 0x5 ); \
+\
+		ZGEMMSUP_RD_FMA( 0, j ) \
+		ZGEMMSUP_RD_FMA( 1, j ) \
+		ZGEMMSUP_RD_FMA( 2, j ) \
+	}
+
+#define ZGEMMSUP_RD_STORE( i, j ) \
+	if ( i < mr && j < n ) \
+	{ \
+		bli_zgemmsup_rd_zen_int_update( sa, sb, ab1 ## i ## j, ab2 ## i ## j, \
+		                                alpha, beta, c + i*rs_c + j*cs_c ); \
+	}
+
+// Compute an mr x n block of C, where mr <= 3 and n <= 2. This function is
+// always inlined with a constant mr so that the compiler generates a fully
+// specialized instance for each row count. If n is one, the second column
+// aliases the first; its dot products are computed but discarded.
+static inline __attribute__((always_inline)) void bli_zgemmsup_rd_zen_int_mx2
+     (
+       const dim_t          mr,
+       const conj_t         conja,
+       const conj_t         conjb,
+       const dim_t          n,
+       const dim_t          k,
+       dcomplex*   restrict alpha,
+       dcomplex*   restrict a, const inc_t rs_a,
+       dcomplex*   restrict b, const inc_t cs_b,
+       dcomplex*   restrict beta,
+       dcomplex*   restrict c, const inc_t rs_c, const inc_t cs_c
+     )
+{
+	dcomplex* restrict a0p = a;
+	dcomplex* restrict a1p = a + bli_min( 1, mr - 1 ) * rs_a;
+	dcomplex* restrict a2p = a + bli_min( 2, mr - 1 ) * rs_a;
+
+	dcomplex* restrict b0p = b;
+	dcomplex* restrict b1p = b + bli_min( 1, n - 1 ) * cs_b;
+
+	const __m256d zerov = _mm256_setzero_pd();
+
+	__m256d ab100 = zerov, ab101 = zerov, ab200 = zerov, ab201 = zerov;
+	__m256d ab110 = zerov, ab111 = zerov, ab210 = zerov, ab211 = zerov;
+	__m256d ab120 = zerov, ab121 = zerov, ab220 = zerov, ab221 = zerov;
+
+	const dim_t k_iter = k / 2;
+	const dim_t k_left = k % 2;
+
+	dim_t l = 0;
+
+	for ( dim_t kk = 0; kk < k_iter; ++kk, l += 2 )
+	{
+		ZGEMMSUP_RD_LOADA( 0, _mm256_loadu_pd )
+		ZGEMMSUP_RD_LOADA( 1, _mm256_loadu_pd )
+		ZGEMMSUP_RD_LOADA( 2, _mm256_loadu_pd )
+
+		ZGEMMSUP_RD_COL( 0, _mm256_loadu_pd )
+		ZGEMMSUP_RD_COL( 1, _mm256_loadu_pd )
+	}
+
+	if ( k_left )
+	{
+		// Use masked loads for the k edge so that we never touch elements
+		// of A or B beyond the end of the current rows and columns.
+		const __m256i mask = bli_zgemmsup_rd_zen_int_mask( 2*k_left );
+
+		#define ZGEMMSUP_RD_MASKLOAD( p ) _mm256_maskload_pd( p, mask )
+
+		ZGEMMSUP_RD_LOADA( 0, ZGEMMSUP_RD_MASKLOAD )
+		ZGEMMSUP_RD_LOADA( 1, ZGEMMSUP_RD_MASKLOAD )
+		ZGEMMSUP_RD_LOADA( 2, ZGEMMSUP_RD_MASKLOAD )
+
+		ZGEMMSUP_RD_COL( 0, ZGEMMSUP_RD_MASKLOAD )
+		ZGEMMSUP_RD_COL( 1, ZGEMMSUP_RD_MASKLOAD )
+
+		#undef ZGEMMSUP_RD_MASKLOAD
+	}
+
+	const double sa = ( bli_is_conj( conja ) ? -1.0 : 1.0 );
+	const double sb = ( bli_is_conj( conjb ) ? -1.0 : 1.0 );
+
+	ZGEMMSUP_RD_STORE( 0, 0 ) ZGEMMSUP_RD_STORE( 0, 1 )
+	ZGEMMSUP_RD_STORE( 1, 0 ) ZGEMMSUP_RD_STORE( 1, 1 )
+	ZGEMMSUP_RD_STORE( 2, 0 ) ZGEMMSUP_RD_STORE( 2, 1 )
+}
+
+// Iterate over micropanels of B (in steps of ps_b) and, within each one,
+// over micropanels of A (in steps of ps_a). Each microtile is computed in
+// blocks of 3x2.
+static void bli_zgemmsup_rd_zen_int_3x4
+     (
+       conj_t               conja,
+       conj_t               conjb,
+       dim_t                m0,
+       dim_t                n0,
+       dim_t                k0,
+       dcomplex*   restrict alpha,
+       dcomplex*   restrict a, inc_t rs_a0, inc_t ps_a0,
+       dcomplex*   restrict b, inc_t cs_b0, inc_t ps_b0,
+       dcomplex*   restrict beta,
+       dcomplex*   restrict c, inc_t rs_c0, inc_t cs_c0
+     )
+{
+	const dim_t mr = 3;
+	const dim_t nr = 4;
+
+	for ( dim_t j = 0; j < n0; j += nr )
+	{
+		const dim_t nr_cur = bli_min( nr, n0 - j );
+
+		dcomplex* restrict bj = b + ( j / nr ) * ps_b0;
+
+		for ( dim_t i = 0; i < m0; i += mr )
+		{
+			const dim_t mr_cur = bli_min( mr, m0 - i );
+
+			dcomplex* restrict ai = a + ( i / mr ) * ps_a0;
+			dcomplex* restrict ci = c + i*rs_c0 + j*cs_c0;
+
+			for ( dim_t jj = 0; jj < nr_cur; jj += 2 )
+			{
+				const dim_t nr_blk = bli_min( 2, nr_cur - jj );
+
+				dcomplex* restrict bjj = bj + jj*cs_b0;
+				dcomplex* restrict cij = ci + jj*cs_c0;
+
+				if      ( mr_cur == 3 )
+					bli_zgemmsup_rd_zen_int_mx2( 3, conja, conjb, nr_blk, k0, alpha, ai, rs_a0, bjj, cs_b0, beta, cij, rs_c0, cs_c0 );
+				else if ( mr_cur == 2 )
+					bli_zgemmsup_rd_zen_int_mx2( 2, conja, conjb, nr_blk, k0, alpha, ai, rs_a0, bjj, cs_b0, beta, cij, rs_c0, cs_c0 );
+				else
+					bli_zgemmsup_rd_zen_int_mx2( 1, conja, conjb, nr_blk, k0, alpha, ai, rs_a0, bjj, cs_b0, beta, cij, rs_c0, cs_c0 );
+			}
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_zgemmsup_rd_zen_int_3x4m
+     (
+       conj_t              conja,
+       conj_t              conjb,
+       dim_t               m0,
+       dim_t               n0,
+       dim_t               k0,
+       dcomplex*  restrict alpha,
+       dcomplex*  restrict a, inc_t rs_a0, inc_t cs_a0,
+       dcomplex*  restrict b, inc_t rs_b0, inc_t cs_b0,
+       dcomplex*  restrict beta,
+       dcomplex*  restrict c, inc_t rs_c0, inc_t cs_c0,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	// This millikernel iterates over the m dimension, stepping through
+	// micropanels of A according to the panel stride embedded in the
+	// auxinfo_t object.
+	const inc_t ps_a0 = bli_auxinfo_ps_a( data );
+	const inc_t ps_b0 = 4 * cs_b0;
+
+	bli_zgemmsup_rd_zen_int_3x4
+	(
+	  conja, conjb, m0, n0, k0,
+	  alpha, a, rs_a0, ps_a0,
+	         b, cs_b0, ps_b0,
+	  beta,  c, rs_c0, cs_c0
+	);
+}
+
+void bli_zgemmsup_rd_zen_int_3x4n
+     (
+       conj_t              conja,
+       conj_t              conjb,
+       dim_t               m0,
+       dim_t               n0,
+       dim_t               k0,
+       dcomplex*  restrict alpha,
+       dcomplex*  restrict a, inc_t rs_a0, inc_t cs_a0,
+       dcomplex*  restrict b, inc_t rs_b0, inc_t cs_b0,
+       dcomplex*  restrict beta,
+       dcomplex*  restrict c, inc_t rs_c0, inc_t cs_c0,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	// This millikernel iterates over the n dimension, stepping through
+	// micropanels of B according to the panel stride embedded in the
+	// auxinfo_t object.
+	const inc_t ps_a0 = 3 * rs_a0;
+	const inc_t ps_b0 = bli_auxinfo_ps_b( data );
+
+	bli_zgemmsup_rd_zen_int_3x4
+	(
+	  conja, conjb, m0, n0, k0,
+	  alpha, a, rs_a0, ps_a0,
+	         b, cs_b0, ps_b0,
+	  beta,  c, rs_c0, cs_c0
+	);
+}
+
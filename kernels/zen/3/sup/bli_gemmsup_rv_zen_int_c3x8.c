@@ -0,0 +1,341 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   The rv kernels compute each row of the microtile as a sequence of rank-1
+   updates, broadcasting the real and imaginary parts of one element of A at
+   a time against a row of B. They require B to have unit column stride. A
+   may be stored by rows or columns (or packed), and C may be stored by rows
+   or columns. When C is stored by columns, the microtile is written back
+   through a small temporary buffer.
+
+   Each row of the microtile is accumulated into two pairs of vectors: one
+   holding the products of the real parts of A with B, and one holding the
+   products of the imaginary parts of A with B. The two are combined (and
+   any conjugation of A or B is applied) only after the k loop completes.
+*/
+
+// Return a mask with the first n (of eight) 32-bit elements enabled.
+BLIS_INLINE __m256i bli_cgemmsup_rv_zen_int_mask( dim_t n )
+{
+	const __m256i idx = _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 );
+
+	return _mm256_cmpgt_epi32( _mm256_set1_epi32( ( int )n ), idx );
+}
+
+// Multiply each complex element of x by the complex scalar (chir,chii).
+BLIS_INLINE __m256 bli_cgemmsup_rv_zen_int_scal
+     (
+       __m256 chir, __m256 chii, __m256 x
+     )
+{
+	return _mm256_addsub_ps( _mm256_mul_ps( chir, x ),
+	                         _mm256_mul_ps( chii, _mm256_permute_ps( x, 0xB1 ) ) );
+}
+
+// Macros used to unroll the microtile computation over the rows of C. Row i
+// of the microtile is accumulated in abri0/abri1 (real parts of A) and in
+// abii0/abii1 (imaginary parts of A). Any row index at or beyond mr is
+// skipped at compile time since mr is constant.
+#define CGEMMSUP_RV_FMA( i ) \
+	if ( i < mr ) \
+	{ \
+		const __m256 ar = _mm256_broadcast_ss( ( float* )( a + i*rs_a ) + 0 ); \
+		const __m256 ai = _mm256_broadcast_ss( ( float* )( a + i*rs_a ) + 1 ); \
+\
+		abr ## i ## 0 = _mm256_fmadd_ps( ar, b0, abr ## i ## 0 ); \
+		abr ## i ## 1 = _mm256_fmadd_ps( ar, b1, abr ## i ## 1 ); \
+		abi ## i ## 0 = _mm256_fmadd_ps( ai, b0, abi ## i ## 0 ); \
+		abi ## i ## 1 = _mm256_fmadd_ps( ai, b1, abi ## i ## 1 ); \
+	}
+
+#define CGEMMSUP_RV_COMBINE( i ) \
+	if ( i < mr ) \
+	{ \
+		abr ## i ## 0 = _mm256_fmadd_ps( s2v, _mm256_permute_ps( abi ## i ## 0, 0xB1 ), \
+		                                 _mm256_mul_ps( s1v, abr ## i ## 0 ) ); \
+		abr ## i ## 1 = _mm256_fmadd_ps( s2v, _mm256_permute_ps( abi ## i ## 1, 0xB1 ), \
+		                                 _mm256_mul_ps( s1v, abr ## i ## 1 ) ); \
+\
+		abr ## i ## 0 = bli_cgemmsup_rv_zen_int_scal( alphar, alphai, abr ## i ## 0 ); \
+		abr ## i ## 1 = bli_cgemmsup_rv_zen_int_scal( alphar, alphai, abr ## i ## 1 ); \
+	}
+
+#define CGEMMSUP_RV_STORE_ROW( i ) \
+	if ( i < mr ) \
+	{ \
+		float* restrict ci = ( float* )( c + i*rs_c ); \
+\
+		if ( is_full ) \
+		{ \
+			if ( !beta_is_zero ) \
+			{ \
+				abr ## i ## 0 = _mm256_add_ps( abr ## i ## 0, bli_cgemmsup_rv_zen_int_scal( betar, betai, _mm256_loadu_ps( ci + 0 ) ) ); \
+				abr ## i ## 1 = _mm256_add_ps( abr ## i ## 1, bli_cgemmsup_rv_zen_int_scal( betar, betai, _mm256_loadu_ps( ci + 8 ) ) ); \
+			} \
+			_mm256_storeu_ps( ci + 0, abr ## i ## 0 ); \
+			_mm256_storeu_ps( ci + 8, abr ## i ## 1 ); \
+		} \
+		else \
+		{ \
+			if ( !beta_is_zero ) \
+			{ \
+				abr ## i ## 0 = _mm256_add_ps( abr ## i ## 0, bli_cgemmsup_rv_zen_int_scal( betar, betai, _mm256_maskload_ps( ci + 0, mask0 ) ) ); \
+				abr ## i ## 1 = _mm256_add_ps( abr ## i ## 1, bli_cgemmsup_rv_zen_int_scal( betar, betai, _mm256_maskload_ps( ci + 8, mask1 ) ) ); \
+			} \
+			_mm256_maskstore_ps( ci + 0, mask0, abr ## i ## 0 ); \
+			_mm256_maskstore_ps( ci + 8, mask1, abr ## i ## 1 ); \
+		} \
+	}
+
+#define CGEMMSUP_RV_STORE_BUF( i ) \
+	if ( i < mr ) \
+	{ \
+		_mm256_storeu_ps( ( float* )&ct[ i ][ 0 ], abr ## i ## 0 ); \
+		_mm256_storeu_ps( ( float* )&ct[ i ][ 4 ], abr ## i ## 1 ); \
+	}
+
+// Compute an mr x n microtile, where mr <= 3 and n <= 8. This function is
+// always inlined with a constant mr so that the compiler generates a fully
+// specialized instance (with all accumulators in registers) for each row
+// count.
+static inline __attribute__((always_inline)) void bli_cgemmsup_rv_zen_int_mx8
+     (
+       const dim_t          mr,
+       const conj_t         conja,
+       const conj_t         conjb,
+       const dim_t          n,
+       const dim_t          k,
+       scomplex*   restrict alpha,
+       scomplex*   restrict a, const inc_t rs_a, const inc_t cs_a,
+       scomplex*   restrict b, const inc_t rs_b,
+       scomplex*   restrict beta,
+       scomplex*   restrict c, const inc_t rs_c, const inc_t cs_c
+     )
+{
+	const __m256 zerov = _mm256_setzero_ps();
+
+	__m256 abr00 = zerov, abr01 = zerov, abi00 = zerov, abi01 = zerov;
+	__m256 abr10 = zerov, abr11 = zerov, abi10 = zerov, abi11 = zerov;
+	__m256 abr20 = zerov, abr21 = zerov, abi20 = zerov, abi21 = zerov;
+
+	const bool    is_full = ( n == 8 );
+	const __m256i mask0   = bli_cgemmsup_rv_zen_int_mask( 2*n     );
+	const __m256i mask1   = bli_cgemmsup_rv_zen_int_mask( 2*n - 8 );
+
+	if ( is_full )
+	{
+		for ( dim_t l = 0; l < k; ++l )
+		{
+			const __m256 b0 = _mm256_loadu_ps( ( float* )b + 0 );
+			const __m256 b1 = _mm256_loadu_ps( ( float* )b + 8 );
+
+			CGEMMSUP_RV_FMA( 0 ) CGEMMSUP_RV_FMA( 1 ) CGEMMSUP_RV_FMA( 2 )
+
+			a += cs_a;
+			b += rs_b;
+		}
+	}
+	else
+	{
+		// Use masked loads so that we never touch elements of B beyond
+		// the n columns of the current micropanel.
+		for ( dim_t l = 0; l < k; ++l )
+		{
+			const __m256 b0 = _mm256_maskload_ps( ( float* )b + 0, mask0 );
+			const __m256 b1 = _mm256_maskload_ps( ( float* )b + 8, mask1 );
+
+			CGEMMSUP_RV_FMA( 0 ) CGEMMSUP_RV_FMA( 1 ) CGEMMSUP_RV_FMA( 2 )
+
+			a += cs_a;
+			b += rs_b;
+		}
+	}
+
+	// Combine the real and imaginary accumulators into complex products.
+	// Given abr = ( ar*br, ar*bi ) and abi = ( ai*br, ai*bi ), the product
+	// (optionally conjugating a with sa = -1 and b with sb = -1) is
+	//   ( ar*br - sa*sb*ai*bi, sb*ar*bi + sa*ai*br ),
+	// which is formed as s1 * abr + s2 * swap( abi ). Then scale by alpha.
+	const float  sa     = ( bli_is_conj( conja ) ? -1.0F : 1.0F );
+	const float  sb     = ( bli_is_conj( conjb ) ? -1.0F : 1.0F );
+	const __m256 s1v    = _mm256_setr_ps(  1.0F,   sb,  1.0F,   sb,
+	                                       1.0F,   sb,  1.0F,   sb );
+	const __m256 s2v    = _mm256_setr_ps( -sa*sb,  sa, -sa*sb,  sa,
+	                                      -sa*sb,  sa, -sa*sb,  sa );
+	const __m256 alphar = _mm256_broadcast_ss( ( float* )alpha + 0 );
+	const __m256 alphai = _mm256_broadcast_ss( ( float* )alpha + 1 );
+
+	CGEMMSUP_RV_COMBINE( 0 ) CGEMMSUP_RV_COMBINE( 1 ) CGEMMSUP_RV_COMBINE( 2 )
+
+	const bool beta_is_zero = PASTEMAC(c,eq0)( *beta );
+
+	if ( cs_c == 1 )
+	{
+		// C is row-stored, so we can update it directly with vector loads
+		// and stores. If beta is zero, C is overwritten without being read.
+		const __m256 betar = _mm256_broadcast_ss( ( float* )beta + 0 );
+		const __m256 betai = _mm256_broadcast_ss( ( float* )beta + 1 );
+
+		CGEMMSUP_RV_STORE_ROW( 0 ) CGEMMSUP_RV_STORE_ROW( 1 ) CGEMMSUP_RV_STORE_ROW( 2 )
+	}
+	else
+	{
+		// C is column-stored (or general-stored), so we write the microtile
+		// to a temporary buffer and then update C one element at a time.
+		scomplex ct[ 3 ][ 8 ];
+
+		CGEMMSUP_RV_STORE_BUF( 0 ) CGEMMSUP_RV_STORE_BUF( 1 ) CGEMMSUP_RV_STORE_BUF( 2 )
+
+		for ( dim_t j = 0; j < n; ++j )
+		for ( dim_t i = 0; i < mr; ++i )
+		{
+			scomplex* restrict cij = c + i*rs_c + j*cs_c;
+
+			if ( beta_is_zero ) { PASTEMAC(c,copys)( ct[ i ][ j ], *cij ); }
+			else                { PASTEMAC(c,xpbys)( ct[ i ][ j ], *beta, *cij ); }
+		}
+	}
+}
+
+// Iterate over micropanels of B (in steps of ps_b) and, within each one,
+// over micropanels of A (in steps of ps_a).
+static void bli_cgemmsup_rv_zen_int_3x8
+     (
+       conj_t               conja,
+       conj_t               conjb,
+       dim_t                m0,
+       dim_t                n0,
+       dim_t                k0,
+       scomplex*   restrict alpha,
+       scomplex*   restrict a, inc_t rs_a0, inc_t cs_a0, inc_t ps_a0,
+       scomplex*   restrict b, inc_t rs_b0,               inc_t ps_b0,
+       scomplex*   restrict beta,
+       scomplex*   restrict c, inc_t rs_c0, inc_t cs_c0
+     )
+{
+	const dim_t mr = 3;
+	const dim_t nr = 8;
+
+	for ( dim_t j = 0; j < n0; j += nr )
+	{
+		const dim_t nr_cur = bli_min( nr, n0 - j );
+
+		scomplex* restrict bj = b + ( j / nr ) * ps_b0;
+
+		for ( dim_t i = 0; i < m0; i += mr )
+		{
+			const dim_t mr_cur = bli_min( mr, m0 - i );
+
+			scomplex* restrict ai  = a + ( i / mr ) * ps_a0;
+			scomplex* restrict cij = c + i*rs_c0 + j*cs_c0;
+
+			if      ( mr_cur == 3 )
+				bli_cgemmsup_rv_zen_int_mx8( 3, conja, conjb, nr_cur, k0, alpha, ai, rs_a0, cs_a0, bj, rs_b0, beta, cij, rs_c0, cs_c0 );
+			else if ( mr_cur == 2 )
+				bli_cgemmsup_rv_zen_int_mx8( 2, conja, conjb, nr_cur, k0, alpha, ai, rs_a0, cs_a0, bj, rs_b0, beta, cij, rs_c0, cs_c0 );
+			else
+				bli_cgemmsup_rv_zen_int_mx8( 1, conja, conjb, nr_cur, k0, alpha, ai, rs_a0, cs_a0, bj, rs_b0, beta, cij, rs_c0, cs_c0 );
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_cgemmsup_rv_zen_int_3x8m
+     (
+       conj_t              conja,
+       conj_t              conjb,
+       dim_t               m0,
+       dim_t               n0,
+       dim_t               k0,
+       scomplex*  restrict alpha,
+       scomplex*  restrict a, inc_t rs_a0, inc_t cs_a0,
+       scomplex*  restrict b, inc_t rs_b0, inc_t cs_b0,
+       scomplex*  restrict beta,
+       scomplex*  restrict c, inc_t rs_c0, inc_t cs_c0,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	// This millikernel iterates over the m dimension, stepping through
+	// micropanels of A according to the panel stride embedded in the
+	// auxinfo_t object.
+	const inc_t ps_a0 = bli_auxinfo_ps_a( data );
+	const inc_t ps_b0 = 8 * cs_b0;
+
+	bli_cgemmsup_rv_zen_int_3x8
+	(
+	  conja, conjb, m0, n0, k0,
+	  alpha, a, rs_a0, cs_a0, ps_a0,
+	         b, rs_b0,        ps_b0,
+	  beta,  c, rs_c0, cs_c0
+	);
+}
+
+void bli_cgemmsup_rv_zen_int_3x8n
+     (
+       conj_t              conja,
+       conj_t              conjb,
+       dim_t               m0,
+       dim_t               n0,
+       dim_t               k0,
+       scomplex*  restrict alpha,
+       scomplex*  restrict a, inc_t rs_a0, inc_t cs_a0,
+       scomplex*  restrict b, inc_t rs_b0, inc_t cs_b0,
+       scomplex*  restrict beta,
+       scomplex*  restrict c, inc_t rs_c0, inc_t cs_c0,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	// This millikernel iterates over the n dimension, stepping through
+	// micropanels of B according to the panel stride embedded in the
+	// auxinfo_t object.
+	const inc_t ps_a0 = 3 * rs_a0;
+	const inc_t ps_b0 = bli_auxinfo_ps_b( data );
+
+	bli_cgemmsup_rv_zen_int_3x8
+	(
+	  conja, conjb, m0, n0, k0,
+	  alpha, a, rs_a0, cs_a0, ps_a0,
+	         b, rs_b0,        ps_b0,
+	  beta,  c, rs_c0, cs_c0
+	);
+}
+
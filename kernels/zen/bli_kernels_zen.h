@@ -34,21 +34,41 @@
 
 // -- level-1v --
 
+// addv (intrinsics)
+ADDV_KER_PROT( float,    s, addv_zen_int )
+ADDV_KER_PROT( double,   d, addv_zen_int )
+ADDV_KER_PROT( scomplex, c, addv_zen_int )
+ADDV_KER_PROT( dcomplex, z, addv_zen_int )
+
 // amaxv (intrinsics)
 AMAXV_KER_PROT( float,    s, amaxv_zen_int )
 AMAXV_KER_PROT( double,   d, amaxv_zen_int )
 
+// axpbyv (intrinsics)
+AXPBYV_KER_PROT( float,    s, axpbyv_zen_int )
+AXPBYV_KER_PROT( double,   d, axpbyv_zen_int )
+
 // axpyv (intrinsics)
 AXPYV_KER_PROT( float,    s, axpyv_zen_int )
 AXPYV_KER_PROT( double,   d, axpyv_zen_int )
+AXPYV_KER_PROT( scomplex, c, axpyv_zen_int )
+AXPYV_KER_PROT( dcomplex, z, axpyv_zen_int )
 
 	// axpyv (intrinsics unrolled x10)
 	AXPYV_KER_PROT( float,    s, axpyv_zen_int10 )
 	AXPYV_KER_PROT( double,   d, axpyv_zen_int10 )
 
+// copyv (intrinsics)
+COPYV_KER_PROT( float,    s, copyv_zen_int )
+COPYV_KER_PROT( double,   d, copyv_zen_int )
+COPYV_KER_PROT( scomplex, c, copyv_zen_int )
+COPYV_KER_PROT( dcomplex, z, copyv_zen_int )
+
 // dotv (intrinsics)
 DOTV_KER_PROT( float,    s, dotv_zen_int )
 DOTV_KER_PROT( double,   d, dotv_zen_int )
+DOTV_KER_PROT( scomplex, c, dotv_zen_int )
+DOTV_KER_PROT( dcomplex, z, dotv_zen_int )
 
 	// dotv (intrinsics, unrolled x10)
 	DOTV_KER_PROT( float,    s, dotv_zen_int10 )
@@ -58,14 +78,54 @@ DOTV_KER_PROT( double,   d, dotv_zen_int )
 DOTXV_KER_PROT( float,    s, dotxv_zen_int )
 DOTXV_KER_PROT( double,   d, dotxv_zen_int )
 
+// normfv (intrinsics)
+NORMFV_KER_PROT( float,    float,  s, s, normfv_zen_int )
+NORMFV_KER_PROT( double,   double, d, d, normfv_zen_int )
+NORMFV_KER_PROT( scomplex, float,  c, s, normfv_zen_int )
+NORMFV_KER_PROT( dcomplex, double, z, d, normfv_zen_int )
+
+// rotv (intrinsics)
+ROTV_KER_PROT( float,    float,  s, s, rotv_zen_int )
+ROTV_KER_PROT( double,   double, d, d, rotv_zen_int )
+ROTV_KER_PROT( scomplex, float,  c, s, rotv_zen_int )
+ROTV_KER_PROT( dcomplex, double, z, d, rotv_zen_int )
+
+// rotmv (intrinsics)
+ROTMV_KER_PROT( float,    s, rotmv_zen_int )
+ROTMV_KER_PROT( double,   d, rotmv_zen_int )
+
 // scalv (intrinsics)
 SCALV_KER_PROT( float,    s, scalv_zen_int )
 SCALV_KER_PROT( double,   d, scalv_zen_int )
+SCALV_KER_PROT( scomplex, c, scalv_zen_int )
+SCALV_KER_PROT( dcomplex, z, scalv_zen_int )
 
 	// scalv (intrinsics unrolled x10)
 	SCALV_KER_PROT( float,    s, scalv_zen_int10 )
 	SCALV_KER_PROT( double,   d, scalv_zen_int10 )
 
+// setv (intrinsics)
+SETV_KER_PROT( float,    s, setv_zen_int )
+SETV_KER_PROT( double,   d, setv_zen_int )
+SETV_KER_PROT( scomplex, c, setv_zen_int )
+SETV_KER_PROT( dcomplex, z, setv_zen_int )
+
+// subv (intrinsics)
+SUBV_KER_PROT( float,    s, subv_zen_int )
+SUBV_KER_PROT( double,   d, subv_zen_int )
+SUBV_KER_PROT( scomplex, c, subv_zen_int )
+SUBV_KER_PROT( dcomplex, z, subv_zen_int )
+
+// swapv (intrinsics)
+SWAPV_KER_PROT( float,    s, swapv_zen_int )
+SWAPV_KER_PROT( double,   d, swapv_zen_int )
+SWAPV_KER_PROT( scomplex, c, swapv_zen_int )
+SWAPV_KER_PROT( dcomplex, z, swapv_zen_int )
+
+// xpbyv (intrinsics)
+XPBYV_KER_PROT( float,    s, xpbyv_zen_int )
+XPBYV_KER_PROT( double,   d, xpbyv_zen_int )
+
 // -- level-1f --
 
 // axpyf (intrinsics)
@@ -76,3 +136,21 @@ AXPYF_KER_PROT( double,   d, axpyf_zen_int_8 )
 DOTXF_KER_PROT( float,    s, dotxf_zen_int_8 )
 DOTXF_KER_PROT( double,   d, dotxf_zen_int_8 )
 
+// -- level-3 sup --------------------------------------------------------------
+
+// gemmsup_rv (intrinsics)
+GEMMSUP_KER_PROT( float,    s, gemmsup_rv_zen_int_6x16m )
+GEMMSUP_KER_PROT( float,    s, gemmsup_rv_zen_int_6x16n )
+GEMMSUP_KER_PROT( scomplex, c, gemmsup_rv_zen_int_3x8m )
+GEMMSUP_KER_PROT( scomplex, c, gemmsup_rv_zen_int_3x8n )
+GEMMSUP_KER_PROT( dcomplex, z, gemmsup_rv_zen_int_3x4m )
+GEMMSUP_KER_PROT( dcomplex, z, gemmsup_rv_zen_int_3x4n )
+
+// gemmsup_rd (intrinsics)
+GEMMSUP_KER_PROT( float,    s, gemmsup_rd_zen_int_6x16m )
+GEMMSUP_KER_PROT( float,    s, gemmsup_rd_zen_int_6x16n )
+GEMMSUP_KER_PROT( scomplex, c, gemmsup_rd_zen_int_3x8m )
+GEMMSUP_KER_PROT( scomplex, c, gemmsup_rd_zen_int_3x8n )
+GEMMSUP_KER_PROT( dcomplex, z, gemmsup_rd_zen_int_3x4m )
+GEMMSUP_KER_PROT( dcomplex, z, gemmsup_rd_zen_int_3x4n )
+
@@ -0,0 +1,79 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, arch, suf ) \
+\
+void PASTEMAC3(ch,opname,arch,suf) \
+     ( \
+       dim_t            n, \
+       ctype*  restrict h, \
+       ctype*  restrict x, inc_t incx, \
+       ctype*  restrict y, inc_t incy, \
+       cntx_t* restrict cntx  \
+     ) \
+{ \
+	/* h holds the 2x2 transformation in column-major order. */ \
+	ctype* restrict h11 = h + 0; \
+	ctype* restrict h21 = h + 1; \
+	ctype* restrict h12 = h + 2; \
+	ctype* restrict h22 = h + 3; \
+\
+	if ( bli_zero_dim1( n ) ) return; \
+\
+	/* Apply the transformation
+	     [ x_i ] := [ h11 h12 ] [ x_i ]
+	     [ y_i ]    [ h21 h22 ] [ y_i ]
+	   to each pair of elements. */ \
+	for ( dim_t i = 0; i < n; ++i ) \
+	{ \
+		ctype* chi1 = x + (i  )*incx; \
+		ctype* psi1 = y + (i  )*incy; \
+		ctype  chi1_new; \
+		ctype  psi1_new; \
+\
+		PASTEMAC(ch,scal2s)( *h11, *chi1, chi1_new ); \
+		PASTEMAC(ch,axpys)( *h12, *psi1, chi1_new ); \
+		PASTEMAC(ch,scal2s)( *h21, *chi1, psi1_new ); \
+		PASTEMAC(ch,axpys)( *h22, *psi1, psi1_new ); \
+\
+		PASTEMAC(ch,copys)( chi1_new, *chi1 ); \
+		PASTEMAC(ch,copys)( psi1_new, *psi1 ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC2( rotmv, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
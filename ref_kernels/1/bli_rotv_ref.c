@@ -0,0 +1,92 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, arch, suf ) \
+\
+void PASTEMAC3(ch,opname,arch,suf) \
+     ( \
+       dim_t             n, \
+       ctype_r* restrict c, \
+       ctype*   restrict s, \
+       ctype*   restrict x, inc_t incx, \
+       ctype*   restrict y, inc_t incy, \
+       cntx_t*  restrict cntx  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	ctype_r     c0 = *c; \
+	ctype_r     s_r; \
+	ctype_r     s_i; \
+\
+	if ( bli_zero_dim1( n ) ) return; \
+\
+	/* Get the real and imaginary components of s. */ \
+	PASTEMAC2(ch,chr,gets)( *s, s_r, s_i ); \
+\
+	/* Apply the plane rotation
+	     [ x_i ] := [  c        s ] [ x_i ]
+	     [ y_i ]    [ -conj(s)  c ] [ y_i ]
+	   to each pair of elements. In the real domain, the imaginary terms
+	   vanish and this reduces to the BLAS ?rot operation. */ \
+	for ( dim_t i = 0; i < n; ++i ) \
+	{ \
+		ctype*  chi1 = x + (i  )*incx; \
+		ctype*  psi1 = y + (i  )*incy; \
+		ctype_r chi1_r, chi1_i; \
+		ctype_r psi1_r, psi1_i; \
+\
+		PASTEMAC2(ch,chr,gets)( *chi1, chi1_r, chi1_i ); \
+		PASTEMAC2(ch,chr,gets)( *psi1, psi1_r, psi1_i ); \
+\
+		if ( bli_is_complex( dt ) ) \
+		{ \
+			PASTEMAC2(chr,ch,sets)( c0 * chi1_r + s_r * psi1_r - s_i * psi1_i, \
+			                        c0 * chi1_i + s_r * psi1_i + s_i * psi1_r, *chi1 ); \
+			PASTEMAC2(chr,ch,sets)( c0 * psi1_r - s_r * chi1_r - s_i * chi1_i, \
+			                        c0 * psi1_i - s_r * chi1_i + s_i * chi1_r, *psi1 ); \
+		} \
+		else \
+		{ \
+			PASTEMAC2(chr,ch,sets)( c0 * chi1_r + s_r * psi1_r, 0.0, *chi1 ); \
+			PASTEMAC2(chr,ch,sets)( c0 * psi1_r - s_r * chi1_r, 0.0, *psi1 ); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNCR_BASIC2( rotv, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
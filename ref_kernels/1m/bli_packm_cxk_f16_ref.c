@@ -0,0 +1,88 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The reference half-precision packm kernel. It up-converts a cdim x n
+// micro-panel of fp16 elements (with a stride of inca along cdim and lda
+// along n) into a single-precision micro-panel with leading dimension ldp,
+// zero-padding up to ldp x n_max.
+
+#undef  GENTFUNC
+#define GENTFUNC( opname, arch, suf ) \
+\
+void PASTEMAC2(opname,arch,suf) \
+     ( \
+       dim_t             cdim, \
+       dim_t             n, \
+       dim_t             n_max, \
+       float*   restrict kappa, \
+       float16* restrict a, inc_t inca, inc_t lda, \
+       float*   restrict p,             inc_t ldp, \
+       cntx_t*  restrict cntx  \
+     ) \
+{ \
+	const float kappa_s = *kappa; \
+\
+	for ( dim_t l = 0; l < n; ++l ) \
+	{ \
+		float16* restrict a_l = a + l*lda; \
+		float*   restrict p_l = p + l*ldp; \
+\
+		if ( kappa_s == 1.0F ) \
+		{ \
+			for ( dim_t i = 0; i < cdim; ++i ) \
+				p_l[ i ] = bli_f16_to_float( a_l[ i*inca ] ); \
+		} \
+		else \
+		{ \
+			for ( dim_t i = 0; i < cdim; ++i ) \
+				p_l[ i ] = kappa_s * bli_f16_to_float( a_l[ i*inca ] ); \
+		} \
+\
+		for ( dim_t i = cdim; i < ldp; ++i ) \
+			p_l[ i ] = 0.0F; \
+	} \
+\
+	for ( dim_t l = n; l < n_max; ++l ) \
+	{ \
+		float* restrict p_l = p + l*ldp; \
+\
+		for ( dim_t i = 0; i < ldp; ++i ) \
+			p_l[ i ] = 0.0F; \
+	} \
+}
+
+GENTFUNC( packm_cxk_f16, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
@@ -0,0 +1,186 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The reference low-precision gemm micro-kernels. Like the optimized
+// kernels, they read micro-panels of A and B that were packed in groups of
+// KR elements along the k dimension, and they prefer row-stored C.
+
+#undef  GENTFUNC
+#define GENTFUNC( opname, arch, suf, mr, nr, kr ) \
+\
+void PASTEMAC2(opname,arch,suf) \
+     ( \
+       dim_t               k, \
+       float*     restrict alpha, \
+       bfloat16*  restrict a, \
+       bfloat16*  restrict b, \
+       float*     restrict beta, \
+       float*     restrict c, inc_t rs_c, inc_t cs_c, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     ) \
+{ \
+	float           ab[ mr * nr ] \
+	                    __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	const dim_t     k_iter = ( k + kr - 1 ) / kr; \
+\
+	for ( dim_t i = 0; i < mr * nr; ++i ) ab[ i ] = 0.0F; \
+\
+	/* Perform a series of rank-kr updates into ab. */ \
+	for ( dim_t l = 0; l < k_iter; ++l ) \
+	{ \
+		for ( dim_t i = 0; i < mr; ++i ) \
+		for ( dim_t j = 0; j < nr; ++j ) \
+		{ \
+			float abij = ab[ i*nr + j ]; \
+\
+			for ( dim_t p = 0; p < kr; ++p ) \
+				abij += bli_bf16_to_float( a[ i*kr + p ] ) * \
+				        bli_bf16_to_float( b[ j*kr + p ] ); \
+\
+			ab[ i*nr + j ] = abij; \
+		} \
+\
+		a += mr * kr; \
+		b += nr * kr; \
+	} \
+\
+	/* Scale by alpha and output or accumulate the result based on the
+	   value of beta. */ \
+	if ( *beta == 0.0F ) \
+	{ \
+		for ( dim_t i = 0; i < mr; ++i ) \
+		for ( dim_t j = 0; j < nr; ++j ) \
+			c[ i*rs_c + j*cs_c ] = *alpha * ab[ i*nr + j ]; \
+	} \
+	else \
+	{ \
+		for ( dim_t i = 0; i < mr; ++i ) \
+		for ( dim_t j = 0; j < nr; ++j ) \
+			c[ i*rs_c + j*cs_c ] = *beta  * c[ i*rs_c + j*cs_c ] + \
+			                       *alpha * ab[ i*nr + j ]; \
+	} \
+}
+
+GENTFUNC( gemm_bf16bf16f32, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX, 4, 16, 2 )
+
+
+// Round a single-precision value to the nearest int32. Values outside of the
+// int32 range (whose results are undefined for the optimized kernels) are
+// saturated here so that the conversion itself is well-defined.
+static int32_t bli_gemmlp_round_s32( float x )
+{
+	if ( x >=  2147483648.0F ) return INT32_MAX;
+	if ( x <= -2147483648.0F ) return INT32_MIN;
+	if ( x != x )              return 0;
+
+	return ( int32_t )lrintf( x );
+}
+
+#undef  GENTFUNC
+#define GENTFUNC( opname, arch, suf, mr, nr, kr ) \
+\
+void PASTEMAC2(opname,arch,suf) \
+     ( \
+       dim_t               k, \
+       float*     restrict alpha, \
+       uint8_t*   restrict a, \
+       int8_t*    restrict b, \
+       float*     restrict beta, \
+       int32_t*   restrict c, inc_t rs_c, inc_t cs_c, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     ) \
+{ \
+	int32_t         ab[ mr * nr ] \
+	                    __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	const dim_t     k_iter = ( k + kr - 1 ) / kr; \
+\
+	for ( dim_t i = 0; i < mr * nr; ++i ) ab[ i ] = 0; \
+\
+	/* Perform a series of rank-kr updates into ab. */ \
+	for ( dim_t l = 0; l < k_iter; ++l ) \
+	{ \
+		for ( dim_t i = 0; i < mr; ++i ) \
+		for ( dim_t j = 0; j < nr; ++j ) \
+		{ \
+			int32_t abij = ab[ i*nr + j ]; \
+\
+			for ( dim_t p = 0; p < kr; ++p ) \
+				abij += ( int32_t )a[ i*kr + p ] * \
+				        ( int32_t )b[ j*kr + p ]; \
+\
+			ab[ i*nr + j ] = abij; \
+		} \
+\
+		a += mr * kr; \
+		b += nr * kr; \
+	} \
+\
+	/* Output or accumulate the result. The update is exact when alpha is
+	   one and beta is zero or one; otherwise, it is computed in single
+	   precision and rounded to the nearest integer. */ \
+	if ( *alpha == 1.0F && *beta == 0.0F ) \
+	{ \
+		for ( dim_t i = 0; i < mr; ++i ) \
+		for ( dim_t j = 0; j < nr; ++j ) \
+			c[ i*rs_c + j*cs_c ] = ab[ i*nr + j ]; \
+	} \
+	else if ( *alpha == 1.0F && *beta == 1.0F ) \
+	{ \
+		for ( dim_t i = 0; i < mr; ++i ) \
+		for ( dim_t j = 0; j < nr; ++j ) \
+			c[ i*rs_c + j*cs_c ] += ab[ i*nr + j ]; \
+	} \
+	else if ( *beta == 0.0F ) \
+	{ \
+		for ( dim_t i = 0; i < mr; ++i ) \
+		for ( dim_t j = 0; j < nr; ++j ) \
+			c[ i*rs_c + j*cs_c ] = \
+			bli_gemmlp_round_s32( *alpha * ( float )ab[ i*nr + j ] ); \
+	} \
+	else \
+	{ \
+		for ( dim_t i = 0; i < mr; ++i ) \
+		for ( dim_t j = 0; j < nr; ++j ) \
+			c[ i*rs_c + j*cs_c ] = \
+			bli_gemmlp_round_s32( *beta  * ( float )c[ i*rs_c + j*cs_c ] + \
+			                      *alpha * ( float )ab[ i*nr + j ] ); \
+	} \
+}
+
+GENTFUNC( gemm_u8s8s32, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX, 4, 16, 4 )
+
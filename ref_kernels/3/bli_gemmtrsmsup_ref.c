@@ -0,0 +1,224 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// These kernels compute
+//
+//   b11 := inv( a11 ) * ( alpha * b11 - a1x * bx1 )
+//
+// for an m x m triangular block a11 (m <= mr), an m x k panel a1x, a k x n
+// panel bx1, and an m x n block b11 (n <= nr), where none of the operands
+// are packed. For the lower triangular kernel, a1x and bx1 are the panels
+// to the left of and above the diagonal block (a10 and b01, respectively),
+// and for the upper triangular kernel they are the panels to the right of
+// and below the diagonal block (a12 and b21, respectively). a1x and a11
+// share the strides rs_a and cs_a, and bx1 and b11 share rs_b and cs_b.
+//
+// The diagonal of a11 is never referenced. Instead, d11 refers to a
+// contiguous vector containing the inverses of the (possibly conjugated)
+// diagonal elements, or ones if a11 has a unit diagonal, so that the
+// kernels may multiply rather than divide.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, arch, suf ) \
+\
+void PASTEMAC3(ch,opname,arch,suf) \
+     ( \
+       conj_t              conja, \
+       dim_t               m, \
+       dim_t               n, \
+       dim_t               k, \
+       ctype*     restrict alpha, \
+       ctype*     restrict a10, \
+       ctype*     restrict a11, inc_t rs_a, inc_t cs_a, \
+       ctype*     restrict d11, \
+       ctype*     restrict b01, \
+       ctype*     restrict b11, inc_t rs_b, inc_t cs_b, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     ) \
+{ \
+	ctype           ab[ BLIS_STACK_BUF_MAX_SIZE \
+	                    / sizeof( ctype ) ] \
+	                    __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	const inc_t     rs_ab  = n; \
+	const inc_t     cs_ab  = 1; \
+\
+	/* Assumptions: m <= mr, n <= nr so that the temporary array ab is
+	   sufficiently large enough to hold the m x n microtile. */ \
+\
+	for ( dim_t i = 0; i < m * n; ++i ) \
+	{ \
+		PASTEMAC(ch,set0s)( ab[i] ); \
+	} \
+\
+	/* ab = a10 * b01; */ \
+	for ( dim_t l = 0; l < k; ++l ) \
+	{ \
+		for ( dim_t i = 0; i < m; ++i ) \
+		{ \
+			ctype alpha_il; \
+\
+			PASTEMAC(ch,copycjs)( conja, a10[ i*rs_a + l*cs_a ], alpha_il ); \
+\
+			for ( dim_t j = 0; j < n; ++j ) \
+			{ \
+				PASTEMAC(ch,axpys) \
+				( \
+				  alpha_il, \
+				  b01[ l*rs_b + j*cs_b ], \
+				  ab[ i*rs_ab + j*cs_ab ]  \
+				); \
+			} \
+		} \
+	} \
+\
+	/* b11 = inv( a11 ) * ( alpha * b11 - ab ); */ \
+	for ( dim_t i = 0; i < m; ++i ) \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		{ \
+			ctype beta11c; \
+\
+			PASTEMAC(ch,scal2s)( *alpha, b11[ i*rs_b + j*cs_b ], beta11c ); \
+			PASTEMAC(ch,subs)( ab[ i*rs_ab + j*cs_ab ], beta11c ); \
+\
+			/* beta11 = beta11 - a10t * b01; (within the diagonal block) */ \
+			for ( dim_t l = 0; l < i; ++l ) \
+			{ \
+				ctype alpha_il; \
+				ctype rho; \
+\
+				PASTEMAC(ch,copycjs)( conja, a11[ i*rs_a + l*cs_a ], alpha_il ); \
+				PASTEMAC(ch,scal2s)( alpha_il, b11[ l*rs_b + j*cs_b ], rho ); \
+				PASTEMAC(ch,subs)( rho, beta11c ); \
+			} \
+\
+			PASTEMAC(ch,scals)( d11[i], beta11c ); \
+\
+			PASTEMAC(ch,copys)( beta11c, b11[ i*rs_b + j*cs_b ] ); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC2( gemmtrsmsup_l, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, arch, suf ) \
+\
+void PASTEMAC3(ch,opname,arch,suf) \
+     ( \
+       conj_t              conja, \
+       dim_t               m, \
+       dim_t               n, \
+       dim_t               k, \
+       ctype*     restrict alpha, \
+       ctype*     restrict a12, \
+       ctype*     restrict a11, inc_t rs_a, inc_t cs_a, \
+       ctype*     restrict d11, \
+       ctype*     restrict b21, \
+       ctype*     restrict b11, inc_t rs_b, inc_t cs_b, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     ) \
+{ \
+	ctype           ab[ BLIS_STACK_BUF_MAX_SIZE \
+	                    / sizeof( ctype ) ] \
+	                    __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	const inc_t     rs_ab  = n; \
+	const inc_t     cs_ab  = 1; \
+\
+	/* Assumptions: m <= mr, n <= nr so that the temporary array ab is
+	   sufficiently large enough to hold the m x n microtile. */ \
+\
+	for ( dim_t i = 0; i < m * n; ++i ) \
+	{ \
+		PASTEMAC(ch,set0s)( ab[i] ); \
+	} \
+\
+	/* ab = a12 * b21; */ \
+	for ( dim_t l = 0; l < k; ++l ) \
+	{ \
+		for ( dim_t i = 0; i < m; ++i ) \
+		{ \
+			ctype alpha_il; \
+\
+			PASTEMAC(ch,copycjs)( conja, a12[ i*rs_a + l*cs_a ], alpha_il ); \
+\
+			for ( dim_t j = 0; j < n; ++j ) \
+			{ \
+				PASTEMAC(ch,axpys) \
+				( \
+				  alpha_il, \
+				  b21[ l*rs_b + j*cs_b ], \
+				  ab[ i*rs_ab + j*cs_ab ]  \
+				); \
+			} \
+		} \
+	} \
+\
+	/* b11 = inv( a11 ) * ( alpha * b11 - ab ); */ \
+	for ( dim_t iter = 0; iter < m; ++iter ) \
+	{ \
+		const dim_t i = m - iter - 1; \
+\
+		for ( dim_t j = 0; j < n; ++j ) \
+		{ \
+			ctype beta11c; \
+\
+			PASTEMAC(ch,scal2s)( *alpha, b11[ i*rs_b + j*cs_b ], beta11c ); \
+			PASTEMAC(ch,subs)( ab[ i*rs_ab + j*cs_ab ], beta11c ); \
+\
+			/* beta11 = beta11 - a12t * b21; (within the diagonal block) */ \
+			for ( dim_t l = i + 1; l < m; ++l ) \
+			{ \
+				ctype alpha_il; \
+				ctype rho; \
+\
+				PASTEMAC(ch,copycjs)( conja, a11[ i*rs_a + l*cs_a ], alpha_il ); \
+				PASTEMAC(ch,scal2s)( alpha_il, b11[ l*rs_b + j*cs_b ], rho ); \
+				PASTEMAC(ch,subs)( rho, beta11c ); \
+			} \
+\
+			PASTEMAC(ch,scals)( d11[i], beta11c ); \
+\
+			PASTEMAC(ch,copys)( beta11c, b11[ i*rs_b + j*cs_b ] ); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC2( gemmtrsmsup_u, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
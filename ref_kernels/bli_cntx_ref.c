@@ -141,9 +141,19 @@
 #undef  gemmsup_gx_ukr_name
 #define gemmsup_gx_ukr_name   GENARNAME(gemmsup_g)
 
+#undef  gemmtrsmsup_l_ukr_name
+#define gemmtrsmsup_l_ukr_name GENARNAME(gemmtrsmsup_l)
+#undef  gemmtrsmsup_u_ukr_name
+#define gemmtrsmsup_u_ukr_name GENARNAME(gemmtrsmsup_u)
+
 // Include the small/unpacked kernel API template.
 #include "bli_l3_sup_ker.h"
 
+// -- Low-precision gemm micro-kernel prototype definitions --------------------
+
+GEMM_BF16BF16F32_UKR_PROT( GENARNAME(gemm_bf16bf16f32) )
+GEMM_U8S8S32_UKR_PROT( GENARNAME(gemm_u8s8s32) )
+
 // -- Level-1m (packm/unpackm) kernel prototype redefinitions ------------------
 
 #undef  packm_2xk_ker_name
@@ -258,6 +268,10 @@
 // template.
 #include "bli_l1m_ker.h"
 
+// The half-precision packm kernel is not type-generic, so its prototype is
+// instantiated directly.
+PACKM_F16_KER_PROT( GENARNAME(packm_cxk_f16) )
+
 // -- Level-1f kernel prototype redefinitions ----------------------------------
 
 #undef  axpy2v_ker_name
@@ -295,6 +309,12 @@
 #define dotxv_ker_name     GENARNAME(dotxv)
 #undef  invertv_ker_name
 #define invertv_ker_name   GENARNAME(invertv)
+#undef  normfv_ker_name
+#define normfv_ker_name    GENARNAME(normfv)
+#undef  rotv_ker_name
+#define rotv_ker_name      GENARNAME(rotv)
+#undef  rotmv_ker_name
+#define rotmv_ker_name     GENARNAME(rotmv)
 #undef  scalv_ker_name
 #define scalv_ker_name     GENARNAME(scalv)
 #undef  scal2v_ker_name
@@ -345,6 +365,7 @@ void GENBARNAME(cntx_init)
 {
 	blksz_t  blkszs[ BLIS_NUM_BLKSZS ];
 	blksz_t  thresh[ BLIS_NUM_THRESH ];
+	blksz_t  l1v_thresh;
 	func_t*  funcs;
 	mbool_t* mbools;
 	dim_t    i;
@@ -465,6 +486,9 @@ void GENBARNAME(cntx_init)
 	// Set the gemm slot to the default gemm sup handler.
 	vfuncs[ BLIS_GEMM ] = bli_gemmsup_ref;
 
+	// Set the trsm slot to the default trsm sup handler.
+	vfuncs[ BLIS_TRSM ] = bli_trsmsup_ref;
+
 
 	// -- Set level-3 small/unpacked micro-kernels and preferences -------------
 
@@ -515,6 +539,33 @@ void GENBARNAME(cntx_init)
 	bli_mbool_init( &mbools[ BLIS_XXX ],  TRUE,  TRUE,  TRUE,  TRUE );
 
 
+	// -- Set level-3 small/unpacked gemmtrsm kernels and preferences ----------
+
+	funcs  = bli_cntx_l3_sup_trsm_kers_buf( cntx );
+	mbools = bli_cntx_l3_sup_trsm_kers_prefs_buf( cntx );
+
+	// Initialize all of the func_t entries to NULL, since only the gemmtrsm
+	// slots are used.
+	for ( i = 0; i < BLIS_NUM_LEVEL3_UKRS; ++i )
+	{
+		bli_func_init_null( &funcs[ i ] );
+		bli_mbool_init( &mbools[ i ], TRUE, TRUE, TRUE, TRUE );
+	}
+
+	gen_func_init( &funcs[ BLIS_GEMMTRSM_L_UKR ], gemmtrsmsup_l_ukr_name );
+	gen_func_init( &funcs[ BLIS_GEMMTRSM_U_UKR ], gemmtrsmsup_u_ukr_name );
+
+
+	// -- Set low-precision gemm micro-kernels ---------------------------------
+
+	// NOTE: Unlike the other micro-kernels, these kernels carry their own
+	// register and cache blocksizes since they do not share the storage
+	// datatypes of the s, d, c, and z blocksizes above.
+	//                                                                   mr  nr  kr   mc    kc    nc
+	bli_cntx_set_lpgemm_ker( BLIS_GEMM_BF16BF16F32, GENBARNAME(gemm_bf16bf16f32),  4, 16,  2, 128,  512, 4096, cntx );
+	bli_cntx_set_lpgemm_ker( BLIS_GEMM_U8S8S32,     GENBARNAME(gemm_u8s8s32),      4, 16,  4, 128, 1024, 4096, cntx );
+
+
 	// -- Set level-1f kernels -------------------------------------------------
 
 	funcs = bli_cntx_l1f_kers_buf( cntx );
@@ -538,6 +589,9 @@ void GENBARNAME(cntx_init)
 	gen_func_init( &funcs[ BLIS_DOTV_KER ],    dotv_ker_name    );
 	gen_func_init( &funcs[ BLIS_DOTXV_KER ],   dotxv_ker_name   );
 	gen_func_init( &funcs[ BLIS_INVERTV_KER ], invertv_ker_name );
+	gen_func_init( &funcs[ BLIS_NORMFV_KER ],  normfv_ker_name  );
+	gen_func_init( &funcs[ BLIS_ROTV_KER ],    rotv_ker_name    );
+	gen_func_init( &funcs[ BLIS_ROTMV_KER ],   rotmv_ker_name   );
 	gen_func_init( &funcs[ BLIS_SCALV_KER ],   scalv_ker_name   );
 	gen_func_init( &funcs[ BLIS_SCAL2V_KER ],  scal2v_ker_name  );
 	gen_func_init( &funcs[ BLIS_SETV_KER ],    setv_ker_name    );
@@ -546,12 +600,25 @@ void GENBARNAME(cntx_init)
 	gen_func_init( &funcs[ BLIS_XPBYV_KER ],   xpbyv_ker_name   );
 
 
+	// -- Set level-1v multithreading threshold --------------------------------
+
+	// NOTE: The level-1v operations are executed with multiple threads only
+	// if the vector length is at least as large as this threshold (and the
+	// user requested more than one thread). A threshold of zero disables
+	// the multithreaded code path altogether. The default values are chosen
+	// so that the vectors involved comfortably exceed the last-level cache,
+	// at which point the operations become bound by memory bandwidth.
+	bli_blksz_init_easy( &l1v_thresh, 524288, 262144, 262144, 131072 );
+
+	bli_cntx_set_l1v_thresh( &l1v_thresh, cntx );
+
+
 	// -- Set level-1m (packm/unpackm) kernels ---------------------------------
 
 	funcs = bli_cntx_packm_kers_buf( cntx );
 
 	// Initialize all packm kernel func_t entries to NULL.
-	for ( i = BLIS_PACKM_0XK_KER; i <= BLIS_PACKM_31XK_KER; ++i )
+	for ( i = BLIS_PACKM_0XK_KER; i <= BLIS_PACKM_32XK_KER; ++i )
 	{
 		bli_func_init_null( &funcs[ i ] );
 	}
@@ -584,6 +651,8 @@ void GENBARNAME(cntx_init)
 	gen_func_init( &funcs[ BLIS_UNPACKM_14XK_KER ], unpackm_14xk_ker_name );
 	gen_func_init( &funcs[ BLIS_UNPACKM_16XK_KER ], unpackm_16xk_ker_name );
 
+	bli_cntx_set_packm_f16_ker( GENBARNAME(packm_cxk_f16), cntx );
+
 
 	// -- Set miscellaneous fields ---------------------------------------------
 
@@ -689,7 +758,7 @@ void GENBAINAME(cntx_init)
 	funcs = bli_cntx_packm_kers_buf( cntx );
 
 	// Initialize all packm kernel func_t entries to NULL.
-	for ( i = BLIS_PACKM_0XK_KER; i <= BLIS_PACKM_31XK_KER; ++i )
+	for ( i = BLIS_PACKM_0XK_KER; i <= BLIS_PACKM_32XK_KER; ++i )
 	{
 		bli_func_init_null( &funcs[ i ] );
 	}
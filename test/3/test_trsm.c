@@ -64,6 +64,10 @@ int main( int argc, char** argv )
 	double   dtime_save;
 	double   gflops;
 
+#ifdef BLIS
+	rntm_t   rntm;
+#endif
+
 	//bli_init();
 
 	//bli_error_checking_level_set( BLIS_NO_ERROR_CHECKING );
@@ -81,6 +85,18 @@ int main( int argc, char** argv )
 	m_input = -1;
 	n_input = -1;
 
+#ifdef BLIS
+	// Initialize a local runtime object from the global settings, and then
+	// choose whether trsm may use its lookahead algorithm. Define TRSM_LA to
+	// zero in order to measure the conventional algorithm instead.
+	bli_rntm_init_from_global( &rntm );
+#ifndef TRSM_LA
+#define TRSM_LA 1
+#endif
+	if ( TRSM_LA ) bli_rntm_enable_trsm_la( &rntm );
+	else           bli_rntm_disable_trsm_la( &rntm );
+#endif
+
 
 	// Supress compiler warnings about unused variable 'ind'.
 	( void )ind;
@@ -198,10 +214,12 @@ int main( int argc, char** argv )
 
 #ifdef BLIS
 
-			bli_trsm( side,
-			          &alpha,
-			          &a,
-			          &c );
+			bli_trsm_ex( side,
+			             &alpha,
+			             &a,
+			             &c,
+			             NULL,
+			             &rntm );
 
 #else
 
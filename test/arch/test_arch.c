@@ -0,0 +1,202 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver compares the gemm performance of several sub-configurations
+// on the same hardware by querying each sub-configuration's context from
+// the gks with bli_gks_query_cntx_for_arch() and passing it into
+// bli_gemm_ex(). The sub-configurations are given by name on the command
+// line (e.g. "./test_arch.x haswell zen2"); by default, only the selected
+// sub-configuration is used. Each result is also checked against the
+// result computed with the default context. Note that a sub-configuration
+// should only be requested if the hardware supports the instructions used
+// by its kernels.
+
+#define MAX_ARCHS 8
+
+int main( int argc, char** argv )
+{
+	dim_t   p;
+	dim_t   p_begin   = P_BEGIN;
+	dim_t   p_end     = P_END;
+	dim_t   p_inc     = P_INC;
+	dim_t   n_repeats = 3;
+	int     n_fail    = 0;
+
+	num_t   dts[ 2 ]  = { BLIS_FLOAT, BLIS_DOUBLE };
+	arch_t  ids[ MAX_ARCHS ];
+	int     n_ids     = 0;
+
+	bli_init();
+
+	printf( "%% selected sub-configuration: %s\n",
+	        bli_arch_string( bli_arch_query_id() ) );
+
+	printf( "%% registered sub-configurations:" );
+	for ( arch_t id = 0; id < BLIS_NUM_ARCHS; ++id )
+		if ( bli_gks_arch_is_registered( id ) )
+			printf( " %s", bli_arch_string( id ) );
+	printf( "\n" );
+
+	for ( int i = 1; i < argc && n_ids < MAX_ARCHS; ++i )
+	{
+		arch_t id = bli_arch_query_id_for_string( argv[i] );
+
+		if ( id == -1 || !bli_gks_arch_is_registered( id ) )
+		{
+			printf( "%% sub-configuration '%s' is not registered; skipping.\n",
+			        argv[i] );
+			continue;
+		}
+
+		ids[ n_ids++ ] = id;
+	}
+
+	if ( n_ids == 0 ) ids[ n_ids++ ] = bli_arch_query_id();
+
+	// Check that each context computes the same product as the default
+	// context.
+	for ( int d = 0; d < 2; ++d )
+	for ( int a = 0; a < n_ids; ++a )
+	{
+		const num_t  dt     = dts[d];
+		const dim_t  m      = 301;
+		const dim_t  n      = 257;
+		const dim_t  k      = 199;
+		const double thresh = ( bli_dt_prec_is_single( dt ) ? 1.0e-4 : 1.0e-12 );
+
+		obj_t   ao, bo, c0, c1, norm;
+		double  diff, dummy;
+		cntx_t* cntx = bli_gks_query_cntx_for_arch( ids[a] );
+
+		bli_obj_create( dt, m, k, 0, 0, &ao );
+		bli_obj_create( dt, k, n, 0, 0, &bo );
+		bli_obj_create( dt, m, n, 0, 0, &c0 );
+		bli_obj_create( dt, m, n, 0, 0, &c1 );
+		bli_obj_create_1x1( dt, &norm );
+
+		bli_randm( &ao );
+		bli_randm( &bo );
+		bli_randm( &c0 );
+		bli_copym( &c0, &c1 );
+
+		bli_gemm_ex( &BLIS_ONE, &ao, &bo, &BLIS_ONE, &c0, NULL, NULL );
+		bli_gemm_ex( &BLIS_ONE, &ao, &bo, &BLIS_ONE, &c1, cntx, NULL );
+
+		bli_subm( &c0, &c1 );
+		bli_normfm( &c1, &norm );
+		bli_getsc( &norm, &diff, &dummy );
+
+		bool pass = ( diff <= thresh * sqrt( ( double )( m * n * k ) ) );
+
+		printf( "%% %s gemm %-10s m=%d n=%d k=%d  diff = %8.2e %s\n",
+		        bli_dt_string( dt ), bli_arch_string( ids[a] ),
+		        ( int )m, ( int )n, ( int )k, diff,
+		        ( pass ? "PASS" : "FAIL" ) );
+
+		if ( !pass ) ++n_fail;
+
+		bli_obj_free( &ao );
+		bli_obj_free( &bo );
+		bli_obj_free( &c0 );
+		bli_obj_free( &c1 );
+		bli_obj_free( &norm );
+	}
+
+	printf( "%% %d failures\n", n_fail );
+
+	// Performance: the single-threaded gemm performance (in GFLOPS) with
+	// each sub-configuration's context for p x p x p problems.
+	printf( "%% columns: p" );
+	for ( int a = 0; a < n_ids; ++a )
+		printf( " %s", bli_arch_string( ids[a] ) );
+	printf( "\n" );
+
+	for ( int d = 0; d < 2; ++d )
+	{
+		num_t dt = dts[d];
+		dim_t i  = 1;
+
+		for ( p = p_begin; p <= p_end; p += p_inc )
+		{
+			obj_t  ao, bo, co;
+			rntm_t rntm = BLIS_RNTM_INITIALIZER;
+			double gflops[ MAX_ARCHS ];
+
+			bli_obj_create( dt, p, p, 0, 0, &ao );
+			bli_obj_create( dt, p, p, 0, 0, &bo );
+			bli_obj_create( dt, p, p, 0, 0, &co );
+
+			bli_randm( &ao );
+			bli_randm( &bo );
+			bli_randm( &co );
+
+			bli_rntm_set_num_threads( 1, &rntm );
+
+			for ( int a = 0; a < n_ids; ++a )
+			{
+				cntx_t* cntx       = bli_gks_query_cntx_for_arch( ids[a] );
+				double  dtime_save = 1.0e9;
+
+				for ( dim_t r = 0; r < n_repeats; ++r )
+				{
+					double dtime = bli_clock();
+
+					bli_gemm_ex( &BLIS_ONE, &ao, &bo, &BLIS_ONE, &co, cntx, &rntm );
+
+					dtime_save = bli_clock_min_diff( dtime_save, dtime );
+				}
+
+				gflops[a] = ( 2.0 * p * p * p ) / ( dtime_save * 1.0e9 );
+			}
+
+			printf( "data_%sgemm( %3lu, 1:%d ) = [ %5lu",
+			        bli_dt_string( dt ), ( unsigned long )i++,
+			        n_ids + 1, ( unsigned long )p );
+			for ( int a = 0; a < n_ids; ++a )
+				printf( " %8.2f", gflops[a] );
+			printf( " ];\n" );
+
+			bli_obj_free( &ao );
+			bli_obj_free( &bo );
+			bli_obj_free( &co );
+		}
+	}
+
+	bli_finalize();
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
@@ -0,0 +1,297 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver checks batched gemm against a loop of independent gemm calls
+// using the object, typed (array-of-pointers and strided), and BLAS
+// (grouped) interfaces, and then compares the performance of a strided
+// batch of n_batch small double-precision gemms with that of a loop over
+// bli_dgemm().
+
+#define N_BATCH 1000
+
+static double resid_of( obj_t* c, obj_t* c_ref )
+{
+	obj_t  norm;
+	double resid, dummy;
+
+	bli_obj_create_1x1( bli_dt_proj_to_real( bli_obj_dt( c ) ), &norm );
+
+	bli_subm( c_ref, c );
+	bli_normfm( c, &norm );
+	bli_getsc( &norm, &resid, &dummy );
+
+	bli_obj_free( &norm );
+
+	return resid;
+}
+
+static int report( const char* label, double resid )
+{
+	printf( "%% %-28s ||C - C_ref||_F = %8.2e %s\n", label, resid,
+	        ( resid < 1.0e-2 ? "PASS" : "FAIL" ) );
+
+	return ( resid < 1.0e-2 ? 0 : 1 );
+}
+
+int main( int argc, char** argv )
+{
+	dim_t  p;
+	dim_t  p_begin   = P_BEGIN;
+	dim_t  p_end     = P_END;
+	dim_t  p_inc     = P_INC;
+	dim_t  n_repeats = 3;
+	num_t  dt;
+	int    n_fail    = 0;
+
+	bli_init();
+
+	if ( argc == 4 )
+	{
+		p_begin = atoi( argv[1] );
+		p_end   = atoi( argv[2] );
+		p_inc   = atoi( argv[3] );
+	}
+
+	// Correctness (object API): items of varying shapes and transposition,
+	// including one that is large enough to use the conventional code path.
+	for ( dt = BLIS_FLOAT; dt <= BLIS_DCOMPLEX; ++dt )
+	{
+		const dim_t n_batch = 23;
+		obj_t       alpha[ 23 ], beta[ 23 ];
+		obj_t       a[ 23 ], b[ 23 ], c[ 23 ], c_ref[ 23 ];
+		double      resid = 0.0;
+
+		for ( dim_t i = 0; i < n_batch; ++i )
+		{
+			const dim_t   m  = ( i == 7 ? 311 : 1 + ( 13 * i ) % 37 );
+			const dim_t   n  = ( i == 7 ? 297 : 1 + ( 7  * i ) % 29 );
+			const dim_t   k  = ( i == 7 ? 283 : 1 + ( 5 * i ) % 41 );
+			const trans_t ta = ( i % 3 == 0 ? BLIS_TRANSPOSE : BLIS_NO_TRANSPOSE );
+			const trans_t tb = ( i % 4 == 1 ? BLIS_CONJ_TRANSPOSE : BLIS_NO_TRANSPOSE );
+
+			bli_obj_create( dt, 1, 1, 0, 0, &alpha[i] );
+			bli_obj_create( dt, 1, 1, 0, 0, &beta[i] );
+			bli_setsc( 1.0 + 0.1 * i, -0.2, &alpha[i] );
+			bli_setsc( ( i % 5 == 0 ? 0.0 : -0.5 ), 0.3, &beta[i] );
+
+			if ( bli_does_trans( ta ) ) bli_obj_create( dt, k, m, 0, 0, &a[i] );
+			else                        bli_obj_create( dt, m, k, 0, 0, &a[i] );
+			if ( bli_does_trans( tb ) ) bli_obj_create( dt, n, k, 0, 0, &b[i] );
+			else                        bli_obj_create( dt, k, n, 0, 0, &b[i] );
+			bli_obj_create( dt, m, n, ( i % 2 ? n : 1 ), ( i % 2 ? 1 : m ), &c[i] );
+			bli_obj_create( dt, m, n, 0, 0, &c_ref[i] );
+
+			bli_randm( &a[i] );
+			bli_randm( &b[i] );
+			bli_randm( &c[i] );
+			bli_copym( &c[i], &c_ref[i] );
+
+			bli_obj_set_conjtrans( ta, &a[i] );
+			bli_obj_set_conjtrans( tb, &b[i] );
+
+			bli_gemm( &alpha[i], &a[i], &b[i], &beta[i], &c_ref[i] );
+		}
+
+		bli_gemm_batch( n_batch, alpha, a, b, beta, c );
+
+		for ( dim_t i = 0; i < n_batch; ++i )
+		{
+			const double resid_i = resid_of( &c[i], &c_ref[i] );
+
+			resid = bli_max( resid, resid_i );
+
+			bli_obj_free( &alpha[i] );
+			bli_obj_free( &beta[i] );
+			bli_obj_free( &a[i] );
+			bli_obj_free( &b[i] );
+			bli_obj_free( &c[i] );
+			bli_obj_free( &c_ref[i] );
+		}
+
+		char label[ 32 ];
+		sprintf( label, "bli_gemm_batch (%s)", bli_dt_string( dt ) );
+		n_fail += report( label, resid );
+	}
+
+	// Correctness (typed and BLAS APIs): a strided batch of equally-sized
+	// double-precision items, which is also accessed via arrays of pointers.
+	{
+		const dim_t n_batch = 57;
+		const dim_t m = 19, n = 23, k = 17;
+		const inc_t ss_a = m * k + 3, ss_b = k * n + 5, ss_c = m * n + 7;
+		double      alpha = 1.5, beta = -0.5;
+		obj_t       ao, bo, co, c_refo, c_pto, c_blaso;
+		double*     ap[ n_batch ];
+		double*     bp[ n_batch ];
+		double*     cp[ n_batch ];
+
+		bli_obj_create( BLIS_DOUBLE, ss_a, n_batch, 0, 0, &ao );
+		bli_obj_create( BLIS_DOUBLE, ss_b, n_batch, 0, 0, &bo );
+		bli_obj_create( BLIS_DOUBLE, ss_c, n_batch, 0, 0, &co );
+		bli_obj_create( BLIS_DOUBLE, ss_c, n_batch, 0, 0, &c_refo );
+		bli_obj_create( BLIS_DOUBLE, ss_c, n_batch, 0, 0, &c_pto );
+		bli_obj_create( BLIS_DOUBLE, ss_c, n_batch, 0, 0, &c_blaso );
+
+		bli_randm( &ao );
+		bli_randm( &bo );
+		bli_randm( &co );
+		bli_copym( &co, &c_refo );
+		bli_copym( &co, &c_pto );
+		bli_copym( &co, &c_blaso );
+
+		double* a     = bli_obj_buffer( &ao );
+		double* b     = bli_obj_buffer( &bo );
+		double* c     = bli_obj_buffer( &co );
+		double* c_ref = bli_obj_buffer( &c_refo );
+		double* c_pt  = bli_obj_buffer( &c_pto );
+		double* c_bla = bli_obj_buffer( &c_blaso );
+
+		for ( dim_t i = 0; i < n_batch; ++i )
+		{
+			// Reference: a (transposed) k x m, b k x n, column-major.
+			bli_dgemm( BLIS_TRANSPOSE, BLIS_NO_TRANSPOSE, m, n, k,
+			           &alpha, a + i * ss_a, 1, k,
+			                   b + i * ss_b, 1, k,
+			           &beta,  c_ref + i * ss_c, 1, m );
+
+			ap[i] = a    + i * ss_a;
+			bp[i] = b    + i * ss_b;
+			cp[i] = c_pt + i * ss_c;
+		}
+
+		bli_dgemm_batch_strided( BLIS_TRANSPOSE, BLIS_NO_TRANSPOSE, m, n, k,
+		                         &alpha, a, 1, k, ss_a,
+		                                 b, 1, k, ss_b,
+		                         &beta,  c, 1, m, ss_c, n_batch );
+		n_fail += report( "bli_dgemm_batch_strided", resid_of( &co, &c_refo ) );
+
+		bli_dgemm_batch( BLIS_TRANSPOSE, BLIS_NO_TRANSPOSE, m, n, k,
+		                 &alpha, ap, 1, k,
+		                         bp, 1, k,
+		                 &beta,  cp, 1, m, n_batch );
+		n_fail += report( "bli_dgemm_batch", resid_of( &c_pto, &c_refo ) );
+
+#ifdef BLIS_ENABLE_BLAS
+		// Split the batch into two groups, the second of which only scales
+		// C by beta (since alpha is zero).
+		const f77_char transa[ 2 ] = { 'T', 'T' };
+		const f77_char transb[ 2 ] = { 'N', 'N' };
+		const f77_int  mb[ 2 ] = { m, m }, nb[ 2 ] = { n, n }, kb[ 2 ] = { k, k };
+		const f77_int  lda[ 2 ] = { k, k }, ldb[ 2 ] = { k, k }, ldc[ 2 ] = { m, m };
+		const double   alphab[ 2 ] = { alpha, 0.0 }, betab[ 2 ] = { beta, beta };
+		const f77_int  n_group = 2;
+		const f77_int  g_size[ 2 ] = { n_batch - 10, 10 };
+
+		for ( dim_t i = 0; i < n_batch; ++i ) cp[i] = c_bla + i * ss_c;
+
+		for ( dim_t i = n_batch - 10; i < n_batch; ++i )
+		{
+			bli_dcopym( 0, BLIS_NONUNIT_DIAG, BLIS_DENSE, BLIS_NO_TRANSPOSE,
+			            m, n, c_bla + i * ss_c, 1, m, c_ref + i * ss_c, 1, m );
+			bli_dscalm( BLIS_NO_CONJUGATE, 0, BLIS_NONUNIT_DIAG, BLIS_DENSE,
+			            m, n, &beta, c_ref + i * ss_c, 1, m );
+		}
+
+		dgemm_batch_( transa, transb, mb, nb, kb, alphab,
+		              ( const double** )ap, lda,
+		              ( const double** )bp, ldb,
+		              betab, cp, ldc, &n_group, g_size );
+		n_fail += report( "dgemm_batch_", resid_of( &c_blaso, &c_refo ) );
+#endif
+
+		bli_obj_free( &ao );
+		bli_obj_free( &bo );
+		bli_obj_free( &co );
+		bli_obj_free( &c_refo );
+		bli_obj_free( &c_pto );
+		bli_obj_free( &c_blaso );
+	}
+
+	// Performance: a strided batch of N_BATCH p x p x p gemms.
+	for ( p = p_begin; p <= p_end; p += p_inc )
+	{
+		const dim_t m = p, n = p, k = p;
+		double      alpha = 1.0, beta = 0.0;
+		double      dtime_loop  = 1.0e9;
+		double      dtime_batch = 1.0e9;
+
+		double*     a = bli_malloc_user( N_BATCH * m * k * sizeof( double ) );
+		double*     b = bli_malloc_user( N_BATCH * k * n * sizeof( double ) );
+		double*     c = bli_malloc_user( N_BATCH * m * n * sizeof( double ) );
+
+		for ( dim_t i = 0; i < N_BATCH * m * k; ++i ) a[i] = 1.0 / ( 1 + i % 7 );
+		for ( dim_t i = 0; i < N_BATCH * k * n; ++i ) b[i] = 1.0 / ( 1 + i % 5 );
+
+		for ( dim_t r = 0; r < n_repeats; ++r )
+		{
+			double dtime = bli_clock();
+
+			for ( dim_t i = 0; i < N_BATCH; ++i )
+				bli_dgemm( BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, m, n, k,
+				           &alpha, a + i * m * k, 1, m,
+				                   b + i * k * n, 1, k,
+				           &beta,  c + i * m * n, 1, m );
+
+			dtime_loop = bli_clock_min_diff( dtime_loop, dtime );
+
+			dtime = bli_clock();
+
+			bli_dgemm_batch_strided( BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE,
+			                         m, n, k,
+			                         &alpha, a, 1, m, m * k,
+			                                 b, 1, k, k * n,
+			                         &beta,  c, 1, m, m * n, N_BATCH );
+
+			dtime_batch = bli_clock_min_diff( dtime_batch, dtime );
+		}
+
+		printf( "data_batch( %2lu, 1:3 ) = [ %4lu %7.2f %7.2f ];\n",
+		        ( unsigned long )( p - p_begin ) / p_inc + 1,
+		        ( unsigned long )m,
+		        ( 2.0 * N_BATCH * m * n * k ) / ( dtime_loop  * 1.0e9 ),
+		        ( 2.0 * N_BATCH * m * n * k ) / ( dtime_batch * 1.0e9 ) );
+
+		bli_free_user( a );
+		bli_free_user( b );
+		bli_free_user( c );
+	}
+
+	bli_finalize();
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
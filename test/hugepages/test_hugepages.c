@@ -0,0 +1,170 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <unistd.h>
+#if defined(__linux__)
+  #include <linux/perf_event.h>
+  #include <sys/ioctl.h>
+  #include <sys/syscall.h>
+#endif
+#include "blis.h"
+
+// This driver measures dgemm performance along with the number of data TLB
+// misses incurred per call. Run it once with BLIS_HUGEPAGES=0 and once with
+// BLIS_HUGEPAGES=1 to compare packing blocks backed by base pages with
+// those backed by huge pages. TLB misses are counted via perf_event_open()
+// and reported as -1 if the counter is unavailable (e.g. on systems other
+// than Linux, or when /proc/sys/kernel/perf_event_paranoid forbids it).
+
+static int tlb_open( void )
+{
+#if defined(__linux__)
+	struct perf_event_attr attr;
+
+	memset( &attr, 0, sizeof( attr ) );
+	attr.type           = PERF_TYPE_HW_CACHE;
+	attr.size           = sizeof( attr );
+	attr.config         = ( PERF_COUNT_HW_CACHE_DTLB ) |
+	                      ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) |
+	                      ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 );
+	attr.disabled       = 1;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv     = 1;
+	attr.inherit        = 1;
+
+	return ( int )syscall( SYS_perf_event_open, &attr, 0, -1, -1, 0 );
+#else
+	return -1;
+#endif
+}
+
+static void tlb_start( int fd )
+{
+#if defined(__linux__)
+	if ( fd < 0 ) return;
+	ioctl( fd, PERF_EVENT_IOC_RESET, 0 );
+	ioctl( fd, PERF_EVENT_IOC_ENABLE, 0 );
+#endif
+}
+
+static double tlb_stop( int fd )
+{
+#if defined(__linux__)
+	long long count;
+
+	if ( fd < 0 ) return -1.0;
+	ioctl( fd, PERF_EVENT_IOC_DISABLE, 0 );
+	if ( read( fd, &count, sizeof( count ) ) != sizeof( count ) ) return -1.0;
+
+	return ( double )count;
+#else
+	return -1.0;
+#endif
+}
+
+int main( int argc, char** argv )
+{
+	obj_t  a, b, c;
+	dim_t  p;
+	dim_t  p_begin   = P_BEGIN;
+	dim_t  p_end     = P_END;
+	dim_t  p_inc     = P_INC;
+	dim_t  n_repeats = 3;
+	num_t  dt        = BLIS_DOUBLE;
+	int    fd;
+
+	bli_init();
+
+	if ( argc == 4 )
+	{
+		p_begin = atoi( argv[1] );
+		p_end   = atoi( argv[2] );
+		p_inc   = atoi( argv[3] );
+	}
+
+	const char* hp_str = bli_hugepage_is_enabled() ? "huge" : "base";
+
+	fd = tlb_open();
+
+	printf( "%% pages: %s, threads: %d\n", hp_str,
+	        ( int )bli_max( 1, bli_thread_get_num_threads() ) );
+
+	for ( p = p_begin; p <= p_end; p += p_inc )
+	{
+		double dtime_min  = 1.0e9;
+		double misses_min = -1.0;
+
+		bli_obj_create( dt, p, p, 0, 0, &a );
+		bli_obj_create( dt, p, p, 0, 0, &b );
+		bli_obj_create( dt, p, p, 0, 0, &c );
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c );
+
+		for ( dim_t r = 0; r < n_repeats; ++r )
+		{
+			double dtime = bli_clock();
+
+			tlb_start( fd );
+
+			bli_gemm( &BLIS_ONE, &a, &b, &BLIS_ONE, &c );
+
+			double misses = tlb_stop( fd );
+
+			dtime_min = bli_clock_min_diff( dtime_min, dtime );
+
+			if ( misses_min < 0.0 || misses < misses_min ) misses_min = misses;
+		}
+
+		double gflops = ( 2.0 * p * p * p ) / ( dtime_min * 1.0e9 );
+
+		printf( "data_gemm_%s( %2lu, 1:3 ) = [ %4lu %7.2f %12.0f ];\n",
+		        hp_str, ( unsigned long )( p - p_begin ) / p_inc + 1,
+		        ( unsigned long )p, gflops, misses_min );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+	}
+
+#if defined(__linux__)
+	if ( 0 <= fd ) close( fd );
+#endif
+
+	bli_finalize();
+
+	return 0;
+}
@@ -0,0 +1,286 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver compares the level-1v kernels registered in the native context
+// with the reference kernels from the context returned by
+// bli_gks_init_ref_cntx(). For each datatype, it first checks that both
+// contexts compute the same result (for unit and non-unit strides, with and
+// without conjugation, and for general, zero, and unit scalars), and then
+// reports the time taken by each kernel for vectors of length p along with
+// the speedup of the native kernel over the reference kernel. Both contexts
+// are used with a single thread so that only the kernels are compared.
+
+#define N_OPS 10
+
+static const char* opnames[ N_OPS ] =
+{
+	"addv", "axpbyv", "axpyv", "copyv", "dotv",
+	"scalv", "setv", "subv", "swapv", "xpbyv"
+};
+
+static void run_op
+     (
+       int     op,
+       obj_t*  alpha,
+       obj_t*  beta,
+       obj_t*  x,
+       obj_t*  y,
+       obj_t*  rho,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	switch ( op )
+	{
+		case 0: bli_addv_ex( x, y, cntx, rntm );                break;
+		case 1: bli_axpbyv_ex( alpha, x, beta, y, cntx, rntm ); break;
+		case 2: bli_axpyv_ex( alpha, x, y, cntx, rntm );        break;
+		case 3: bli_copyv_ex( x, y, cntx, rntm );               break;
+		case 4: bli_dotv_ex( x, y, rho, cntx, rntm );           break;
+		case 5: bli_scalv_ex( alpha, y, cntx, rntm );           break;
+		case 6: bli_setv_ex( alpha, y, cntx, rntm );            break;
+		case 7: bli_subv_ex( x, y, cntx, rntm );                break;
+		case 8: bli_swapv_ex( x, y, cntx, rntm );               break;
+		case 9: bli_xpbyv_ex( x, beta, y, cntx, rntm );         break;
+	}
+}
+
+static double rel_resid_of( obj_t* y, obj_t* y_ref )
+{
+	obj_t  norm, norm_ref;
+	double resid, resid_ref, dummy;
+
+	bli_obj_create_1x1( bli_dt_proj_to_real( bli_obj_dt( y ) ), &norm );
+	bli_obj_create_1x1( bli_dt_proj_to_real( bli_obj_dt( y ) ), &norm_ref );
+
+	bli_normfv( y_ref, &norm_ref );
+	bli_subv( y_ref, y );
+	bli_normfv( y, &norm );
+	bli_getsc( &norm, &resid, &dummy );
+	bli_getsc( &norm_ref, &resid_ref, &dummy );
+
+	bli_obj_free( &norm );
+	bli_obj_free( &norm_ref );
+
+	return ( resid_ref == 0.0 ? resid : resid / resid_ref );
+}
+
+static int check_all( num_t dt, cntx_t* cntx, cntx_t* cntx_ref, rntm_t* rntm )
+{
+	// Choose a length that leaves an edge case for every kernel.
+	const dim_t  n      = 1027;
+	const double thresh = ( bli_dt_prec_is_single( dt ) ? 1.0e-4 : 1.0e-12 );
+
+	obj_t  alpha, beta, rho, rho_ref;
+	int    n_fail = 0;
+
+	bli_obj_create_1x1( dt, &alpha );
+	bli_obj_create_1x1( dt, &beta );
+	bli_obj_create_1x1( dt, &rho );
+	bli_obj_create_1x1( dt, &rho_ref );
+
+	for ( inc_t inc = 1; inc <= 3; inc += 2 )
+	for ( conj_t conjx = BLIS_NO_CONJUGATE; conjx <= BLIS_CONJUGATE; conjx += BLIS_CONJUGATE )
+	for ( int sc = 0; sc < 3; ++sc )
+	{
+		obj_t x, y, x_ref, y_ref;
+
+		// Exercise the special cases for zero and unit scalars as well as
+		// general values.
+		if      ( sc == 0 ) { bli_setsc( 1.2, -0.3, &alpha ); bli_setsc( 0.7, 0.4, &beta ); }
+		else if ( sc == 1 ) { bli_setsc( 0.0,  0.0, &alpha ); bli_setsc( 0.0, 0.0, &beta ); }
+		else                { bli_setsc( 1.0,  0.0, &alpha ); bli_setsc( 1.0, 0.0, &beta ); }
+
+		bli_obj_create( dt, n, 1, inc, inc * n, &x );
+		bli_obj_create( dt, n, 1, inc, inc * n, &y );
+		bli_obj_create( dt, n, 1, inc, inc * n, &x_ref );
+		bli_obj_create( dt, n, 1, inc, inc * n, &y_ref );
+
+		for ( int op = 0; op < N_OPS; ++op )
+		{
+			double resid;
+
+			bli_randv( &x );
+			bli_randv( &y );
+			bli_copyv( &x, &x_ref );
+			bli_copyv( &y, &y_ref );
+
+			bli_obj_set_conj( conjx, &x );
+			bli_obj_set_conj( conjx, &x_ref );
+			bli_obj_set_conj( conjx, &alpha );
+
+			run_op( op, &alpha, &beta, &x_ref, &y_ref, &rho_ref, cntx_ref, rntm );
+			run_op( op, &alpha, &beta, &x,     &y,     &rho,     cntx,     rntm );
+
+			bli_obj_set_conj( BLIS_NO_CONJUGATE, &x );
+			bli_obj_set_conj( BLIS_NO_CONJUGATE, &x_ref );
+			bli_obj_set_conj( BLIS_NO_CONJUGATE, &alpha );
+
+			if      ( op == 4 ) resid = rel_resid_of( &rho, &rho_ref );
+			else if ( op == 8 ) resid = rel_resid_of( &x, &x_ref ) +
+			                            rel_resid_of( &y, &y_ref );
+			else                resid = rel_resid_of( &y, &y_ref );
+
+			printf( "%% %s %-6s inc=%d conj=%d scalars=%d  rel. resid = %8.2e %s\n",
+			        bli_dt_string( dt ), opnames[ op ], ( int )inc,
+			        ( int )conjx, sc, resid,
+			        ( resid < thresh ? "PASS" : "FAIL" ) );
+
+			if ( !( resid < thresh ) ) ++n_fail;
+		}
+
+		bli_obj_free( &x ); bli_obj_free( &y );
+		bli_obj_free( &x_ref ); bli_obj_free( &y_ref );
+	}
+
+	bli_obj_free( &alpha );
+	bli_obj_free( &beta );
+	bli_obj_free( &rho );
+	bli_obj_free( &rho_ref );
+
+	return n_fail;
+}
+
+static double time_op
+     (
+       int     op,
+       obj_t*  alpha,
+       obj_t*  beta,
+       obj_t*  x,
+       obj_t*  y,
+       obj_t*  rho,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       dim_t   n_repeats
+     )
+{
+	double dtime_save = 1.0e9;
+
+	for ( dim_t r = 0; r < n_repeats; ++r )
+	{
+		double dtime = bli_clock();
+
+		run_op( op, alpha, beta, x, y, rho, cntx, rntm );
+
+		dtime_save = bli_clock_min_diff( dtime_save, dtime );
+	}
+
+	return dtime_save;
+}
+
+int main( int argc, char** argv )
+{
+	dim_t   p;
+	dim_t   p_begin   = P_BEGIN;
+	dim_t   p_end     = P_END;
+	dim_t   p_inc     = P_INC;
+	dim_t   n_repeats = 50;
+	int     n_fail    = 0;
+
+	cntx_t* cntx;
+	cntx_t  cntx_ref;
+	rntm_t  rntm      = BLIS_RNTM_INITIALIZER;
+
+	bli_init();
+
+	if ( argc == 4 )
+	{
+		p_begin = atoi( argv[1] );
+		p_end   = atoi( argv[2] );
+		p_inc   = atoi( argv[3] );
+	}
+
+	cntx = bli_gks_query_cntx();
+	bli_gks_init_ref_cntx( &cntx_ref );
+	bli_rntm_set_num_threads( 1, &rntm );
+
+	for ( num_t dt = BLIS_FLOAT; dt <= BLIS_DCOMPLEX; ++dt )
+		n_fail += check_all( dt, cntx, &cntx_ref, &rntm );
+
+	printf( "%% %d failures\n", n_fail );
+
+	// Performance: the time (in microseconds) taken by the native and the
+	// reference kernel for each operation, followed by the speedup of the
+	// former over the latter.
+	printf( "%% columns: p t_native t_ref speedup\n" );
+
+	for ( num_t dt = BLIS_FLOAT; dt <= BLIS_DCOMPLEX; ++dt )
+	for ( int op = 0; op < N_OPS; ++op )
+	{
+		dim_t i = 1;
+
+		for ( p = p_begin; p <= p_end; p += p_inc )
+		{
+			obj_t  x, y, alpha, beta, rho;
+			double t_nat, t_ref;
+
+			bli_obj_create( dt, p, 1, 0, 0, &x );
+			bli_obj_create( dt, p, 1, 0, 0, &y );
+			bli_obj_create_1x1( dt, &alpha );
+			bli_obj_create_1x1( dt, &beta );
+			bli_obj_create_1x1( dt, &rho );
+
+			// Use scalars that avoid the special cases so that the general
+			// code paths are timed, and keep the values bounded across
+			// repeats.
+			bli_setsc( 0.5, 0.1, &alpha );
+			bli_setsc( 0.5, 0.1, &beta );
+
+			bli_randv( &x );
+			bli_randv( &y );
+
+			t_nat = time_op( op, &alpha, &beta, &x, &y, &rho, cntx,      &rntm, n_repeats );
+			t_ref = time_op( op, &alpha, &beta, &x, &y, &rho, &cntx_ref, &rntm, n_repeats );
+
+			printf( "data_%s%s( %3lu, 1:4 ) = [ %6lu %9.2f %9.2f %6.2f ];\n",
+			        bli_dt_string( dt ), opnames[ op ],
+			        ( unsigned long )i++,
+			        ( unsigned long )p,
+			        t_nat * 1.0e6, t_ref * 1.0e6, t_ref / t_nat );
+
+			bli_obj_free( &x );
+			bli_obj_free( &y );
+			bli_obj_free( &alpha );
+			bli_obj_free( &beta );
+			bli_obj_free( &rho );
+		}
+	}
+
+	bli_finalize();
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
@@ -0,0 +1,506 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver checks bli_gemm_bf16bf16f32(), bli_gemm_u8s8s32(), and the
+// half-precision storage operations bli_gemm_f16f16f32(),
+// bli_gemm_f16f32f32(), and bli_gemm_f32f16f32() against a scalar reference
+// for a range of shapes, transpositions, storage formats of C, scalars, and
+// thread counts, and then compares their performance with that of
+// bli_sgemm().
+
+typedef struct
+{
+	dim_t m, n, k;
+} shape_t;
+
+static const shape_t shapes[] =
+{
+	{   1,   1,   1 },
+	{   7,   5,   3 },
+	{  16,  17,   2 },
+	{  33,  47,  65 },
+	{ 130, 129, 257 },
+	{  61, 300, 1100 },
+	{ 157, 151, 530 },
+};
+
+#define N_SHAPES ( sizeof( shapes ) / sizeof( shapes[0] ) )
+
+static const float alphas[] = { 1.0F, 1.0F, 0.5F, 0.0F };
+static const float betas[]  = { 0.0F, 1.0F, -2.0F, 0.5F };
+
+#define N_SCALARS 4
+
+// Set the strides of an m x n matrix stored by rows (0), columns (1), or
+// with general stride (2).
+static void set_strides( int stor, dim_t m, dim_t n, inc_t* rs, inc_t* cs )
+{
+	if      ( stor == 0 ) { *rs = n;         *cs = 1;     }
+	else if ( stor == 1 ) { *rs = 1;         *cs = m;     }
+	else                  { *rs = 2 * n + 1; *cs = 2;     }
+}
+
+static dim_t size_of( dim_t m, dim_t n, inc_t rs, inc_t cs )
+{
+	return ( m - 1 ) * rs + ( n - 1 ) * cs + 1;
+}
+
+static int check_bf16
+     (
+       trans_t transa, trans_t transb, int stor_c,
+       dim_t m, dim_t n, dim_t k, float alpha, float beta, dim_t nt
+     )
+{
+	inc_t rs_a, cs_a, rs_b, cs_b, rs_c, cs_c;
+	inc_t ors_a, ocs_a, ors_b, ocs_b;
+	dim_t m_a = m, n_a = k, m_b = k, n_b = n;
+	int   n_fail = 0;
+
+	if ( bli_does_trans( transa ) ) { m_a = k; n_a = m; }
+	if ( bli_does_trans( transb ) ) { m_b = n; n_b = k; }
+
+	set_strides( 1, m_a, n_a, &rs_a, &cs_a );
+	set_strides( 0, m_b, n_b, &rs_b, &cs_b );
+	set_strides( stor_c, m, n, &rs_c, &cs_c );
+
+	// Compute the strides of transa(A) and transb(B) for the reference.
+	ors_a = rs_a; ocs_a = cs_a;
+	ors_b = rs_b; ocs_b = cs_b;
+	if ( bli_does_trans( transa ) ) bli_swap_incs( &ors_a, &ocs_a );
+	if ( bli_does_trans( transb ) ) bli_swap_incs( &ors_b, &ocs_b );
+
+	dim_t     size_c = size_of( m, n, rs_c, cs_c );
+	bfloat16* a      = malloc( m * k * sizeof( bfloat16 ) );
+	bfloat16* b      = malloc( k * n * sizeof( bfloat16 ) );
+	float*    c      = malloc( size_c * sizeof( float ) );
+	float*    c0     = malloc( size_c * sizeof( float ) );
+
+	for ( dim_t i = 0; i < m * k; ++i )
+		a[i] = bli_float_to_bf16( ( float )( ( i * 7 ) % 13 ) / 8.0F - 0.75F );
+	for ( dim_t i = 0; i < k * n; ++i )
+		b[i] = bli_float_to_bf16( ( float )( ( i * 5 ) % 11 ) / 4.0F - 1.25F );
+	for ( dim_t i = 0; i < size_c; ++i )
+		c[i] = c0[i] = ( float )( i % 9 ) - 4.0F;
+
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	bli_gemm_bf16bf16f32_ex( transa, transb, m, n, k,
+	                         &alpha, a, rs_a, cs_a, b, rs_b, cs_b,
+	                         &beta, c, rs_c, cs_c, NULL, &rntm );
+
+	for ( dim_t i = 0; i < m; ++i )
+	for ( dim_t j = 0; j < n; ++j )
+	{
+		double ab = 0.0, abs_ab = 0.0;
+
+		for ( dim_t p = 0; p < k; ++p )
+		{
+			double aip = bli_bf16_to_float( a[ i*ors_a + p*ocs_a ] );
+			double bpj = bli_bf16_to_float( b[ p*ors_b + j*ocs_b ] );
+
+			ab     += aip * bpj;
+			abs_ab += fabs( aip * bpj );
+		}
+
+		double c0ij  = ( beta == 0.0F ? 0.0 : c0[ i*rs_c + j*cs_c ] );
+		double ref   = beta * c0ij + alpha * ab;
+		double tol   = 1.0e-5 * ( fabs( alpha ) * abs_ab + fabs( beta * c0ij ) ) + 1.0e-6;
+
+		if ( fabs( c[ i*rs_c + j*cs_c ] - ref ) > tol ) n_fail += 1;
+	}
+
+	free( a ); free( b ); free( c ); free( c0 );
+
+	return n_fail;
+}
+
+static int check_u8s8
+     (
+       trans_t transa, trans_t transb, int stor_c,
+       dim_t m, dim_t n, dim_t k, float alpha, float beta, dim_t nt
+     )
+{
+	inc_t rs_a, cs_a, rs_b, cs_b, rs_c, cs_c;
+	inc_t ors_a, ocs_a, ors_b, ocs_b;
+	dim_t m_a = m, n_a = k, m_b = k, n_b = n;
+	int   n_fail = 0;
+
+	if ( bli_does_trans( transa ) ) { m_a = k; n_a = m; }
+	if ( bli_does_trans( transb ) ) { m_b = n; n_b = k; }
+
+	set_strides( 0, m_a, n_a, &rs_a, &cs_a );
+	set_strides( 1, m_b, n_b, &rs_b, &cs_b );
+	set_strides( stor_c, m, n, &rs_c, &cs_c );
+
+	// Compute the strides of transa(A) and transb(B) for the reference.
+	ors_a = rs_a; ocs_a = cs_a;
+	ors_b = rs_b; ocs_b = cs_b;
+	if ( bli_does_trans( transa ) ) bli_swap_incs( &ors_a, &ocs_a );
+	if ( bli_does_trans( transb ) ) bli_swap_incs( &ors_b, &ocs_b );
+
+	dim_t     size_c = size_of( m, n, rs_c, cs_c );
+	uint8_t*  a      = malloc( m * k * sizeof( uint8_t ) );
+	int8_t*   b      = malloc( k * n * sizeof( int8_t ) );
+	int32_t*  c      = malloc( size_c * sizeof( int32_t ) );
+	int32_t*  c0     = malloc( size_c * sizeof( int32_t ) );
+
+	// Use the full ranges of both types.
+	for ( dim_t i = 0; i < m * k; ++i ) a[i] = ( uint8_t )( ( i * 97 + 13 ) % 256 );
+	for ( dim_t i = 0; i < k * n; ++i ) b[i] = ( int8_t )( ( i * 61 + 7 ) % 256 - 128 );
+	for ( dim_t i = 0; i < size_c; ++i ) c[i] = c0[i] = ( int32_t )( i % 1001 ) - 500;
+
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	bli_gemm_u8s8s32_ex( transa, transb, m, n, k,
+	                     &alpha, a, rs_a, cs_a, b, rs_b, cs_b,
+	                     &beta, c, rs_c, cs_c, NULL, &rntm );
+
+	const bool exact = ( alpha == 1.0F && ( beta == 0.0F || beta == 1.0F ) ) ||
+	                   ( alpha == 0.0F && ( beta == 0.0F || beta == 1.0F ) );
+
+	for ( dim_t i = 0; i < m; ++i )
+	for ( dim_t j = 0; j < n; ++j )
+	{
+		int64_t ab = 0;
+
+		for ( dim_t p = 0; p < k; ++p )
+			ab += ( int64_t )a[ i*ors_a + p*ocs_a ] * ( int64_t )b[ p*ors_b + j*ocs_b ];
+
+		double c0ij = ( beta == 0.0F ? 0.0 : c0[ i*rs_c + j*cs_c ] );
+		double ref  = beta * c0ij + alpha * ( double )ab;
+		double cij  = c[ i*rs_c + j*cs_c ];
+
+		if ( exact )
+		{
+			if ( cij != ref ) n_fail += 1;
+		}
+		else
+		{
+			// Allow for the rounding of single-precision scaling.
+			double tol = 1.0 + 4.0e-7 * ( fabs( alpha * ( double )ab ) + fabs( beta * c0ij ) );
+
+			if ( fabs( cij - ref ) > tol ) n_fail += 1;
+		}
+	}
+
+	free( a ); free( b ); free( c ); free( c0 );
+
+	return n_fail;
+}
+
+// Check one of the half-precision storage operations: f16f16f32 (var 0),
+// f16f32f32 (var 1), or f32f16f32 (var 2). A is stored like C, and B is
+// stored in the next of the three storage formats, so that every way of
+// reading an fp16 micro-panel is exercised.
+static int check_f16
+     (
+       int var, trans_t transa, trans_t transb, int stor_c,
+       dim_t m, dim_t n, dim_t k, float alpha, float beta, dim_t nt
+     )
+{
+	inc_t rs_a, cs_a, rs_b, cs_b, rs_c, cs_c;
+	inc_t ors_a, ocs_a, ors_b, ocs_b;
+	dim_t m_a = m, n_a = k, m_b = k, n_b = n;
+	int   n_fail = 0;
+
+	if ( bli_does_trans( transa ) ) { m_a = k; n_a = m; }
+	if ( bli_does_trans( transb ) ) { m_b = n; n_b = k; }
+
+	set_strides( stor_c, m_a, n_a, &rs_a, &cs_a );
+	set_strides( ( stor_c + 1 ) % 3, m_b, n_b, &rs_b, &cs_b );
+	set_strides( stor_c, m, n, &rs_c, &cs_c );
+
+	// Compute the strides of transa(A) and transb(B) for the reference.
+	ors_a = rs_a; ocs_a = cs_a;
+	ors_b = rs_b; ocs_b = cs_b;
+	if ( bli_does_trans( transa ) ) bli_swap_incs( &ors_a, &ocs_a );
+	if ( bli_does_trans( transb ) ) bli_swap_incs( &ors_b, &ocs_b );
+
+	dim_t     size_a = size_of( m_a, n_a, rs_a, cs_a );
+	dim_t     size_b = size_of( m_b, n_b, rs_b, cs_b );
+	dim_t     size_c = size_of( m, n, rs_c, cs_c );
+	float*    af     = malloc( size_a * sizeof( float ) );
+	float*    bf     = malloc( size_b * sizeof( float ) );
+	float16*  ah     = malloc( size_a * sizeof( float16 ) );
+	float16*  bh     = malloc( size_b * sizeof( float16 ) );
+	float*    c      = malloc( size_c * sizeof( float ) );
+	float*    c0     = malloc( size_c * sizeof( float ) );
+
+	// The values of A and B are exactly representable in fp16, so the fp16
+	// and single-precision copies hold the same matrices.
+	for ( dim_t i = 0; i < size_a; ++i )
+	{
+		af[i] = ( float )( ( i * 7 ) % 13 ) / 8.0F - 0.75F;
+		ah[i] = bli_float_to_f16( af[i] );
+	}
+	for ( dim_t i = 0; i < size_b; ++i )
+	{
+		bf[i] = ( float )( ( i * 5 ) % 11 ) / 4.0F - 1.25F;
+		bh[i] = bli_float_to_f16( bf[i] );
+	}
+	for ( dim_t i = 0; i < size_c; ++i )
+		c[i] = c0[i] = ( float )( i % 9 ) - 4.0F;
+
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	if ( var == 0 )
+		bli_gemm_f16f16f32_ex( transa, transb, m, n, k,
+		                       &alpha, ah, rs_a, cs_a, bh, rs_b, cs_b,
+		                       &beta, c, rs_c, cs_c, NULL, &rntm );
+	else if ( var == 1 )
+		bli_gemm_f16f32f32_ex( transa, transb, m, n, k,
+		                       &alpha, ah, rs_a, cs_a, bf, rs_b, cs_b,
+		                       &beta, c, rs_c, cs_c, NULL, &rntm );
+	else
+		bli_gemm_f32f16f32_ex( transa, transb, m, n, k,
+		                       &alpha, af, rs_a, cs_a, bh, rs_b, cs_b,
+		                       &beta, c, rs_c, cs_c, NULL, &rntm );
+
+	for ( dim_t i = 0; i < m; ++i )
+	for ( dim_t j = 0; j < n; ++j )
+	{
+		double ab = 0.0, abs_ab = 0.0;
+
+		for ( dim_t p = 0; p < k; ++p )
+		{
+			double aip = af[ i*ors_a + p*ocs_a ];
+			double bpj = bf[ p*ors_b + j*ocs_b ];
+
+			ab     += aip * bpj;
+			abs_ab += fabs( aip * bpj );
+		}
+
+		double c0ij  = ( beta == 0.0F ? 0.0 : c0[ i*rs_c + j*cs_c ] );
+		double ref   = beta * c0ij + alpha * ab;
+		double tol   = 1.0e-5 * ( fabs( alpha ) * abs_ab + fabs( beta * c0ij ) ) + 1.0e-6;
+
+		if ( fabs( c[ i*rs_c + j*cs_c ] - ref ) > tol ) n_fail += 1;
+	}
+
+	free( af ); free( bf ); free( ah ); free( bh ); free( c ); free( c0 );
+
+	return n_fail;
+}
+
+// Check the float <-> fp16 conversions on special values and at the edges
+// of the fp16 range.
+static int check_f16_conv( void )
+{
+	const struct { float f; float16 h; } cases[] =
+	{
+		{  0.0F,             0x0000 },
+		{  1.0F,             0x3c00 },
+		{ -2.0F,             0xc000 },
+		{  65504.0F,         0x7bff }, // largest finite fp16
+		{  65519.0F,         0x7bff }, // rounds down to 65504
+		{  65520.0F,         0x7c00 }, // rounds up to infinity
+		{  6.103515625e-5F,  0x0400 }, // smallest normal fp16
+		{  5.9604645e-8F,    0x0001 }, // smallest subnormal fp16
+		{  2.9802322e-8F,    0x0000 }, // tie between 0 and 2^-24
+		{  1.00048828125F,   0x3c00 }, // tie, rounds to even
+		{  1.00146484375F,   0x3c02 }, // tie, rounds to even
+	};
+	int n_fail = 0;
+
+	for ( dim_t i = 0; i < sizeof( cases ) / sizeof( cases[0] ); ++i )
+	{
+		if ( bli_float_to_f16( cases[i].f ) != cases[i].h ) n_fail += 1;
+		if ( cases[i].h != 0x7c00 &&
+		     bli_f16_to_float( bli_float_to_f16( cases[i].f ) ) !=
+		     bli_f16_to_float( cases[i].h ) ) n_fail += 1;
+	}
+
+	// Every finite fp16 value survives a round trip through float.
+	for ( uint32_t h = 0; h < 0x10000; ++h )
+	{
+		if ( ( h & 0x7c00 ) == 0x7c00 ) continue;
+		if ( bli_float_to_f16( bli_f16_to_float( ( float16 )h ) ) != h ) n_fail += 1;
+	}
+
+	return n_fail;
+}
+
+int main( int argc, char** argv )
+{
+	dim_t  p;
+	dim_t  p_begin   = P_BEGIN;
+	dim_t  p_end     = P_END;
+	dim_t  p_inc     = P_INC;
+	dim_t  n_repeats = 3;
+	int    n_fail    = 0;
+
+	bli_init();
+
+	if ( argc == 4 )
+	{
+		p_begin = atoi( argv[1] );
+		p_end   = atoi( argv[2] );
+		p_inc   = atoi( argv[3] );
+	}
+
+	// Correctness.
+	if ( check_f16_conv() != 0 )
+	{
+		printf( "%% fp16 conversions: FAIL\n" );
+		n_fail += 1;
+	}
+
+	for ( dim_t nt = 1; nt <= 4; nt += 3 )
+	for ( dim_t s = 0; s < N_SHAPES; ++s )
+	{
+		int n_fail_bf16 = 0;
+		int n_fail_u8s8 = 0;
+		int n_fail_f16  = 0;
+
+		for ( int t = 0; t < 4; ++t )
+		for ( int stor_c = 0; stor_c < 3; ++stor_c )
+		for ( int x = 0; x < N_SCALARS; ++x )
+		{
+			trans_t transa = ( t & 1 ? BLIS_TRANSPOSE : BLIS_NO_TRANSPOSE );
+			trans_t transb = ( t & 2 ? BLIS_TRANSPOSE : BLIS_NO_TRANSPOSE );
+
+			n_fail_bf16 += check_bf16( transa, transb, stor_c,
+			                           shapes[s].m, shapes[s].n, shapes[s].k,
+			                           alphas[x], betas[x], nt );
+			n_fail_u8s8 += check_u8s8( transa, transb, stor_c,
+			                           shapes[s].m, shapes[s].n, shapes[s].k,
+			                           alphas[x], betas[x], nt );
+			n_fail_f16  += check_f16( x % 3, transa, transb, stor_c,
+			                          shapes[s].m, shapes[s].n, shapes[s].k,
+			                          alphas[x], betas[x], nt );
+		}
+
+		printf( "%% nt = %lu  m n k = %4lu %4lu %4lu  bf16bf16f32: %s  u8s8s32: %s  f16: %s\n",
+		        ( unsigned long )nt,
+		        ( unsigned long )shapes[s].m,
+		        ( unsigned long )shapes[s].n,
+		        ( unsigned long )shapes[s].k,
+		        ( n_fail_bf16 == 0 ? "PASS" : "FAIL" ),
+		        ( n_fail_u8s8 == 0 ? "PASS" : "FAIL" ),
+		        ( n_fail_f16  == 0 ? "PASS" : "FAIL" ) );
+
+		n_fail += n_fail_bf16 + n_fail_u8s8 + n_fail_f16;
+	}
+
+	// Performance: p x p x p problems with C stored by rows.
+	for ( p = p_begin; p <= p_end; p += p_inc )
+	{
+		const dim_t m = p, n = p, k = p;
+		float       alpha = 1.0F, beta = 0.0F;
+		double      dtime_s    = 1.0e9;
+		double      dtime_bf16 = 1.0e9;
+		double      dtime_u8s8 = 1.0e9;
+		double      dtime_f16  = 1.0e9;
+
+		float*      as = bli_malloc_user( m * k * sizeof( float ) );
+		float*      bs = bli_malloc_user( k * n * sizeof( float ) );
+		float*      cs = bli_malloc_user( m * n * sizeof( float ) );
+		bfloat16*   ah = bli_malloc_user( m * k * sizeof( bfloat16 ) );
+		bfloat16*   bh = bli_malloc_user( k * n * sizeof( bfloat16 ) );
+		float16*    af = bli_malloc_user( m * k * sizeof( float16 ) );
+		uint8_t*    au = bli_malloc_user( m * k * sizeof( uint8_t ) );
+		int8_t*     bi = bli_malloc_user( k * n * sizeof( int8_t ) );
+		int32_t*    ci = bli_malloc_user( m * n * sizeof( int32_t ) );
+
+		for ( dim_t i = 0; i < m * k; ++i )
+		{
+			as[i] = 1.0F / ( 1 + i % 7 );
+			ah[i] = bli_float_to_bf16( as[i] );
+			af[i] = bli_float_to_f16( as[i] );
+			au[i] = ( uint8_t )( i % 251 );
+		}
+		for ( dim_t i = 0; i < k * n; ++i )
+		{
+			bs[i] = 1.0F / ( 1 + i % 5 );
+			bh[i] = bli_float_to_bf16( bs[i] );
+			bi[i] = ( int8_t )( i % 255 - 127 );
+		}
+
+		for ( dim_t r = 0; r < n_repeats; ++r )
+		{
+			double dtime = bli_clock();
+
+			bli_sgemm( BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, m, n, k,
+			           &alpha, as, k, 1, bs, n, 1, &beta, cs, n, 1 );
+
+			dtime_s = bli_clock_min_diff( dtime_s, dtime );
+
+			dtime = bli_clock();
+
+			bli_gemm_bf16bf16f32( BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, m, n, k,
+			                      &alpha, ah, k, 1, bh, n, 1, &beta, cs, n, 1 );
+
+			dtime_bf16 = bli_clock_min_diff( dtime_bf16, dtime );
+
+			dtime = bli_clock();
+
+			bli_gemm_u8s8s32( BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, m, n, k,
+			                  &alpha, au, k, 1, bi, n, 1, &beta, ci, n, 1 );
+
+			dtime_u8s8 = bli_clock_min_diff( dtime_u8s8, dtime );
+
+			dtime = bli_clock();
+
+			bli_gemm_f16f32f32( BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, m, n, k,
+			                    &alpha, af, k, 1, bs, n, 1, &beta, cs, n, 1 );
+
+			dtime_f16 = bli_clock_min_diff( dtime_f16, dtime );
+		}
+
+		// Report GFLOPS (or GOPS) for sgemm, bf16bf16f32, u8s8s32, and
+		// f16f32f32.
+		printf( "data_lpgemm( %2lu, 1:5 ) = [ %4lu %8.2f %8.2f %8.2f %8.2f ];\n",
+		        ( unsigned long )( p - p_begin ) / p_inc + 1,
+		        ( unsigned long )m,
+		        ( 2.0 * m * n * k ) / ( dtime_s    * 1.0e9 ),
+		        ( 2.0 * m * n * k ) / ( dtime_bf16 * 1.0e9 ),
+		        ( 2.0 * m * n * k ) / ( dtime_u8s8 * 1.0e9 ),
+		        ( 2.0 * m * n * k ) / ( dtime_f16  * 1.0e9 ) );
+
+		bli_free_user( as ); bli_free_user( bs ); bli_free_user( cs );
+		bli_free_user( ah ); bli_free_user( bh ); bli_free_user( af );
+		bli_free_user( au ); bli_free_user( bi ); bli_free_user( ci );
+	}
+
+	bli_finalize();
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
+
@@ -0,0 +1,259 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver checks that normfv computes the Euclidean norm accurately
+// for vectors whose elements are very large or very small (such that the
+// sum of their squares would overflow or underflow), for vectors mixing
+// such elements, and for vectors containing Inf or NaN, using the result
+// of sumsqv as a reference. It then reports the time taken by normfv,
+// sumsqv, and dotv (the latter computing x^H x) on vectors of length p.
+
+static double norm_ref_of( obj_t* x )
+{
+	num_t  dt_r = bli_dt_proj_to_real( bli_obj_dt( x ) );
+	obj_t  scale, sumsq;
+	double scale_d, sumsq_d, dummy;
+
+	bli_obj_create_1x1( dt_r, &scale );
+	bli_obj_create_1x1( dt_r, &sumsq );
+	bli_setsc( 0.0, 0.0, &scale );
+	bli_setsc( 1.0, 0.0, &sumsq );
+
+	bli_sumsqv( x, &scale, &sumsq );
+
+	bli_getsc( &scale, &scale_d, &dummy );
+	bli_getsc( &sumsq, &sumsq_d, &dummy );
+
+	bli_obj_free( &scale );
+	bli_obj_free( &sumsq );
+
+	// Compute the reference in double precision so that it does not
+	// overflow for the single precision datatypes.
+	return scale_d * sqrt( sumsq_d );
+}
+
+static double norm_of( obj_t* x )
+{
+	obj_t  norm;
+	double norm_d, dummy;
+
+	bli_obj_create_1x1( bli_dt_proj_to_real( bli_obj_dt( x ) ), &norm );
+
+	bli_normfv( x, &norm );
+	bli_getsc( &norm, &norm_d, &dummy );
+
+	bli_obj_free( &norm );
+
+	return norm_d;
+}
+
+static int check_all( num_t dt )
+{
+	const dim_t  n      = 1003;
+	const bool   is_s   = bli_dt_prec_is_single( dt );
+	const double thresh = ( is_s ? 1.0e-5 : 1.0e-13 );
+
+	// Scaling factors whose squares overflow or underflow, respectively.
+	const double big    = ( is_s ? 1.0e25  : 1.0e200  );
+	const double sml    = ( is_s ? 1.0e-25 : 1.0e-200 );
+
+	int          n_fail = 0;
+
+	for ( inc_t inc = 1; inc <= 3; inc += 2 )
+	for ( int t = 0; t < 6; ++t )
+	{
+		obj_t       x, alpha;
+		double      norm, norm_ref;
+		bool        pass;
+		const char* label = "";
+
+		bli_obj_create( dt, n, 1, inc, inc * n, &x );
+		bli_obj_create_1x1( dt, &alpha );
+
+		bli_randv( &x );
+
+		switch ( t )
+		{
+			case 0:
+			label = "random";
+			break;
+
+			case 1:
+			label = "big";
+			bli_setsc( big, 0.0, &alpha );
+			bli_scalv( &alpha, &x );
+			break;
+
+			case 2:
+			label = "small";
+			bli_setsc( sml, 0.0, &alpha );
+			bli_scalv( &alpha, &x );
+			break;
+
+			case 3:
+			label = "mixed";
+			bli_setijm( big, 0.0, n / 3,     0, &x );
+			bli_setijm( sml, 0.0, n / 2,     0, &x );
+			bli_setijm( 0.0, sml, n - 1,     0, &x );
+			break;
+
+			case 4:
+			label = "inf";
+			bli_setijm( INFINITY, 0.0, n / 2, 0, &x );
+			break;
+
+			case 5:
+			label = "nan";
+			bli_setijm( big, 0.0, 7,     0, &x );
+			bli_setijm( NAN, 0.0, n / 2, 0, &x );
+			break;
+		}
+
+		norm     = norm_of( &x );
+		norm_ref = norm_ref_of( &x );
+
+		if      ( t == 4 ) pass = ( bli_isinf( norm ) );
+		else if ( t == 5 ) pass = ( bli_isnan( norm ) );
+		else               pass = ( fabs( norm - norm_ref ) <= thresh * norm_ref );
+
+		printf( "%% %s normfv inc=%d %-6s norm = %12.5e ref = %12.5e %s\n",
+		        bli_dt_string( dt ), ( int )inc, label, norm, norm_ref,
+		        ( pass ? "PASS" : "FAIL" ) );
+
+		if ( !pass ) ++n_fail;
+
+		bli_obj_free( &x );
+		bli_obj_free( &alpha );
+	}
+
+	return n_fail;
+}
+
+int main( int argc, char** argv )
+{
+	dim_t  p;
+	dim_t  p_begin   = P_BEGIN;
+	dim_t  p_end     = P_END;
+	dim_t  p_inc     = P_INC;
+	dim_t  n_repeats = 50;
+	int    n_fail    = 0;
+
+	bli_init();
+
+	if ( argc == 4 )
+	{
+		p_begin = atoi( argv[1] );
+		p_end   = atoi( argv[2] );
+		p_inc   = atoi( argv[3] );
+	}
+
+	for ( num_t dt = BLIS_FLOAT; dt <= BLIS_DCOMPLEX; ++dt )
+		n_fail += check_all( dt );
+
+	printf( "%% %d failures\n", n_fail );
+
+	// Performance: the time (in microseconds) taken by normfv, sumsqv, and
+	// dotv, followed by the speedup of normfv over sumsqv.
+	printf( "%% columns: p t_normfv t_sumsqv t_dotv speedup\n" );
+
+	for ( num_t dt = BLIS_FLOAT; dt <= BLIS_DCOMPLEX; ++dt )
+	{
+		num_t dt_r = bli_dt_proj_to_real( dt );
+		dim_t i    = 1;
+
+		for ( p = p_begin; p <= p_end; p += p_inc )
+		{
+			obj_t  x, xc, norm, scale, sumsq, rho;
+			double dtime_save[ 3 ];
+
+			bli_obj_create( dt, p, 1, 0, 0, &x );
+			bli_obj_create_1x1( dt_r, &norm );
+			bli_obj_create_1x1( dt_r, &scale );
+			bli_obj_create_1x1( dt_r, &sumsq );
+			bli_obj_create_1x1( dt, &rho );
+
+			bli_randv( &x );
+			bli_obj_alias_with_conj( BLIS_CONJUGATE, &x, &xc );
+
+			for ( int op = 0; op < 3; ++op )
+			{
+				dtime_save[ op ] = 1.0e9;
+
+				for ( dim_t r = 0; r < n_repeats; ++r )
+				{
+					double dtime = bli_clock();
+
+					switch ( op )
+					{
+						case 0:
+						bli_normfv( &x, &norm );
+						break;
+
+						case 1:
+						bli_setsc( 0.0, 0.0, &scale );
+						bli_setsc( 1.0, 0.0, &sumsq );
+						bli_sumsqv( &x, &scale, &sumsq );
+						break;
+
+						case 2:
+						bli_dotv( &xc, &x, &rho );
+						break;
+					}
+
+					dtime_save[ op ] = bli_clock_min_diff( dtime_save[ op ], dtime );
+				}
+			}
+
+			printf( "data_%snrm2( %3lu, 1:5 ) = [ %6lu %9.2f %9.2f %9.2f %6.2f ];\n",
+			        bli_dt_string( dt ),
+			        ( unsigned long )i++,
+			        ( unsigned long )p,
+			        dtime_save[0] * 1.0e6, dtime_save[1] * 1.0e6,
+			        dtime_save[2] * 1.0e6, dtime_save[1] / dtime_save[0] );
+
+			bli_obj_free( &x );
+			bli_obj_free( &norm );
+			bli_obj_free( &scale );
+			bli_obj_free( &sumsq );
+			bli_obj_free( &rho );
+		}
+	}
+
+	bli_finalize();
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
@@ -0,0 +1,292 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver exercises the packm kernels registered in the native context
+// for the MR and NR of each datatype. For each kernel, it first checks the
+// packed micropanel against one formed with scal2m (and zero-filled beyond
+// the edges) when packing from column-stored, row-stored, and general-stride
+// sources, with and without conjugation, for unit and non-unit kappa, and
+// for full and partial micropanels. It then reports the time taken by the
+// native kernel and by the reference kernel from the context returned by
+// bli_gks_init_ref_cntx() to pack a micropanel of length p, along with the
+// speedup of the former over the latter.
+
+#define N_LAYOUTS 3
+
+static const char* layoutnames[ N_LAYOUTS ] = { "col", "row", "gen" };
+
+typedef void (*packm_ker_ft)
+     (
+       conj_t           conja,
+       pack_t           schema,
+       dim_t            cdim,
+       dim_t            n,
+       dim_t            n_max,
+       void*   restrict kappa,
+       void*   restrict a, inc_t inca, inc_t lda,
+       void*   restrict p,             inc_t ldp,
+       cntx_t* restrict cntx
+     );
+
+// Create an mnr x n matrix whose rows (inca) and columns (lda) are strided
+// according to the given layout.
+static void create_source( num_t dt, int layout, dim_t mnr, dim_t n, obj_t* a )
+{
+	if      ( layout == 0 ) bli_obj_create( dt, mnr, n, 1,     mnr + 3,     a );
+	else if ( layout == 1 ) bli_obj_create( dt, mnr, n, n + 5, 1,           a );
+	else                    bli_obj_create( dt, mnr, n, 2,     2 * mnr + 1, a );
+}
+
+static void call_ker
+     (
+       packm_ker_ft f,
+       conj_t       conja,
+       dim_t        cdim,
+       dim_t        n,
+       dim_t        n_max,
+       obj_t*       kappa,
+       obj_t*       a,
+       obj_t*       p,
+       cntx_t*      cntx
+     )
+{
+	f
+	(
+	  conja,
+	  BLIS_PACKED_ROW_PANELS,
+	  cdim,
+	  n,
+	  n_max,
+	  bli_obj_buffer( kappa ),
+	  bli_obj_buffer( a ), bli_obj_row_stride( a ), bli_obj_col_stride( a ),
+	  bli_obj_buffer( p ),                          bli_obj_col_stride( p ),
+	  cntx
+	);
+}
+
+static int check_ker
+     (
+       num_t        dt,
+       dim_t        mnr,
+       packm_ker_ft f,
+       cntx_t*      cntx
+     )
+{
+	// Choose a length that leaves an edge case for every kernel.
+	const dim_t  n      = 37;
+	const double thresh = ( bli_dt_prec_is_single( dt ) ? 1.0e-6 : 1.0e-14 );
+
+	obj_t  kappa, norm;
+	int    n_fail = 0;
+
+	bli_obj_create_1x1( dt, &kappa );
+	bli_obj_create_1x1( bli_dt_proj_to_real( dt ), &norm );
+
+	for ( int layout = 0; layout < N_LAYOUTS; ++layout )
+	for ( dim_t cdim = mnr; cdim >= mnr - 1; --cdim )
+	for ( dim_t n_max = n; n_max <= n + 3; n_max += 3 )
+	for ( conj_t conja = BLIS_NO_CONJUGATE; conja <= BLIS_CONJUGATE; conja += BLIS_CONJUGATE )
+	for ( int sc = 0; sc < 2; ++sc )
+	{
+		obj_t  a, a_sub, p, p_ref, p_sub;
+		double resid, dummy;
+
+		if ( sc == 0 ) bli_setsc( 1.0,  0.0, &kappa );
+		else           bli_setsc( 1.2, -0.3, &kappa );
+
+		create_source( dt, layout, mnr, n, &a );
+		bli_obj_create( dt, mnr, n_max, 1, mnr, &p );
+		bli_obj_create( dt, mnr, n_max, 1, mnr, &p_ref );
+
+		bli_randm( &a );
+
+		// Fill the packed micropanel with garbage so that any element the
+		// kernel fails to write is detected.
+		bli_randm( &p );
+
+		// Form the expected micropanel: kappa * conja( A ) in the leading
+		// cdim x n submatrix and zeros everywhere else.
+		bli_setm( &BLIS_ZERO, &p_ref );
+		bli_obj_alias_to( &a, &a_sub );
+		bli_obj_alias_to( &p_ref, &p_sub );
+		bli_obj_set_dims( cdim, n, &a_sub );
+		bli_obj_set_dims( cdim, n, &p_sub );
+		bli_obj_set_conj( conja, &a_sub );
+		bli_scal2m( &kappa, &a_sub, &p_sub );
+
+		call_ker( f, conja, cdim, n, n_max, &kappa, &a, &p, cntx );
+
+		bli_subm( &p_ref, &p );
+		bli_normfm( &p, &norm );
+		bli_getsc( &norm, &resid, &dummy );
+
+		printf( "%% %s %2luxk %s cdim=%2lu n_max=%2lu conj=%d kappa=%d  resid = %8.2e %s\n",
+		        bli_dt_string( dt ), ( unsigned long )mnr,
+		        layoutnames[ layout ], ( unsigned long )cdim,
+		        ( unsigned long )n_max, ( int )conja, sc, resid,
+		        ( resid < thresh ? "PASS" : "FAIL" ) );
+
+		if ( !( resid < thresh ) ) ++n_fail;
+
+		bli_obj_free( &a );
+		bli_obj_free( &p );
+		bli_obj_free( &p_ref );
+	}
+
+	bli_obj_free( &kappa );
+	bli_obj_free( &norm );
+
+	return n_fail;
+}
+
+static double time_ker
+     (
+       packm_ker_ft f,
+       obj_t*       kappa,
+       obj_t*       a,
+       obj_t*       p,
+       cntx_t*      cntx,
+       dim_t        n_repeats
+     )
+{
+	const dim_t mnr = bli_obj_length( a );
+	const dim_t n   = bli_obj_width( a );
+
+	double dtime_save = 1.0e9;
+
+	for ( dim_t r = 0; r < n_repeats; ++r )
+	{
+		double dtime = bli_clock();
+
+		call_ker( f, BLIS_NO_CONJUGATE, mnr, n, n, kappa, a, p, cntx );
+
+		dtime_save = bli_clock_min_diff( dtime_save, dtime );
+	}
+
+	return dtime_save;
+}
+
+int main( int argc, char** argv )
+{
+	dim_t   p;
+	dim_t   p_begin   = P_BEGIN;
+	dim_t   p_end     = P_END;
+	dim_t   p_inc     = P_INC;
+	dim_t   n_repeats = 200;
+	int     n_fail    = 0;
+
+	cntx_t* cntx;
+	cntx_t  cntx_ref;
+
+	bli_init();
+
+	if ( argc == 4 )
+	{
+		p_begin = atoi( argv[1] );
+		p_end   = atoi( argv[2] );
+		p_inc   = atoi( argv[3] );
+	}
+
+	cntx = bli_gks_query_cntx();
+	bli_gks_init_ref_cntx( &cntx_ref );
+
+	for ( num_t dt = BLIS_FLOAT; dt <= BLIS_DCOMPLEX; ++dt )
+	for ( bszid_t bs = BLIS_MR; bs <= BLIS_NR; ++bs )
+	{
+		const dim_t  mnr = bli_cntx_get_blksz_def_dt( dt, bs, cntx );
+		packm_ker_ft f   = bli_cntx_get_packm_ker_dt( dt, mnr, cntx );
+
+		if ( f == NULL )
+		{
+			printf( "%% %s %2luxk: no packm kernel registered\n",
+			        bli_dt_string( dt ), ( unsigned long )mnr );
+			continue;
+		}
+
+		n_fail += check_ker( dt, mnr, f, cntx );
+	}
+
+	printf( "%% %d failures\n", n_fail );
+
+	// Performance: the time (in microseconds) taken by the native and the
+	// reference kernel to pack a micropanel from each source layout,
+	// followed by the speedup of the former over the latter.
+	printf( "%% columns: p t_native t_ref speedup\n" );
+
+	for ( num_t dt = BLIS_FLOAT; dt <= BLIS_DCOMPLEX; ++dt )
+	for ( bszid_t bs = BLIS_MR; bs <= BLIS_NR; ++bs )
+	for ( int layout = 0; layout < N_LAYOUTS; ++layout )
+	{
+		const dim_t  mnr   = bli_cntx_get_blksz_def_dt( dt, bs, cntx );
+		packm_ker_ft f     = bli_cntx_get_packm_ker_dt( dt, mnr, cntx );
+		packm_ker_ft f_ref = bli_cntx_get_packm_ker_dt( dt, mnr, &cntx_ref );
+		dim_t        i     = 1;
+
+		if ( f == NULL || f_ref == NULL ) continue;
+
+		for ( p = p_begin; p <= p_end; p += p_inc )
+		{
+			obj_t  a, pp, kappa;
+			double t_nat, t_ref;
+
+			create_source( dt, layout, mnr, p, &a );
+			bli_obj_create( dt, mnr, p, 1, mnr, &pp );
+			bli_obj_create_1x1( dt, &kappa );
+
+			bli_setsc( 1.0, 0.0, &kappa );
+			bli_randm( &a );
+
+			t_nat = time_ker( f,     &kappa, &a, &pp, cntx,      n_repeats );
+			t_ref = time_ker( f_ref, &kappa, &a, &pp, &cntx_ref, n_repeats );
+
+			printf( "data_%spackm_%lu_%s( %3lu, 1:4 ) = [ %6lu %9.3f %9.3f %6.2f ];\n",
+			        bli_dt_string( dt ), ( unsigned long )mnr,
+			        layoutnames[ layout ],
+			        ( unsigned long )i++,
+			        ( unsigned long )p,
+			        t_nat * 1.0e6, t_ref * 1.0e6, t_ref / t_nat );
+
+			bli_obj_free( &a );
+			bli_obj_free( &pp );
+			bli_obj_free( &kappa );
+		}
+	}
+
+	bli_finalize();
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
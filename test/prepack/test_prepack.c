@@ -0,0 +1,169 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver checks gemm with a pre-packed B (see bli_gemm_prepack_b())
+// against gemm with the original B for each datatype, and then compares
+// the performance of repeatedly multiplying different A matrices by the
+// same B, with and without pre-packing.
+
+int main( int argc, char** argv )
+{
+	obj_t  a, b, bp, c, c_ref;
+	obj_t  alpha, beta, norm;
+	dim_t  p;
+	dim_t  p_begin   = P_BEGIN;
+	dim_t  p_end     = P_END;
+	dim_t  p_inc     = P_INC;
+	dim_t  n_repeats = 3;
+	num_t  dt;
+	double resid, dummy;
+	int    n_fail    = 0;
+
+	bli_init();
+
+	if ( argc == 4 )
+	{
+		p_begin = atoi( argv[1] );
+		p_end   = atoi( argv[2] );
+		p_inc   = atoi( argv[3] );
+	}
+
+	// Correctness: use dimensions that do not divide evenly into the
+	// register and cache blocksizes, a transposed B, and both column- and
+	// row-stored C (so that the operation is transposed in one case but not
+	// the other).
+	for ( dt = BLIS_FLOAT; dt <= BLIS_DCOMPLEX; ++dt )
+	for ( int row_c = 0; row_c <= 1; ++row_c )
+	{
+		const dim_t m = 301, n = 457, k = 611;
+
+		bli_obj_create( dt, 1, 1, 0, 0, &alpha );
+		bli_obj_create( dt, 1, 1, 0, 0, &beta );
+		bli_obj_create_1x1( bli_dt_proj_to_real( dt ), &norm );
+
+		bli_obj_create( dt, m, k, 0, 0, &a );
+		bli_obj_create( dt, n, k, 0, 0, &b );
+		bli_obj_create( dt, m, n, ( row_c ? n : 1 ), ( row_c ? 1 : m ), &c );
+		bli_obj_create( dt, m, n, 0, 0, &c_ref );
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c );
+		bli_copym( &c, &c_ref );
+
+		bli_setsc(  (0.9/1.0), 0.2, &alpha );
+		bli_setsc( -(1.1/1.0), 0.3, &beta );
+
+		bli_obj_set_conjtrans( BLIS_CONJ_TRANSPOSE, &b );
+
+		bli_gemm_prepack_b( &b, &bp );
+
+		bli_gemm( &alpha, &a, &b,  &beta, &c_ref );
+		bli_gemm( &alpha, &a, &bp, &beta, &c );
+
+		bli_subm( &c_ref, &c );
+		bli_normfm( &c, &norm );
+		bli_getsc( &norm, &resid, &dummy );
+
+		printf( "%% %-8s (%s C): ||C - C_ref||_F = %8.2e %s\n",
+		        bli_dt_string( dt ), ( row_c ? "row" : "col" ), resid,
+		        ( resid < 1.0e-2 ? "PASS" : "FAIL" ) );
+
+		if ( !( resid < 1.0e-2 ) ) ++n_fail;
+
+		bli_obj_free( &alpha );
+		bli_obj_free( &beta );
+		bli_obj_free( &norm );
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &bp );
+		bli_obj_free( &c );
+		bli_obj_free( &c_ref );
+	}
+
+	// Performance: multiply n_repeats different A matrices (of m = p rows)
+	// by a fixed k x n matrix B.
+	dt = BLIS_DOUBLE;
+
+	for ( p = p_begin; p <= p_end; p += p_inc )
+	{
+		const dim_t m = p, n = 1000, k = 1000;
+		double      dtime_orig = 1.0e9;
+		double      dtime_pack = 1.0e9;
+
+		bli_obj_create( dt, m, k, 0, 0, &a );
+		bli_obj_create( dt, k, n, 0, 0, &b );
+		bli_obj_create( dt, m, n, 0, 0, &c );
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c );
+
+		bli_gemm_prepack_b( &b, &bp );
+
+		for ( dim_t r = 0; r < n_repeats; ++r )
+		{
+			double dtime = bli_clock();
+
+			bli_gemm( &BLIS_ONE, &a, &b, &BLIS_ZERO, &c );
+
+			dtime_orig = bli_clock_min_diff( dtime_orig, dtime );
+
+			dtime = bli_clock();
+
+			bli_gemm( &BLIS_ONE, &a, &bp, &BLIS_ZERO, &c );
+
+			dtime_pack = bli_clock_min_diff( dtime_pack, dtime );
+		}
+
+		printf( "data_prepack( %2lu, 1:3 ) = [ %4lu %7.2f %7.2f ];\n",
+		        ( unsigned long )( p - p_begin ) / p_inc + 1,
+		        ( unsigned long )m,
+		        ( 2.0 * m * n * k ) / ( dtime_orig * 1.0e9 ),
+		        ( 2.0 * m * n * k ) / ( dtime_pack * 1.0e9 ) );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &bp );
+		bli_obj_free( &c );
+	}
+
+	bli_finalize();
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
@@ -0,0 +1,396 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver checks the rotv and rotmv kernels against a scalar reference
+// computed in double precision, for unit and non-unit increments and (for
+// the complex datatypes) for both real and complex s. It then checks that
+// rotsm, which applies sequences of rotations to a matrix with the
+// cache-blocked, wavefront-ordered algorithm, matches applying the same
+// rotations one at a time with rotv, for rotations from the left and
+// from the right, column- and row-stored matrices, and one or four
+// threads. Finally, it reports the time taken to apply K_SEQ sequences of
+// rotations to a p x p matrix with rotsm and with one rotv call per
+// rotation.
+
+#define K_SEQ 16
+
+typedef struct { double r; double i; } cmplx_t;
+
+static cmplx_t getij( dim_t i, dim_t j, obj_t* a )
+{
+	cmplx_t z;
+
+	bli_getijm( i, j, a, &z.r, &z.i );
+
+	return z;
+}
+
+static cmplx_t cmul( cmplx_t a, cmplx_t b )
+{
+	cmplx_t z = { a.r * b.r - a.i * b.i, a.r * b.i + a.i * b.r };
+	return z;
+}
+
+static cmplx_t cadd( cmplx_t a, cmplx_t b )
+{
+	cmplx_t z = { a.r + b.r, a.i + b.i };
+	return z;
+}
+
+static double cdist( cmplx_t a, cmplx_t b )
+{
+	return bli_fmaxabs( a.r - b.r, a.i - b.i );
+}
+
+static void setsc_buf( num_t dt, double zr, double zi, void* chi )
+{
+	switch ( dt )
+	{
+		case BLIS_FLOAT:    bli_ssetsc( zr, zi, chi ); break;
+		case BLIS_DOUBLE:   bli_dsetsc( zr, zi, chi ); break;
+		case BLIS_SCOMPLEX: bli_csetsc( zr, zi, chi ); break;
+		case BLIS_DCOMPLEX: bli_zsetsc( zr, zi, chi ); break;
+		default:            break;
+	}
+}
+
+// Set c and s to a random rotation. The imaginary part of s is zero if
+// real_s is true.
+static void rand_rot( num_t dt, bool real_s, void* c, void* s )
+{
+	double th = 2.0 * M_PI * ( double )rand() / RAND_MAX;
+	double ph = real_s ? 0.0 : 2.0 * M_PI * ( double )rand() / RAND_MAX;
+
+	setsc_buf( bli_dt_proj_to_real( dt ), cos( th ), 0.0, c );
+	setsc_buf( dt, sin( th ) * cos( ph ), sin( th ) * sin( ph ), s );
+}
+
+static int check_rotv( num_t dt )
+{
+	const dim_t  n      = 1003;
+	const num_t  dt_r   = bli_dt_proj_to_real( dt );
+	const double thresh = ( bli_dt_prec_is_single( dt ) ? 1.0e-5 : 1.0e-13 );
+
+	int          n_fail = 0;
+
+	for ( int op = 0; op < 2; ++op )
+	for ( inc_t inc = 1; inc <= 3; inc += 2 )
+	for ( int real_s = 1; real_s >= ( bli_is_complex( dt ) ? 0 : 1 ); --real_s )
+	{
+		obj_t   x, y, x0, y0, c, s, h;
+		double  diff = 0.0;
+
+		if ( op == 1 && !real_s ) continue;
+
+		bli_obj_create( dt, n, 1, inc, inc * n, &x );
+		bli_obj_create( dt, n, 1, inc, inc * n, &y );
+		bli_obj_create( dt, n, 1, 0, 0, &x0 );
+		bli_obj_create( dt, n, 1, 0, 0, &y0 );
+		bli_obj_create_1x1( dt_r, &c );
+		bli_obj_create_1x1( dt, &s );
+		bli_obj_create( dt, 2, 2, 1, 2, &h );
+
+		bli_randm( &x );
+		bli_randm( &y );
+		bli_randm( &h );
+		bli_copym( &x, &x0 );
+		bli_copym( &y, &y0 );
+
+		rand_rot( dt, real_s, bli_obj_buffer( &c ), bli_obj_buffer( &s ) );
+
+		if ( op == 0 )
+			bli_rotv_ex_qfp( dt )
+			( n, bli_obj_buffer( &c ), bli_obj_buffer( &s ),
+			  bli_obj_buffer( &x ), inc, bli_obj_buffer( &y ), inc, NULL, NULL );
+		else
+			bli_rotmv_ex_qfp( dt )
+			( n, bli_obj_buffer( &h ),
+			  bli_obj_buffer( &x ), inc, bli_obj_buffer( &y ), inc, NULL, NULL );
+
+		cmplx_t c1  = getij( 0, 0, &c );
+		cmplx_t s1  = getij( 0, 0, &s );
+		cmplx_t sc1 = { -s1.r, s1.i };
+
+		for ( dim_t i = 0; i < n; ++i )
+		{
+			cmplx_t chi = getij( i, 0, &x0 );
+			cmplx_t psi = getij( i, 0, &y0 );
+			cmplx_t chi_ref, psi_ref;
+
+			if ( op == 0 )
+			{
+				// x := c x + s y; y := c y - conj(s) x
+				chi_ref = cadd( cmul( c1, chi ), cmul( s1, psi ) );
+				psi_ref = cadd( cmul( c1, psi ), cmul( sc1, chi ) );
+			}
+			else
+			{
+				// x := h11 x + h12 y; y := h21 x + h22 y
+				chi_ref = cadd( cmul( getij( 0, 0, &h ), chi ), cmul( getij( 0, 1, &h ), psi ) );
+				psi_ref = cadd( cmul( getij( 1, 0, &h ), chi ), cmul( getij( 1, 1, &h ), psi ) );
+			}
+
+			diff = bli_fmax( diff, cdist( getij( i, 0, &x ), chi_ref ) );
+			diff = bli_fmax( diff, cdist( getij( i, 0, &y ), psi_ref ) );
+		}
+
+		bool pass = ( diff <= thresh );
+
+		printf( "%% %s %-5s inc=%d %s s  diff = %8.2e %s\n",
+		        bli_dt_string( dt ), ( op == 0 ? "rotv" : "rotmv" ),
+		        ( int )inc, ( real_s ? "real" : "cplx" ), diff,
+		        ( pass ? "PASS" : "FAIL" ) );
+
+		if ( !pass ) ++n_fail;
+
+		bli_obj_free( &x );
+		bli_obj_free( &y );
+		bli_obj_free( &x0 );
+		bli_obj_free( &y0 );
+		bli_obj_free( &c );
+		bli_obj_free( &s );
+		bli_obj_free( &h );
+	}
+
+	return n_fail;
+}
+
+// Apply k sequences of rotations to a by calling rotv once per rotation.
+static void rotsm_ref
+     (
+       side_t side, dim_t n_rot, dim_t k,
+       obj_t* c, obj_t* s, obj_t* a
+     )
+{
+	num_t  dt    = bli_obj_dt( a );
+	siz_t  es    = bli_obj_elem_size( a );
+	siz_t  es_r  = bli_obj_elem_size( c );
+	dim_t  n     = ( bli_is_right( side ) ? bli_obj_length( a ) : bli_obj_width( a ) );
+	inc_t  inc   = ( bli_is_right( side ) ? bli_obj_row_stride( a ) : bli_obj_col_stride( a ) );
+	inc_t  ld    = ( bli_is_right( side ) ? bli_obj_col_stride( a ) : bli_obj_row_stride( a ) );
+	char*  a_buf = bli_obj_buffer( a );
+	char*  c_buf = bli_obj_buffer( c );
+	char*  s_buf = bli_obj_buffer( s );
+	inc_t  ldc   = bli_obj_col_stride( c );
+	inc_t  lds   = bli_obj_col_stride( s );
+
+	for ( dim_t p = 0; p < k; ++p )
+	for ( dim_t j = 0; j < n_rot; ++j )
+	{
+		bli_rotv_ex_qfp( dt )
+		(
+		  n,
+		  c_buf + ( j + p*ldc ) * es_r,
+		  s_buf + ( j + p*lds ) * es,
+		  a_buf + ( j   )*ld * es, inc,
+		  a_buf + ( j+1 )*ld * es, inc,
+		  NULL, NULL
+		);
+	}
+}
+
+static int check_rotsm( num_t dt )
+{
+	const dim_t  dims[ 4 ][ 3 ] = { { 300, 70, 37 }, { 5, 129, 3 },
+	                                { 257, 2, 20 }, { 1, 1, 4 } };
+	const num_t  dt_r   = bli_dt_proj_to_real( dt );
+	const double thresh = ( bli_dt_prec_is_single( dt ) ? 1.0e-4 : 1.0e-12 );
+
+	int          n_fail = 0;
+
+	for ( int d = 0; d < 4; ++d )
+	for ( int si = 0; si < 2; ++si )
+	for ( int st = 0; st < 2; ++st )
+	for ( dim_t nt = 1; nt <= 4; nt += 3 )
+	{
+		side_t  side  = ( si == 0 ? BLIS_LEFT : BLIS_RIGHT );
+		dim_t   m     = dims[ d ][ 0 ];
+		dim_t   n     = dims[ d ][ 1 ];
+		dim_t   k     = dims[ d ][ 2 ];
+		dim_t   n_rot = bli_max( ( bli_is_left( side ) ? m : n ) - 1, 0 );
+		inc_t   rs    = ( st == 0 ? 1 : n );
+		inc_t   cs    = ( st == 0 ? m : 1 );
+		obj_t   a, a_ref, c, s;
+		rntm_t  rntm  = BLIS_RNTM_INITIALIZER;
+		double  diff  = 0.0;
+
+		bli_obj_create( dt, m, n, rs, cs, &a );
+		bli_obj_create( dt, m, n, rs, cs, &a_ref );
+		bli_obj_create( dt_r, bli_max( n_rot, 1 ), k, 0, 0, &c );
+		bli_obj_create( dt,   bli_max( n_rot, 1 ), k, 0, 0, &s );
+
+		bli_randm( &a );
+		bli_copym( &a, &a_ref );
+
+		for ( dim_t p = 0; p < k; ++p )
+		for ( dim_t j = 0; j < n_rot; ++j )
+		{
+			rand_rot( dt, FALSE,
+			          ( char* )bli_obj_buffer( &c ) + ( j + p*bli_obj_col_stride( &c ) ) * bli_obj_elem_size( &c ),
+			          ( char* )bli_obj_buffer( &s ) + ( j + p*bli_obj_col_stride( &s ) ) * bli_obj_elem_size( &s ) );
+		}
+
+		bli_rntm_set_num_threads( nt, &rntm );
+
+		bli_rotsm_ex_qfp( dt )
+		(
+		  side, m, n, k,
+		  bli_obj_buffer( &c ), 1, bli_obj_col_stride( &c ),
+		  bli_obj_buffer( &s ), 1, bli_obj_col_stride( &s ),
+		  bli_obj_buffer( &a ), rs, cs,
+		  NULL, &rntm
+		);
+
+		rotsm_ref( side, n_rot, k, &c, &s, &a_ref );
+
+		for ( dim_t j = 0; j < n; ++j )
+		for ( dim_t i = 0; i < m; ++i )
+			diff = bli_fmax( diff, cdist( getij( i, j, &a ), getij( i, j, &a_ref ) ) );
+
+		bool pass = ( diff <= thresh );
+
+		printf( "%% %s rotsm %s m=%3d n=%3d k=%2d %s nt=%d  diff = %8.2e %s\n",
+		        bli_dt_string( dt ), ( bli_is_left( side ) ? "left " : "right" ),
+		        ( int )m, ( int )n, ( int )k, ( st == 0 ? "col" : "row" ),
+		        ( int )nt, diff, ( pass ? "PASS" : "FAIL" ) );
+
+		if ( !pass ) ++n_fail;
+
+		bli_obj_free( &a );
+		bli_obj_free( &a_ref );
+		bli_obj_free( &c );
+		bli_obj_free( &s );
+	}
+
+	return n_fail;
+}
+
+int main( int argc, char** argv )
+{
+	dim_t  p;
+	dim_t  p_begin   = P_BEGIN;
+	dim_t  p_end     = P_END;
+	dim_t  p_inc     = P_INC;
+	dim_t  n_repeats = 2;
+	int    n_fail    = 0;
+
+	bli_init();
+
+	if ( argc == 4 )
+	{
+		p_begin = atoi( argv[1] );
+		p_end   = atoi( argv[2] );
+		p_inc   = atoi( argv[3] );
+	}
+
+	for ( num_t dt = BLIS_FLOAT; dt <= BLIS_DCOMPLEX; ++dt )
+	{
+		n_fail += check_rotv( dt );
+		n_fail += check_rotsm( dt );
+	}
+
+	printf( "%% %d failures\n", n_fail );
+
+	// Performance: the time (in milliseconds) taken to apply K_SEQ
+	// sequences of rotations to the columns of a p x p column-stored matrix
+	// with a single thread, using rotsm and using rotv once per rotation,
+	// followed by the speedup of rotsm.
+	printf( "%% columns: p t_rotsm t_rotv speedup\n" );
+
+	for ( num_t dt = BLIS_FLOAT; dt <= BLIS_DCOMPLEX; ++dt )
+	{
+		num_t dt_r = bli_dt_proj_to_real( dt );
+		dim_t i    = 1;
+
+		for ( p = p_begin; p <= p_end; p += p_inc )
+		{
+			obj_t  a, c, s;
+			rntm_t rntm = BLIS_RNTM_INITIALIZER;
+			double dtime_save[ 2 ];
+
+			bli_obj_create( dt, p, p, 0, 0, &a );
+			bli_obj_create( dt_r, p - 1, K_SEQ, 0, 0, &c );
+			bli_obj_create( dt,   p - 1, K_SEQ, 0, 0, &s );
+
+			bli_randm( &a );
+			bli_randm( &c );
+			bli_randm( &s );
+
+			bli_rntm_set_num_threads( 1, &rntm );
+
+			for ( int op = 0; op < 2; ++op )
+			{
+				dtime_save[ op ] = 1.0e9;
+
+				for ( dim_t r = 0; r < n_repeats; ++r )
+				{
+					double dtime = bli_clock();
+
+					if ( op == 0 )
+						bli_rotsm_ex_qfp( dt )
+						(
+						  BLIS_RIGHT, p, p, K_SEQ,
+						  bli_obj_buffer( &c ), 1, bli_obj_col_stride( &c ),
+						  bli_obj_buffer( &s ), 1, bli_obj_col_stride( &s ),
+						  bli_obj_buffer( &a ), 1, bli_obj_col_stride( &a ),
+						  NULL, &rntm
+						);
+					else
+						rotsm_ref( BLIS_RIGHT, p - 1, K_SEQ, &c, &s, &a );
+
+					dtime_save[ op ] = bli_clock_min_diff( dtime_save[ op ], dtime );
+				}
+			}
+
+			printf( "data_%srot( %3lu, 1:4 ) = [ %6lu %9.2f %9.2f %6.2f ];\n",
+			        bli_dt_string( dt ),
+			        ( unsigned long )i++,
+			        ( unsigned long )p,
+			        dtime_save[0] * 1.0e3, dtime_save[1] * 1.0e3,
+			        dtime_save[1] / dtime_save[0] );
+
+			bli_obj_free( &a );
+			bli_obj_free( &c );
+			bli_obj_free( &s );
+		}
+	}
+
+	bli_finalize();
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
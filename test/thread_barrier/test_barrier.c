@@ -0,0 +1,142 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver measures the average latency of bli_thrcomm_barrier() for
+// a range of thread counts. Build BLIS with and without BLIS_TREE_BARRIER
+// defined (e.g. via CFLAGS) to compare the centralized and tree barriers.
+
+typedef struct
+{
+	dim_t      tid;
+	dim_t      n_barriers;
+	thrcomm_t* comm;
+	double     dtime;
+} barrier_data_t;
+
+void* barrier_entry( void* data_void )
+{
+	barrier_data_t* data       = data_void;
+	dim_t           tid        = data->tid;
+	dim_t           n_barriers = data->n_barriers;
+	thrcomm_t*      comm       = data->comm;
+
+	// Warm up the barrier (and make sure all threads have started) before
+	// starting the timer.
+	bli_thrcomm_barrier( tid, comm );
+	bli_thrcomm_barrier( tid, comm );
+
+	double dtime = bli_clock();
+
+	for ( dim_t i = 0; i < n_barriers; ++i )
+		bli_thrcomm_barrier( tid, comm );
+
+	data->dtime = bli_clock_min_diff( 1.0e9, dtime );
+
+	return NULL;
+}
+
+int main( int argc, char** argv )
+{
+	dim_t t_begin    = T_BEGIN;
+	dim_t t_end      = T_END;
+	dim_t n_barriers = N_BARRIERS;
+	dim_t n_repeats  = 3;
+	dim_t r;
+
+	bli_init();
+
+	if ( argc == 4 )
+	{
+		t_begin    = atoi( argv[1] );
+		t_end      = atoi( argv[2] );
+		n_barriers = atoi( argv[3] );
+	}
+
+#ifdef BLIS_TREE_BARRIER
+	const char* bar_str = "tree";
+#else
+	const char* bar_str = "central";
+#endif
+
+	printf( "%% barrier: %s, barriers per run: %d\n", bar_str, ( int )n_barriers );
+
+	for ( r = 1; t_begin <= t_end; t_begin *= 2, ++r )
+	{
+		dim_t           n_threads = t_begin;
+		double          dtime_min = 1.0e9;
+
+		bli_pthread_t*  pthreads  = malloc( sizeof( bli_pthread_t ) * n_threads );
+		barrier_data_t* datas     = malloc( sizeof( barrier_data_t ) * n_threads );
+
+		for ( dim_t rep = 0; rep < n_repeats; ++rep )
+		{
+			thrcomm_t* comm = bli_thrcomm_create( NULL, n_threads );
+
+			for ( dim_t tid = n_threads - 1; 0 <= tid; tid-- )
+			{
+				datas[tid].tid        = tid;
+				datas[tid].n_barriers = n_barriers;
+				datas[tid].comm       = comm;
+
+				if ( tid != 0 )
+					bli_pthread_create( &pthreads[tid], NULL, &barrier_entry, &datas[tid] );
+				else
+					barrier_entry( &datas[0] );
+			}
+
+			for ( dim_t tid = 1; tid < n_threads; tid++ )
+				bli_pthread_join( pthreads[tid], NULL );
+
+			dtime_min = bli_min( dtime_min, datas[0].dtime );
+
+			bli_thrcomm_free( NULL, comm );
+		}
+
+		// Report the average latency of one barrier in microseconds.
+		printf( "data_barrier_%s( %2lu, 1:2 ) = [ %4lu %10.3f ];\n",
+		        bar_str, ( unsigned long )r, ( unsigned long )n_threads,
+		        1.0e6 * dtime_min / ( double )n_barriers );
+
+		free( pthreads );
+		free( datas );
+	}
+
+	bli_finalize();
+
+	return 0;
+}
+
@@ -0,0 +1,329 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver checks the multithreaded level-1v operations (addv, copyv,
+// subv, axpyv, scal2v, scalv, setv, dotv, and amaxv) against their
+// single-threaded counterparts for all datatypes and for unit and non-unit
+// strides, using vectors long enough to exceed the level-1v threshold held
+// by the context. It then measures the memory bandwidth achieved by each
+// double-precision operation on vectors of length p as the number of
+// threads doubles from one up to the number requested via the environment
+// (e.g. BLIS_NUM_THREADS).
+
+static rntm_t rntm_with( dim_t nt )
+{
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	return rntm;
+}
+
+static double rel_resid_of( obj_t* y, obj_t* y_ref )
+{
+	obj_t  norm, norm_ref;
+	double resid, resid_ref, dummy;
+
+	bli_obj_create_1x1( bli_dt_proj_to_real( bli_obj_dt( y ) ), &norm );
+	bli_obj_create_1x1( bli_dt_proj_to_real( bli_obj_dt( y ) ), &norm_ref );
+
+	bli_normfv( y_ref, &norm_ref );
+	bli_subv( y_ref, y );
+	bli_normfv( y, &norm );
+	bli_getsc( &norm, &resid, &dummy );
+	bli_getsc( &norm_ref, &resid_ref, &dummy );
+
+	bli_obj_free( &norm );
+	bli_obj_free( &norm_ref );
+
+	return ( resid_ref == 0.0 ? resid : resid / resid_ref );
+}
+
+static int report( const char* label, num_t dt, double resid )
+{
+	const double thresh = ( bli_dt_prec_is_single( dt ) ? 1.0e-4 : 1.0e-12 );
+
+	printf( "%% %-40s rel. resid = %8.2e %s\n", label, resid,
+	        ( resid < thresh ? "PASS" : "FAIL" ) );
+
+	return ( resid < thresh ? 0 : 1 );
+}
+
+static int check_all( num_t dt, dim_t nt )
+{
+	// Choose a length that exceeds the threshold and that does not divide
+	// evenly among the threads.
+	const dim_t n = bli_cntx_get_l1v_thresh_dt( dt, bli_gks_query_cntx() ) + 4099;
+
+	rntm_t rntm_st = rntm_with( 1 );
+	rntm_t rntm_mt = rntm_with( nt );
+
+	obj_t  alpha, rho, rho_ref;
+	char   label[ 64 ];
+	int    n_fail = 0;
+
+	bli_obj_create_1x1( dt, &alpha );
+	bli_obj_create_1x1( dt, &rho );
+	bli_obj_create_1x1( dt, &rho_ref );
+	bli_setsc( 1.2, -0.3, &alpha );
+
+	for ( inc_t inc = 1; inc <= 3; inc += 2 )
+	for ( conj_t conjx = BLIS_NO_CONJUGATE; conjx <= BLIS_CONJUGATE; conjx += BLIS_CONJUGATE )
+	{
+		obj_t x, y, y_ref;
+
+		bli_obj_create( dt, n, 1, inc, inc * n, &x );
+		bli_obj_create( dt, n, 1, inc, inc * n, &y );
+		bli_obj_create( dt, n, 1, inc, inc * n, &y_ref );
+		bli_randv( &x );
+
+		for ( int op = 0; op < 7; ++op )
+		{
+			const char* opname = "";
+
+			bli_randv( &y );
+			bli_copyv( &y, &y_ref );
+			bli_obj_set_conj( conjx, &x );
+
+			switch ( op )
+			{
+				case 0:
+				opname = "addv";
+				bli_addv_ex( &x, &y_ref, NULL, &rntm_st );
+				bli_addv_ex( &x, &y,     NULL, &rntm_mt );
+				break;
+
+				case 1:
+				opname = "copyv";
+				bli_copyv_ex( &x, &y_ref, NULL, &rntm_st );
+				bli_copyv_ex( &x, &y,     NULL, &rntm_mt );
+				break;
+
+				case 2:
+				opname = "subv";
+				bli_subv_ex( &x, &y_ref, NULL, &rntm_st );
+				bli_subv_ex( &x, &y,     NULL, &rntm_mt );
+				break;
+
+				case 3:
+				opname = "axpyv";
+				bli_axpyv_ex( &alpha, &x, &y_ref, NULL, &rntm_st );
+				bli_axpyv_ex( &alpha, &x, &y,     NULL, &rntm_mt );
+				break;
+
+				case 4:
+				opname = "scal2v";
+				bli_scal2v_ex( &alpha, &x, &y_ref, NULL, &rntm_st );
+				bli_scal2v_ex( &alpha, &x, &y,     NULL, &rntm_mt );
+				break;
+
+				case 5:
+				opname = "scalv";
+				bli_obj_set_conj( conjx, &alpha );
+				bli_scalv_ex( &alpha, &y_ref, NULL, &rntm_st );
+				bli_scalv_ex( &alpha, &y,     NULL, &rntm_mt );
+				bli_obj_set_conj( BLIS_NO_CONJUGATE, &alpha );
+				break;
+
+				case 6:
+				opname = "setv";
+				bli_setv_ex( &alpha, &y_ref, NULL, &rntm_st );
+				bli_setv_ex( &alpha, &y,     NULL, &rntm_mt );
+				break;
+			}
+
+			bli_obj_set_conj( BLIS_NO_CONJUGATE, &x );
+
+			sprintf( label, "%s %s inc=%d conj=%d", bli_dt_string( dt ),
+			         opname, ( int )inc, ( int )conjx );
+			n_fail += report( label, dt, rel_resid_of( &y, &y_ref ) );
+		}
+
+		// dotv
+		{
+			bli_randv( &y );
+			bli_obj_set_conj( conjx, &x );
+
+			bli_dotv_ex( &x, &y, &rho_ref, NULL, &rntm_st );
+			bli_dotv_ex( &x, &y, &rho,     NULL, &rntm_mt );
+
+			bli_obj_set_conj( BLIS_NO_CONJUGATE, &x );
+
+			sprintf( label, "%s dotv inc=%d conj=%d", bli_dt_string( dt ),
+			         ( int )inc, ( int )conjx );
+			n_fail += report( label, dt, rel_resid_of( &rho, &rho_ref ) );
+		}
+
+		// amaxv, with the largest absolute value occurring twice so that the
+		// lowest index must be chosen from among two different threads.
+		if ( bli_is_noconj( conjx ) )
+		{
+			obj_t  index, index_ref;
+			dim_t* i_max;
+			dim_t* i_max_ref;
+
+			bli_obj_create_1x1( BLIS_INT, &index );
+			bli_obj_create_1x1( BLIS_INT, &index_ref );
+			i_max     = bli_obj_buffer( &index );
+			i_max_ref = bli_obj_buffer( &index_ref );
+
+			bli_setijm(  4.0, 0.0, n - 5,     0, &x );
+			bli_setijm( -4.0, 0.0, n / 2 + 7, 0, &x );
+
+			bli_amaxv_ex( &x, &index_ref, NULL, &rntm_st );
+			bli_amaxv_ex( &x, &index,     NULL, &rntm_mt );
+
+			sprintf( label, "%s amaxv inc=%d", bli_dt_string( dt ), ( int )inc );
+			n_fail += report( label, dt, ( *i_max == *i_max_ref &&
+			                               *i_max == n / 2 + 7 ? 0.0 : 1.0 ) );
+
+			bli_obj_free( &index );
+			bli_obj_free( &index_ref );
+		}
+
+		bli_obj_free( &x ); bli_obj_free( &y ); bli_obj_free( &y_ref );
+	}
+
+	bli_obj_free( &alpha );
+	bli_obj_free( &rho );
+	bli_obj_free( &rho_ref );
+
+	return n_fail;
+}
+
+int main( int argc, char** argv )
+{
+	dim_t  p;
+	dim_t  p_begin   = P_BEGIN;
+	dim_t  p_end     = P_END;
+	dim_t  p_inc     = P_INC;
+	dim_t  n_repeats = 3;
+	dim_t  nt_max    = 1;
+	int    n_fail    = 0;
+
+	bli_init();
+
+	if ( argc == 4 )
+	{
+		p_begin = atoi( argv[1] );
+		p_end   = atoi( argv[2] );
+		p_inc   = atoi( argv[3] );
+	}
+
+	// Use the number of threads requested via the environment as the
+	// largest number of threads, but check correctness with at least four.
+	nt_max = bli_max( bli_thread_get_num_threads(), 1 );
+
+	for ( num_t dt = BLIS_FLOAT; dt <= BLIS_DCOMPLEX; ++dt )
+		n_fail += check_all( dt, bli_max( nt_max, 4 ) );
+
+	printf( "%% %d failures\n", n_fail );
+
+	// Performance: the memory bandwidth (in GB/s) achieved by each operation
+	// for each number of threads. Each vector that is read counts once and
+	// each vector that is updated counts twice.
+	printf( "%% columns: p nt copyv axpyv scalv dotv amaxv\n" );
+
+	dim_t i = 1;
+
+	for ( p = p_begin; p <= p_end; p += p_inc )
+	{
+		obj_t x, y, alpha, rho, index;
+
+		bli_obj_create( BLIS_DOUBLE, p, 1, 0, 0, &x );
+		bli_obj_create( BLIS_DOUBLE, p, 1, 0, 0, &y );
+		bli_obj_create_1x1( BLIS_DOUBLE, &alpha );
+		bli_obj_create_1x1( BLIS_DOUBLE, &rho );
+		bli_obj_create_1x1( BLIS_INT, &index );
+		bli_setsc( 0.5, 0.0, &alpha );
+
+		bli_randv( &x );
+		bli_randv( &y );
+
+		for ( dim_t nt = 1; ; nt = bli_min( 2 * nt, nt_max ) )
+		{
+			rntm_t rntm = rntm_with( nt );
+			double dtime_save[ 5 ];
+
+			for ( int op = 0; op < 5; ++op )
+			{
+				dtime_save[ op ] = 1.0e9;
+
+				for ( dim_t r = 0; r < n_repeats; ++r )
+				{
+					double dtime = bli_clock();
+
+					switch ( op )
+					{
+						case 0: bli_copyv_ex( &x, &y, NULL, &rntm );          break;
+						case 1: bli_axpyv_ex( &alpha, &x, &y, NULL, &rntm );  break;
+						case 2: bli_scalv_ex( &alpha, &y, NULL, &rntm );      break;
+						case 3: bli_dotv_ex( &x, &y, &rho, NULL, &rntm );     break;
+						case 4: bli_amaxv_ex( &x, &index, NULL, &rntm );      break;
+					}
+
+					dtime_save[ op ] = bli_clock_min_diff( dtime_save[ op ], dtime );
+				}
+			}
+
+			const double bytes = ( double )p * sizeof( double );
+
+			printf( "data_thread_l1v( %3lu, 1:7 ) = [ %8lu %3lu %7.2f %7.2f %7.2f %7.2f %7.2f ];\n",
+			        ( unsigned long )i++,
+			        ( unsigned long )p,
+			        ( unsigned long )nt,
+			        2.0 * bytes / ( dtime_save[0] * 1.0e9 ),
+			        3.0 * bytes / ( dtime_save[1] * 1.0e9 ),
+			        2.0 * bytes / ( dtime_save[2] * 1.0e9 ),
+			        2.0 * bytes / ( dtime_save[3] * 1.0e9 ),
+			        1.0 * bytes / ( dtime_save[4] * 1.0e9 ) );
+
+			if ( nt == nt_max ) break;
+		}
+
+		bli_obj_free( &x );
+		bli_obj_free( &y );
+		bli_obj_free( &alpha );
+		bli_obj_free( &rho );
+		bli_obj_free( &index );
+	}
+
+	bli_finalize();
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
@@ -0,0 +1,421 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver checks the multithreaded level-2 operations (gemv, ger,
+// hemv/symv, trmv, and trsv) against their single-threaded counterparts
+// for all datatypes and a range of storage, transposition, triangle, and
+// conjugation parameters. It then measures the memory bandwidth achieved
+// by each double-precision operation on p x p problems as the number of
+// threads doubles from one up to the number requested via the environment
+// (e.g. BLIS_NUM_THREADS).
+
+static rntm_t rntm_with( dim_t nt )
+{
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	return rntm;
+}
+
+static double rel_resid_of( obj_t* y, obj_t* y_ref )
+{
+	obj_t  norm, norm_ref;
+	double resid, resid_ref, dummy;
+
+	bli_obj_create_1x1( bli_dt_proj_to_real( bli_obj_dt( y ) ), &norm );
+	bli_obj_create_1x1( bli_dt_proj_to_real( bli_obj_dt( y ) ), &norm_ref );
+
+	bli_normfm( y_ref, &norm_ref );
+	bli_subm( y_ref, y );
+	bli_normfm( y, &norm );
+	bli_getsc( &norm, &resid, &dummy );
+	bli_getsc( &norm_ref, &resid_ref, &dummy );
+
+	bli_obj_free( &norm );
+	bli_obj_free( &norm_ref );
+
+	return resid / resid_ref;
+}
+
+static int report( const char* label, num_t dt, double resid )
+{
+	const double thresh = ( bli_dt_prec_is_single( dt ) ? 1.0e-4 : 1.0e-12 );
+
+	printf( "%% %-40s rel. resid = %8.2e %s\n", label, resid,
+	        ( resid < thresh ? "PASS" : "FAIL" ) );
+
+	return ( resid < thresh ? 0 : 1 );
+}
+
+// Create an m x n matrix that is either column- or row-stored.
+static void create_mat( num_t dt, dim_t m, dim_t n, bool row, obj_t* a )
+{
+	if ( row ) bli_obj_create( dt, m, n, n, 1, a );
+	else       bli_obj_create( dt, m, n, 1, m, a );
+}
+
+static int check_all( num_t dt, dim_t nt )
+{
+	const dim_t m = 601, n = 517, mt = 1003;
+
+	rntm_t rntm_st = rntm_with( 1 );
+	rntm_t rntm_mt = rntm_with( nt );
+
+	obj_t  alpha, beta;
+	char   label[ 64 ];
+	int    n_fail = 0;
+
+	bli_obj_create_1x1( dt, &alpha );
+	bli_obj_create_1x1( dt, &beta );
+	bli_setsc(  1.2, -0.3, &alpha );
+	bli_setsc( -0.7,  0.4, &beta );
+
+	for ( int row = 0; row < 2; ++row )
+	{
+		obj_t a, at, x, y, y_ref;
+
+		// gemv
+		for ( trans_t trans = BLIS_NO_TRANSPOSE; trans <= BLIS_CONJ_TRANSPOSE; trans += BLIS_TRANS_BIT )
+		for ( conj_t  conjx = BLIS_NO_CONJUGATE; conjx <= BLIS_CONJUGATE; conjx += BLIS_CONJUGATE )
+		{
+			dim_t m_y, n_x;
+
+			bli_set_dims_with_trans( trans, mt, n, &m_y, &n_x );
+
+			create_mat( dt, mt, n, row, &a );
+			bli_obj_create( dt, n_x, 1, 0, 0, &x );
+			bli_obj_create( dt, m_y, 1, 0, 0, &y );
+			bli_obj_create( dt, m_y, 1, 0, 0, &y_ref );
+			bli_randm( &a );
+			bli_randv( &x );
+			bli_randv( &y );
+			bli_copyv( &y, &y_ref );
+
+			bli_obj_alias_to( &a, &at );
+			bli_obj_set_conjtrans( trans, &at );
+			bli_obj_set_conj( conjx, &x );
+
+			bli_gemv_ex( &alpha, &at, &x, &beta, &y_ref, NULL, &rntm_st );
+			bli_gemv_ex( &alpha, &at, &x, &beta, &y,     NULL, &rntm_mt );
+
+			sprintf( label, "%s gemv %s trans=%d conjx=%d", bli_dt_string( dt ),
+			         row ? "row" : "col", ( int )trans, ( int )conjx );
+			n_fail += report( label, dt, rel_resid_of( &y, &y_ref ) );
+
+			bli_obj_free( &a ); bli_obj_free( &x ); bli_obj_free( &y ); bli_obj_free( &y_ref );
+		}
+
+		// ger (both a tall and a wide problem)
+		for ( int wide = 0; wide < 2; ++wide )
+		for ( conj_t conjy = BLIS_NO_CONJUGATE; conjy <= BLIS_CONJUGATE; conjy += BLIS_CONJUGATE )
+		{
+			const dim_t mg = ( wide ? 24 : mt );
+			const dim_t ng = ( wide ? 40 * mt : n );
+
+			obj_t a_ref;
+
+			create_mat( dt, mg, ng, row, &a );
+			create_mat( dt, mg, ng, row, &a_ref );
+			bli_obj_create( dt, mg, 1, 0, 0, &x );
+			bli_obj_create( dt, ng, 1, 0, 0, &y );
+			bli_randm( &a );
+			bli_randv( &x );
+			bli_randv( &y );
+			bli_copym( &a, &a_ref );
+			bli_obj_set_conj( conjy, &y );
+
+			bli_ger_ex( &alpha, &x, &y, &a_ref, NULL, &rntm_st );
+			bli_ger_ex( &alpha, &x, &y, &a,     NULL, &rntm_mt );
+
+			sprintf( label, "%s ger %s %s conjy=%d", bli_dt_string( dt ),
+			         row ? "row" : "col", wide ? "wide" : "tall", ( int )conjy );
+			n_fail += report( label, dt, rel_resid_of( &a, &a_ref ) );
+
+			bli_obj_free( &a ); bli_obj_free( &a_ref ); bli_obj_free( &x ); bli_obj_free( &y );
+		}
+
+		// hemv and symv
+		for ( int herm = 0; herm < 2; ++herm )
+		for ( uplo_t uplo = BLIS_LOWER; ; uplo = BLIS_UPPER )
+		{
+			for ( conj_t conja = BLIS_NO_CONJUGATE; conja <= BLIS_CONJUGATE; conja += BLIS_CONJUGATE )
+			{
+				create_mat( dt, m, m, row, &a );
+				bli_obj_create( dt, m, 1, 0, 0, &x );
+				bli_obj_create( dt, m, 1, 0, 0, &y );
+				bli_obj_create( dt, m, 1, 0, 0, &y_ref );
+				bli_obj_set_struc( herm ? BLIS_HERMITIAN : BLIS_SYMMETRIC, &a );
+				bli_obj_set_uplo( uplo, &a );
+				bli_randm( &a );
+				bli_randv( &x );
+				bli_randv( &y );
+				bli_copyv( &y, &y_ref );
+				bli_obj_set_conj( conja, &a );
+				bli_obj_set_conj( conja, &x );
+
+				if ( herm )
+				{
+					bli_hemv_ex( &alpha, &a, &x, &beta, &y_ref, NULL, &rntm_st );
+					bli_hemv_ex( &alpha, &a, &x, &beta, &y,     NULL, &rntm_mt );
+				}
+				else
+				{
+					bli_symv_ex( &alpha, &a, &x, &beta, &y_ref, NULL, &rntm_st );
+					bli_symv_ex( &alpha, &a, &x, &beta, &y,     NULL, &rntm_mt );
+				}
+
+				sprintf( label, "%s %s %s %s conj=%d", bli_dt_string( dt ),
+				         herm ? "hemv" : "symv", row ? "row" : "col",
+				         bli_is_lower( uplo ) ? "lower" : "upper", ( int )conja );
+				n_fail += report( label, dt, rel_resid_of( &y, &y_ref ) );
+
+				bli_obj_free( &a ); bli_obj_free( &x ); bli_obj_free( &y ); bli_obj_free( &y_ref );
+			}
+
+			if ( bli_is_upper( uplo ) ) break;
+		}
+
+		// trmv and trsv
+		for ( int solve = 0; solve < 2; ++solve )
+		for ( uplo_t uplo = BLIS_LOWER; ; uplo = BLIS_UPPER )
+		{
+			for ( trans_t trans = BLIS_NO_TRANSPOSE; trans <= BLIS_CONJ_TRANSPOSE; trans += BLIS_TRANS_BIT )
+			for ( diag_t  diag  = BLIS_NONUNIT_DIAG; ; diag = BLIS_UNIT_DIAG )
+			{
+				obj_t shift;
+
+				create_mat( dt, m, m, row, &a );
+				bli_obj_create( dt, m, 1, 0, 0, &x );
+				bli_obj_create( dt, m, 1, 0, 0, &y_ref );
+				bli_obj_create_1x1( dt, &shift );
+				bli_randm( &a );
+				bli_randv( &x );
+				bli_copyv( &x, &y_ref );
+
+				// Keep the triangular matrix well-conditioned, regardless of
+				// whether the diagonal is implicitly unit.
+				bli_setsc( 1.0 / m, 0.0, &shift );
+				bli_scalm( &shift, &a );
+				bli_setsc( 1.0, 0.0, &shift );
+				bli_shiftd( &shift, &a );
+				bli_obj_set_struc( BLIS_TRIANGULAR, &a );
+				bli_obj_set_uplo( uplo, &a );
+				bli_obj_set_diag( diag, &a );
+				bli_obj_set_conjtrans( trans, &a );
+
+				if ( solve )
+				{
+					bli_trsv_ex( &alpha, &a, &y_ref, NULL, &rntm_st );
+					bli_trsv_ex( &alpha, &a, &x,     NULL, &rntm_mt );
+				}
+				else
+				{
+					bli_trmv_ex( &alpha, &a, &y_ref, NULL, &rntm_st );
+					bli_trmv_ex( &alpha, &a, &x,     NULL, &rntm_mt );
+				}
+
+				sprintf( label, "%s %s %s %s trans=%d diag=%s", bli_dt_string( dt ),
+				         solve ? "trsv" : "trmv", row ? "row" : "col",
+				         bli_is_lower( uplo ) ? "lower" : "upper", ( int )trans,
+				         bli_is_unit_diag( diag ) ? "u" : "n" );
+				n_fail += report( label, dt, rel_resid_of( &x, &y_ref ) );
+
+				bli_obj_free( &a ); bli_obj_free( &x ); bli_obj_free( &y_ref ); bli_obj_free( &shift );
+
+				if ( bli_is_unit_diag( diag ) ) break;
+			}
+
+			if ( bli_is_upper( uplo ) ) break;
+		}
+	}
+
+	bli_obj_free( &alpha );
+	bli_obj_free( &beta );
+
+	return n_fail;
+}
+
+int main( int argc, char** argv )
+{
+	dim_t  p;
+	dim_t  p_begin   = P_BEGIN;
+	dim_t  p_end     = P_END;
+	dim_t  p_inc     = P_INC;
+	dim_t  n_repeats = 3;
+	dim_t  nt_max    = 1;
+	int    n_fail    = 0;
+
+	bli_init();
+
+	if ( argc == 4 )
+	{
+		p_begin = atoi( argv[1] );
+		p_end   = atoi( argv[2] );
+		p_inc   = atoi( argv[3] );
+	}
+
+	// Use the number of threads requested via the environment as the
+	// largest number of threads, but check correctness with at least four.
+	nt_max = bli_max( bli_thread_get_num_threads(), 1 );
+
+	for ( num_t dt = BLIS_FLOAT; dt <= BLIS_DCOMPLEX; ++dt )
+		n_fail += check_all( dt, bli_max( nt_max, 4 ) );
+
+	printf( "%% %d failures\n", n_fail );
+
+	// Performance: the memory bandwidth (in GB/s) achieved by each operation
+	// for each number of threads. Only the matrix traffic is counted, i.e.
+	// p*p elements for gemv and hemv, 2*p*p for ger (A is read and written),
+	// and p*p/2 for trmv and trsv.
+	printf( "%% columns: p nt gemv_n gemv_t ger symv trmv trsv\n" );
+
+	dim_t i = 1;
+
+	for ( p = p_begin; p <= p_end; p += p_inc )
+	{
+		obj_t  a, x, y, alpha, beta, norm;
+		double nrm, dummy;
+
+		bli_obj_create( BLIS_DOUBLE, p, p, 0, 0, &a );
+		bli_obj_create( BLIS_DOUBLE, p, 1, 0, 0, &x );
+		bli_obj_create( BLIS_DOUBLE, p, 1, 0, 0, &y );
+		bli_obj_create_1x1( BLIS_DOUBLE, &alpha );
+		bli_obj_create_1x1( BLIS_DOUBLE, &beta );
+		bli_obj_create_1x1( BLIS_DOUBLE, &norm );
+		bli_setsc( 1.0 / p, 0.0, &alpha );
+		bli_setsc( 0.5,     0.0, &beta );
+
+		bli_randm( &a );
+		bli_randv( &x );
+		bli_randv( &y );
+
+		// Keep trsv well-conditioned.
+		bli_setsc( ( double )p, 0.0, &norm );
+		bli_shiftd( &norm, &a );
+
+		for ( dim_t nt = 1; ; nt = bli_min( 2 * nt, nt_max ) )
+		{
+			rntm_t rntm = rntm_with( nt );
+			double dtime_save[ 6 ];
+
+			for ( int op = 0; op < 6; ++op )
+			{
+				obj_t a_op;
+
+				dtime_save[ op ] = 1.0e9;
+
+				bli_obj_alias_to( &a, &a_op );
+
+				for ( dim_t r = 0; r < n_repeats; ++r )
+				{
+					double dtime = bli_clock();
+
+					switch ( op )
+					{
+						case 0:
+						bli_gemv_ex( &alpha, &a_op, &x, &beta, &y, NULL, &rntm );
+						break;
+
+						case 1:
+						bli_obj_set_onlytrans( BLIS_TRANSPOSE, &a_op );
+						bli_gemv_ex( &alpha, &a_op, &x, &beta, &y, NULL, &rntm );
+						break;
+
+						case 2:
+						bli_ger_ex( &alpha, &x, &y, &a_op, NULL, &rntm );
+						break;
+
+						case 3:
+						bli_obj_set_struc( BLIS_SYMMETRIC, &a_op );
+						bli_obj_set_uplo( BLIS_LOWER, &a_op );
+						bli_symv_ex( &alpha, &a_op, &x, &beta, &y, NULL, &rntm );
+						break;
+
+						case 4:
+						bli_obj_set_struc( BLIS_TRIANGULAR, &a_op );
+						bli_obj_set_uplo( BLIS_LOWER, &a_op );
+						bli_trmv_ex( &alpha, &a_op, &x, NULL, &rntm );
+						break;
+
+						case 5:
+						bli_obj_set_struc( BLIS_TRIANGULAR, &a_op );
+						bli_obj_set_uplo( BLIS_LOWER, &a_op );
+						bli_trsv_ex( &alpha, &a_op, &x, NULL, &rntm );
+						break;
+					}
+
+					dtime_save[ op ] = bli_clock_min_diff( dtime_save[ op ], dtime );
+
+					// Keep the magnitude of x bounded across repetitions.
+					bli_normfv( &x, &norm );
+					bli_getsc( &norm, &nrm, &dummy );
+					bli_setsc( 1.0 / nrm, 0.0, &norm );
+					bli_scalv( &norm, &x );
+				}
+			}
+
+			const double bytes = ( double )p * p * sizeof( double );
+
+			printf( "data_thread_l2( %3lu, 1:8 ) = [ %5lu %3lu %7.2f %7.2f %7.2f %7.2f %7.2f %7.2f ];\n",
+			        ( unsigned long )i++,
+			        ( unsigned long )p,
+			        ( unsigned long )nt,
+			        1.0 * bytes / ( dtime_save[0] * 1.0e9 ),
+			        1.0 * bytes / ( dtime_save[1] * 1.0e9 ),
+			        2.0 * bytes / ( dtime_save[2] * 1.0e9 ),
+			        1.0 * bytes / ( dtime_save[3] * 1.0e9 ),
+			        0.5 * bytes / ( dtime_save[4] * 1.0e9 ),
+			        0.5 * bytes / ( dtime_save[5] * 1.0e9 ) );
+
+			if ( nt == nt_max ) break;
+		}
+
+		bli_obj_free( &a );
+		bli_obj_free( &x );
+		bli_obj_free( &y );
+		bli_obj_free( &alpha );
+		bli_obj_free( &beta );
+		bli_obj_free( &norm );
+	}
+
+	bli_finalize();
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
+
@@ -0,0 +1,164 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver measures the throughput of small, single-threaded gemm calls
+// made concurrently by a range of independent application threads. Since
+// each call checks out (and back in) its packing blocks from the packing
+// block allocator, this exposes any contention within the allocator. Build
+// BLIS with and without BLIS_DISABLE_PBA_TCACHE defined (e.g. via CFLAGS) to
+// compare the per-thread block cache with the mutex-protected pools alone.
+
+typedef struct
+{
+	dim_t  p;
+	dim_t  n_calls;
+	double dtime;
+} pba_data_t;
+
+void* pba_entry( void* data_void )
+{
+	pba_data_t* data    = data_void;
+	dim_t       p       = data->p;
+	dim_t       n_calls = data->n_calls;
+	obj_t       a, b, c;
+	rntm_t      rntm    = BLIS_RNTM_INITIALIZER;
+
+	// Each application thread calls single-threaded BLIS on its own
+	// operands. We disable the sup code path so that every call packs A
+	// and B via the packing block allocator.
+	bli_rntm_set_num_threads( 1, &rntm );
+	bli_rntm_disable_l3_sup( &rntm );
+
+	bli_obj_create( BLIS_DOUBLE, p, p, 0, 0, &a );
+	bli_obj_create( BLIS_DOUBLE, p, p, 0, 0, &b );
+	bli_obj_create( BLIS_DOUBLE, p, p, 0, 0, &c );
+
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_randm( &c );
+
+	// Warm up before starting the timer.
+	bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &c, NULL, &rntm );
+
+	double dtime = bli_clock();
+
+	for ( dim_t i = 0; i < n_calls; ++i )
+		bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &c, NULL, &rntm );
+
+	data->dtime = bli_clock_min_diff( 1.0e9, dtime );
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+
+	return NULL;
+}
+
+int main( int argc, char** argv )
+{
+	dim_t t_begin   = T_BEGIN;
+	dim_t t_end     = T_END;
+	dim_t p         = P_SIZE;
+	dim_t n_calls   = N_CALLS;
+	dim_t n_repeats = 3;
+	dim_t r;
+
+	bli_init();
+
+	if ( argc == 5 )
+	{
+		t_begin = atoi( argv[1] );
+		t_end   = atoi( argv[2] );
+		p       = atoi( argv[3] );
+		n_calls = atoi( argv[4] );
+	}
+
+#ifdef BLIS_ENABLE_PBA_TCACHE
+	const char* pba_str = "tcache";
+#else
+	const char* pba_str = "locked";
+#endif
+
+	printf( "%% pba: %s, problem size: %d, calls per thread: %d\n",
+	        pba_str, ( int )p, ( int )n_calls );
+
+	for ( r = 1; t_begin <= t_end; t_begin *= 2, ++r )
+	{
+		dim_t          n_threads = t_begin;
+		double         dtime_max;
+		double         dtime_min = 1.0e9;
+
+		bli_pthread_t* pthreads  = malloc( sizeof( bli_pthread_t ) * n_threads );
+		pba_data_t*    datas     = malloc( sizeof( pba_data_t ) * n_threads );
+
+		for ( dim_t rep = 0; rep < n_repeats; ++rep )
+		{
+			for ( dim_t tid = 0; tid < n_threads; tid++ )
+			{
+				datas[tid].p       = p;
+				datas[tid].n_calls = n_calls;
+
+				bli_pthread_create( &pthreads[tid], NULL, &pba_entry, &datas[tid] );
+			}
+
+			dtime_max = 0.0;
+
+			for ( dim_t tid = 0; tid < n_threads; tid++ )
+			{
+				bli_pthread_join( pthreads[tid], NULL );
+
+				dtime_max = bli_max( dtime_max, datas[tid].dtime );
+			}
+
+			dtime_min = bli_min( dtime_min, dtime_max );
+		}
+
+		// Report the aggregate number of gemm calls per second across all
+		// threads.
+		printf( "data_pba_%s( %2lu, 1:2 ) = [ %4lu %12.1f ];\n",
+		        pba_str, ( unsigned long )r, ( unsigned long )n_threads,
+		        ( double )( n_threads * n_calls ) / dtime_min );
+
+		free( pthreads );
+		free( datas );
+	}
+
+	bli_finalize();
+
+	return 0;
+}
@@ -314,6 +314,7 @@ void libblis_test_level3_ukrs( thread_data_t* tdata, test_params_t* params, test
 void libblis_test_level3_ops( thread_data_t* tdata, test_params_t* params, test_ops_t* ops )
 {
 	libblis_test_gemm( tdata, params, &(ops->gemm) );
+	libblis_test_gemmt( tdata, params, &(ops->gemmt) );
 	libblis_test_hemm( tdata, params, &(ops->hemm) );
 	libblis_test_herk( tdata, params, &(ops->herk) );
 	libblis_test_her2k( tdata, params, &(ops->her2k) );
@@ -408,6 +409,7 @@ void libblis_test_read_ops_file( char* input_filename, test_ops_t* ops )
 
 	// Level-3
 	libblis_test_read_op_info( ops, input_stream, BLIS_GEMM,  BLIS_TEST_DIMS_MNK, 2, &(ops->gemm) );
+	libblis_test_read_op_info( ops, input_stream, BLIS_GEMMT, BLIS_TEST_DIMS_MK,  3, &(ops->gemmt) );
 	libblis_test_read_op_info( ops, input_stream, BLIS_HEMM,  BLIS_TEST_DIMS_MN,  4, &(ops->hemm) );
 	libblis_test_read_op_info( ops, input_stream, BLIS_HERK,  BLIS_TEST_DIMS_MK,  2, &(ops->herk) );
 	libblis_test_read_op_info( ops, input_stream, BLIS_HER2K, BLIS_TEST_DIMS_MK,  3, &(ops->her2k) );
@@ -943,6 +945,11 @@ void libblis_test_output_params_struct( FILE* os, test_params_t* params )
 	                        bli_info_get_gemm_impl_string( BLIS_DOUBLE ),
 	                        bli_info_get_gemm_impl_string( BLIS_SCOMPLEX ),
 	                        bli_info_get_gemm_impl_string( BLIS_DCOMPLEX ) );
+	libblis_test_fprintf_c( os, "  gemmt                  %7s %7s %7s %7s\n",
+	                        bli_info_get_gemmt_impl_string( BLIS_FLOAT ),
+	                        bli_info_get_gemmt_impl_string( BLIS_DOUBLE ),
+	                        bli_info_get_gemmt_impl_string( BLIS_SCOMPLEX ),
+	                        bli_info_get_gemmt_impl_string( BLIS_DCOMPLEX ) );
 	libblis_test_fprintf_c( os, "  hemm                   %7s %7s %7s %7s\n",
 	                        bli_info_get_hemm_impl_string( BLIS_FLOAT ),
 	                        bli_info_get_hemm_impl_string( BLIS_DOUBLE ),